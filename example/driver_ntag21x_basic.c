@@ -36,7 +36,8 @@
 
 #include "driver_ntag21x_basic.h"
 
-static ntag21x_handle_t gs_handle;        /**< ntag21x handle */
+static ntag21x_handle_t gs_handle;             /**< ntag21x handle */
+static ntag21x_poll_handle_t gs_poll;         /**< ntag21x poll handle */
 
 /**
  * @brief     interface print format data
@@ -82,6 +83,30 @@ uint8_t ntag21x_basic_init(void)
         return 1;
     }
     
+    /* link the poll function */
+    DRIVER_NTAG21X_POLL_LINK_INIT(&gs_poll, ntag21x_poll_handle_t);
+    DRIVER_NTAG21X_POLL_LINK_DELAY_MS(&gs_poll, ntag21x_interface_delay_ms);
+    
+    /* poll init */
+    res = ntag21x_poll_init(&gs_poll, &gs_handle);
+    if (res != 0)
+    {
+        ntag21x_interface_debug_print("ntag21x: poll init failed.\n");
+        (void)ntag21x_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* set the search profile */
+    res = ntag21x_poll_set_profile(&gs_poll, MIFARE_NTAG21X_DEFAULT_SEARCH_PROFILE);
+    if (res != 0)
+    {
+        ntag21x_interface_debug_print("ntag21x: set search profile failed.\n");
+        (void)ntag21x_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
     return 0;
 }
 
@@ -153,74 +178,118 @@ uint8_t ntag21x_basic_wake_up(void)
  * @brief      basic example search
  * @param[out] *type pointer to a type buffer
  * @param[out] *id pointer to an id buffer
- * @param[in]  timeout check times
+ * @param[in]  timeout_ms wall clock timeout in ms, -1 means never
  * @return     status code
  *             - 0 success
  *             - 1 timeout
+ * @note       the tag is probed at the intervals of the balanced poll profile
+ */
+uint8_t ntag21x_basic_search(ntag21x_capability_container_t *type, uint8_t id[8], int32_t timeout_ms)
+{
+    uint8_t res;
+    uint32_t wait_ms;
+    
+    /* check the timeout */
+    if (timeout_ms < 0)
+    {
+        /* never timeout */
+        wait_ms = NTAG21X_POLL_WAIT_FOREVER;
+    }
+    else
+    {
+        /* wall clock timeout */
+        wait_ms = (uint32_t)timeout_ms;
+    }
+    
+    /* search */
+    res = ntag21x_poll_search(&gs_poll, type, id, wait_ms);
+    if (res != 0)
+    {
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     basic example wait until the tag leaves
+ * @param[in] timeout_ms wall clock timeout in ms, -1 means never
+ * @return    status code
+ *            - 0 success
+ *            - 1 timeout
+ * @note      the next search polls fast for a while
+ */
+uint8_t ntag21x_basic_wait_removed(int32_t timeout_ms)
+{
+    uint8_t res;
+    uint32_t wait_ms;
+    
+    /* check the timeout */
+    if (timeout_ms < 0)
+    {
+        /* never timeout */
+        wait_ms = NTAG21X_POLL_WAIT_FOREVER;
+    }
+    else
+    {
+        /* wall clock timeout */
+        wait_ms = (uint32_t)timeout_ms;
+    }
+    
+    /* wait removed */
+    res = ntag21x_poll_wait_removed(&gs_poll, wait_ms);
+    if (res != 0)
+    {
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     basic example link the search clock and interrupt
+ * @param[in] *timestamp_ms pointer to a monotonic timestamp_ms function address, NULL counts the slept time
+ * @param[in] *wait_irq pointer to a wait_irq function address, NULL sleeps with ntag21x_interface_delay_ms
+ * @return    status code
+ *            - 0 success
+ *            - 1 link failed
+ * @note      call after ntag21x_basic_init
+ */
+uint8_t ntag21x_basic_link_search(uint32_t (*timestamp_ms)(void), uint8_t (*wait_irq)(uint32_t timeout_ms))
+{
+    /* check the poll handle */
+    if (gs_poll.inited != 1)
+    {
+        return 1;
+    }
+    
+    /* link */
+    DRIVER_NTAG21X_POLL_LINK_TIMESTAMP_MS(&gs_poll, timestamp_ms);
+    DRIVER_NTAG21X_POLL_LINK_WAIT_IRQ(&gs_poll, wait_irq);
+    
+    return 0;
+}
+
+/**
+ * @brief      basic example get the search statistics
+ * @param[out] *statistics pointer to a statistics structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 get statistics failed
  * @note       none
  */
-uint8_t ntag21x_basic_search(ntag21x_capability_container_t *type, uint8_t id[8], int32_t timeout)
+uint8_t ntag21x_basic_get_search_statistics(ntag21x_poll_statistics_t *statistics)
 {
     uint8_t res;
-    ntag21x_type_t t;
-    
-    /* loop */
-    while (1)
-    {
-        /* request */
-        res = ntag21x_request(&gs_handle, &t);
-        if (res == 0)
-        {
-            /* anti collision_cl1 */
-            res = ntag21x_anticollision_cl1(&gs_handle, id);
-            if (res == 0)
-            {
-                /* cl1 */
-                res = ntag21x_select_cl1(&gs_handle, id);
-                if (res == 0)
-                {
-                    /* anti collision_cl2 */
-                    res = ntag21x_anticollision_cl2(&gs_handle, id + 4);
-                    if (res == 0)
-                    {
-                        /* cl2 */
-                        res = ntag21x_select_cl2(&gs_handle, id + 4);
-                        if (res == 0)
-                        {
-                            res = ntag21x_get_capability_container(&gs_handle, type);
-                            if (res == 0)
-                            {
-                                return 0;
-                            }
-                        }
-                    }
-                }
-            }
-        }
-        
-        /* delay */
-        ntag21x_interface_delay_ms(MIFARE_NTAG21X_DEFAULT_SEARCH_DELAY_MS);
-        
-        /* check the timeout */
-        if (timeout < 0)
-        {
-            /* never timeout */
-            continue;
-        }
-        else
-        {
-            /* timeout */
-            if (timeout == 0)
-            {
-                return 1;
-            }
-            else
-            {
-                /* timout-- */
-                timeout--;
-            }
-        }
+    
+    /* get the statistics */
+    res = ntag21x_poll_get_statistics(&gs_poll, statistics);
+    if (res != 0)
+    {
+        return 1;
     }
+    
+    return 0;
 }
 
 /**
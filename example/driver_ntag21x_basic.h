@@ -38,6 +38,7 @@
 #define DRIVER_NTAG21X_BASIC_H
 
 #include "driver_ntag21x_interface.h"
+#include "driver_ntag21x_poll.h"
 
 #ifdef __cplusplus
 extern "C"{
@@ -53,7 +54,7 @@ extern "C"{
 /**
  * @brief ntag21x basic example default definition
  */
-#define MIFARE_NTAG21X_DEFAULT_SEARCH_DELAY_MS        200        /**< 5Hz */
+#define MIFARE_NTAG21X_DEFAULT_SEARCH_PROFILE         NTAG21X_POLL_PROFILE_BALANCED        /**< 10 ms to 100 ms polling */
 
 /**
  * @brief  basic example init
@@ -95,13 +96,44 @@ uint8_t ntag21x_basic_wake_up(void);
  * @brief      basic example search
  * @param[out] *type pointer to a type buffer
  * @param[out] *id pointer to an id buffer
- * @param[in]  timeout check times
+ * @param[in]  timeout_ms wall clock timeout in ms, -1 means never
  * @return     status code
  *             - 0 success
  *             - 1 timeout
+ * @note       the tag is probed at the intervals of the balanced poll profile
+ */
+uint8_t ntag21x_basic_search(ntag21x_capability_container_t *type, uint8_t id[8], int32_t timeout_ms);
+
+/**
+ * @brief     basic example wait until the tag leaves
+ * @param[in] timeout_ms wall clock timeout in ms, -1 means never
+ * @return    status code
+ *            - 0 success
+ *            - 1 timeout
+ * @note      the next search polls fast for a while
+ */
+uint8_t ntag21x_basic_wait_removed(int32_t timeout_ms);
+
+/**
+ * @brief     basic example link the search clock and interrupt
+ * @param[in] *timestamp_ms pointer to a monotonic timestamp_ms function address, NULL counts the slept time
+ * @param[in] *wait_irq pointer to a wait_irq function address, NULL sleeps with ntag21x_interface_delay_ms
+ * @return    status code
+ *            - 0 success
+ *            - 1 link failed
+ * @note      call after ntag21x_basic_init
+ */
+uint8_t ntag21x_basic_link_search(uint32_t (*timestamp_ms)(void), uint8_t (*wait_irq)(uint32_t timeout_ms));
+
+/**
+ * @brief      basic example get the search statistics
+ * @param[out] *statistics pointer to a statistics structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 get statistics failed
  * @note       none
  */
-uint8_t ntag21x_basic_search(ntag21x_capability_container_t *type, uint8_t id[8], int32_t timeout);
+uint8_t ntag21x_basic_get_search_statistics(ntag21x_poll_statistics_t *statistics);
 
 /**
  * @brief      basic example read
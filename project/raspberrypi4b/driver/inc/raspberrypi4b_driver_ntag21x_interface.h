@@ -0,0 +1,78 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file      raspberrypi4b_driver_ntag21x_interface.h
+ * @brief     raspberrypi4b driver ntag21x interface header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef RASPBERRYPI4B_DRIVER_NTAG21X_INTERFACE_H
+#define RASPBERRYPI4B_DRIVER_NTAG21X_INTERFACE_H
+
+#include "driver_ntag21x_interface.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup ntag21x_raspberrypi4b_interface ntag21x raspberrypi4b interface function
+ * @brief    ntag21x raspberrypi4b interface modules
+ * @ingroup  ntag21x_driver
+ * @{
+ */
+
+/**
+ * @brief  interface timestamp ms
+ * @return monotonic time in ms
+ * @note   link with DRIVER_NTAG21X_POLL_LINK_TIMESTAMP_MS
+ */
+uint32_t ntag21x_interface_timestamp_ms(void);
+
+/**
+ * @brief     interface wait for the reader interrupt
+ * @param[in] timeout_ms max waiting time
+ * @return    status code
+ *            - 0 woken by the interrupt
+ *            - 1 timeout
+ * @note      interrupts raised before the call are dropped, link with DRIVER_NTAG21X_POLL_LINK_WAIT_IRQ
+ */
+uint8_t ntag21x_interface_wait_irq(uint32_t timeout_ms);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
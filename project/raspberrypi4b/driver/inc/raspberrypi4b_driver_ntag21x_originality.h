@@ -0,0 +1,88 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file      raspberrypi4b_driver_ntag21x_originality.h
+ * @brief     raspberrypi4b driver ntag21x originality header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef RASPBERRYPI4B_DRIVER_NTAG21X_ORIGINALITY_H
+#define RASPBERRYPI4B_DRIVER_NTAG21X_ORIGINALITY_H
+
+#include "driver_ntag21x_originality.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup ntag21x_originality_parallel ntag21x originality parallel function
+ * @brief    ntag21x originality parallel modules
+ * @ingroup  ntag21x_originality_driver
+ * @{
+ */
+
+/**
+ * @brief ntag21x originality max thread definition
+ */
+#ifndef NTAG21X_ORIGINALITY_MAX_THREAD
+    #define NTAG21X_ORIGINALITY_MAX_THREAD 64
+#endif
+
+/**
+ * @brief      verify a list of originality signatures on several cores
+ * @param[in]  *handle pointer to an initialized ntag21x originality handle structure
+ * @param[in]  **uid pointer to a 7 bytes uid list
+ * @param[in]  **signature pointer to a 32 bytes signature list
+ * @param[out] *result pointer to a result list, 0 genuine and 1 invalid
+ * @param[in]  num list length
+ * @param[in]  threads thread number, 0 for one per online core
+ * @param[out] *valid pointer to a genuine number buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 verify failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       every thread runs ntag21x_originality_verify_batch on its own slice,
+ *             a slice whose thread can't be created runs on the calling thread
+ */
+uint8_t ntag21x_originality_verify_parallel(ntag21x_originality_handle_t *handle, uint8_t (*uid)[7], uint8_t (*signature)[32],
+                                            uint8_t *result, uint32_t num, uint8_t threads, uint32_t *valid);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,215 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file      raspberrypi4b_driver_ntag21x_pool.h
+ * @brief     raspberrypi4b driver ntag21x pool header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef RASPBERRYPI4B_DRIVER_NTAG21X_POOL_H
+#define RASPBERRYPI4B_DRIVER_NTAG21X_POOL_H
+
+#include "driver_ntag21x.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup ntag21x_pool ntag21x pool function
+ * @brief    ntag21x pool modules
+ * @ingroup  ntag21x_driver
+ * @{
+ */
+
+/**
+ * @brief ntag21x pool max reader definition
+ */
+#ifndef NTAG21X_POOL_MAX_READER
+    #define NTAG21X_POOL_MAX_READER 8
+#endif
+
+/**
+ * @brief ntag21x pool event queue size definition
+ * @note  must be a power of 2
+ */
+#ifndef NTAG21X_POOL_QUEUE_SIZE
+    #define NTAG21X_POOL_QUEUE_SIZE 64
+#endif
+
+/**
+ * @brief ntag21x pool default poll interval definition
+ */
+#define NTAG21X_POOL_DEFAULT_POLL_INTERVAL_MS        50        /**< 50ms */
+
+/**
+ * @brief ntag21x pool default miss limit definition
+ */
+#define NTAG21X_POOL_DEFAULT_MISS_LIMIT              3         /**< 3 polls */
+
+/**
+ * @brief ntag21x pool event type enumeration definition
+ */
+typedef enum
+{
+    NTAG21X_POOL_EVENT_ARRIVED = 0x00,        /**< a tag entered the field */
+    NTAG21X_POOL_EVENT_LEFT    = 0x01,        /**< the tag left the field */
+} ntag21x_pool_event_type_t;
+
+/**
+ * @brief ntag21x pool reader structure definition
+ */
+typedef struct ntag21x_pool_reader_s
+{
+    void *context;                                                         /**< reader context passed to every function */
+    uint8_t (*contactless_init)(void *context);                            /**< point to a contactless_init function address */
+    uint8_t (*contactless_deinit)(void *context);                          /**< point to a contactless_deinit function address */
+    uint8_t (*contactless_transceiver)(void *context, uint8_t *in_buf, uint8_t in_len,
+                                       uint8_t *out_buf, uint8_t *out_len);  /**< point to a contactless_transceiver function address */
+} ntag21x_pool_reader_t;
+
+/**
+ * @brief ntag21x pool event structure definition
+ */
+typedef struct ntag21x_pool_event_s
+{
+    uint8_t reader;                          /**< reader index */
+    ntag21x_pool_event_type_t type;          /**< event type */
+    ntag21x_type_t tag_type;                 /**< tag answer to request */
+    uint8_t id[8];                           /**< cl1 and cl2 id as returned by the anti collision */
+    uint64_t timestamp_ns;                   /**< monotonic time of the event */
+} ntag21x_pool_event_t;
+
+/**
+ * @brief ntag21x pool status structure definition
+ */
+typedef struct ntag21x_pool_status_s
+{
+    uint32_t polls;                          /**< search rounds */
+    uint32_t arrivals;                       /**< arrived events */
+    uint32_t departures;                     /**< left events */
+    uint32_t handler_errors;                 /**< handler calls that returned an error */
+    uint32_t dropped;                        /**< events lost because the queue was full */
+} ntag21x_pool_status_t;
+
+/**
+ * @brief     pool init
+ * @param[in] *reader pointer to a reader list
+ * @param[in] num reader number
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ *            - 2 num is invalid
+ * @note      one ntag21x handle is bound to each reader
+ */
+uint8_t ntag21x_pool_init(ntag21x_pool_reader_t *reader, uint8_t num);
+
+/**
+ * @brief     pool set the tag handler
+ * @param[in] *handler pointer to a handler function address
+ * @return    status code
+ *            - 0 success
+ *            - 1 pool is running
+ * @note      the handler runs on the worker thread of the reader after the tag is selected,
+ *            so it can drive the handle directly, the tag is halted after it returns
+ */
+uint8_t ntag21x_pool_set_handler(uint8_t (*handler)(uint8_t reader, ntag21x_handle_t *handle, ntag21x_pool_event_t *event));
+
+/**
+ * @brief     pool set the polling parameters
+ * @param[in] interval_ms delay between two search rounds of a reader
+ * @param[in] miss_limit missed rounds before a tag is reported as left
+ * @return    status code
+ *            - 0 success
+ *            - 1 pool is running
+ *            - 2 miss_limit is invalid
+ * @note      none
+ */
+uint8_t ntag21x_pool_set_polling(uint32_t interval_ms, uint8_t miss_limit);
+
+/**
+ * @brief  pool start one worker thread per reader
+ * @return status code
+ *         - 0 success
+ *         - 1 start failed
+ * @note   none
+ */
+uint8_t ntag21x_pool_start(void);
+
+/**
+ * @brief  pool stop and join all worker threads
+ * @return status code
+ *         - 0 success
+ *         - 1 stop failed
+ * @note   none
+ */
+uint8_t ntag21x_pool_stop(void);
+
+/**
+ * @brief  pool deinit
+ * @return status code
+ *         - 0 success
+ *         - 1 deinit failed
+ * @note   stops the pool if it is running
+ */
+uint8_t ntag21x_pool_deinit(void);
+
+/**
+ * @brief      pool get the next event
+ * @param[out] *event pointer to an event buffer
+ * @param[in]  timeout_ms max wait time, 0 returns at once and -1 waits forever
+ * @return     status code
+ *             - 0 success
+ *             - 1 no event
+ * @note       only one thread may consume events
+ */
+uint8_t ntag21x_pool_get_event(ntag21x_pool_event_t *event, int32_t timeout_ms);
+
+/**
+ * @brief      pool get the status of a reader
+ * @param[in]  reader reader index
+ * @param[out] *status pointer to a status structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 reader is invalid
+ * @note       the counters are a snapshot, workers keep updating them
+ */
+uint8_t ntag21x_pool_get_status(uint8_t reader, ntag21x_pool_status_t *status);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
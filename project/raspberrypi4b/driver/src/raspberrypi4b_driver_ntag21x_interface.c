@@ -34,13 +34,36 @@
  * </table>
  */
 
-#include "driver_ntag21x_interface.h"
+#define _DEFAULT_SOURCE
+
+#include "raspberrypi4b_driver_ntag21x_interface.h"
 #include "driver_mfrc522_basic.h"
 #include "gpio.h"
 #include <unistd.h>
 #include <stdarg.h>
+#include <semaphore.h>
+#include <errno.h>
+#include <time.h>
 
 uint8_t (*g_gpio_irq)(void) = NULL;        /**< gpio irq function address */
+static sem_t gs_irq_sem;                   /**< irq semaphore */
+
+/**
+ * @brief  interface gpio irq
+ * @return status code
+ *         - 0 success
+ *         - 1 run failed
+ * @note   runs the reader irq handler and wakes ntag21x_interface_wait_irq
+ */
+static uint8_t a_gpio_irq(void)
+{
+    uint8_t res;
+    
+    res = mfrc522_interrupt_irq_handler();
+    (void)sem_post(&gs_irq_sem);
+    
+    return res;
+}
 
 #ifdef USE_DRIVER_MFRC522
 /**
@@ -113,11 +136,17 @@ static void a_receive_callback(uint16_t type)
  */
 uint8_t ntag21x_interface_contactless_init(void)
 {
+    if (sem_init(&gs_irq_sem, 0, 0) != 0)
+    {
+        return 1;
+    }
     if (gpio_interrupt_init() != 0)
     {
+        (void)sem_destroy(&gs_irq_sem);
+        
         return 1;
     }
-    g_gpio_irq = mfrc522_interrupt_irq_handler;
+    g_gpio_irq = a_gpio_irq;
 #ifdef USE_DRIVER_MFRC522
     if (mfrc522_basic_init(MFRC522_INTERFACE_SPI, 0x00, a_receive_callback) != 0)
     {
@@ -144,6 +173,7 @@ uint8_t ntag21x_interface_contactless_deinit(void)
         return 1;
     }
     g_gpio_irq = NULL;
+    (void)sem_destroy(&gs_irq_sem);
 #ifdef USE_DRIVER_MFRC522
     if (mfrc522_basic_deinit() != 0)
     {
@@ -186,6 +216,60 @@ void ntag21x_interface_delay_ms(uint32_t ms)
     usleep(1000 * ms);
 }
 
+/**
+ * @brief  interface timestamp ms
+ * @return monotonic time in ms
+ * @note   none
+ */
+uint32_t ntag21x_interface_timestamp_ms(void)
+{
+    struct timespec ts;
+    
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000 + (uint64_t)ts.tv_nsec / 1000000);
+}
+
+/**
+ * @brief     interface wait for the reader interrupt
+ * @param[in] timeout_ms max waiting time
+ * @return    status code
+ *            - 0 woken by the interrupt
+ *            - 1 timeout
+ * @note      interrupts raised before the call are dropped
+ */
+uint8_t ntag21x_interface_wait_irq(uint32_t timeout_ms)
+{
+    struct timespec ts;
+    
+    /* drop the interrupts of the last exchange */
+    while (sem_trywait(&gs_irq_sem) == 0)
+    {
+        continue;
+    }
+    
+    /* absolute deadline */
+    (void)clock_gettime(CLOCK_REALTIME, &ts);
+    ts.tv_sec += timeout_ms / 1000;
+    ts.tv_nsec += (long)(timeout_ms % 1000) * 1000000L;
+    if (ts.tv_nsec >= 1000000000L)
+    {
+        ts.tv_sec++;
+        ts.tv_nsec -= 1000000000L;
+    }
+    
+    /* wait */
+    while (sem_timedwait(&gs_irq_sem, &ts) != 0)
+    {
+        if (errno != EINTR)
+        {
+            return 1;
+        }
+    }
+    
+    return 0;
+}
+
 /**
  * @brief     interface print format data
  * @param[in] fmt format data
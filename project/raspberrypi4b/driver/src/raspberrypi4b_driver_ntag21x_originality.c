@@ -0,0 +1,176 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file      raspberrypi4b_driver_ntag21x_originality.c
+ * @brief     raspberrypi4b driver ntag21x originality source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "raspberrypi4b_driver_ntag21x_originality.h"
+#include <pthread.h>
+#include <unistd.h>
+
+/**
+ * @brief originality slice structure definition
+ */
+typedef struct ntag21x_originality_slice_s
+{
+    ntag21x_originality_handle_t *handle;        /**< shared verifier handle */
+    uint8_t (*uid)[7];                           /**< first uid of the slice */
+    uint8_t (*signature)[32];                    /**< first signature of the slice */
+    uint8_t *result;                             /**< first result of the slice */
+    uint32_t num;                                /**< slice length */
+    uint32_t valid;                              /**< genuine number */
+    uint8_t res;                                 /**< verify status */
+    uint8_t started;                             /**< thread started flag */
+    pthread_t thread;                            /**< worker thread */
+} ntag21x_originality_slice_t;
+
+/**
+ * @brief     originality worker thread
+ * @param[in] *arg pointer to an originality slice structure
+ * @return    NULL
+ * @note      none
+ */
+static void *a_ntag21x_originality_worker(void *arg)
+{
+    ntag21x_originality_slice_t *slice = (ntag21x_originality_slice_t *)arg;
+    
+    slice->res = ntag21x_originality_verify_batch(slice->handle, slice->uid, slice->signature,
+                                                  slice->result, slice->num, &slice->valid);
+    
+    return NULL;
+}
+
+/**
+ * @brief      verify a list of originality signatures on several cores
+ * @param[in]  *handle pointer to an initialized ntag21x originality handle structure
+ * @param[in]  **uid pointer to a 7 bytes uid list
+ * @param[in]  **signature pointer to a 32 bytes signature list
+ * @param[out] *result pointer to a result list, 0 genuine and 1 invalid
+ * @param[in]  num list length
+ * @param[in]  threads thread number, 0 for one per online core
+ * @param[out] *valid pointer to a genuine number buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 verify failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       every thread runs ntag21x_originality_verify_batch on its own slice,
+ *             a slice whose thread can't be created runs on the calling thread
+ */
+uint8_t ntag21x_originality_verify_parallel(ntag21x_originality_handle_t *handle, uint8_t (*uid)[7], uint8_t (*signature)[32],
+                                            uint8_t *result, uint32_t num, uint8_t threads, uint32_t *valid)
+{
+    uint8_t i;
+    uint8_t res = 0;
+    uint32_t offset;
+    uint32_t step;
+    long cores;
+    ntag21x_originality_slice_t slice[NTAG21X_ORIGINALITY_MAX_THREAD];
+    
+    if ((handle == NULL) || (valid == NULL) ||
+        (((uid == NULL) || (signature == NULL) || (result == NULL)) && (num != 0)))
+    {
+        return 2;
+    }
+    if (handle->inited != 1)
+    {
+        return 3;
+    }
+    
+    /* one thread per online core by default */
+    if (threads == 0)
+    {
+        cores = sysconf(_SC_NPROCESSORS_ONLN);
+        threads = (uint8_t)((cores < 1) ? 1 : ((cores > NTAG21X_ORIGINALITY_MAX_THREAD) ? NTAG21X_ORIGINALITY_MAX_THREAD : cores));
+    }
+    if (threads > NTAG21X_ORIGINALITY_MAX_THREAD)
+    {
+        threads = NTAG21X_ORIGINALITY_MAX_THREAD;
+    }
+    
+    /* keep every slice at least one batch long */
+    step = (num + threads - 1) / threads;
+    if (step < NTAG21X_ORIGINALITY_BATCH)
+    {
+        step = NTAG21X_ORIGINALITY_BATCH;
+    }
+    
+    offset = 0;
+    for (i = 0; i < threads; i++)
+    {
+        slice[i].handle = handle;
+        slice[i].uid = uid + offset;
+        slice[i].signature = signature + offset;
+        slice[i].result = result + offset;
+        slice[i].num = (num - offset > step) ? step : (num - offset);
+        slice[i].valid = 0;
+        slice[i].res = 0;
+        slice[i].started = 0;
+        offset += slice[i].num;
+        if (slice[i].num == 0)
+        {
+            continue;
+        }
+        if (pthread_create(&slice[i].thread, NULL, a_ntag21x_originality_worker, &slice[i]) == 0)
+        {
+            slice[i].started = 1;
+        }
+    }
+    
+    /* run the slices left over and collect the results */
+    *valid = 0;
+    for (i = 0; i < threads; i++)
+    {
+        if (slice[i].started != 0)
+        {
+            (void)pthread_join(slice[i].thread, NULL);
+        }
+        else if (slice[i].num != 0)
+        {
+            (void)a_ntag21x_originality_worker(&slice[i]);
+        }
+        else
+        {
+            continue;
+        }
+        if (slice[i].res != 0)
+        {
+            res = 1;
+        }
+        *valid += slice[i].valid;
+    }
+    
+    return res;
+}
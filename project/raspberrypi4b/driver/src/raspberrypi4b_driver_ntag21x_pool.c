@@ -0,0 +1,647 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file      raspberrypi4b_driver_ntag21x_pool.c
+ * @brief     raspberrypi4b driver ntag21x pool source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "raspberrypi4b_driver_ntag21x_pool.h"
+#include "driver_ntag21x_interface.h"
+#include <pthread.h>
+#include <semaphore.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include <errno.h>
+#include <time.h>
+
+#if ((NTAG21X_POOL_QUEUE_SIZE & (NTAG21X_POOL_QUEUE_SIZE - 1)) != 0)
+    #error "NTAG21X_POOL_QUEUE_SIZE must be a power of 2"
+#endif
+
+/**
+ * @brief pool queue cell structure definition
+ */
+typedef struct ntag21x_pool_cell_s
+{
+    atomic_size_t sequence;                 /**< slot sequence */
+    ntag21x_pool_event_t event;             /**< event */
+} ntag21x_pool_cell_t;
+
+/**
+ * @brief pool worker structure definition
+ */
+typedef struct ntag21x_pool_worker_s
+{
+    ntag21x_handle_t handle;                /**< ntag21x handle of the reader */
+    ntag21x_pool_reader_t reader;           /**< reader functions */
+    pthread_t thread;                       /**< worker thread */
+    uint8_t index;                          /**< reader index */
+    uint8_t started;                        /**< thread started flag */
+    atomic_uint polls;                      /**< search rounds */
+    atomic_uint arrivals;                   /**< arrived events */
+    atomic_uint departures;                 /**< left events */
+    atomic_uint handler_errors;             /**< failed handler calls */
+    atomic_uint dropped;                    /**< lost events */
+} ntag21x_pool_worker_t;
+
+/**
+ * @brief pool structure definition
+ */
+typedef struct ntag21x_pool_s
+{
+    ntag21x_pool_worker_t worker[NTAG21X_POOL_MAX_READER];                                      /**< one worker per reader */
+    uint8_t num;                                                                                /**< reader number */
+    uint8_t inited;                                                                             /**< inited flag */
+    uint8_t running;                                                                            /**< running flag */
+    uint8_t miss_limit;                                                                         /**< missed rounds before a tag left */
+    uint32_t interval_ms;                                                                       /**< search interval */
+    uint8_t (*handler)(uint8_t reader, ntag21x_handle_t *handle, ntag21x_pool_event_t *event);  /**< tag handler */
+    atomic_int stop;                                                                            /**< stop request */
+    ntag21x_pool_cell_t cell[NTAG21X_POOL_QUEUE_SIZE];                                          /**< event ring */
+    atomic_size_t head;                                                                         /**< producer position */
+    size_t tail;                                                                                /**< consumer position */
+    sem_t sem;                                                                                  /**< queued events */
+} ntag21x_pool_t;
+
+static ntag21x_pool_t gs_pool;        /**< reader pool */
+
+/**
+ * @brief     pool delay ms
+ * @param[in] ms time
+ * @note      none
+ */
+static void a_ntag21x_pool_delay_ms(uint32_t ms)
+{
+    struct timespec ts;
+    
+    ts.tv_sec = ms / 1000;
+    ts.tv_nsec = (long)(ms % 1000) * 1000000L;
+    while (nanosleep(&ts, &ts) != 0 && errno == EINTR)
+    {
+        continue;
+    }
+}
+
+#ifdef NO_DEBUG
+/**
+ * @brief     pool print format data
+ * @param[in] fmt format data
+ * @note      none
+ */
+static void a_ntag21x_pool_debug_print(const char *const fmt, ...)
+{
+    (void)fmt;
+    
+    return;
+}
+#endif
+
+/**
+ * @brief  pool get the monotonic time
+ * @return time in ns
+ * @note   none
+ */
+static uint64_t a_ntag21x_pool_now_ns(void)
+{
+    struct timespec ts;
+    
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ * @brief     pool push an event
+ * @param[in] *event pointer to an event structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 queue is full
+ * @note      bounded multi producer ring, every cell carries a sequence so producers
+ *            only race on the head index and the consumer never takes a lock
+ */
+static uint8_t a_ntag21x_pool_push(ntag21x_pool_event_t *event)
+{
+    ntag21x_pool_cell_t *cell;
+    size_t pos;
+    size_t seq;
+    intptr_t dif;
+    
+    pos = atomic_load_explicit(&gs_pool.head, memory_order_relaxed);
+    while (1)
+    {
+        cell = &gs_pool.cell[pos & (NTAG21X_POOL_QUEUE_SIZE - 1)];
+        seq = atomic_load_explicit(&cell->sequence, memory_order_acquire);
+        dif = (intptr_t)seq - (intptr_t)pos;
+        if (dif == 0)
+        {
+            /* claim the cell */
+            if (atomic_compare_exchange_weak_explicit(&gs_pool.head, &pos, pos + 1,
+                                                      memory_order_relaxed, memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else if (dif < 0)
+        {
+            /* the consumer has not freed the cell yet */
+            return 1;
+        }
+        else
+        {
+            /* another producer took it */
+            pos = atomic_load_explicit(&gs_pool.head, memory_order_relaxed);
+        }
+    }
+    
+    /* publish */
+    cell->event = *event;
+    atomic_store_explicit(&cell->sequence, pos + 1, memory_order_release);
+    (void)sem_post(&gs_pool.sem);
+    
+    return 0;
+}
+
+/**
+ * @brief     pool report an event
+ * @param[in] *worker pointer to a worker structure
+ * @param[in] type event type
+ * @param[in] tag_type tag type
+ * @param[in] *id pointer to an id buffer
+ * @note      none
+ */
+static void a_ntag21x_pool_report(ntag21x_pool_worker_t *worker, ntag21x_pool_event_type_t type,
+                                  ntag21x_type_t tag_type, uint8_t id[8])
+{
+    ntag21x_pool_event_t event;
+    
+    event.reader = worker->index;
+    event.type = type;
+    event.tag_type = tag_type;
+    memcpy(event.id, id, 8);
+    event.timestamp_ns = a_ntag21x_pool_now_ns();
+    if (type == NTAG21X_POOL_EVENT_ARRIVED)
+    {
+        atomic_fetch_add_explicit(&worker->arrivals, 1, memory_order_relaxed);
+        
+        /* let the handler work on the selected tag first */
+        if (gs_pool.handler != NULL)
+        {
+            if (gs_pool.handler(worker->index, &worker->handle, &event) != 0)
+            {
+                atomic_fetch_add_explicit(&worker->handler_errors, 1, memory_order_relaxed);
+            }
+        }
+    }
+    else
+    {
+        atomic_fetch_add_explicit(&worker->departures, 1, memory_order_relaxed);
+    }
+    if (a_ntag21x_pool_push(&event) != 0)
+    {
+        atomic_fetch_add_explicit(&worker->dropped, 1, memory_order_relaxed);
+    }
+}
+
+/**
+ * @brief      pool search a tag
+ * @param[in]  *handle pointer to an ntag21x handle structure
+ * @param[out] *type pointer to a type buffer
+ * @param[out] *id pointer to an id buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 no tag
+ * @note       wake up also reaches a tag halted in the previous round
+ */
+static uint8_t a_ntag21x_pool_search(ntag21x_handle_t *handle, ntag21x_type_t *type, uint8_t id[8])
+{
+    if (ntag21x_wake_up(handle, type) != 0)
+    {
+        return 1;
+    }
+    if (ntag21x_anticollision_cl1(handle, id) != 0)
+    {
+        return 1;
+    }
+    if (ntag21x_select_cl1(handle, id) != 0)
+    {
+        return 1;
+    }
+    if (ntag21x_anticollision_cl2(handle, id + 4) != 0)
+    {
+        return 1;
+    }
+    if (ntag21x_select_cl2(handle, id + 4) != 0)
+    {
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     pool worker thread
+ * @param[in] *arg pointer to a worker structure
+ * @return    NULL
+ * @note      none
+ */
+static void *a_ntag21x_pool_worker(void *arg)
+{
+    ntag21x_pool_worker_t *worker = (ntag21x_pool_worker_t *)arg;
+    ntag21x_type_t type;
+    ntag21x_type_t last_type = NTAG21X_TYPE_INVALID;
+    uint8_t id[8];
+    uint8_t last[8];
+    uint8_t present = 0;
+    uint8_t misses = 0;
+    
+    while (atomic_load_explicit(&gs_pool.stop, memory_order_acquire) == 0)
+    {
+        atomic_fetch_add_explicit(&worker->polls, 1, memory_order_relaxed);
+        if (a_ntag21x_pool_search(&worker->handle, &type, id) == 0)
+        {
+            /* another tag replaced the last one */
+            if ((present != 0) && (memcmp(id, last, 8) != 0))
+            {
+                a_ntag21x_pool_report(worker, NTAG21X_POOL_EVENT_LEFT, last_type, last);
+                present = 0;
+            }
+            if (present == 0)
+            {
+                memcpy(last, id, 8);
+                last_type = type;
+                present = 1;
+                a_ntag21x_pool_report(worker, NTAG21X_POOL_EVENT_ARRIVED, type, id);
+            }
+            misses = 0;
+            (void)ntag21x_halt(&worker->handle);
+        }
+        else if (present != 0)
+        {
+            misses++;
+            if (misses >= gs_pool.miss_limit)
+            {
+                a_ntag21x_pool_report(worker, NTAG21X_POOL_EVENT_LEFT, last_type, last);
+                present = 0;
+                misses = 0;
+            }
+        }
+        else
+        {
+            /* nothing in the field */
+        }
+        a_ntag21x_pool_delay_ms(gs_pool.interval_ms);
+    }
+    
+    return NULL;
+}
+
+/**
+ * @brief     pool init
+ * @param[in] *reader pointer to a reader list
+ * @param[in] num reader number
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ *            - 2 num is invalid
+ * @note      one ntag21x handle is bound to each reader
+ */
+uint8_t ntag21x_pool_init(ntag21x_pool_reader_t *reader, uint8_t num)
+{
+    uint8_t i;
+    size_t k;
+    ntag21x_pool_worker_t *worker;
+    
+    if ((reader == NULL) || (gs_pool.inited != 0))
+    {
+        return 1;
+    }
+    if ((num == 0) || (num > NTAG21X_POOL_MAX_READER))
+    {
+        return 2;
+    }
+    
+    memset(&gs_pool, 0, sizeof(gs_pool));
+    for (k = 0; k < NTAG21X_POOL_QUEUE_SIZE; k++)
+    {
+        atomic_init(&gs_pool.cell[k].sequence, k);
+    }
+    atomic_init(&gs_pool.head, 0);
+    atomic_init(&gs_pool.stop, 0);
+    gs_pool.tail = 0;
+    if (sem_init(&gs_pool.sem, 0, 0) != 0)
+    {
+        return 1;
+    }
+    for (i = 0; i < num; i++)
+    {
+        worker = &gs_pool.worker[i];
+        worker->reader = reader[i];
+        worker->index = i;
+        atomic_init(&worker->polls, 0);
+        atomic_init(&worker->arrivals, 0);
+        atomic_init(&worker->departures, 0);
+        atomic_init(&worker->handler_errors, 0);
+        atomic_init(&worker->dropped, 0);
+        
+        /* link function */
+        DRIVER_NTAG21X_LINK_INIT(&worker->handle, ntag21x_handle_t);
+        DRIVER_NTAG21X_LINK_USER(&worker->handle, worker->reader.context);
+        DRIVER_NTAG21X_LINK_CONTACTLESS_INIT_CTX(&worker->handle, worker->reader.contactless_init);
+        DRIVER_NTAG21X_LINK_CONTACTLESS_DEINIT_CTX(&worker->handle, worker->reader.contactless_deinit);
+        DRIVER_NTAG21X_LINK_CONTACTLESS_TRANSCEIVER_CTX(&worker->handle, worker->reader.contactless_transceiver);
+        DRIVER_NTAG21X_LINK_DELAY_MS(&worker->handle, a_ntag21x_pool_delay_ms);
+#ifndef NO_DEBUG
+        DRIVER_NTAG21X_LINK_DEBUG_PRINT(&worker->handle, ntag21x_interface_debug_print);
+#else
+        DRIVER_NTAG21X_LINK_DEBUG_PRINT(&worker->handle, a_ntag21x_pool_debug_print);
+#endif
+    }
+    gs_pool.num = num;
+    gs_pool.interval_ms = NTAG21X_POOL_DEFAULT_POLL_INTERVAL_MS;
+    gs_pool.miss_limit = NTAG21X_POOL_DEFAULT_MISS_LIMIT;
+    gs_pool.inited = 1;
+    
+    return 0;
+}
+
+/**
+ * @brief     pool set the tag handler
+ * @param[in] *handler pointer to a handler function address
+ * @return    status code
+ *            - 0 success
+ *            - 1 pool is running
+ * @note      the handler runs on the worker thread of the reader after the tag is selected,
+ *            so it can drive the handle directly, the tag is halted after it returns
+ */
+uint8_t ntag21x_pool_set_handler(uint8_t (*handler)(uint8_t reader, ntag21x_handle_t *handle, ntag21x_pool_event_t *event))
+{
+    if (gs_pool.running != 0)
+    {
+        return 1;
+    }
+    gs_pool.handler = handler;
+    
+    return 0;
+}
+
+/**
+ * @brief     pool set the polling parameters
+ * @param[in] interval_ms delay between two search rounds of a reader
+ * @param[in] miss_limit missed rounds before a tag is reported as left
+ * @return    status code
+ *            - 0 success
+ *            - 1 pool is running
+ *            - 2 miss_limit is invalid
+ * @note      none
+ */
+uint8_t ntag21x_pool_set_polling(uint32_t interval_ms, uint8_t miss_limit)
+{
+    if (gs_pool.running != 0)
+    {
+        return 1;
+    }
+    if (miss_limit == 0)
+    {
+        return 2;
+    }
+    gs_pool.interval_ms = interval_ms;
+    gs_pool.miss_limit = miss_limit;
+    
+    return 0;
+}
+
+/**
+ * @brief  pool stop and join all worker threads
+ * @return status code
+ *         - 0 success
+ *         - 1 stop failed
+ * @note   none
+ */
+uint8_t ntag21x_pool_stop(void)
+{
+    uint8_t i;
+    uint8_t res = 0;
+    ntag21x_pool_worker_t *worker;
+    
+    if (gs_pool.running == 0)
+    {
+        return 1;
+    }
+    
+    atomic_store_explicit(&gs_pool.stop, 1, memory_order_release);
+    for (i = 0; i < gs_pool.num; i++)
+    {
+        worker = &gs_pool.worker[i];
+        if (worker->started != 0)
+        {
+            (void)pthread_join(worker->thread, NULL);
+            worker->started = 0;
+        }
+        if (worker->handle.inited != 0)
+        {
+            if (ntag21x_deinit(&worker->handle) != 0)
+            {
+                res = 1;
+            }
+        }
+    }
+    gs_pool.running = 0;
+    
+    return res;
+}
+
+/**
+ * @brief  pool start one worker thread per reader
+ * @return status code
+ *         - 0 success
+ *         - 1 start failed
+ * @note   none
+ */
+uint8_t ntag21x_pool_start(void)
+{
+    uint8_t i;
+    ntag21x_pool_worker_t *worker;
+    
+    if ((gs_pool.inited == 0) || (gs_pool.running != 0))
+    {
+        return 1;
+    }
+    
+    atomic_store_explicit(&gs_pool.stop, 0, memory_order_release);
+    gs_pool.running = 1;
+    for (i = 0; i < gs_pool.num; i++)
+    {
+        worker = &gs_pool.worker[i];
+        
+        /* init the reader before its thread owns it */
+        if (ntag21x_init(&worker->handle) != 0)
+        {
+            ntag21x_interface_debug_print("ntag21x_pool: reader %d init failed.\n", i);
+            (void)ntag21x_pool_stop();
+            
+            return 1;
+        }
+        if (pthread_create(&worker->thread, NULL, a_ntag21x_pool_worker, worker) != 0)
+        {
+            ntag21x_interface_debug_print("ntag21x_pool: reader %d thread create failed.\n", i);
+            (void)ntag21x_pool_stop();
+            
+            return 1;
+        }
+        worker->started = 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief  pool deinit
+ * @return status code
+ *         - 0 success
+ *         - 1 deinit failed
+ * @note   stops the pool if it is running
+ */
+uint8_t ntag21x_pool_deinit(void)
+{
+    uint8_t res = 0;
+    
+    if (gs_pool.inited == 0)
+    {
+        return 1;
+    }
+    if (gs_pool.running != 0)
+    {
+        res = ntag21x_pool_stop();
+    }
+    (void)sem_destroy(&gs_pool.sem);
+    gs_pool.inited = 0;
+    
+    return res;
+}
+
+/**
+ * @brief      pool get the next event
+ * @param[out] *event pointer to an event buffer
+ * @param[in]  timeout_ms max wait time, 0 returns at once and -1 waits forever
+ * @return     status code
+ *             - 0 success
+ *             - 1 no event
+ * @note       only one thread may consume events
+ */
+uint8_t ntag21x_pool_get_event(ntag21x_pool_event_t *event, int32_t timeout_ms)
+{
+    ntag21x_pool_cell_t *cell;
+    struct timespec ts;
+    int ret;
+    
+    if ((event == NULL) || (gs_pool.inited == 0))
+    {
+        return 1;
+    }
+    
+    /* wait for a published event */
+    if (timeout_ms == 0)
+    {
+        ret = sem_trywait(&gs_pool.sem);
+    }
+    else if (timeout_ms < 0)
+    {
+        while (((ret = sem_wait(&gs_pool.sem)) != 0) && (errno == EINTR))
+        {
+            continue;
+        }
+    }
+    else
+    {
+        clock_gettime(CLOCK_REALTIME, &ts);
+        ts.tv_sec += timeout_ms / 1000;
+        ts.tv_nsec += (long)(timeout_ms % 1000) * 1000000L;
+        if (ts.tv_nsec >= 1000000000L)
+        {
+            ts.tv_sec++;
+            ts.tv_nsec -= 1000000000L;
+        }
+        while (((ret = sem_timedwait(&gs_pool.sem, &ts)) != 0) && (errno == EINTR))
+        {
+            continue;
+        }
+    }
+    if (ret != 0)
+    {
+        return 1;
+    }
+    
+    /* the token may belong to a later cell, the producer of the tail cell has claimed it and is still copying */
+    cell = &gs_pool.cell[gs_pool.tail & (NTAG21X_POOL_QUEUE_SIZE - 1)];
+    while (atomic_load_explicit(&cell->sequence, memory_order_acquire) != gs_pool.tail + 1)
+    {
+        (void)sched_yield();
+    }
+    
+    /* take the event and hand the cell back to the producers */
+    *event = cell->event;
+    atomic_store_explicit(&cell->sequence, gs_pool.tail + NTAG21X_POOL_QUEUE_SIZE, memory_order_release);
+    gs_pool.tail++;
+    
+    return 0;
+}
+
+/**
+ * @brief      pool get the status of a reader
+ * @param[in]  reader reader index
+ * @param[out] *status pointer to a status structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 reader is invalid
+ * @note       the counters are a snapshot, workers keep updating them
+ */
+uint8_t ntag21x_pool_get_status(uint8_t reader, ntag21x_pool_status_t *status)
+{
+    ntag21x_pool_worker_t *worker;
+    
+    if ((status == NULL) || (reader >= gs_pool.num))
+    {
+        return 1;
+    }
+    
+    worker = &gs_pool.worker[reader];
+    status->polls = atomic_load_explicit(&worker->polls, memory_order_relaxed);
+    status->arrivals = atomic_load_explicit(&worker->arrivals, memory_order_relaxed);
+    status->departures = atomic_load_explicit(&worker->departures, memory_order_relaxed);
+    status->handler_errors = atomic_load_explicit(&worker->handler_errors, memory_order_relaxed);
+    status->dropped = atomic_load_explicit(&worker->dropped, memory_order_relaxed);
+    
+    return 0;
+}
@@ -0,0 +1,790 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file      benchmark.c
+ * @brief     driver benchmark source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include "driver_ntag21x.h"
+#include "driver_ntag21x_emulator.h"
+#include <stdlib.h>
+#include <time.h>
+
+/**
+ * @brief benchmark output format enumeration definition
+ */
+typedef enum
+{
+    BENCHMARK_FORMAT_CSV  = 0x00,        /**< csv */
+    BENCHMARK_FORMAT_JSON = 0x01,        /**< json */
+} benchmark_format_t;
+
+/**
+ * @brief benchmark operation structure definition
+ */
+typedef struct benchmark_operation_s
+{
+    const char *name;                    /**< operation name */
+    uint8_t (*run)(uint8_t arg);         /**< operation */
+    uint8_t arg;                         /**< operation argument */
+} benchmark_operation_t;
+
+static ntag21x_handle_t gs_handle;                 /**< ntag21x handle */
+static uint8_t gs_buf[NTAG21X_PAGE_CACHE_MAX_LEN]; /**< data buffer */
+static benchmark_format_t gs_format;               /**< output format */
+static uint32_t gs_results;                        /**< printed results */
+static volatile uint16_t gs_sink;                  /**< keeps the crc alive */
+
+/**
+ * @brief  get the monotonic time
+ * @return time in ns
+ * @note   none
+ */
+static uint64_t a_benchmark_now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ * @brief     debug print
+ * @param[in] fmt format data
+ * @note      driver messages are dropped so that only results are printed
+ */
+static void a_benchmark_debug_print(const char *const fmt, ...)
+{
+    (void)fmt;
+}
+
+/**
+ * @brief  select the emulated tag
+ * @return status code
+ *         - 0 success
+ *         - 1 select failed
+ * @note   none
+ */
+static uint8_t a_benchmark_select(void)
+{
+    ntag21x_type_t type;
+    ntag21x_capability_container_t container;
+    uint8_t id[4];
+
+    if ((ntag21x_wake_up(&gs_handle, &type) != 0) ||
+        (ntag21x_anticollision_cl1(&gs_handle, id) != 0) ||
+        (ntag21x_select_cl1(&gs_handle, id) != 0) ||
+        (ntag21x_anticollision_cl2(&gs_handle, id) != 0) ||
+        (ntag21x_select_cl2(&gs_handle, id) != 0) ||
+        (ntag21x_get_capability_container(&gs_handle, &container) != 0))
+    {
+        return 1;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief     benchmark crc
+ * @param[in] arg crc length
+ * @return    status code of the operation
+ * @note      none
+ */
+static uint8_t a_benchmark_crc(uint8_t arg)
+{
+    uint16_t crc = NTAG21X_ISO14443A_CRC_INIT;
+
+    (void)ntag21x_iso14443a_crc_update(&crc, gs_buf, arg);
+    gs_sink = crc;
+
+    return 0;
+}
+
+/**
+ * @brief     benchmark select sequence
+ * @param[in] arg not used
+ * @return    status code of the operation
+ * @note      none
+ */
+static uint8_t a_benchmark_select_sequence(uint8_t arg)
+{
+    (void)arg;
+
+    (void)ntag21x_halt(&gs_handle);
+
+    return a_benchmark_select();
+}
+
+/**
+ * @brief     benchmark read page
+ * @param[in] arg page
+ * @return    status code of the operation
+ * @note      none
+ */
+static uint8_t a_benchmark_read_page(uint8_t arg)
+{
+    return ntag21x_read_page(&gs_handle, arg, gs_buf);
+}
+
+/**
+ * @brief     benchmark read four pages
+ * @param[in] arg start page
+ * @return    status code of the operation
+ * @note      none
+ */
+static uint8_t a_benchmark_read_four_pages(uint8_t arg)
+{
+    return ntag21x_read_four_pages(&gs_handle, arg, gs_buf);
+}
+
+/**
+ * @brief     benchmark fast read page
+ * @param[in] arg page count
+ * @return    status code of the operation
+ * @note      none
+ */
+static uint8_t a_benchmark_fast_read_page(uint8_t arg)
+{
+    uint16_t len = sizeof(gs_buf);
+
+    return ntag21x_fast_read_page(&gs_handle, 4, (uint8_t)(4 + arg - 1), gs_buf, &len);
+}
+
+/**
+ * @brief     benchmark dump memory
+ * @param[in] arg last page
+ * @return    status code of the operation
+ * @note      none
+ */
+static uint8_t a_benchmark_dump_memory(uint8_t arg)
+{
+    uint16_t len = sizeof(gs_buf);
+
+    return ntag21x_dump_memory(&gs_handle, 0, arg, gs_buf, &len);
+}
+
+/**
+ * @brief     benchmark write page
+ * @param[in] arg page
+ * @return    status code of the operation
+ * @note      none
+ */
+static uint8_t a_benchmark_write_page(uint8_t arg)
+{
+    uint8_t data[4] = {0x12, 0x34, 0x56, 0x78};
+
+    return ntag21x_write_page(&gs_handle, arg, data);
+}
+
+/**
+ * @brief     benchmark compatibility write page
+ * @param[in] arg page
+ * @return    status code of the operation
+ * @note      none
+ */
+static uint8_t a_benchmark_compatibility_write_page(uint8_t arg)
+{
+    uint8_t data[4] = {0x87, 0x65, 0x43, 0x21};
+
+    return ntag21x_compatibility_write_page(&gs_handle, arg, data);
+}
+
+/**
+ * @brief     benchmark authenticate
+ * @param[in] arg not used
+ * @return    status code of the operation
+ * @note      none
+ */
+static uint8_t a_benchmark_authenticate(uint8_t arg)
+{
+    uint8_t pwd[4] = {0xFF, 0xFF, 0xFF, 0xFF};
+    uint8_t pack[2] = {0x00, 0x00};
+
+    (void)arg;
+
+    return ntag21x_authenticate(&gs_handle, pwd, pack);
+}
+
+/**
+ * @brief     benchmark get version
+ * @param[in] arg not used
+ * @return    status code of the operation
+ * @note      none
+ */
+static uint8_t a_benchmark_get_version(uint8_t arg)
+{
+    ntag21x_version_t version;
+
+    (void)arg;
+
+    return ntag21x_get_version(&gs_handle, &version);
+}
+
+/**
+ * @brief     benchmark read counter
+ * @param[in] arg not used
+ * @return    status code of the operation
+ * @note      none
+ */
+static uint8_t a_benchmark_read_counter(uint8_t arg)
+{
+    uint32_t cnt;
+
+    (void)arg;
+
+    return ntag21x_read_counter(&gs_handle, &cnt);
+}
+
+/**
+ * @brief     benchmark read signature
+ * @param[in] arg not used
+ * @return    status code of the operation
+ * @note      none
+ */
+static uint8_t a_benchmark_read_signature(uint8_t arg)
+{
+    (void)arg;
+
+    return ntag21x_read_signature(&gs_handle, gs_buf);
+}
+
+/**
+ * @brief     benchmark get serial number
+ * @param[in] arg not used
+ * @return    status code of the operation
+ * @note      none
+ */
+static uint8_t a_benchmark_get_serial_number(uint8_t arg)
+{
+    (void)arg;
+
+    return ntag21x_get_serial_number(&gs_handle, gs_buf);
+}
+
+/**
+ * @brief     benchmark get capability container
+ * @param[in] arg not used
+ * @return    status code of the operation
+ * @note      none
+ */
+static uint8_t a_benchmark_get_capability_container(uint8_t arg)
+{
+    ntag21x_capability_container_t container;
+
+    (void)arg;
+
+    return ntag21x_get_capability_container(&gs_handle, &container);
+}
+
+/**
+ * @brief     benchmark set password
+ * @param[in] arg not used
+ * @return    status code of the operation
+ * @note      none
+ */
+static uint8_t a_benchmark_set_password(uint8_t arg)
+{
+    uint8_t pwd[4] = {0xFF, 0xFF, 0xFF, 0xFF};
+
+    (void)arg;
+
+    return ntag21x_set_password(&gs_handle, pwd);
+}
+
+/**
+ * @brief     benchmark set pack
+ * @param[in] arg not used
+ * @return    status code of the operation
+ * @note      none
+ */
+static uint8_t a_benchmark_set_pack(uint8_t arg)
+{
+    uint8_t pack[2] = {0x00, 0x00};
+
+    (void)arg;
+
+    return ntag21x_set_pack(&gs_handle, pack);
+}
+
+/**
+ * @brief     benchmark set dynamic lock
+ * @param[in] arg not used
+ * @return    status code of the operation
+ * @note      none
+ */
+static uint8_t a_benchmark_set_dynamic_lock(uint8_t arg)
+{
+    uint8_t lock[3] = {0x00, 0x00, 0x00};
+
+    (void)arg;
+
+    return ntag21x_set_dynamic_lock(&gs_handle, lock);
+}
+
+/**
+ * @brief     benchmark get dynamic lock
+ * @param[in] arg not used
+ * @return    status code of the operation
+ * @note      none
+ */
+static uint8_t a_benchmark_get_dynamic_lock(uint8_t arg)
+{
+    uint8_t lock[3];
+
+    (void)arg;
+
+    return ntag21x_get_dynamic_lock(&gs_handle, lock);
+}
+
+/**
+ * @brief     benchmark set static lock
+ * @param[in] arg not used
+ * @return    status code of the operation
+ * @note      none
+ */
+static uint8_t a_benchmark_set_static_lock(uint8_t arg)
+{
+    uint8_t lock[2] = {0x00, 0x00};
+
+    (void)arg;
+
+    return ntag21x_set_static_lock(&gs_handle, lock);
+}
+
+/**
+ * @brief     benchmark get static lock
+ * @param[in] arg not used
+ * @return    status code of the operation
+ * @note      none
+ */
+static uint8_t a_benchmark_get_static_lock(uint8_t arg)
+{
+    uint8_t lock[2];
+
+    (void)arg;
+
+    return ntag21x_get_static_lock(&gs_handle, lock);
+}
+
+/**
+ * @brief     benchmark set mirror
+ * @param[in] arg not used
+ * @return    status code of the operation
+ * @note      none
+ */
+static uint8_t a_benchmark_set_mirror(uint8_t arg)
+{
+    (void)arg;
+
+    return ntag21x_set_mirror(&gs_handle, NTAG21X_MIRROR_NO_ASCII);
+}
+
+/**
+ * @brief     benchmark get mirror
+ * @param[in] arg not used
+ * @return    status code of the operation
+ * @note      none
+ */
+static uint8_t a_benchmark_get_mirror(uint8_t arg)
+{
+    ntag21x_mirror_t mirror;
+
+    (void)arg;
+
+    return ntag21x_get_mirror(&gs_handle, &mirror);
+}
+
+/**
+ * @brief     benchmark set mirror byte
+ * @param[in] arg not used
+ * @return    status code of the operation
+ * @note      none
+ */
+static uint8_t a_benchmark_set_mirror_byte(uint8_t arg)
+{
+    (void)arg;
+
+    return ntag21x_set_mirror_byte(&gs_handle, NTAG21X_MIRROR_BYTE_0);
+}
+
+/**
+ * @brief     benchmark get mirror byte
+ * @param[in] arg not used
+ * @return    status code of the operation
+ * @note      none
+ */
+static uint8_t a_benchmark_get_mirror_byte(uint8_t arg)
+{
+    ntag21x_mirror_byte_t byte;
+
+    (void)arg;
+
+    return ntag21x_get_mirror_byte(&gs_handle, &byte);
+}
+
+/**
+ * @brief     benchmark set modulation mode
+ * @param[in] arg not used
+ * @return    status code of the operation
+ * @note      none
+ */
+static uint8_t a_benchmark_set_modulation_mode(uint8_t arg)
+{
+    (void)arg;
+
+    return ntag21x_set_modulation_mode(&gs_handle, NTAG21X_MODULATION_MODE_STRONG);
+}
+
+/**
+ * @brief     benchmark get modulation mode
+ * @param[in] arg not used
+ * @return    status code of the operation
+ * @note      none
+ */
+static uint8_t a_benchmark_get_modulation_mode(uint8_t arg)
+{
+    ntag21x_modulation_mode_t mode;
+
+    (void)arg;
+
+    return ntag21x_get_modulation_mode(&gs_handle, &mode);
+}
+
+/**
+ * @brief     benchmark set mirror page
+ * @param[in] arg not used
+ * @return    status code of the operation
+ * @note      none
+ */
+static uint8_t a_benchmark_set_mirror_page(uint8_t arg)
+{
+    (void)arg;
+
+    return ntag21x_set_mirror_page(&gs_handle, 0x00);
+}
+
+/**
+ * @brief     benchmark get mirror page
+ * @param[in] arg not used
+ * @return    status code of the operation
+ * @note      none
+ */
+static uint8_t a_benchmark_get_mirror_page(uint8_t arg)
+{
+    uint8_t page;
+
+    (void)arg;
+
+    return ntag21x_get_mirror_page(&gs_handle, &page);
+}
+
+/**
+ * @brief     benchmark set protect start page
+ * @param[in] arg not used
+ * @return    status code of the operation
+ * @note      none
+ */
+static uint8_t a_benchmark_set_protect_start_page(uint8_t arg)
+{
+    (void)arg;
+
+    return ntag21x_set_protect_start_page(&gs_handle, 0xFF);
+}
+
+/**
+ * @brief     benchmark get protect start page
+ * @param[in] arg not used
+ * @return    status code of the operation
+ * @note      none
+ */
+static uint8_t a_benchmark_get_protect_start_page(uint8_t arg)
+{
+    uint8_t page;
+
+    (void)arg;
+
+    return ntag21x_get_protect_start_page(&gs_handle, &page);
+}
+
+/**
+ * @brief     benchmark set access
+ * @param[in] arg access
+ * @return    status code of the operation
+ * @note      none
+ */
+static uint8_t a_benchmark_set_access(uint8_t arg)
+{
+    return ntag21x_set_access(&gs_handle, (ntag21x_access_t)arg, NTAG21X_BOOL_FALSE);
+}
+
+/**
+ * @brief     benchmark get access
+ * @param[in] arg access
+ * @return    status code of the operation
+ * @note      none
+ */
+static uint8_t a_benchmark_get_access(uint8_t arg)
+{
+    ntag21x_bool_t enable;
+
+    return ntag21x_get_access(&gs_handle, (ntag21x_access_t)arg, &enable);
+}
+
+/**
+ * @brief     benchmark set authenticate limitation
+ * @param[in] arg not used
+ * @return    status code of the operation
+ * @note      none
+ */
+static uint8_t a_benchmark_set_authenticate_limitation(uint8_t arg)
+{
+    (void)arg;
+
+    return ntag21x_set_authenticate_limitation(&gs_handle, 0);
+}
+
+/**
+ * @brief     benchmark get authenticate limitation
+ * @param[in] arg not used
+ * @return    status code of the operation
+ * @note      none
+ */
+static uint8_t a_benchmark_get_authenticate_limitation(uint8_t arg)
+{
+    uint8_t limit;
+
+    (void)arg;
+
+    return ntag21x_get_authenticate_limitation(&gs_handle, &limit);
+}
+
+/**
+ * @brief benchmark operation list
+ * @note  arg 0xFF of read, write and dump operations is replaced by the type dependent page
+ */
+static const benchmark_operation_t gsc_operations[] =
+{
+    {"crc_3", a_benchmark_crc, 3},
+    {"crc_18", a_benchmark_crc, 18},
+    {"crc_66", a_benchmark_crc, 66},
+    {"select", a_benchmark_select_sequence, 0},
+    {"read_page", a_benchmark_read_page, 4},
+    {"read_four_pages", a_benchmark_read_four_pages, 4},
+    {"dump_memory", a_benchmark_dump_memory, 0xFF},
+    {"write_page", a_benchmark_write_page, 0xFF},
+    {"compatibility_write_page", a_benchmark_compatibility_write_page, 0xFF},
+    {"authenticate", a_benchmark_authenticate, 0},
+    {"get_version", a_benchmark_get_version, 0},
+    {"read_counter", a_benchmark_read_counter, 0},
+    {"read_signature", a_benchmark_read_signature, 0},
+    {"get_serial_number", a_benchmark_get_serial_number, 0},
+    {"get_capability_container", a_benchmark_get_capability_container, 0},
+    {"set_password", a_benchmark_set_password, 0},
+    {"set_pack", a_benchmark_set_pack, 0},
+    {"set_dynamic_lock", a_benchmark_set_dynamic_lock, 0},
+    {"get_dynamic_lock", a_benchmark_get_dynamic_lock, 0},
+    {"set_static_lock", a_benchmark_set_static_lock, 0},
+    {"get_static_lock", a_benchmark_get_static_lock, 0},
+    {"set_mirror", a_benchmark_set_mirror, 0},
+    {"get_mirror", a_benchmark_get_mirror, 0},
+    {"set_mirror_byte", a_benchmark_set_mirror_byte, 0},
+    {"get_mirror_byte", a_benchmark_get_mirror_byte, 0},
+    {"set_modulation_mode", a_benchmark_set_modulation_mode, 0},
+    {"get_modulation_mode", a_benchmark_get_modulation_mode, 0},
+    {"set_mirror_page", a_benchmark_set_mirror_page, 0},
+    {"get_mirror_page", a_benchmark_get_mirror_page, 0},
+    {"set_protect_start_page", a_benchmark_set_protect_start_page, 0},
+    {"get_protect_start_page", a_benchmark_get_protect_start_page, 0},
+    {"set_access_read_protection", a_benchmark_set_access, NTAG21X_ACCESS_READ_PROTECTION},
+    {"get_access_read_protection", a_benchmark_get_access, NTAG21X_ACCESS_READ_PROTECTION},
+    {"set_access_user_conf_protection", a_benchmark_set_access, NTAG21X_ACCESS_USER_CONF_PROTECTION},
+    {"get_access_user_conf_protection", a_benchmark_get_access, NTAG21X_ACCESS_USER_CONF_PROTECTION},
+    {"set_access_nfc_counter", a_benchmark_set_access, NTAG21X_ACCESS_NFC_COUNTER},
+    {"get_access_nfc_counter", a_benchmark_get_access, NTAG21X_ACCESS_NFC_COUNTER},
+    {"set_access_nfc_counter_password_protection", a_benchmark_set_access, NTAG21X_ACCESS_NFC_COUNTER_PASSWORD_PROTECTION},
+    {"get_access_nfc_counter_password_protection", a_benchmark_get_access, NTAG21X_ACCESS_NFC_COUNTER_PASSWORD_PROTECTION},
+    {"set_authenticate_limitation", a_benchmark_set_authenticate_limitation, 0},
+    {"get_authenticate_limitation", a_benchmark_get_authenticate_limitation, 0},
+};
+
+/**
+ * @brief benchmark type name list
+ */
+static const char *const gsc_type_name[] = {"ntag213", "ntag215", "ntag216"};
+
+/**
+ * @brief     run and print one operation
+ * @param[in] *type type name
+ * @param[in] *name operation name
+ * @param[in] *run pointer to an operation
+ * @param[in] arg operation argument
+ * @param[in] iterations iterations
+ * @return    status code
+ *            - 0 success
+ *            - 1 operation failed
+ * @note      ns_per_op is host cpu time, air_ns_per_op is the emulated rf and eeprom time
+ */
+static uint8_t a_benchmark_run(const char *type, const char *name, uint8_t (*run)(uint8_t arg),
+                               uint8_t arg, uint32_t iterations)
+{
+    ntag21x_emulator_statistics_t statistics;
+    uint64_t start;
+    uint64_t ns;
+    uint32_t i;
+    uint8_t res;
+    double ns_per_op;
+
+    res = run(arg);
+    if (res != 0)
+    {
+        fprintf(stderr, "benchmark: %s %s failed %d.\n", type, name, res);
+
+        return 1;
+    }
+    (void)ntag21x_emulator_clear_statistics();
+    start = a_benchmark_now_ns();
+    for (i = 0; i < iterations; i++)
+    {
+        (void)run(arg);
+    }
+    ns = a_benchmark_now_ns() - start;
+    (void)ntag21x_emulator_get_statistics(&statistics);
+    ns_per_op = (double)ns / iterations;
+    if (gs_format == BENCHMARK_FORMAT_JSON)
+    {
+        printf("%s\n    {\"type\": \"%s\", \"operation\": \"%s\", \"iterations\": %u, "
+               "\"ns_per_op\": %.1f, \"ops_per_sec\": %.0f, \"air_ns_per_op\": %.0f}",
+               (gs_results != 0) ? "," : "", type, name, iterations, ns_per_op,
+               1000000000.0 / (ns_per_op > 0 ? ns_per_op : 1), (double)statistics.elapsed_ns / iterations);
+    }
+    else
+    {
+        printf("%s,%s,%u,%.1f,%.0f,%.0f\n", type, name, iterations, ns_per_op,
+               1000000000.0 / (ns_per_op > 0 ? ns_per_op : 1), (double)statistics.elapsed_ns / iterations);
+    }
+    gs_results++;
+
+    return 0;
+}
+
+/**
+ * @brief     main function
+ * @param[in] argc arg numbers
+ * @param[in] **argv arg address
+ * @return    status code
+ *             - 0 success
+ *             - 1 run failed
+ * @note      benchmark [csv|json] [iterations]
+ */
+int main(int argc, char **argv)
+{
+    uint8_t uid[7] = {0x04, 0x4E, 0x54, 0x41, 0x47, 0x32, 0x31};
+    uint8_t end_page;
+    uint8_t arg;
+    uint8_t t;
+    uint8_t n;
+    uint32_t iterations;
+    size_t k;
+    char name[32];
+
+    gs_format = ((argc > 1) && (strcmp(argv[1], "json") == 0)) ? BENCHMARK_FORMAT_JSON : BENCHMARK_FORMAT_CSV;
+    iterations = (argc > 2) ? (uint32_t)strtoul(argv[2], NULL, 0) : 20000;
+    if (iterations == 0)
+    {
+        iterations = 1;
+    }
+    if (gs_format == BENCHMARK_FORMAT_JSON)
+    {
+        printf("{\n  \"driver_version\": %d,\n  \"crc_backend\": %d,\n  \"results\": [", 1000, NTAG21X_CRC_BACKEND);
+    }
+    else
+    {
+        printf("type,operation,iterations,ns_per_op,ops_per_sec,air_ns_per_op\n");
+    }
+
+    for (t = 0; t < 3; t++)
+    {
+        /* fresh tag and handle for every layout */
+        if (ntag21x_emulator_init((ntag21x_emulator_type_t)t, uid) != 0)
+        {
+            return 1;
+        }
+        DRIVER_NTAG21X_LINK_INIT(&gs_handle, ntag21x_handle_t);
+        DRIVER_NTAG21X_LINK_CONTACTLESS_INIT(&gs_handle, ntag21x_emulator_contactless_init);
+        DRIVER_NTAG21X_LINK_CONTACTLESS_DEINIT(&gs_handle, ntag21x_emulator_contactless_deinit);
+        DRIVER_NTAG21X_LINK_CONTACTLESS_TRANSCEIVER(&gs_handle, ntag21x_emulator_contactless_transceiver);
+        DRIVER_NTAG21X_LINK_DELAY_MS(&gs_handle, ntag21x_emulator_delay_ms);
+        DRIVER_NTAG21X_LINK_DEBUG_PRINT(&gs_handle, a_benchmark_debug_print);
+        if ((ntag21x_init(&gs_handle) != 0) || (a_benchmark_select() != 0) ||
+            (ntag21x_set_access(&gs_handle, NTAG21X_ACCESS_NFC_COUNTER, NTAG21X_BOOL_TRUE) != 0))
+        {
+            fprintf(stderr, "benchmark: %s init failed.\n", gsc_type_name[t]);
+
+            return 1;
+        }
+        end_page = (t == 0) ? 0x2C : ((t == 1) ? 0x86 : 0xE6);
+
+        for (k = 0; k < sizeof(gsc_operations) / sizeof(gsc_operations[0]); k++)
+        {
+            arg = gsc_operations[k].arg;
+            if (arg == 0xFF)
+            {
+                arg = (gsc_operations[k].run == a_benchmark_dump_memory) ? end_page : (uint8_t)(end_page - 5);
+            }
+            if (a_benchmark_run(gsc_type_name[t], gsc_operations[k].name, gsc_operations[k].run, arg, iterations) != 0)
+            {
+                return 1;
+            }
+        }
+
+        /* every fast read range size the reader frame allows */
+        for (n = 1; n <= 15; n++)
+        {
+            (void)snprintf(name, sizeof(name), "fast_read_page_%d", n);
+            if (a_benchmark_run(gsc_type_name[t], name, a_benchmark_fast_read_page, n, iterations) != 0)
+            {
+                return 1;
+            }
+        }
+        (void)ntag21x_deinit(&gs_handle);
+    }
+
+    if (gs_format == BENCHMARK_FORMAT_JSON)
+    {
+        printf("\n  ]\n}\n");
+    }
+
+    return 0;
+}
@@ -0,0 +1,606 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file      cpp_benchmark.cpp
+ * @brief     driver c++ benchmark source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_ntag21x.hpp"
+#include "driver_ntag21x_emulator.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+/**
+ * @brief benchmark output format enumeration definition
+ */
+typedef enum
+{
+    BENCHMARK_FORMAT_CSV  = 0x00,        /**< csv */
+    BENCHMARK_FORMAT_JSON = 0x01,        /**< json */
+} benchmark_format_t;
+
+/**
+ * @brief benchmark operation structure definition
+ */
+typedef struct benchmark_operation_s
+{
+    const char *name;                    /**< operation name */
+    uint8_t (*c_run)(uint8_t arg);       /**< operation through the c function */
+    uint8_t (*cpp_run)(uint8_t arg);     /**< operation through the c++ wrapper */
+    uint8_t arg;                         /**< operation argument */
+} benchmark_operation_t;
+
+static ntag21x::reader *gs_reader;                  /**< ntag21x reader */
+static ntag21x::session *gs_session;                /**< session of the emulated tag */
+static uint8_t gs_buf[NTAG21X_PAGE_CACHE_MAX_LEN];  /**< data buffer */
+static benchmark_format_t gs_format;                /**< output format */
+static uint32_t gs_results;                         /**< printed results */
+
+/**
+ * @brief  get the monotonic time
+ * @return time in ns
+ * @note   none
+ */
+static uint64_t a_benchmark_now_ns(void)
+{
+    return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+           std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/**
+ * @brief     debug print
+ * @param[in] fmt format data
+ * @note      driver messages are dropped so that only results are printed
+ */
+static void a_benchmark_debug_print(const char *const fmt, ...)
+{
+    (void)fmt;
+}
+
+/**
+ * @brief  convert a result
+ * @return status code of the c function
+ * @note   none
+ */
+template <class T>
+static uint8_t a_benchmark_status(const ntag21x::result<T> &res)
+{
+    return res.has_value() ? 0 : static_cast<uint8_t>(res.error());
+}
+
+/**
+ * @brief     benchmark select sequence
+ * @param[in] arg not used
+ * @return    status code of the operation
+ * @note      none
+ */
+static uint8_t a_benchmark_c_select(uint8_t arg)
+{
+    ntag21x_handle_t *handle = gs_reader->native();
+    ntag21x_capability_container_t container;
+    ntag21x_type_t type;
+    uint8_t id[8];
+
+    (void)arg;
+
+    (void)ntag21x_halt(handle);
+    if ((ntag21x_wake_up(handle, &type) != 0) ||
+        (ntag21x_anticollision_cl1(handle, id) != 0) ||
+        (ntag21x_select_cl1(handle, id) != 0) ||
+        (ntag21x_anticollision_cl2(handle, id + 4) != 0) ||
+        (ntag21x_select_cl2(handle, id + 4) != 0) ||
+        (ntag21x_get_capability_container(handle, &container) != 0))
+    {
+        return 1;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief     benchmark select sequence
+ * @param[in] arg not used
+ * @return    status code of the operation
+ * @note      none
+ */
+static uint8_t a_benchmark_cpp_select(uint8_t arg)
+{
+    (void)arg;
+
+    (void)gs_session->halt();
+    auto res = gs_reader->select();
+    if (!res)
+    {
+        return static_cast<uint8_t>(res.error());
+    }
+    *gs_session = std::move(*res);
+
+    return 0;
+}
+
+/**
+ * @brief     benchmark read page
+ * @param[in] arg page
+ * @return    status code of the operation
+ * @note      none
+ */
+static uint8_t a_benchmark_c_read_page(uint8_t arg)
+{
+    return ntag21x_read_page(gs_reader->native(), arg, gs_buf);
+}
+
+/**
+ * @brief     benchmark read page
+ * @param[in] arg page
+ * @return    status code of the operation
+ * @note      none
+ */
+static uint8_t a_benchmark_cpp_read_page(uint8_t arg)
+{
+    return a_benchmark_status(gs_session->read_page(arg, std::span(gs_buf).first<4>()));
+}
+
+/**
+ * @brief     benchmark read four pages
+ * @param[in] arg start page
+ * @return    status code of the operation
+ * @note      none
+ */
+static uint8_t a_benchmark_c_read_four_pages(uint8_t arg)
+{
+    return ntag21x_read_four_pages(gs_reader->native(), arg, gs_buf);
+}
+
+/**
+ * @brief     benchmark read four pages
+ * @param[in] arg start page
+ * @return    status code of the operation
+ * @note      none
+ */
+static uint8_t a_benchmark_cpp_read_four_pages(uint8_t arg)
+{
+    return a_benchmark_status(gs_session->read_four_pages(arg, std::span(gs_buf).first<16>()));
+}
+
+/**
+ * @brief     benchmark dump memory
+ * @param[in] arg last page
+ * @return    status code of the operation
+ * @note      none
+ */
+static uint8_t a_benchmark_c_read(uint8_t arg)
+{
+    uint16_t len = sizeof(gs_buf);
+
+    return ntag21x_dump_memory(gs_reader->native(), 0, arg, gs_buf, &len);
+}
+
+/**
+ * @brief     benchmark dump memory
+ * @param[in] arg last page
+ * @return    status code of the operation
+ * @note      none
+ */
+static uint8_t a_benchmark_cpp_read(uint8_t arg)
+{
+    return a_benchmark_status(gs_session->read(0, arg, gs_buf));
+}
+
+/**
+ * @brief     benchmark write page
+ * @param[in] arg page
+ * @return    status code of the operation
+ * @note      none
+ */
+static uint8_t a_benchmark_c_write_page(uint8_t arg)
+{
+    uint8_t data[4] = {0x12, 0x34, 0x56, 0x78};
+
+    return ntag21x_write_page(gs_reader->native(), arg, data);
+}
+
+/**
+ * @brief     benchmark write page
+ * @param[in] arg page
+ * @return    status code of the operation
+ * @note      none
+ */
+static uint8_t a_benchmark_cpp_write_page(uint8_t arg)
+{
+    const uint8_t data[4] = {0x12, 0x34, 0x56, 0x78};
+
+    return a_benchmark_status(gs_session->write_page(arg, data));
+}
+
+/**
+ * @brief     benchmark authenticate
+ * @param[in] arg not used
+ * @return    status code of the operation
+ * @note      none
+ */
+static uint8_t a_benchmark_c_authenticate(uint8_t arg)
+{
+    uint8_t pwd[4] = {0xFF, 0xFF, 0xFF, 0xFF};
+    uint8_t pack[2] = {0x00, 0x00};
+
+    (void)arg;
+
+    return ntag21x_authenticate(gs_reader->native(), pwd, pack);
+}
+
+/**
+ * @brief     benchmark authenticate
+ * @param[in] arg not used
+ * @return    status code of the operation
+ * @note      none
+ */
+static uint8_t a_benchmark_cpp_authenticate(uint8_t arg)
+{
+    const uint8_t pwd[4] = {0xFF, 0xFF, 0xFF, 0xFF};
+    const uint8_t pack[2] = {0x00, 0x00};
+
+    (void)arg;
+
+    return a_benchmark_status(gs_session->authenticate(pwd, pack));
+}
+
+/**
+ * @brief     benchmark get version
+ * @param[in] arg not used
+ * @return    status code of the operation
+ * @note      none
+ */
+static uint8_t a_benchmark_c_get_version(uint8_t arg)
+{
+    ntag21x_version_t version;
+
+    (void)arg;
+
+    return ntag21x_get_version(gs_reader->native(), &version);
+}
+
+/**
+ * @brief     benchmark get version
+ * @param[in] arg not used
+ * @return    status code of the operation
+ * @note      none
+ */
+static uint8_t a_benchmark_cpp_get_version(uint8_t arg)
+{
+    (void)arg;
+
+    return a_benchmark_status(gs_session->version());
+}
+
+/**
+ * @brief     benchmark read counter
+ * @param[in] arg not used
+ * @return    status code of the operation
+ * @note      none
+ */
+static uint8_t a_benchmark_c_read_counter(uint8_t arg)
+{
+    uint32_t cnt;
+
+    (void)arg;
+
+    return ntag21x_read_counter(gs_reader->native(), &cnt);
+}
+
+/**
+ * @brief     benchmark read counter
+ * @param[in] arg not used
+ * @return    status code of the operation
+ * @note      none
+ */
+static uint8_t a_benchmark_cpp_read_counter(uint8_t arg)
+{
+    (void)arg;
+
+    return a_benchmark_status(gs_session->read_counter());
+}
+
+/**
+ * @brief     benchmark read signature
+ * @param[in] arg not used
+ * @return    status code of the operation
+ * @note      none
+ */
+static uint8_t a_benchmark_c_read_signature(uint8_t arg)
+{
+    (void)arg;
+
+    return ntag21x_read_signature(gs_reader->native(), gs_buf);
+}
+
+/**
+ * @brief     benchmark read signature
+ * @param[in] arg not used
+ * @return    status code of the operation
+ * @note      none
+ */
+static uint8_t a_benchmark_cpp_read_signature(uint8_t arg)
+{
+    (void)arg;
+
+    return a_benchmark_status(gs_session->read_signature(std::span(gs_buf).first<32>()));
+}
+
+/**
+ * @brief     benchmark get serial number
+ * @param[in] arg not used
+ * @return    status code of the operation
+ * @note      none
+ */
+static uint8_t a_benchmark_c_get_serial_number(uint8_t arg)
+{
+    (void)arg;
+
+    return ntag21x_get_serial_number(gs_reader->native(), gs_buf);
+}
+
+/**
+ * @brief     benchmark get serial number
+ * @param[in] arg not used
+ * @return    status code of the operation
+ * @note      none
+ */
+static uint8_t a_benchmark_cpp_get_serial_number(uint8_t arg)
+{
+    (void)arg;
+
+    return a_benchmark_status(gs_session->serial_number(std::span(gs_buf).first<7>()));
+}
+
+/**
+ * @brief     benchmark get capability container
+ * @param[in] arg not used
+ * @return    status code of the operation
+ * @note      none
+ */
+static uint8_t a_benchmark_c_get_capability_container(uint8_t arg)
+{
+    ntag21x_capability_container_t container;
+
+    (void)arg;
+
+    return ntag21x_get_capability_container(gs_reader->native(), &container);
+}
+
+/**
+ * @brief     benchmark get capability container
+ * @param[in] arg not used
+ * @return    status code of the operation
+ * @note      none
+ */
+static uint8_t a_benchmark_cpp_get_capability_container(uint8_t arg)
+{
+    (void)arg;
+
+    return a_benchmark_status(gs_session->capability_container());
+}
+
+/**
+ * @brief benchmark operation list
+ * @note  arg 0xFF of write and dump operations is replaced by the type dependent page
+ */
+static const benchmark_operation_t gsc_operations[] =
+{
+    {"select", a_benchmark_c_select, a_benchmark_cpp_select, 0},
+    {"read_page", a_benchmark_c_read_page, a_benchmark_cpp_read_page, 4},
+    {"read_four_pages", a_benchmark_c_read_four_pages, a_benchmark_cpp_read_four_pages, 4},
+    {"dump_memory", a_benchmark_c_read, a_benchmark_cpp_read, 0xFF},
+    {"write_page", a_benchmark_c_write_page, a_benchmark_cpp_write_page, 0xFF},
+    {"authenticate", a_benchmark_c_authenticate, a_benchmark_cpp_authenticate, 0},
+    {"get_version", a_benchmark_c_get_version, a_benchmark_cpp_get_version, 0},
+    {"read_counter", a_benchmark_c_read_counter, a_benchmark_cpp_read_counter, 0},
+    {"read_signature", a_benchmark_c_read_signature, a_benchmark_cpp_read_signature, 0},
+    {"get_serial_number", a_benchmark_c_get_serial_number, a_benchmark_cpp_get_serial_number, 0},
+    {"get_capability_container", a_benchmark_c_get_capability_container, a_benchmark_cpp_get_capability_container, 0},
+};
+
+/**
+ * @brief benchmark type name list
+ */
+static const char *const gsc_type_name[] = {"ntag213", "ntag215", "ntag216"};
+
+/**
+ * @brief     time one operation
+ * @param[in] *run pointer to an operation
+ * @param[in] arg operation argument
+ * @param[in] iterations iterations
+ * @return    elapsed time in ns
+ * @note      none
+ */
+static uint64_t a_benchmark_time(uint8_t (*run)(uint8_t arg), uint8_t arg, uint32_t iterations)
+{
+    uint64_t start;
+    uint32_t i;
+
+    start = a_benchmark_now_ns();
+    for (i = 0; i < iterations; i++)
+    {
+        (void)run(arg);
+    }
+
+    return a_benchmark_now_ns() - start;
+}
+
+/**
+ * @brief     run and print one operation
+ * @param[in] *type type name
+ * @param[in] *operation pointer to an operation
+ * @param[in] arg operation argument
+ * @param[in] iterations iterations
+ * @return    status code
+ *            - 0 success
+ *            - 1 operation failed
+ * @note      c and c++ rounds alternate and the fastest round of each is kept,
+ *            so that frequency and cache drift hit both sides alike
+ */
+static uint8_t a_benchmark_run(const char *type, const benchmark_operation_t *operation,
+                               uint8_t arg, uint32_t iterations)
+{
+    uint64_t c_ns = UINT64_MAX;
+    uint64_t cpp_ns = UINT64_MAX;
+    uint64_t ns;
+    uint8_t res;
+    uint8_t round;
+    double c_ns_per_op;
+    double cpp_ns_per_op;
+    double overhead;
+
+    res = operation->c_run(arg);
+    if (res == 0)
+    {
+        res = operation->cpp_run(arg);
+    }
+    if (res != 0)
+    {
+        fprintf(stderr, "cpp_benchmark: %s %s failed %d.\n", type, operation->name, res);
+
+        return 1;
+    }
+    for (round = 0; round < 5; round++)
+    {
+        ns = a_benchmark_time(operation->c_run, arg, iterations);
+        c_ns = (ns < c_ns) ? ns : c_ns;
+        ns = a_benchmark_time(operation->cpp_run, arg, iterations);
+        cpp_ns = (ns < cpp_ns) ? ns : cpp_ns;
+    }
+    c_ns_per_op = (double)c_ns / iterations;
+    cpp_ns_per_op = (double)cpp_ns / iterations;
+    overhead = (c_ns_per_op > 0) ? (cpp_ns_per_op / c_ns_per_op - 1.0) * 100.0 : 0.0;
+    if (gs_format == BENCHMARK_FORMAT_JSON)
+    {
+        printf("%s\n    {\"type\": \"%s\", \"operation\": \"%s\", \"iterations\": %u, "
+               "\"c_ns_per_op\": %.1f, \"cpp_ns_per_op\": %.1f, \"overhead_percent\": %.1f}",
+               (gs_results != 0) ? "," : "", type, operation->name, iterations, c_ns_per_op,
+               cpp_ns_per_op, overhead);
+    }
+    else
+    {
+        printf("%s,%s,%u,%.1f,%.1f,%.1f\n", type, operation->name, iterations, c_ns_per_op,
+               cpp_ns_per_op, overhead);
+    }
+    gs_results++;
+
+    return 0;
+}
+
+/**
+ * @brief     main function
+ * @param[in] argc arg numbers
+ * @param[in] **argv arg address
+ * @return    status code
+ *             - 0 success
+ *             - 1 run failed
+ * @note      cpp_benchmark [csv|json] [iterations]
+ */
+int main(int argc, char **argv)
+{
+    uint8_t uid[7] = {0x04, 0x4E, 0x54, 0x41, 0x47, 0x32, 0x31};
+    uint8_t end_page;
+    uint8_t arg;
+    uint8_t t;
+    uint32_t iterations;
+    size_t k;
+
+    gs_format = ((argc > 1) && (strcmp(argv[1], "json") == 0)) ? BENCHMARK_FORMAT_JSON : BENCHMARK_FORMAT_CSV;
+    iterations = (argc > 2) ? (uint32_t)strtoul(argv[2], NULL, 0) : 20000;
+    if (iterations == 0)
+    {
+        iterations = 1;
+    }
+    if (gs_format == BENCHMARK_FORMAT_JSON)
+    {
+        printf("{\n  \"driver_version\": %d,\n  \"results\": [", 1000);
+    }
+    else
+    {
+        printf("type,operation,iterations,c_ns_per_op,cpp_ns_per_op,overhead_percent\n");
+    }
+
+    for (t = 0; t < 3; t++)
+    {
+        /* fresh tag and reader for every layout */
+        if (ntag21x_emulator_init((ntag21x_emulator_type_t)t, uid) != 0)
+        {
+            return 1;
+        }
+        ntag21x::reader reader;
+        DRIVER_NTAG21X_LINK_CONTACTLESS_INIT(reader.native(), ntag21x_emulator_contactless_init);
+        DRIVER_NTAG21X_LINK_CONTACTLESS_DEINIT(reader.native(), ntag21x_emulator_contactless_deinit);
+        DRIVER_NTAG21X_LINK_CONTACTLESS_TRANSCEIVER(reader.native(), ntag21x_emulator_contactless_transceiver);
+        DRIVER_NTAG21X_LINK_DELAY_MS(reader.native(), ntag21x_emulator_delay_ms);
+        DRIVER_NTAG21X_LINK_DEBUG_PRINT(reader.native(), a_benchmark_debug_print);
+        if (!reader.open())
+        {
+            fprintf(stderr, "cpp_benchmark: %s init failed.\n", gsc_type_name[t]);
+
+            return 1;
+        }
+        auto session = reader.select();
+        if (!session || !session->capability_container() ||
+            (ntag21x_set_access(reader.native(), NTAG21X_ACCESS_NFC_COUNTER, NTAG21X_BOOL_TRUE) != 0))
+        {
+            fprintf(stderr, "cpp_benchmark: %s select failed.\n", gsc_type_name[t]);
+
+            return 1;
+        }
+        gs_reader = &reader;
+        gs_session = &*session;
+        end_page = (t == 0) ? 0x2C : ((t == 1) ? 0x86 : 0xE6);
+
+        for (k = 0; k < sizeof(gsc_operations) / sizeof(gsc_operations[0]); k++)
+        {
+            arg = gsc_operations[k].arg;
+            if (arg == 0xFF)
+            {
+                arg = (gsc_operations[k].c_run == a_benchmark_c_read) ? end_page : (uint8_t)(end_page - 5);
+            }
+            if (a_benchmark_run(gsc_type_name[t], &gsc_operations[k], arg, iterations) != 0)
+            {
+                return 1;
+            }
+        }
+    }
+
+    if (gs_format == BENCHMARK_FORMAT_JSON)
+    {
+        printf("\n  ]\n}\n");
+    }
+
+    return 0;
+}
@@ -0,0 +1,176 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file      crc_benchmark.c
+ * @brief     crc benchmark source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include "driver_ntag21x.h"
+#include <stdlib.h>
+#include <time.h>
+
+/**
+ * @brief benchmark backend name definition
+ */
+#if (NTAG21X_CRC_BACKEND == NTAG21X_CRC_BACKEND_BITWISE)
+    #define CRC_BENCHMARK_BACKEND_NAME        "bitwise"
+#elif (NTAG21X_CRC_BACKEND == NTAG21X_CRC_BACKEND_TABLE)
+    #define CRC_BENCHMARK_BACKEND_NAME        "table"
+#elif (NTAG21X_CRC_BACKEND == NTAG21X_CRC_BACKEND_SLICE_BY_4)
+    #define CRC_BENCHMARK_BACKEND_NAME        "slice_by_4"
+#else
+    #define CRC_BENCHMARK_BACKEND_NAME        "slice_by_8"
+#endif
+
+/**
+ * @brief benchmark frame length definition
+ * @note  request frame, read response, 15 pages fast read response and a whole ntag216
+ */
+static const uint16_t gsc_frame_len[] = {3, 18, 62, 66, 926};
+
+/**
+ * @brief     reference crc
+ * @param[in] *p pointer to a data buffer
+ * @param[in] len data length
+ * @return    crc
+ * @note      plain bitwise crc_a
+ */
+static uint16_t a_crc_reference(uint8_t *p, uint16_t len)
+{
+    uint16_t crc = NTAG21X_ISO14443A_CRC_INIT;
+    uint16_t i;
+    uint8_t j;
+
+    for (i = 0; i < len; i++)
+    {
+        crc ^= p[i];
+        for (j = 0; j < 8; j++)
+        {
+            crc = (crc & 1) ? (uint16_t)((crc >> 1) ^ 0x8408) : (uint16_t)(crc >> 1);
+        }
+    }
+
+    return crc;
+}
+
+/**
+ * @brief  get the monotonic time
+ * @return time in ns
+ * @note   none
+ */
+static uint64_t a_crc_now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ * @brief     main function
+ * @param[in] argc arg numbers
+ * @param[in] **argv arg address
+ * @return    status code
+ *             - 0 success
+ *             - 1 check failed
+ * @note      crc_benchmark [iterations]
+ */
+int main(int argc, char **argv)
+{
+    uint8_t buf[926];
+    uint32_t iterations;
+    uint32_t i;
+    uint16_t n;
+    uint16_t k;
+    uint16_t crc;
+    uint16_t split;
+    volatile uint16_t sink;
+    uint64_t start;
+    uint64_t ns;
+
+    iterations = (argc > 1) ? (uint32_t)strtoul(argv[1], NULL, 0) : 200000;
+    if (iterations == 0)
+    {
+        iterations = 1;
+    }
+    for (i = 0; i < sizeof(buf); i++)
+    {
+        buf[i] = (uint8_t)(i * 37 + 11);
+    }
+
+    /* check one shot and streaming updates against the reference */
+    for (n = 1; n <= sizeof(buf); n++)
+    {
+        crc = NTAG21X_ISO14443A_CRC_INIT;
+        (void)ntag21x_iso14443a_crc_update(&crc, buf, n);
+        if (crc != a_crc_reference(buf, n))
+        {
+            printf("crc_benchmark: %s check failed at length %d.\n", CRC_BENCHMARK_BACKEND_NAME, n);
+
+            return 1;
+        }
+        split = (uint16_t)(n / 3);
+        crc = NTAG21X_ISO14443A_CRC_INIT;
+        (void)ntag21x_iso14443a_crc_update(&crc, buf, split);
+        (void)ntag21x_iso14443a_crc_update(&crc, buf + split, (uint16_t)(n - split));
+        if (crc != a_crc_reference(buf, n))
+        {
+            printf("crc_benchmark: %s streaming check failed at length %d.\n", CRC_BENCHMARK_BACKEND_NAME, n);
+
+            return 1;
+        }
+    }
+
+    /* time every frame length */
+    printf("backend,length,ns_per_call,mbyte_per_s\n");
+    for (k = 0; k < sizeof(gsc_frame_len) / sizeof(gsc_frame_len[0]); k++)
+    {
+        n = gsc_frame_len[k];
+        start = a_crc_now_ns();
+        for (i = 0; i < iterations; i++)
+        {
+            crc = NTAG21X_ISO14443A_CRC_INIT;
+            buf[0] = (uint8_t)i;
+            (void)ntag21x_iso14443a_crc_update(&crc, buf, n);
+            sink = crc;
+        }
+        ns = a_crc_now_ns() - start;
+        (void)sink;
+        printf("%s,%d,%.2f,%.1f\n", CRC_BENCHMARK_BACKEND_NAME, n,
+               (double)ns / iterations, (double)n * iterations * 1000.0 / (double)(ns ? ns : 1));
+    }
+
+    return 0;
+}
@@ -36,10 +36,44 @@
 
 #include "driver_ntag21x_basic.h"
 #include "driver_ntag21x_card_test.h"
+#include "driver_ntag21x_originality.h"
+#include "driver_ntag21x_kdf.h"
+#include "raspberrypi4b_driver_ntag21x_interface.h"
 #include <getopt.h>
 #include <math.h>
 #include <stdlib.h>
 
+/**
+ * @brief  basic example init with the search clock and interrupt
+ * @return status code
+ *         - 0 success
+ *         - 1 init failed
+ * @note   none
+ */
+static uint8_t a_ntag21x_basic_init(void)
+{
+    uint8_t res;
+
+    /* basic init */
+    res = ntag21x_basic_init();
+    if (res != 0)
+    {
+        return 1;
+    }
+
+    /* link the search clock and interrupt */
+    res = ntag21x_basic_link_search(ntag21x_interface_timestamp_ms, ntag21x_interface_wait_irq);
+    if (res != 0)
+    {
+        ntag21x_interface_debug_print("ntag21x: link search failed.\n");
+        (void)ntag21x_basic_deinit();
+
+        return 1;
+    }
+
+    return 0;
+}
+
 /**
  * @brief     ntag21x full function
  * @param[in] argc arg numbers
@@ -664,12 +698,49 @@ uint8_t ntag21x(uint8_t argc, char **argv)
 
         return 0;
     }
+    else if (strcmp("t_kdf", type) == 0)
+    {
+        uint8_t res;
+
+        /* run the kdf self test */
+        res = ntag21x_kdf_self_test();
+        if (res != 0)
+        {
+            ntag21x_interface_debug_print("ntag21x: kdf self test failed %d.\n", res);
+
+            return 1;
+        }
+
+        /* output */
+        ntag21x_interface_debug_print("ntag21x: kdf self test passed.\n");
+
+        return 0;
+    }
+    else if (strcmp("t_originality", type) == 0)
+    {
+        uint8_t res;
+        static ntag21x_originality_handle_t handle;
+
+        /* run the originality self test */
+        res = ntag21x_originality_self_test(&handle);
+        if (res != 0)
+        {
+            ntag21x_interface_debug_print("ntag21x: originality self test failed %d.\n", res);
+
+            return 1;
+        }
+
+        /* output */
+        ntag21x_interface_debug_print("ntag21x: originality self test passed.\n");
+
+        return 0;
+    }
     else if (strcmp("e_halt", type) == 0)
     {
         uint8_t res;
 
         /* basic init */
-        res = ntag21x_basic_init();
+        res = a_ntag21x_basic_init();
         if (res != 0)
         {
             return 1;
@@ -697,7 +768,7 @@ uint8_t ntag21x(uint8_t argc, char **argv)
         uint8_t res;
 
         /* basic init */
-        res = ntag21x_basic_init();
+        res = a_ntag21x_basic_init();
         if (res != 0)
         {
             return 1;
@@ -729,14 +800,14 @@ uint8_t ntag21x(uint8_t argc, char **argv)
         ntag21x_capability_container_t type_s;
 
         /* basic init */
-        res = ntag21x_basic_init();
+        res = a_ntag21x_basic_init();
         if (res != 0)
         {
             return 1;
         }
 
         /* search */
-        res = ntag21x_basic_search(&type_s, id, 50);
+        res = ntag21x_basic_search(&type_s, id, 10000);
         if (res != 0)
         {
             (void)ntag21x_basic_deinit();
@@ -800,14 +871,14 @@ uint8_t ntag21x(uint8_t argc, char **argv)
         ntag21x_capability_container_t type_s;
 
         /* basic init */
-        res = ntag21x_basic_init();
+        res = a_ntag21x_basic_init();
         if (res != 0)
         {
             return 1;
         }
 
         /* search */
-        res = ntag21x_basic_search(&type_s, id, 50);
+        res = ntag21x_basic_search(&type_s, id, 10000);
         if (res != 0)
         {
             (void)ntag21x_basic_deinit();
@@ -871,14 +942,14 @@ uint8_t ntag21x(uint8_t argc, char **argv)
         ntag21x_capability_container_t type_s;
 
         /* basic init */
-        res = ntag21x_basic_init();
+        res = a_ntag21x_basic_init();
         if (res != 0)
         {
             return 1;
         }
 
         /* search */
-        res = ntag21x_basic_search(&type_s, id, 50);
+        res = ntag21x_basic_search(&type_s, id, 10000);
         if (res != 0)
         {
             (void)ntag21x_basic_deinit();
@@ -941,14 +1012,14 @@ uint8_t ntag21x(uint8_t argc, char **argv)
         ntag21x_capability_container_t type_s;
 
         /* basic init */
-        res = ntag21x_basic_init();
+        res = a_ntag21x_basic_init();
         if (res != 0)
         {
             return 1;
         }
 
         /* search */
-        res = ntag21x_basic_search(&type_s, id, 50);
+        res = ntag21x_basic_search(&type_s, id, 10000);
         if (res != 0)
         {
             (void)ntag21x_basic_deinit();
@@ -1015,14 +1086,14 @@ uint8_t ntag21x(uint8_t argc, char **argv)
         ntag21x_version_t version;
 
         /* basic init */
-        res = ntag21x_basic_init();
+        res = a_ntag21x_basic_init();
         if (res != 0)
         {
             return 1;
         }
 
         /* search */
-        res = ntag21x_basic_search(&type_s, id, 50);
+        res = ntag21x_basic_search(&type_s, id, 10000);
         if (res != 0)
         {
             (void)ntag21x_basic_deinit();
@@ -1087,14 +1158,14 @@ uint8_t ntag21x(uint8_t argc, char **argv)
         uint32_t cnt;
 
         /* basic init */
-        res = ntag21x_basic_init();
+        res = a_ntag21x_basic_init();
         if (res != 0)
         {
             return 1;
         }
 
         /* search */
-        res = ntag21x_basic_search(&type_s, id, 50);
+        res = ntag21x_basic_search(&type_s, id, 10000);
         if (res != 0)
         {
             (void)ntag21x_basic_deinit();
@@ -1152,14 +1223,14 @@ uint8_t ntag21x(uint8_t argc, char **argv)
         uint8_t signature[32];
 
         /* basic init */
-        res = ntag21x_basic_init();
+        res = a_ntag21x_basic_init();
         if (res != 0)
         {
             return 1;
         }
 
         /* search */
-        res = ntag21x_basic_search(&type_s, id, 50);
+        res = ntag21x_basic_search(&type_s, id, 10000);
         if (res != 0)
         {
             (void)ntag21x_basic_deinit();
@@ -1222,14 +1293,14 @@ uint8_t ntag21x(uint8_t argc, char **argv)
         uint8_t number[7];
 
         /* basic init */
-        res = ntag21x_basic_init();
+        res = a_ntag21x_basic_init();
         if (res != 0)
         {
             return 1;
         }
 
         /* search */
-        res = ntag21x_basic_search(&type_s, id, 50);
+        res = ntag21x_basic_search(&type_s, id, 10000);
         if (res != 0)
         {
             (void)ntag21x_basic_deinit();
@@ -1291,14 +1362,14 @@ uint8_t ntag21x(uint8_t argc, char **argv)
         ntag21x_capability_container_t type_s;
 
         /* basic init */
-        res = ntag21x_basic_init();
+        res = a_ntag21x_basic_init();
         if (res != 0)
         {
             return 1;
         }
 
         /* search */
-        res = ntag21x_basic_search(&type_s, id, 50);
+        res = ntag21x_basic_search(&type_s, id, 10000);
         if (res != 0)
         {
             (void)ntag21x_basic_deinit();
@@ -1360,14 +1431,14 @@ uint8_t ntag21x(uint8_t argc, char **argv)
             uint8_t lock_buf[3];
 
             /* basic init */
-            res = ntag21x_basic_init();
+            res = a_ntag21x_basic_init();
             if (res != 0)
             {
                 return 1;
             }
 
             /* search */
-            res = ntag21x_basic_search(&type_s, id, 50);
+            res = ntag21x_basic_search(&type_s, id, 10000);
             if (res != 0)
             {
                 (void)ntag21x_basic_deinit();
@@ -1433,14 +1504,14 @@ uint8_t ntag21x(uint8_t argc, char **argv)
             ntag21x_capability_container_t type_s;
 
             /* basic init */
-            res = ntag21x_basic_init();
+            res = a_ntag21x_basic_init();
             if (res != 0)
             {
                 return 1;
             }
 
             /* search */
-            res = ntag21x_basic_search(&type_s, id, 50);
+            res = ntag21x_basic_search(&type_s, id, 10000);
             if (res != 0)
             {
                 (void)ntag21x_basic_deinit();
@@ -1505,14 +1576,14 @@ uint8_t ntag21x(uint8_t argc, char **argv)
         ntag21x_capability_container_t type_s;
 
         /* basic init */
-        res = ntag21x_basic_init();
+        res = a_ntag21x_basic_init();
         if (res != 0)
         {
             return 1;
         }
 
         /* search */
-        res = ntag21x_basic_search(&type_s, id, 50);
+        res = ntag21x_basic_search(&type_s, id, 10000);
         if (res != 0)
         {
             (void)ntag21x_basic_deinit();
@@ -1566,14 +1637,14 @@ uint8_t ntag21x(uint8_t argc, char **argv)
         ntag21x_capability_container_t type_s;
 
         /* basic init */
-        res = ntag21x_basic_init();
+        res = a_ntag21x_basic_init();
         if (res != 0)
         {
             return 1;
         }
 
         /* search */
-        res = ntag21x_basic_search(&type_s, id, 50);
+        res = ntag21x_basic_search(&type_s, id, 10000);
         if (res != 0)
         {
             (void)ntag21x_basic_deinit();
@@ -1627,14 +1698,14 @@ uint8_t ntag21x(uint8_t argc, char **argv)
         ntag21x_capability_container_t type_s;
 
         /* basic init */
-        res = ntag21x_basic_init();
+        res = a_ntag21x_basic_init();
         if (res != 0)
         {
             return 1;
         }
 
         /* search */
-        res = ntag21x_basic_search(&type_s, id, 50);
+        res = ntag21x_basic_search(&type_s, id, 10000);
         if (res != 0)
         {
             (void)ntag21x_basic_deinit();
@@ -1690,14 +1761,14 @@ uint8_t ntag21x(uint8_t argc, char **argv)
         ntag21x_capability_container_t type_s;
 
         /* basic init */
-        res = ntag21x_basic_init();
+        res = a_ntag21x_basic_init();
         if (res != 0)
         {
             return 1;
         }
 
         /* search */
-        res = ntag21x_basic_search(&type_s, id, 50);
+        res = ntag21x_basic_search(&type_s, id, 10000);
         if (res != 0)
         {
             (void)ntag21x_basic_deinit();
@@ -1752,14 +1823,14 @@ uint8_t ntag21x(uint8_t argc, char **argv)
         ntag21x_capability_container_t type_s;
 
         /* basic init */
-        res = ntag21x_basic_init();
+        res = a_ntag21x_basic_init();
         if (res != 0)
         {
             return 1;
         }
 
         /* search */
-        res = ntag21x_basic_search(&type_s, id, 50);
+        res = ntag21x_basic_search(&type_s, id, 10000);
         if (res != 0)
         {
             (void)ntag21x_basic_deinit();
@@ -1813,14 +1884,14 @@ uint8_t ntag21x(uint8_t argc, char **argv)
         ntag21x_capability_container_t type_s;
 
         /* basic init */
-        res = ntag21x_basic_init();
+        res = a_ntag21x_basic_init();
         if (res != 0)
         {
             return 1;
         }
 
         /* search */
-        res = ntag21x_basic_search(&type_s, id, 50);
+        res = ntag21x_basic_search(&type_s, id, 10000);
         if (res != 0)
         {
             (void)ntag21x_basic_deinit();
@@ -1879,6 +1950,8 @@ uint8_t ntag21x(uint8_t argc, char **argv)
         ntag21x_interface_debug_print("  ntag21x (-h | --help)\n");
         ntag21x_interface_debug_print("  ntag21x (-p | --port)\n");
         ntag21x_interface_debug_print("  ntag21x (-t card | --test=card)\n");
+        ntag21x_interface_debug_print("  ntag21x (-t kdf | --test=kdf)\n");
+        ntag21x_interface_debug_print("  ntag21x (-t originality | --test=originality)\n");
         ntag21x_interface_debug_print("  ntag21x (-e halt | --example=halt)\n");
         ntag21x_interface_debug_print("  ntag21x (-e wake-up | --example=wake-up)\n");
         ntag21x_interface_debug_print("  ntag21x (-e read | --example=read) [--page=<addr>]\n");
@@ -1932,7 +2005,8 @@ uint8_t ntag21x(uint8_t argc, char **argv)
         ntag21x_interface_debug_print("      --pwd=<password>           Set the password authentication and it is hexadecimal.([default: 0xFFFFFFFF])\n");
         ntag21x_interface_debug_print("      --start=<taddr>            Set read pages start address.([default: 0])\n");
         ntag21x_interface_debug_print("      --stop=<paddr>             Set read pages stop address.([default: 3])\n");
-        ntag21x_interface_debug_print("  -t <card>, --test=<card>       Run the driver test.\n");
+        ntag21x_interface_debug_print("  -t <card | kdf | originality>, --test=<card | kdf | originality>\n");
+        ntag21x_interface_debug_print("                                 Run the driver test.\n");
 
         return 0;
     }
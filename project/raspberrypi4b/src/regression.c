@@ -0,0 +1,1227 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file      regression.c
+ * @brief     driver regression source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_ntag21x.h"
+#include "driver_ntag21x_async.h"
+#include "driver_ntag21x_inventory.h"
+#include "driver_ntag21x_kdf.h"
+#include "driver_ntag21x_ndef.h"
+#include "driver_ntag21x_originality.h"
+#include "driver_ntag21x_poll.h"
+#include "driver_ntag21x_trace.h"
+#include "driver_ntag21x_emulator.h"
+#include <stdio.h>
+#include <string.h>
+
+/**
+ * @brief regression case structure definition
+ */
+typedef struct regression_case_s
+{
+    const char *name;              /**< case name */
+    uint8_t (*run)(void);          /**< case, 0 means passed */
+} regression_case_t;
+
+static const uint8_t gsc_uid[7] = {0x04, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06};        /**< uid of the emulated tag */
+static ntag21x_handle_t gs_handle;                                                  /**< ntag21x handle */
+static uint8_t gs_buf[1024];                                                        /**< read buffer */
+static uint8_t gs_image[1024];                                                      /**< image buffer */
+static uint8_t gs_log[8192];                                                        /**< trace log */
+static uint32_t gs_clock_us;                                                        /**< trace clock */
+static uint32_t gs_processed;                                                       /**< inventory process calls */
+static volatile uint8_t gs_done;                                                    /**< async completion flag */
+static uint8_t gs_res;                                                              /**< async completion result */
+static uint16_t gs_num;                                                             /**< queue entries run */
+
+/**
+ * @brief     debug print
+ * @param[in] fmt format data
+ * @note      driver messages are dropped, the failed checks are printed by the cases
+ */
+static void a_regression_debug_print(const char *const fmt, ...)
+{
+    (void)fmt;
+}
+
+/**
+ * @brief     check a condition
+ * @param[in] ok condition
+ * @param[in] *what pointer to a check name
+ * @return    1 if the check failed, otherwise 0
+ * @note      none
+ */
+static uint8_t a_regression_expect(uint8_t ok, const char *what)
+{
+    if (ok == 0)
+    {
+        printf("regression:   %s failed.\n", what);
+
+        return 1;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief  get the emulated frame number
+ * @return frames received by the emulated tags
+ * @note   none
+ */
+static uint32_t a_regression_frames(void)
+{
+    ntag21x_emulator_statistics_t statistics;
+
+    (void)ntag21x_emulator_get_statistics(&statistics);
+
+    return statistics.frames;
+}
+
+/**
+ * @brief  get the emulated time
+ * @return time in ms
+ * @note   the poll clock follows the air time of the emulator
+ */
+static uint32_t a_regression_timestamp_ms(void)
+{
+    ntag21x_emulator_statistics_t statistics;
+
+    (void)ntag21x_emulator_get_statistics(&statistics);
+
+    return (uint32_t)(statistics.elapsed_ns / 1000000ULL);
+}
+
+/**
+ * @brief  get the trace time
+ * @return time in us
+ * @note   a fixed step keeps the log reproducible
+ */
+static uint32_t a_regression_timestamp_us(void)
+{
+    gs_clock_us += 7;
+
+    return gs_clock_us;
+}
+
+/**
+ * @brief  link the handle to the emulated tag
+ * @return none
+ * @note   none
+ */
+static void a_regression_link(void)
+{
+    DRIVER_NTAG21X_LINK_INIT(&gs_handle, ntag21x_handle_t);
+    DRIVER_NTAG21X_LINK_CONTACTLESS_INIT(&gs_handle, ntag21x_emulator_contactless_init);
+    DRIVER_NTAG21X_LINK_CONTACTLESS_DEINIT(&gs_handle, ntag21x_emulator_contactless_deinit);
+    DRIVER_NTAG21X_LINK_CONTACTLESS_TRANSCEIVER(&gs_handle, ntag21x_emulator_contactless_transceiver);
+    DRIVER_NTAG21X_LINK_CONTACTLESS_TRANSCEIVER_BITS(&gs_handle, ntag21x_emulator_contactless_transceiver_bits);
+    DRIVER_NTAG21X_LINK_DELAY_MS(&gs_handle, ntag21x_emulator_delay_ms);
+    DRIVER_NTAG21X_LINK_DEBUG_PRINT(&gs_handle, a_regression_debug_print);
+}
+
+/**
+ * @brief      select the emulated tag
+ * @param[out] *container pointer to a capability container buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 select failed
+ * @note       none
+ */
+static uint8_t a_regression_select(ntag21x_capability_container_t *container)
+{
+    ntag21x_type_t type;
+    uint8_t id[4];
+
+    if ((ntag21x_wake_up(&gs_handle, &type) != 0) ||
+        (ntag21x_anticollision_cl1(&gs_handle, id) != 0) ||
+        (ntag21x_select_cl1(&gs_handle, id) != 0) ||
+        (ntag21x_anticollision_cl2(&gs_handle, id) != 0) ||
+        (ntag21x_select_cl2(&gs_handle, id) != 0) ||
+        (ntag21x_get_capability_container(&gs_handle, container) != 0))
+    {
+        return 1;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief      start a fresh emulated tag and select it
+ * @param[in]  type emulated tag type
+ * @param[out] *container pointer to a capability container buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 setup failed
+ * @note       none
+ */
+static uint8_t a_regression_setup(ntag21x_emulator_type_t type, ntag21x_capability_container_t *container)
+{
+    uint8_t uid[7];
+
+    memcpy(uid, gsc_uid, 7);
+    if (ntag21x_emulator_init(type, uid) != 0)
+    {
+        return 1;
+    }
+    a_regression_link();
+    if ((ntag21x_init(&gs_handle) != 0) || (a_regression_select(container) != 0))
+    {
+        printf("regression:   setup failed.\n");
+
+        return 1;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief  halt and select the known tag again
+ * @return status code
+ *         - 0 success
+ *         - 1 reselect failed
+ * @note   none
+ */
+static uint8_t a_regression_reselect(void)
+{
+    uint8_t uid[7];
+
+    memcpy(uid, gsc_uid, 7);
+    (void)ntag21x_halt(&gs_handle);
+
+    return ntag21x_reselect(&gs_handle, uid);
+}
+
+/**
+ * @brief     async completion
+ * @param[in] *handle pointer to an ntag21x async handle structure
+ * @param[in] command finished command
+ * @param[in] res command result
+ * @note      none
+ */
+static void a_regression_async_callback(ntag21x_async_handle_t *handle, ntag21x_async_command_t command, uint8_t res)
+{
+    (void)handle;
+    (void)command;
+    gs_res = res;
+    gs_done = 1;
+}
+
+/**
+ * @brief     queue completion
+ * @param[in] *handle pointer to an ntag21x async handle structure
+ * @param[in] num entries run
+ * @param[in] res result of the last entry
+ * @note      none
+ */
+static void a_regression_queue_callback(ntag21x_async_handle_t *handle, uint16_t num, uint8_t res)
+{
+    (void)handle;
+    gs_num = num;
+    gs_res = res;
+    gs_done = 1;
+}
+
+/**
+ * @brief     process the async handle until the callback runs
+ * @param[in] *handle pointer to an ntag21x async handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 the callback did not run
+ * @note      none
+ */
+static uint8_t a_regression_async_wait(ntag21x_async_handle_t *handle)
+{
+    uint32_t i;
+
+    for (i = 0; (i < 100000) && (gs_done == 0); i++)
+    {
+        (void)ntag21x_async_process(handle);
+    }
+
+    return (gs_done != 0) ? 0 : 1;
+}
+
+/**
+ * @brief     inventory process
+ * @param[in] *ntag pointer to an ntag21x handle structure
+ * @param[in] *uid pointer to the uid of the selected tag
+ * @note      reads page 0 of the selected tag and compares the uid
+ */
+static void a_regression_inventory_process(ntag21x_handle_t *ntag, uint8_t uid[7])
+{
+    uint8_t data[16];
+
+    if ((ntag21x_read_four_pages(ntag, 0x00, data) == 0) && (memcmp(data, uid, 3) == 0))
+    {
+        gs_processed++;
+    }
+}
+
+/**
+ * @brief      derive the password of a tag
+ * @param[in]  *uid pointer to a uid buffer
+ * @param[out] *pwd pointer to a password buffer
+ * @param[out] *pack pointer to a pack buffer
+ * @return     status code
+ *             - 0 success
+ * @note       none
+ */
+static uint8_t a_regression_derive_password(uint8_t uid[7], uint8_t pwd[4], uint8_t pack[2])
+{
+    uint8_t i;
+
+    for (i = 0; i < 4; i++)
+    {
+        pwd[i] = (uint8_t)(uid[i] ^ uid[i + 3] ^ 0x5A);
+    }
+    pack[0] = uid[6];
+    pack[1] = 0xA5;
+
+    return 0;
+}
+
+/**
+ * @brief protect reads and writes of the emulated ntag213 from page 0x10
+ * @note  the password and the pack are derived from the uid
+ */
+static void a_regression_protect(void)
+{
+    uint8_t uid[7];
+    uint8_t pwd[4];
+    uint8_t pack[2];
+    uint8_t page[4];
+
+    memcpy(uid, gsc_uid, 7);
+    (void)a_regression_derive_password(uid, pwd, pack);
+    (void)ntag21x_emulator_read_memory(0x29, page);
+    page[3] = 0x10;
+    (void)ntag21x_emulator_write_memory(0x29, page);
+    (void)ntag21x_emulator_read_memory(0x2A, page);
+    page[0] = 0x80;
+    (void)ntag21x_emulator_write_memory(0x2A, page);
+    (void)ntag21x_emulator_write_memory(0x2B, pwd);
+    page[0] = pack[0];
+    page[1] = pack[1];
+    page[2] = 0x00;
+    page[3] = 0x00;
+    (void)ntag21x_emulator_write_memory(0x2C, page);
+}
+
+/**
+ * @brief  ndef round trip on every layout
+ * @return 0 if passed, otherwise the number of failed checks
+ * @note   the encoded image is written with write_image and read back with read_ndef and ndef_scan
+ */
+static uint8_t a_regression_ndef_round_trip(void)
+{
+    static const char *const mime = "application/octet-stream";
+    ntag21x_capability_container_t container;
+    ntag21x_ndef_encoder_t encoder;
+    ntag21x_ndef_parser_t parser;
+    ntag21x_ndef_record_t record;
+    uint8_t payload[256];
+    uint8_t err;
+    uint8_t t;
+    uint8_t records;
+    uint16_t size;
+    uint16_t len;
+    uint16_t pages;
+    uint16_t message;
+    uint16_t payload_len;
+    uint16_t i;
+
+    err = 0;
+    for (t = 0; t < 3; t++)
+    {
+        if (a_regression_setup((ntag21x_emulator_type_t)t, &container) != 0)
+        {
+            return 1;
+        }
+        err += a_regression_expect(ntag21x_ndef_get_data_area_size(container, &size) == 0, "data area size");
+        payload_len = (uint16_t)((t == 0) ? 64 : 256);
+        for (i = 0; i < payload_len; i++)
+        {
+            payload[i] = (uint8_t)(i * 13 + t);
+        }
+
+        err += a_regression_expect(ntag21x_ndef_encoder_init(&encoder, gs_image, 30) == 1, "unaligned cap refused");
+        err += a_regression_expect(ntag21x_ndef_encoder_init(&encoder, gs_image, size) == 0, "encoder init");
+        err += a_regression_expect(ntag21x_ndef_encoder_add_uri(&encoder, "https://www.libdriver.com") == 0, "add uri");
+        err += a_regression_expect(ntag21x_ndef_encoder_add_text(&encoder, "en", "ntag21x") == 0, "add text");
+        err += a_regression_expect(ntag21x_ndef_encoder_add_mime(&encoder, (char *)mime, payload, payload_len) == 0, "add mime");
+        err += a_regression_expect(ntag21x_ndef_encoder_finish(&encoder, &len, &pages) == 0, "encoder finish");
+        err += a_regression_expect((len % 4 == 0) && (pages * 4 == len) && (len <= size), "padded length");
+        err += a_regression_expect(ntag21x_write_image(&gs_handle, 4, gs_image, len, NTAG21X_WRITE_IMAGE_FLAG_VERIFY) == 0,
+                                   "write image");
+        if (err != 0)
+        {
+            return err;
+        }
+
+        /* read_ndef returns the message without the tlv header */
+        message = (uint16_t)((gs_image[1] == 0xFF) ? 4 : 2);
+        size = (uint16_t)((gs_image[1] == 0xFF) ? ((gs_image[2] << 8) | gs_image[3]) : gs_image[1]);
+        err += a_regression_expect(ntag21x_read_ndef(&gs_handle, gs_buf, sizeof(gs_buf), &len) == 0, "read ndef");
+        err += a_regression_expect((len == size) && (memcmp(gs_buf, gs_image + message, len) == 0), "read ndef message");
+
+        /* the scan parses the records while the data area arrives */
+        err += a_regression_expect(ntag21x_ndef_scan(&gs_handle, gs_buf, sizeof(gs_buf), &parser) == 0, "ndef scan");
+        records = 0;
+        while (ntag21x_ndef_parser_next_record(&parser, &record) == 0)
+        {
+            if (records == 0)
+            {
+                err += a_regression_expect((record.tnf == NTAG21X_NDEF_TNF_WELL_KNOWN) && (record.type_len == 1) &&
+                                           (record.type[0] == 'U') && (record.payload[0] == 0x02) &&
+                                           (record.payload_len == 14) &&
+                                           (memcmp(record.payload + 1, "libdriver.com", 13) == 0), "uri record");
+            }
+            else if (records == 1)
+            {
+                err += a_regression_expect((record.tnf == NTAG21X_NDEF_TNF_WELL_KNOWN) && (record.type[0] == 'T') &&
+                                           (record.payload[0] == 2) && (record.payload_len == 10) &&
+                                           (memcmp(record.payload + 3, "ntag21x", 7) == 0), "text record");
+            }
+            else
+            {
+                err += a_regression_expect((record.tnf == NTAG21X_NDEF_TNF_MEDIA) &&
+                                           (record.type_len == strlen(mime)) &&
+                                           (memcmp(record.type, mime, record.type_len) == 0) &&
+                                           (record.payload_len == payload_len) &&
+                                           (memcmp(record.payload, payload, payload_len) == 0), "mime record");
+            }
+            records++;
+        }
+        err += a_regression_expect(records == 3, "record number");
+        (void)ntag21x_deinit(&gs_handle);
+    }
+
+    return err;
+}
+
+/**
+ * @brief  ndef error paths
+ * @return 0 if passed, otherwise the number of failed checks
+ * @note   none
+ */
+static uint8_t a_regression_ndef_errors(void)
+{
+    static const uint8_t blank[4] = {0x00, 0x00, 0x00, 0x00};
+    static const uint8_t terminator[4] = {0xFE, 0x00, 0x00, 0x00};
+    static const uint8_t overflow[4] = {0x03, 0xFF, 0x10, 0x00};
+    ntag21x_capability_container_t container;
+    ntag21x_ndef_encoder_t encoder;
+    ntag21x_ndef_parser_t parser;
+    uint8_t cc[4];
+    uint8_t page[4];
+    uint8_t err;
+    uint16_t len;
+    uint16_t pages;
+
+    if (a_regression_setup(NTAG21X_EMULATOR_TYPE_NTAG213, &container) != 0)
+    {
+        return 1;
+    }
+    err = 0;
+    err += a_regression_expect(ntag21x_read_ndef(&gs_handle, NULL, sizeof(gs_buf), &len) == 5, "null buffer");
+    err += a_regression_expect(ntag21x_read_ndef(&gs_handle, gs_buf, 8, &len) == 5, "cap under 12");
+
+    /* a blank capability container is not ndef formatted */
+    (void)ntag21x_emulator_read_memory(0x03, cc);
+    memcpy(page, blank, 4);
+    (void)ntag21x_emulator_write_memory(0x03, page);
+    err += a_regression_expect(ntag21x_read_ndef(&gs_handle, gs_buf, sizeof(gs_buf), &len) == 4, "blank cc");
+    err += a_regression_expect(ntag21x_ndef_scan(&gs_handle, gs_buf, sizeof(gs_buf), &parser) == 4, "blank cc scan");
+    (void)ntag21x_emulator_write_memory(0x03, cc);
+
+    /* a terminator before any message */
+    memcpy(page, terminator, 4);
+    (void)ntag21x_emulator_write_memory(0x04, page);
+    err += a_regression_expect(ntag21x_read_ndef(&gs_handle, gs_buf, sizeof(gs_buf), &len) == 7, "no message");
+
+    /* a message longer than the data area */
+    memcpy(page, overflow, 4);
+    (void)ntag21x_emulator_write_memory(0x04, page);
+    err += a_regression_expect(ntag21x_read_ndef(&gs_handle, gs_buf, sizeof(gs_buf), &len) == 6, "tlv overflow");
+    err += a_regression_expect(ntag21x_ndef_scan(&gs_handle, gs_buf, sizeof(gs_buf), &parser) == 6, "tlv overflow scan");
+
+    /* a valid message that does not fit the buffer */
+    (void)ntag21x_ndef_encoder_init(&encoder, gs_image, 144);
+    (void)ntag21x_ndef_encoder_add_mime(&encoder, "text/plain", gs_buf, 100);
+    (void)ntag21x_ndef_encoder_finish(&encoder, &len, &pages);
+    err += a_regression_expect(ntag21x_write_image(&gs_handle, 4, gs_image, len, NTAG21X_WRITE_IMAGE_FLAG_NONE) == 0, "write image");
+    err += a_regression_expect(ntag21x_read_ndef(&gs_handle, gs_buf, 64, &len) == 5, "cap too small");
+
+    /* the encoder refuses records that overflow the image */
+    (void)ntag21x_ndef_encoder_init(&encoder, gs_image, 16);
+    err += a_regression_expect(ntag21x_ndef_encoder_add_mime(&encoder, "text/plain", gs_buf, 16) == 1, "encoder full");
+    (void)ntag21x_deinit(&gs_handle);
+
+    return err;
+}
+
+/**
+ * @brief  inventory across several tags
+ * @return 0 if passed, otherwise the number of failed checks
+ * @note   tags share uid prefixes so that the collision tree is walked on both cascade levels
+ */
+static uint8_t a_regression_inventory(void)
+{
+    ntag21x_capability_container_t container;
+    ntag21x_inventory_handle_t inventory;
+    uint8_t list[8][7];
+    uint8_t uid[16][7];
+    uint8_t num;
+    uint8_t index;
+    uint8_t err;
+    uint8_t i;
+    uint8_t j;
+
+    if (a_regression_setup(NTAG21X_EMULATOR_TYPE_NTAG213, &container) != 0)
+    {
+        return 1;
+    }
+    err = 0;
+    memcpy(list[0], gsc_uid, 7);
+    for (i = 1; i < 8; i++)
+    {
+        for (j = 0; j < 7; j++)
+        {
+            list[i][j] = (uint8_t)(0x11 * i + 0x3D * j);
+        }
+        list[i][0] = 0x04;
+        if (i < 4)
+        {
+            /* same cascade level 1 prefix as the first tag */
+            list[i][1] = gsc_uid[1];
+            list[i][2] = gsc_uid[2];
+        }
+        if (i == 4)
+        {
+            /* differs from the first tag in the last bit only */
+            memcpy(list[i], gsc_uid, 7);
+            list[i][6] ^= 0x80;
+        }
+        err += a_regression_expect(ntag21x_emulator_add_tag((ntag21x_emulator_type_t)(i % 3), list[i], &index) == 0,
+                                   "add tag");
+    }
+    (void)ntag21x_emulator_field_reset();
+    DRIVER_NTAG21X_INVENTORY_LINK_INIT(&inventory, ntag21x_inventory_handle_t);
+    err += a_regression_expect(ntag21x_inventory_init(&inventory, &gs_handle) == 0, "inventory init");
+
+    gs_processed = 0;
+    num = 16;
+    err += a_regression_expect(ntag21x_inventory(&inventory, uid, &num, a_regression_inventory_process) == 0, "inventory");
+    err += a_regression_expect((num == 8) && (gs_processed == 8), "every tag found and processed");
+    for (i = 0; i < 8; i++)
+    {
+        for (j = 0; j < num; j++)
+        {
+            if (memcmp(uid[j], list[i], 7) == 0)
+            {
+                break;
+            }
+        }
+        err += a_regression_expect(j < num, "uid listed");
+    }
+
+    /* the halted tags answer the next inventory again */
+    num = 16;
+    err += a_regression_expect((ntag21x_inventory(&inventory, uid, &num, NULL) == 0) && (num == 8), "second inventory");
+
+    /* a short list stops with the list full */
+    num = 4;
+    err += a_regression_expect((ntag21x_inventory(&inventory, uid, &num, NULL) == 4) && (num == 4), "list full");
+
+    /* a tag that left the field is not listed */
+    (void)ntag21x_emulator_select_tag(0);
+    (void)ntag21x_emulator_set_present(NTAG21X_BOOL_FALSE);
+    num = 16;
+    err += a_regression_expect((ntag21x_inventory(&inventory, uid, &num, NULL) == 0) && (num == 7), "removed tag");
+    for (j = 0; j < num; j++)
+    {
+        err += a_regression_expect(memcmp(uid[j], gsc_uid, 7) != 0, "removed uid");
+    }
+    (void)ntag21x_emulator_set_present(NTAG21X_BOOL_TRUE);
+    (void)ntag21x_deinit(&gs_handle);
+
+    return err;
+}
+
+/**
+ * @brief  async commands and queue
+ * @return 0 if passed, otherwise the number of failed checks
+ * @note   the linked synchronous handle must see the async writes
+ */
+static uint8_t a_regression_async_queue(void)
+{
+    static uint8_t cache[NTAG21X_PAGE_CACHE_MAX_LEN];
+    static const uint8_t w1[4] = {0x01, 0x02, 0x03, 0x04};
+    static const uint8_t w2[4] = {0x05, 0x06, 0x07, 0x08};
+    ntag21x_capability_container_t container;
+    ntag21x_async_handle_t handle;
+    ntag21x_async_entry_t queue[5];
+    ntag21x_bool_t busy;
+    uint8_t uid[7];
+    uint8_t d1[16];
+    uint8_t d2[60];
+    uint8_t page[4];
+    uint8_t err;
+
+    if (a_regression_setup(NTAG21X_EMULATOR_TYPE_NTAG216, &container) != 0)
+    {
+        return 1;
+    }
+    err = 0;
+    (void)ntag21x_set_page_cache(&gs_handle, cache, sizeof(cache));
+    (void)ntag21x_emulator_set_poll_count(2);
+    DRIVER_NTAG21X_ASYNC_LINK_INIT(&handle, ntag21x_async_handle_t);
+    DRIVER_NTAG21X_ASYNC_LINK_SUBMIT(&handle, ntag21x_emulator_submit);
+    DRIVER_NTAG21X_ASYNC_LINK_POLL(&handle, ntag21x_emulator_poll);
+    DRIVER_NTAG21X_ASYNC_LINK_DEBUG_PRINT(&handle, a_regression_debug_print);
+    DRIVER_NTAG21X_ASYNC_LINK_NTAG(&handle, &gs_handle);
+    err += a_regression_expect(ntag21x_async_init(&handle) == 0, "async init");
+
+    /* parameter errors leave the handle idle */
+    memset(queue, 0, sizeof(queue));
+    queue[0].command = NTAG21X_ASYNC_COMMAND_WRITE;
+    queue[0].page = 4;
+    queue[1].command = NTAG21X_ASYNC_COMMAND_READ;
+    queue[1].page = 4;
+    err += a_regression_expect(ntag21x_async_queue_run(&handle, queue, 0, a_regression_queue_callback) == 5, "empty queue");
+    err += a_regression_expect(ntag21x_async_queue_run(&handle, queue, 2, a_regression_queue_callback) == 6, "read without data");
+    queue[1].command = NTAG21X_ASYNC_COMMAND_FAST_READ;
+    queue[1].stop_page = 30;
+    queue[1].data = d2;
+    err += a_regression_expect(ntag21x_async_queue_run(&handle, queue, 2, a_regression_queue_callback) == 6, "fast read range");
+    err += a_regression_expect(ntag21x_async_read(&handle, 4, NULL, a_regression_async_callback) == 2, "single read without data");
+    err += a_regression_expect((ntag21x_async_is_busy(&handle, &busy) == 0) && (busy == NTAG21X_BOOL_FALSE), "idle");
+
+    /* a full queue */
+    (void)ntag21x_read_page(&gs_handle, 4, page);
+    (void)ntag21x_halt(&gs_handle);
+    memset(queue, 0, sizeof(queue));
+    queue[0].command = NTAG21X_ASYNC_COMMAND_ANTICOLLISION;
+    queue[0].data = uid;
+    queue[1].command = NTAG21X_ASYNC_COMMAND_WRITE;
+    queue[1].page = 4;
+    memcpy(queue[1].arg, w1, 4);
+    queue[2].command = NTAG21X_ASYNC_COMMAND_COMP_WRITE;
+    queue[2].page = 5;
+    memcpy(queue[2].arg, w2, 4);
+    queue[3].command = NTAG21X_ASYNC_COMMAND_READ;
+    queue[3].page = 4;
+    queue[3].data = d1;
+    queue[4].command = NTAG21X_ASYNC_COMMAND_FAST_READ;
+    queue[4].page = 4;
+    queue[4].stop_page = 18;
+    queue[4].data = d2;
+    gs_done = 0;
+    err += a_regression_expect(ntag21x_async_queue_run(&handle, queue, 5, a_regression_queue_callback) == 0, "queue run");
+    err += a_regression_expect(ntag21x_async_read(&handle, 4, d1, a_regression_async_callback) == 4, "busy");
+    err += a_regression_expect(a_regression_async_wait(&handle) == 0, "queue callback");
+    err += a_regression_expect((gs_num == 5) && (gs_res == 0), "queue result");
+    err += a_regression_expect(memcmp(uid, gsc_uid, 7) == 0, "queue uid");
+    err += a_regression_expect((memcmp(d1, w1, 4) == 0) && (memcmp(d1 + 4, w2, 4) == 0), "queue read");
+    err += a_regression_expect((memcmp(d2, w1, 4) == 0) && (memcmp(d2 + 4, w2, 4) == 0), "queue fast read");
+
+    /* the synchronous cache sees the async write */
+    err += a_regression_expect((ntag21x_read_page(&gs_handle, 4, page) == 0) && (memcmp(page, w1, 4) == 0), "sync coherence");
+
+    /* the queue stops at the first failure */
+    memset(queue, 0, sizeof(queue));
+    queue[0].command = NTAG21X_ASYNC_COMMAND_WRITE;
+    queue[0].page = 6;
+    queue[1].command = NTAG21X_ASYNC_COMMAND_WRITE;
+    queue[1].page = 0xF0;
+    queue[2].command = NTAG21X_ASYNC_COMMAND_READ;
+    queue[2].page = 4;
+    queue[2].data = d1;
+    gs_done = 0;
+    err += a_regression_expect(ntag21x_async_queue_run(&handle, queue, 3, a_regression_queue_callback) == 0, "failing queue run");
+    err += a_regression_expect(a_regression_async_wait(&handle) == 0, "failing queue callback");
+    err += a_regression_expect((gs_num == 2) && (gs_res != 0) && (queue[0].status == 0) &&
+                               (queue[2].status == NTAG21X_ASYNC_STATUS_NOT_RUN), "queue stops");
+    (void)ntag21x_async_deinit(&handle);
+    (void)ntag21x_emulator_set_poll_count(0);
+    (void)ntag21x_deinit(&gs_handle);
+
+    return err;
+}
+
+/**
+ * @brief  session authentication
+ * @return 0 if passed, otherwise the number of failed checks
+ * @note   none
+ */
+static uint8_t a_regression_session(void)
+{
+    ntag21x_capability_container_t container;
+    ntag21x_session_t session;
+    uint8_t page[4];
+    uint8_t data[16];
+    uint8_t err;
+    uint32_t frames;
+
+    if (a_regression_setup(NTAG21X_EMULATOR_TYPE_NTAG213, &container) != 0)
+    {
+        return 1;
+    }
+    err = 0;
+
+    /* protect reads and writes from page 0x10 with the derived password */
+    a_regression_protect();
+
+    /* without the hook the protected page is refused */
+    err += a_regression_expect(a_regression_reselect() == 0, "reselect");
+    err += a_regression_expect(ntag21x_read_four_pages(&gs_handle, 0x10, data) != 0, "unauthenticated read refused");
+
+    /* with the hook the driver authenticates once per selection */
+    DRIVER_NTAG21X_LINK_DERIVE_PASSWORD(&gs_handle, a_regression_derive_password);
+    err += a_regression_expect(a_regression_reselect() == 0, "reselect");
+    err += a_regression_expect(ntag21x_read_four_pages(&gs_handle, 0x10, data) == 0, "protected read");
+    err += a_regression_expect((ntag21x_get_session(&gs_handle, &session) == 0) && (session.authenticated == 1) &&
+                               (session.auth0 == 0x10) && (session.prot == 1), "session");
+    frames = a_regression_frames();
+    err += a_regression_expect(ntag21x_read_four_pages(&gs_handle, 0x14, data) == 0, "second protected read");
+    err += a_regression_expect(a_regression_frames() - frames == 1, "no second authentication");
+    err += a_regression_expect(a_regression_reselect() == 0, "reselect");
+    err += a_regression_expect((ntag21x_get_session(&gs_handle, &session) == 0) && (session.authenticated == 0), "selection drops the session");
+    frames = a_regression_frames();
+    err += a_regression_expect(ntag21x_read_four_pages(&gs_handle, 0x04, data) == 0, "unprotected read");
+    err += a_regression_expect(a_regression_frames() - frames == 1, "unprotected read costs no authentication");
+    (void)ntag21x_deinit(&gs_handle);
+
+    /* a fresh handle with a wrong password on the tag */
+    if (a_regression_setup(NTAG21X_EMULATOR_TYPE_NTAG213, &container) != 0)
+    {
+        return 1;
+    }
+    DRIVER_NTAG21X_LINK_DERIVE_PASSWORD(&gs_handle, a_regression_derive_password);
+    memset(page, 0, 4);
+    (void)ntag21x_emulator_write_memory(0x2B, page);
+    err += a_regression_expect(ntag21x_session_authenticate(&gs_handle) == 1, "wrong password");
+    (void)ntag21x_deinit(&gs_handle);
+
+    return err;
+}
+
+/**
+ * @brief  page cache of a read protected tag
+ * @return 0 if passed, otherwise the number of failed checks
+ * @note   an unauthenticated read rolls over at auth0, the rolled pages must not be cached
+ */
+static uint8_t a_regression_protected_cache(void)
+{
+    static uint8_t cache[NTAG21X_PAGE_CACHE_MAX_LEN];
+    ntag21x_capability_container_t container;
+    uint8_t uid[7];
+    uint8_t pwd[4];
+    uint8_t pack[2];
+    uint8_t page[4];
+    uint8_t data[16];
+    uint8_t err;
+    uint32_t frames;
+
+    if (a_regression_setup(NTAG21X_EMULATOR_TYPE_NTAG213, &container) != 0)
+    {
+        return 1;
+    }
+    err = 0;
+    (void)ntag21x_set_page_cache(&gs_handle, cache, sizeof(cache));
+    a_regression_protect();
+
+    /* auth0 is unknown, only the requested page is cached */
+    err += a_regression_expect(a_regression_reselect() == 0, "reselect");
+    err += a_regression_expect(ntag21x_read_page(&gs_handle, 0x0E, page) == 0, "read below auth0");
+    err += a_regression_expect(ntag21x_read_page(&gs_handle, 0x10, page) != 0, "unknown auth0 refused");
+    err += a_regression_expect(a_regression_reselect() == 0, "reselect");
+    err += a_regression_expect(ntag21x_read_four_pages(&gs_handle, 0x0D, data) == 0, "rolled read");
+    err += a_regression_expect(ntag21x_read_page(&gs_handle, 0x10, page) != 0, "rolled page refused");
+
+    /* learn auth0 and prot once authenticated, the next selection is not */
+    err += a_regression_expect(a_regression_reselect() == 0, "reselect");
+    memcpy(uid, gsc_uid, 7);
+    (void)a_regression_derive_password(uid, pwd, pack);
+    err += a_regression_expect(ntag21x_authenticate(&gs_handle, pwd, pack) == 0, "authenticate");
+    err += a_regression_expect(ntag21x_read_four_pages(&gs_handle, 0x28, data) == 0, "configuration read");
+    err += a_regression_expect(a_regression_reselect() == 0, "reselect");
+    err += a_regression_expect(ntag21x_read_page(&gs_handle, 0x0E, page) == 0, "read below auth0");
+    frames = a_regression_frames();
+    err += a_regression_expect(ntag21x_read_page(&gs_handle, 0x0F, page) == 0, "cached below auth0");
+    err += a_regression_expect(a_regression_frames() == frames, "no frame below auth0");
+    err += a_regression_expect(ntag21x_read_page(&gs_handle, 0x10, page) != 0, "known auth0 refused");
+    (void)ntag21x_deinit(&gs_handle);
+
+    return err;
+}
+
+/**
+ * @brief  kdf provisioning and authentication
+ * @return 0 if passed, otherwise the number of failed checks
+ * @note   none
+ */
+static uint8_t a_regression_kdf(void)
+{
+    static const uint8_t label[6] = {'s', 'i', 't', 'e', '-', 'a'};
+    ntag21x_capability_container_t container;
+    ntag21x_kdf_handle_t kdf;
+    ntag21x_kdf_handle_t other;
+    uint8_t key[16];
+    uint8_t uid[7];
+    uint8_t pwd[4];
+    uint8_t pack[2];
+    uint8_t page[4];
+    uint8_t err;
+    uint8_t i;
+
+    err = 0;
+    err += a_regression_expect(ntag21x_kdf_self_test() == 0, "kdf self test");
+    if (a_regression_setup(NTAG21X_EMULATOR_TYPE_NTAG215, &container) != 0)
+    {
+        return 1;
+    }
+    for (i = 0; i < 16; i++)
+    {
+        key[i] = (uint8_t)(i + 1);
+    }
+    memcpy(uid, gsc_uid, 7);
+    err += a_regression_expect(ntag21x_kdf_init(&kdf, NTAG21X_KDF_ALGORITHM_AES_CMAC, key, 16) == 0, "kdf init");
+    err += a_regression_expect(ntag21x_kdf_set_label(&kdf, (uint8_t *)label, 6) == 0, "kdf label");
+    err += a_regression_expect(ntag21x_kdf_derive(&kdf, uid, pwd, pack) == 0, "kdf derive");
+
+    /* the derived password lands on the tag */
+    err += a_regression_expect(ntag21x_kdf_write_password(&kdf, &gs_handle, uid) == 0, "write password");
+    (void)ntag21x_emulator_read_memory(0x85, page);
+    err += a_regression_expect(memcmp(page, pwd, 4) == 0, "tag password");
+    (void)ntag21x_emulator_read_memory(0x86, page);
+    err += a_regression_expect(memcmp(page, pack, 2) == 0, "tag pack");
+    err += a_regression_expect(a_regression_reselect() == 0, "reselect");
+    err += a_regression_expect(ntag21x_kdf_authenticate(&kdf, &gs_handle, uid) == 0, "kdf authenticate");
+
+    /* the session hook derives the same password */
+    DRIVER_NTAG21X_LINK_USER(&gs_handle, &kdf);
+    DRIVER_NTAG21X_LINK_DERIVE_PASSWORD_CTX(&gs_handle, ntag21x_kdf_derive_password);
+    err += a_regression_expect(a_regression_reselect() == 0, "reselect");
+    err += a_regression_expect(ntag21x_session_authenticate(&gs_handle) == 0, "session authenticate");
+
+    /* another master key does not open the tag */
+    key[0] ^= 0x01;
+    (void)ntag21x_kdf_init(&other, NTAG21X_KDF_ALGORITHM_AES_CMAC, key, 16);
+    (void)ntag21x_kdf_set_label(&other, (uint8_t *)label, 6);
+    err += a_regression_expect(a_regression_reselect() == 0, "reselect");
+    err += a_regression_expect(ntag21x_kdf_authenticate(&other, &gs_handle, uid) != 0, "other key refused");
+    (void)ntag21x_deinit(&gs_handle);
+
+    return err;
+}
+
+/**
+ * @brief  originality signature check
+ * @return 0 if passed, otherwise the number of failed checks
+ * @note   the self test leaves its key loaded, the emulated uid matches its genuine signature
+ */
+static uint8_t a_regression_originality(void)
+{
+    static const uint8_t genuine[32] = {0x27, 0xC1, 0x2F, 0x19, 0x1C, 0xC6, 0xB5, 0x0A,
+                                        0x83, 0x31, 0x41, 0x33, 0x12, 0x35, 0x3C, 0xC5,
+                                        0x75, 0xD4, 0x06, 0xF1, 0x05, 0x51, 0x19, 0x30,
+                                        0x69, 0xB3, 0xE0, 0x2F, 0xA1, 0x6F, 0x32, 0x26};
+    static ntag21x_originality_handle_t handle;
+    ntag21x_capability_container_t container;
+    uint8_t signature[32];
+    uint8_t err;
+
+    err = 0;
+    err += a_regression_expect(ntag21x_originality_self_test(&handle) == 0, "originality self test");
+    if (a_regression_setup(NTAG21X_EMULATOR_TYPE_NTAG216, &container) != 0)
+    {
+        return 1;
+    }
+    memcpy(signature, genuine, 32);
+    (void)ntag21x_emulator_set_signature(signature);
+    err += a_regression_expect(ntag21x_originality_check(&handle, &gs_handle) == 0, "genuine tag");
+    signature[0] ^= 0x01;
+    (void)ntag21x_emulator_set_signature(signature);
+    err += a_regression_expect(ntag21x_originality_check(&handle, &gs_handle) != 0, "forged tag");
+    (void)ntag21x_deinit(&gs_handle);
+
+    return err;
+}
+
+/**
+ * @brief      run the traced sequence
+ * @param[out] *out pointer to a dump buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 run failed
+ * @note       none
+ */
+static uint8_t a_regression_trace_run(uint8_t *out)
+{
+    ntag21x_capability_container_t container;
+    uint16_t len;
+    uint8_t res;
+
+    len = 180;
+    res = 0;
+    if ((ntag21x_init(&gs_handle) != 0) || (a_regression_select(&container) != 0) ||
+        (ntag21x_dump_memory(&gs_handle, 0x00, 0x2C, out, &len) != 0))
+    {
+        res = 1;
+    }
+    (void)ntag21x_halt(&gs_handle);
+    (void)ntag21x_deinit(&gs_handle);
+
+    return res;
+}
+
+/**
+ * @brief  trace and replay
+ * @return 0 if passed, otherwise the number of failed checks
+ * @note   the replay runs without a tag in the field
+ */
+static uint8_t a_regression_trace_replay(void)
+{
+    ntag21x_trace_handle_t trace;
+    ntag21x_trace_status_t status;
+    ntag21x_trace_record_t record;
+    uint8_t uid[7];
+    uint8_t a[180];
+    uint8_t b[180];
+    uint8_t err;
+    uint32_t offset;
+    uint32_t records;
+    uint32_t length;
+
+    err = 0;
+    memcpy(uid, gsc_uid, 7);
+    (void)ntag21x_emulator_init(NTAG21X_EMULATOR_TYPE_NTAG213, uid);
+    a_regression_link();
+    gs_clock_us = 0;
+    DRIVER_NTAG21X_TRACE_LINK_INIT(&trace, ntag21x_trace_handle_t);
+    DRIVER_NTAG21X_TRACE_LINK_TIMESTAMP_US(&trace, a_regression_timestamp_us);
+    err += a_regression_expect(ntag21x_trace_init(&trace, &gs_handle) == 0, "trace init");
+    err += a_regression_expect(ntag21x_trace_set_buffer(&trace, gs_log, sizeof(gs_log)) == 0, "trace buffer");
+    err += a_regression_expect(a_regression_trace_run(a) == 0, "traced run");
+    err += a_regression_expect((ntag21x_trace_get_status(&trace, &status) == 0) && (status.records != 0) &&
+                               (status.dropped == 0), "trace status");
+    length = status.length;
+    offset = 0;
+    records = 0;
+    while (ntag21x_trace_next(gs_log, length, &offset, &record) == 0)
+    {
+        records++;
+    }
+    err += a_regression_expect(records == status.records, "trace records");
+    (void)ntag21x_trace_deinit(&trace);
+
+    /* the log answers the same requests with the tag gone */
+    (void)ntag21x_emulator_set_present(NTAG21X_BOOL_FALSE);
+    DRIVER_NTAG21X_TRACE_LINK_INIT(&trace, ntag21x_trace_handle_t);
+    err += a_regression_expect(ntag21x_trace_replay_init(&trace, &gs_handle, gs_log, length) == 0, "replay init");
+    err += a_regression_expect(a_regression_trace_run(b) == 0, "replayed run");
+    err += a_regression_expect(memcmp(a, b, sizeof(a)) == 0, "replayed data");
+    err += a_regression_expect((ntag21x_trace_get_status(&trace, &status) == 0) && (status.records == records) &&
+                               (status.mismatches == 0), "replay status");
+    (void)ntag21x_trace_deinit(&trace);
+    (void)ntag21x_emulator_set_present(NTAG21X_BOOL_TRUE);
+
+    return err;
+}
+
+/**
+ * @brief  write image
+ * @return 0 if passed, otherwise the number of failed checks
+ * @note   only the pages that differ are programmed
+ */
+static uint8_t a_regression_write_image(void)
+{
+    ntag21x_capability_container_t container;
+    ntag21x_emulator_statistics_t statistics;
+    uint8_t page[4];
+    uint8_t err;
+    uint16_t i;
+
+    if (a_regression_setup(NTAG21X_EMULATOR_TYPE_NTAG216, &container) != 0)
+    {
+        return 1;
+    }
+    err = 0;
+    for (i = 0; i < 399; i++)
+    {
+        gs_image[i] = (uint8_t)(i * 7);
+    }
+    err += a_regression_expect(ntag21x_write_image(&gs_handle, 4, gs_image, 399, NTAG21X_WRITE_IMAGE_FLAG_VERIFY) == 0, "first image");
+
+    /* two changed bytes program two pages */
+    gs_image[100] ^= 0x01;
+    gs_image[300] ^= 0x01;
+    (void)ntag21x_emulator_clear_statistics();
+    err += a_regression_expect(ntag21x_write_image(&gs_handle, 4, gs_image, 399, NTAG21X_WRITE_IMAGE_FLAG_VERIFY) == 0, "second image");
+    (void)ntag21x_emulator_get_statistics(&statistics);
+    err += a_regression_expect(statistics.eeprom_writes == 2, "changed pages only");
+
+    /* the partial last page keeps its fourth byte */
+    (void)ntag21x_emulator_read_memory(4 + 99, page);
+    err += a_regression_expect((page[0] == gs_image[396]) && (page[1] == gs_image[397]) && (page[2] == gs_image[398]), "last page");
+    for (i = 0; i < 99; i++)
+    {
+        (void)ntag21x_emulator_read_memory((uint8_t)(4 + i), page);
+        if (memcmp(page, gs_image + i * 4, 4) != 0)
+        {
+            break;
+        }
+    }
+    err += a_regression_expect(i == 99, "tag memory");
+    err += a_regression_expect(ntag21x_write_image(&gs_handle, 4, gs_image, 0, NTAG21X_WRITE_IMAGE_FLAG_NONE) == 4, "empty image");
+    err += a_regression_expect(ntag21x_write_image(&gs_handle, 0xE0, gs_image, 64, NTAG21X_WRITE_IMAGE_FLAG_NONE) == 4, "image over the end");
+    (void)ntag21x_deinit(&gs_handle);
+
+    return err;
+}
+
+/**
+ * @brief  config begin and commit
+ * @return 0 if passed, otherwise the number of failed checks
+ * @note   none
+ */
+static uint8_t a_regression_config(void)
+{
+    ntag21x_capability_container_t container;
+    ntag21x_config_t config;
+    ntag21x_mirror_t mirror;
+    ntag21x_bool_t enable;
+    uint8_t page;
+    uint8_t limitation;
+    uint8_t err;
+    uint32_t frames;
+
+    if (a_regression_setup(NTAG21X_EMULATOR_TYPE_NTAG215, &container) != 0)
+    {
+        return 1;
+    }
+    err = 0;
+    err += a_regression_expect(ntag21x_config_begin(&gs_handle, &config) == 0, "config begin");
+    err += a_regression_expect((config.protect_start_page == 0xFF) && (config.read_protection == NTAG21X_BOOL_FALSE), "default config");
+    config.mirror = NTAG21X_MIRROR_UID_ASCII;
+    config.mirror_byte = NTAG21X_MIRROR_BYTE_2;
+    config.mirror_page = 8;
+    config.nfc_counter = NTAG21X_BOOL_TRUE;
+    config.authenticate_limitation = 3;
+    err += a_regression_expect(ntag21x_config_commit(&gs_handle, &config) == 0, "config commit");
+
+    /* an unchanged config costs no frame */
+    frames = a_regression_frames();
+    err += a_regression_expect(ntag21x_config_commit(&gs_handle, &config) == 0, "second commit");
+    err += a_regression_expect(a_regression_frames() == frames, "unchanged commit");
+
+    /* the accessors read what the commit wrote */
+    err += a_regression_expect((ntag21x_get_mirror(&gs_handle, &mirror) == 0) && (mirror == NTAG21X_MIRROR_UID_ASCII), "mirror");
+    err += a_regression_expect((ntag21x_get_mirror_page(&gs_handle, &page) == 0) && (page == 8), "mirror page");
+    err += a_regression_expect((ntag21x_get_access(&gs_handle, NTAG21X_ACCESS_NFC_COUNTER, &enable) == 0) &&
+                               (enable == NTAG21X_BOOL_TRUE), "nfc counter");
+    err += a_regression_expect((ntag21x_get_authenticate_limitation(&gs_handle, &limitation) == 0) && (limitation == 3),
+                               "authenticate limitation");
+    (void)ntag21x_deinit(&gs_handle);
+
+    return err;
+}
+
+/**
+ * @brief  reselect and presence check
+ * @return 0 if passed, otherwise the number of failed checks
+ * @note   none
+ */
+static uint8_t a_regression_reselect_presence(void)
+{
+    static const uint8_t stranger[7] = {0x04, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09};
+    ntag21x_capability_container_t container;
+    uint8_t uid[7];
+    uint8_t page[4];
+    uint8_t err;
+    uint32_t frames;
+
+    if (a_regression_setup(NTAG21X_EMULATOR_TYPE_NTAG216, &container) != 0)
+    {
+        return 1;
+    }
+    err = 0;
+
+    /* the known uid is selected without anti collision */
+    memcpy(uid, gsc_uid, 7);
+    (void)ntag21x_halt(&gs_handle);
+    frames = a_regression_frames();
+    err += a_regression_expect(ntag21x_reselect(&gs_handle, uid) == 0, "reselect");
+    err += a_regression_expect(a_regression_frames() - frames == 3, "wake up and two selects");
+    err += a_regression_expect(ntag21x_read_page(&gs_handle, 4, page) == 0, "read after reselect");
+    err += a_regression_expect(ntag21x_check_presence(&gs_handle, uid) == 0, "present");
+
+    /* another uid falls back to the anti collision and learns the tag */
+    memcpy(uid, stranger, 7);
+    (void)ntag21x_halt(&gs_handle);
+    err += a_regression_expect(ntag21x_reselect(&gs_handle, uid) == 0, "reselect with another uid");
+    err += a_regression_expect(memcmp(uid, gsc_uid, 7) == 0, "learned uid");
+
+    /* a swapped tag and an empty field */
+    memcpy(uid, stranger, 7);
+    err += a_regression_expect(ntag21x_check_presence(&gs_handle, uid) == 6, "other tag");
+    (void)ntag21x_emulator_set_present(NTAG21X_BOOL_FALSE);
+    memcpy(uid, gsc_uid, 7);
+    err += a_regression_expect(ntag21x_check_presence(&gs_handle, uid) == 1, "removed");
+    (void)ntag21x_emulator_set_present(NTAG21X_BOOL_TRUE);
+    (void)ntag21x_deinit(&gs_handle);
+
+    return err;
+}
+
+/**
+ * @brief  poll search and track
+ * @return 0 if passed, otherwise the number of failed checks
+ * @note   the poll clock is the emulated air time
+ */
+static uint8_t a_regression_poll_track(void)
+{
+    ntag21x_capability_container_t container;
+    ntag21x_poll_handle_t poll;
+    ntag21x_poll_event_t event;
+    uint8_t id[8];
+    uint8_t err;
+    uint8_t i;
+    uint8_t removed;
+
+    if (a_regression_setup(NTAG21X_EMULATOR_TYPE_NTAG215, &container) != 0)
+    {
+        return 1;
+    }
+    err = 0;
+    (void)ntag21x_emulator_set_timing(200000, 1000000);
+    DRIVER_NTAG21X_POLL_LINK_INIT(&poll, ntag21x_poll_handle_t);
+    DRIVER_NTAG21X_POLL_LINK_TIMESTAMP_MS(&poll, a_regression_timestamp_ms);
+    DRIVER_NTAG21X_POLL_LINK_DELAY_MS(&poll, ntag21x_emulator_delay_ms);
+    err += a_regression_expect(ntag21x_poll_init(&poll, &gs_handle) == 0, "poll init");
+    err += a_regression_expect(ntag21x_poll_set_profile(&poll, NTAG21X_POLL_PROFILE_LOW_LATENCY) == 0, "poll profile");
+
+    /* search */
+    (void)ntag21x_emulator_set_present(NTAG21X_BOOL_FALSE);
+    err += a_regression_expect(ntag21x_poll_search(&poll, &container, id, 100) != 0, "search timeout");
+    (void)ntag21x_emulator_set_present(NTAG21X_BOOL_TRUE);
+    err += a_regression_expect(ntag21x_poll_search(&poll, &container, id, 100) == 0, "search");
+    err += a_regression_expect(container == NTAG21X_CAPABILITY_CONTAINER_496_BYTE_NTAG215, "search container");
+
+    /* track, the request of the search is answered by an idle tag only */
+    (void)ntag21x_emulator_field_reset();
+    err += a_regression_expect((ntag21x_poll_track(&poll, 500, &event) == 0) && (event.type == NTAG21X_POLL_EVENT_ARRIVED) &&
+                               (memcmp(event.uid, gsc_uid, 7) == 0), "arrived");
+    err += a_regression_expect((ntag21x_poll_track(&poll, 500, &event) == 0) && (event.type == NTAG21X_POLL_EVENT_PRESENT), "present");
+    (void)ntag21x_emulator_field_reset();
+    err += a_regression_expect((ntag21x_poll_track(&poll, 500, &event) == 0) && (event.type == NTAG21X_POLL_EVENT_PRESENT),
+                               "present after a field reset");
+    (void)ntag21x_emulator_set_present(NTAG21X_BOOL_FALSE);
+    removed = 0;
+    for (i = 0; (i < 8) && (removed == 0); i++)
+    {
+        if ((ntag21x_poll_track(&poll, 500, &event) == 0) && (event.type == NTAG21X_POLL_EVENT_REMOVED))
+        {
+            removed = 1;
+        }
+    }
+    err += a_regression_expect(removed == 1, "removed");
+    err += a_regression_expect(ntag21x_poll_track(&poll, 100, &event) == 4, "empty field");
+    (void)ntag21x_emulator_set_present(NTAG21X_BOOL_TRUE);
+    (void)ntag21x_emulator_set_timing(0, 0);
+    (void)ntag21x_deinit(&gs_handle);
+
+    return err;
+}
+
+/**
+ * @brief regression case list
+ */
+static const regression_case_t gsc_cases[] =
+{
+    {"ndef_round_trip", a_regression_ndef_round_trip},
+    {"ndef_errors", a_regression_ndef_errors},
+    {"inventory", a_regression_inventory},
+    {"async_queue", a_regression_async_queue},
+    {"session", a_regression_session},
+    {"protected_cache", a_regression_protected_cache},
+    {"kdf", a_regression_kdf},
+    {"originality", a_regression_originality},
+    {"trace_replay", a_regression_trace_replay},
+    {"write_image", a_regression_write_image},
+    {"config", a_regression_config},
+    {"reselect_presence", a_regression_reselect_presence},
+    {"poll_track", a_regression_poll_track},
+};
+
+/**
+ * @brief     main function
+ * @param[in] argc arg numbers
+ * @param[in] **argv arg address
+ * @return    status code
+ *            - 0 success
+ *            - 1 a case failed
+ * @note      an optional argument runs the case with that name only
+ */
+int main(int argc, char **argv)
+{
+    size_t k;
+    uint32_t passed;
+    uint32_t failed;
+
+    passed = 0;
+    failed = 0;
+    for (k = 0; k < sizeof(gsc_cases) / sizeof(gsc_cases[0]); k++)
+    {
+        if ((argc > 1) && (strcmp(argv[1], gsc_cases[k].name) != 0))
+        {
+            continue;
+        }
+        if (gsc_cases[k].run() == 0)
+        {
+            printf("regression: %s passed.\n", gsc_cases[k].name);
+            passed++;
+        }
+        else
+        {
+            printf("regression: %s failed.\n", gsc_cases[k].name);
+            failed++;
+        }
+    }
+    printf("regression: %u passed, %u failed.\n", (unsigned int)passed, (unsigned int)failed);
+
+    return ((failed == 0) && (passed != 0)) ? 0 : 1;
+}
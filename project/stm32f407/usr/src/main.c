@@ -747,7 +747,7 @@ uint8_t ntag21x(uint8_t argc, char **argv)
         }
 
         /* search */
-        res = ntag21x_basic_search(&type_s, id, 50);
+        res = ntag21x_basic_search(&type_s, id, 10000);
         if (res != 0)
         {
             (void)ntag21x_basic_deinit();
@@ -818,7 +818,7 @@ uint8_t ntag21x(uint8_t argc, char **argv)
         }
 
         /* search */
-        res = ntag21x_basic_search(&type_s, id, 50);
+        res = ntag21x_basic_search(&type_s, id, 10000);
         if (res != 0)
         {
             (void)ntag21x_basic_deinit();
@@ -889,7 +889,7 @@ uint8_t ntag21x(uint8_t argc, char **argv)
         }
 
         /* search */
-        res = ntag21x_basic_search(&type_s, id, 50);
+        res = ntag21x_basic_search(&type_s, id, 10000);
         if (res != 0)
         {
             (void)ntag21x_basic_deinit();
@@ -959,7 +959,7 @@ uint8_t ntag21x(uint8_t argc, char **argv)
         }
 
         /* search */
-        res = ntag21x_basic_search(&type_s, id, 50);
+        res = ntag21x_basic_search(&type_s, id, 10000);
         if (res != 0)
         {
             (void)ntag21x_basic_deinit();
@@ -1033,7 +1033,7 @@ uint8_t ntag21x(uint8_t argc, char **argv)
         }
 
         /* search */
-        res = ntag21x_basic_search(&type_s, id, 50);
+        res = ntag21x_basic_search(&type_s, id, 10000);
         if (res != 0)
         {
             (void)ntag21x_basic_deinit();
@@ -1105,7 +1105,7 @@ uint8_t ntag21x(uint8_t argc, char **argv)
         }
 
         /* search */
-        res = ntag21x_basic_search(&type_s, id, 50);
+        res = ntag21x_basic_search(&type_s, id, 10000);
         if (res != 0)
         {
             (void)ntag21x_basic_deinit();
@@ -1170,7 +1170,7 @@ uint8_t ntag21x(uint8_t argc, char **argv)
         }
 
         /* search */
-        res = ntag21x_basic_search(&type_s, id, 50);
+        res = ntag21x_basic_search(&type_s, id, 10000);
         if (res != 0)
         {
             (void)ntag21x_basic_deinit();
@@ -1240,7 +1240,7 @@ uint8_t ntag21x(uint8_t argc, char **argv)
         }
 
         /* search */
-        res = ntag21x_basic_search(&type_s, id, 50);
+        res = ntag21x_basic_search(&type_s, id, 10000);
         if (res != 0)
         {
             (void)ntag21x_basic_deinit();
@@ -1309,7 +1309,7 @@ uint8_t ntag21x(uint8_t argc, char **argv)
         }
 
         /* search */
-        res = ntag21x_basic_search(&type_s, id, 50);
+        res = ntag21x_basic_search(&type_s, id, 10000);
         if (res != 0)
         {
             (void)ntag21x_basic_deinit();
@@ -1378,7 +1378,7 @@ uint8_t ntag21x(uint8_t argc, char **argv)
             }
 
             /* search */
-            res = ntag21x_basic_search(&type_s, id, 50);
+            res = ntag21x_basic_search(&type_s, id, 10000);
             if (res != 0)
             {
                 (void)ntag21x_basic_deinit();
@@ -1451,7 +1451,7 @@ uint8_t ntag21x(uint8_t argc, char **argv)
             }
 
             /* search */
-            res = ntag21x_basic_search(&type_s, id, 50);
+            res = ntag21x_basic_search(&type_s, id, 10000);
             if (res != 0)
             {
                 (void)ntag21x_basic_deinit();
@@ -1523,7 +1523,7 @@ uint8_t ntag21x(uint8_t argc, char **argv)
         }
 
         /* search */
-        res = ntag21x_basic_search(&type_s, id, 50);
+        res = ntag21x_basic_search(&type_s, id, 10000);
         if (res != 0)
         {
             (void)ntag21x_basic_deinit();
@@ -1584,7 +1584,7 @@ uint8_t ntag21x(uint8_t argc, char **argv)
         }
 
         /* search */
-        res = ntag21x_basic_search(&type_s, id, 50);
+        res = ntag21x_basic_search(&type_s, id, 10000);
         if (res != 0)
         {
             (void)ntag21x_basic_deinit();
@@ -1645,7 +1645,7 @@ uint8_t ntag21x(uint8_t argc, char **argv)
         }
 
         /* search */
-        res = ntag21x_basic_search(&type_s, id, 50);
+        res = ntag21x_basic_search(&type_s, id, 10000);
         if (res != 0)
         {
             (void)ntag21x_basic_deinit();
@@ -1708,7 +1708,7 @@ uint8_t ntag21x(uint8_t argc, char **argv)
         }
 
         /* search */
-        res = ntag21x_basic_search(&type_s, id, 50);
+        res = ntag21x_basic_search(&type_s, id, 10000);
         if (res != 0)
         {
             (void)ntag21x_basic_deinit();
@@ -1770,7 +1770,7 @@ uint8_t ntag21x(uint8_t argc, char **argv)
         }
 
         /* search */
-        res = ntag21x_basic_search(&type_s, id, 50);
+        res = ntag21x_basic_search(&type_s, id, 10000);
         if (res != 0)
         {
             (void)ntag21x_basic_deinit();
@@ -1831,7 +1831,7 @@ uint8_t ntag21x(uint8_t argc, char **argv)
         }
 
         /* search */
-        res = ntag21x_basic_search(&type_s, id, 50);
+        res = ntag21x_basic_search(&type_s, id, 10000);
         if (res != 0)
         {
             (void)ntag21x_basic_deinit();
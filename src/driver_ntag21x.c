@@ -67,28 +67,1074 @@
 #define NTAG21X_COMMAND_PWD_AUTH                 0x1B           /**< pwd auth command */
 #define NTAG21X_COMMAND_READ_SIG                 0x3C           /**< read sig command */
 
+/**
+ * @brief page map definition
+ * @note  a constant in a single variant build, learned from the tag otherwise
+ */
+#if (NTAG21X_VARIANT == NTAG21X_VARIANT_GENERIC)
+    #define NTAG21X_END_PAGE(HANDLE)        ((HANDLE)->end_page)
+#else
+    #define NTAG21X_END_PAGE(HANDLE)        (NTAG21X_VARIANT_END_PAGE)
+#endif
+#define NTAG21X_PAGE_DYNAMIC_LOCK(HANDLE)   (NTAG21X_END_PAGE(HANDLE) - 4)        /**< dynamic lock page */
+#define NTAG21X_PAGE_CFG0(HANDLE)           (NTAG21X_END_PAGE(HANDLE) - 3)        /**< cfg0 page */
+#define NTAG21X_PAGE_CFG1(HANDLE)           (NTAG21X_END_PAGE(HANDLE) - 2)        /**< cfg1 page */
+#define NTAG21X_PAGE_PWD(HANDLE)            (NTAG21X_END_PAGE(HANDLE) - 1)        /**< password page */
+#define NTAG21X_PAGE_PACK(HANDLE)           (NTAG21X_END_PAGE(HANDLE))            /**< pack page */
+
+#if (NTAG21X_CRC_BACKEND != NTAG21X_CRC_BACKEND_BITWISE)
+/**
+ * @brief crc_a table 0
+ */
+static const uint16_t gsc_ntag21x_crc_table_0[256] =
+{
+    0x0000, 0x1189, 0x2312, 0x329B, 0x4624, 0x57AD, 0x6536, 0x74BF,
+    0x8C48, 0x9DC1, 0xAF5A, 0xBED3, 0xCA6C, 0xDBE5, 0xE97E, 0xF8F7,
+    0x1081, 0x0108, 0x3393, 0x221A, 0x56A5, 0x472C, 0x75B7, 0x643E,
+    0x9CC9, 0x8D40, 0xBFDB, 0xAE52, 0xDAED, 0xCB64, 0xF9FF, 0xE876,
+    0x2102, 0x308B, 0x0210, 0x1399, 0x6726, 0x76AF, 0x4434, 0x55BD,
+    0xAD4A, 0xBCC3, 0x8E58, 0x9FD1, 0xEB6E, 0xFAE7, 0xC87C, 0xD9F5,
+    0x3183, 0x200A, 0x1291, 0x0318, 0x77A7, 0x662E, 0x54B5, 0x453C,
+    0xBDCB, 0xAC42, 0x9ED9, 0x8F50, 0xFBEF, 0xEA66, 0xD8FD, 0xC974,
+    0x4204, 0x538D, 0x6116, 0x709F, 0x0420, 0x15A9, 0x2732, 0x36BB,
+    0xCE4C, 0xDFC5, 0xED5E, 0xFCD7, 0x8868, 0x99E1, 0xAB7A, 0xBAF3,
+    0x5285, 0x430C, 0x7197, 0x601E, 0x14A1, 0x0528, 0x37B3, 0x263A,
+    0xDECD, 0xCF44, 0xFDDF, 0xEC56, 0x98E9, 0x8960, 0xBBFB, 0xAA72,
+    0x6306, 0x728F, 0x4014, 0x519D, 0x2522, 0x34AB, 0x0630, 0x17B9,
+    0xEF4E, 0xFEC7, 0xCC5C, 0xDDD5, 0xA96A, 0xB8E3, 0x8A78, 0x9BF1,
+    0x7387, 0x620E, 0x5095, 0x411C, 0x35A3, 0x242A, 0x16B1, 0x0738,
+    0xFFCF, 0xEE46, 0xDCDD, 0xCD54, 0xB9EB, 0xA862, 0x9AF9, 0x8B70,
+    0x8408, 0x9581, 0xA71A, 0xB693, 0xC22C, 0xD3A5, 0xE13E, 0xF0B7,
+    0x0840, 0x19C9, 0x2B52, 0x3ADB, 0x4E64, 0x5FED, 0x6D76, 0x7CFF,
+    0x9489, 0x8500, 0xB79B, 0xA612, 0xD2AD, 0xC324, 0xF1BF, 0xE036,
+    0x18C1, 0x0948, 0x3BD3, 0x2A5A, 0x5EE5, 0x4F6C, 0x7DF7, 0x6C7E,
+    0xA50A, 0xB483, 0x8618, 0x9791, 0xE32E, 0xF2A7, 0xC03C, 0xD1B5,
+    0x2942, 0x38CB, 0x0A50, 0x1BD9, 0x6F66, 0x7EEF, 0x4C74, 0x5DFD,
+    0xB58B, 0xA402, 0x9699, 0x8710, 0xF3AF, 0xE226, 0xD0BD, 0xC134,
+    0x39C3, 0x284A, 0x1AD1, 0x0B58, 0x7FE7, 0x6E6E, 0x5CF5, 0x4D7C,
+    0xC60C, 0xD785, 0xE51E, 0xF497, 0x8028, 0x91A1, 0xA33A, 0xB2B3,
+    0x4A44, 0x5BCD, 0x6956, 0x78DF, 0x0C60, 0x1DE9, 0x2F72, 0x3EFB,
+    0xD68D, 0xC704, 0xF59F, 0xE416, 0x90A9, 0x8120, 0xB3BB, 0xA232,
+    0x5AC5, 0x4B4C, 0x79D7, 0x685E, 0x1CE1, 0x0D68, 0x3FF3, 0x2E7A,
+    0xE70E, 0xF687, 0xC41C, 0xD595, 0xA12A, 0xB0A3, 0x8238, 0x93B1,
+    0x6B46, 0x7ACF, 0x4854, 0x59DD, 0x2D62, 0x3CEB, 0x0E70, 0x1FF9,
+    0xF78F, 0xE606, 0xD49D, 0xC514, 0xB1AB, 0xA022, 0x92B9, 0x8330,
+    0x7BC7, 0x6A4E, 0x58D5, 0x495C, 0x3DE3, 0x2C6A, 0x1EF1, 0x0F78
+};
+#endif
+
+#if (NTAG21X_CRC_BACKEND == NTAG21X_CRC_BACKEND_SLICE_BY_4) || (NTAG21X_CRC_BACKEND == NTAG21X_CRC_BACKEND_SLICE_BY_8)
+/**
+ * @brief crc_a table 1
+ */
+static const uint16_t gsc_ntag21x_crc_table_1[256] =
+{
+    0x0000, 0x19D8, 0x33B0, 0x2A68, 0x6760, 0x7EB8, 0x54D0, 0x4D08,
+    0xCEC0, 0xD718, 0xFD70, 0xE4A8, 0xA9A0, 0xB078, 0x9A10, 0x83C8,
+    0x9591, 0x8C49, 0xA621, 0xBFF9, 0xF2F1, 0xEB29, 0xC141, 0xD899,
+    0x5B51, 0x4289, 0x68E1, 0x7139, 0x3C31, 0x25E9, 0x0F81, 0x1659,
+    0x2333, 0x3AEB, 0x1083, 0x095B, 0x4453, 0x5D8B, 0x77E3, 0x6E3B,
+    0xEDF3, 0xF42B, 0xDE43, 0xC79B, 0x8A93, 0x934B, 0xB923, 0xA0FB,
+    0xB6A2, 0xAF7A, 0x8512, 0x9CCA, 0xD1C2, 0xC81A, 0xE272, 0xFBAA,
+    0x7862, 0x61BA, 0x4BD2, 0x520A, 0x1F02, 0x06DA, 0x2CB2, 0x356A,
+    0x4666, 0x5FBE, 0x75D6, 0x6C0E, 0x2106, 0x38DE, 0x12B6, 0x0B6E,
+    0x88A6, 0x917E, 0xBB16, 0xA2CE, 0xEFC6, 0xF61E, 0xDC76, 0xC5AE,
+    0xD3F7, 0xCA2F, 0xE047, 0xF99F, 0xB497, 0xAD4F, 0x8727, 0x9EFF,
+    0x1D37, 0x04EF, 0x2E87, 0x375F, 0x7A57, 0x638F, 0x49E7, 0x503F,
+    0x6555, 0x7C8D, 0x56E5, 0x4F3D, 0x0235, 0x1BED, 0x3185, 0x285D,
+    0xAB95, 0xB24D, 0x9825, 0x81FD, 0xCCF5, 0xD52D, 0xFF45, 0xE69D,
+    0xF0C4, 0xE91C, 0xC374, 0xDAAC, 0x97A4, 0x8E7C, 0xA414, 0xBDCC,
+    0x3E04, 0x27DC, 0x0DB4, 0x146C, 0x5964, 0x40BC, 0x6AD4, 0x730C,
+    0x8CCC, 0x9514, 0xBF7C, 0xA6A4, 0xEBAC, 0xF274, 0xD81C, 0xC1C4,
+    0x420C, 0x5BD4, 0x71BC, 0x6864, 0x256C, 0x3CB4, 0x16DC, 0x0F04,
+    0x195D, 0x0085, 0x2AED, 0x3335, 0x7E3D, 0x67E5, 0x4D8D, 0x5455,
+    0xD79D, 0xCE45, 0xE42D, 0xFDF5, 0xB0FD, 0xA925, 0x834D, 0x9A95,
+    0xAFFF, 0xB627, 0x9C4F, 0x8597, 0xC89F, 0xD147, 0xFB2F, 0xE2F7,
+    0x613F, 0x78E7, 0x528F, 0x4B57, 0x065F, 0x1F87, 0x35EF, 0x2C37,
+    0x3A6E, 0x23B6, 0x09DE, 0x1006, 0x5D0E, 0x44D6, 0x6EBE, 0x7766,
+    0xF4AE, 0xED76, 0xC71E, 0xDEC6, 0x93CE, 0x8A16, 0xA07E, 0xB9A6,
+    0xCAAA, 0xD372, 0xF91A, 0xE0C2, 0xADCA, 0xB412, 0x9E7A, 0x87A2,
+    0x046A, 0x1DB2, 0x37DA, 0x2E02, 0x630A, 0x7AD2, 0x50BA, 0x4962,
+    0x5F3B, 0x46E3, 0x6C8B, 0x7553, 0x385B, 0x2183, 0x0BEB, 0x1233,
+    0x91FB, 0x8823, 0xA24B, 0xBB93, 0xF69B, 0xEF43, 0xC52B, 0xDCF3,
+    0xE999, 0xF041, 0xDA29, 0xC3F1, 0x8EF9, 0x9721, 0xBD49, 0xA491,
+    0x2759, 0x3E81, 0x14E9, 0x0D31, 0x4039, 0x59E1, 0x7389, 0x6A51,
+    0x7C08, 0x65D0, 0x4FB8, 0x5660, 0x1B68, 0x02B0, 0x28D8, 0x3100,
+    0xB2C8, 0xAB10, 0x8178, 0x98A0, 0xD5A8, 0xCC70, 0xE618, 0xFFC0
+};
+
+/**
+ * @brief crc_a table 2
+ */
+static const uint16_t gsc_ntag21x_crc_table_2[256] =
+{
+    0x0000, 0x5ADC, 0xB5B8, 0xEF64, 0x6361, 0x39BD, 0xD6D9, 0x8C05,
+    0xC6C2, 0x9C1E, 0x737A, 0x29A6, 0xA5A3, 0xFF7F, 0x101B, 0x4AC7,
+    0x8595, 0xDF49, 0x302D, 0x6AF1, 0xE6F4, 0xBC28, 0x534C, 0x0990,
+    0x4357, 0x198B, 0xF6EF, 0xAC33, 0x2036, 0x7AEA, 0x958E, 0xCF52,
+    0x033B, 0x59E7, 0xB683, 0xEC5F, 0x605A, 0x3A86, 0xD5E2, 0x8F3E,
+    0xC5F9, 0x9F25, 0x7041, 0x2A9D, 0xA698, 0xFC44, 0x1320, 0x49FC,
+    0x86AE, 0xDC72, 0x3316, 0x69CA, 0xE5CF, 0xBF13, 0x5077, 0x0AAB,
+    0x406C, 0x1AB0, 0xF5D4, 0xAF08, 0x230D, 0x79D1, 0x96B5, 0xCC69,
+    0x0676, 0x5CAA, 0xB3CE, 0xE912, 0x6517, 0x3FCB, 0xD0AF, 0x8A73,
+    0xC0B4, 0x9A68, 0x750C, 0x2FD0, 0xA3D5, 0xF909, 0x166D, 0x4CB1,
+    0x83E3, 0xD93F, 0x365B, 0x6C87, 0xE082, 0xBA5E, 0x553A, 0x0FE6,
+    0x4521, 0x1FFD, 0xF099, 0xAA45, 0x2640, 0x7C9C, 0x93F8, 0xC924,
+    0x054D, 0x5F91, 0xB0F5, 0xEA29, 0x662C, 0x3CF0, 0xD394, 0x8948,
+    0xC38F, 0x9953, 0x7637, 0x2CEB, 0xA0EE, 0xFA32, 0x1556, 0x4F8A,
+    0x80D8, 0xDA04, 0x3560, 0x6FBC, 0xE3B9, 0xB965, 0x5601, 0x0CDD,
+    0x461A, 0x1CC6, 0xF3A2, 0xA97E, 0x257B, 0x7FA7, 0x90C3, 0xCA1F,
+    0x0CEC, 0x5630, 0xB954, 0xE388, 0x6F8D, 0x3551, 0xDA35, 0x80E9,
+    0xCA2E, 0x90F2, 0x7F96, 0x254A, 0xA94F, 0xF393, 0x1CF7, 0x462B,
+    0x8979, 0xD3A5, 0x3CC1, 0x661D, 0xEA18, 0xB0C4, 0x5FA0, 0x057C,
+    0x4FBB, 0x1567, 0xFA03, 0xA0DF, 0x2CDA, 0x7606, 0x9962, 0xC3BE,
+    0x0FD7, 0x550B, 0xBA6F, 0xE0B3, 0x6CB6, 0x366A, 0xD90E, 0x83D2,
+    0xC915, 0x93C9, 0x7CAD, 0x2671, 0xAA74, 0xF0A8, 0x1FCC, 0x4510,
+    0x8A42, 0xD09E, 0x3FFA, 0x6526, 0xE923, 0xB3FF, 0x5C9B, 0x0647,
+    0x4C80, 0x165C, 0xF938, 0xA3E4, 0x2FE1, 0x753D, 0x9A59, 0xC085,
+    0x0A9A, 0x5046, 0xBF22, 0xE5FE, 0x69FB, 0x3327, 0xDC43, 0x869F,
+    0xCC58, 0x9684, 0x79E0, 0x233C, 0xAF39, 0xF5E5, 0x1A81, 0x405D,
+    0x8F0F, 0xD5D3, 0x3AB7, 0x606B, 0xEC6E, 0xB6B2, 0x59D6, 0x030A,
+    0x49CD, 0x1311, 0xFC75, 0xA6A9, 0x2AAC, 0x7070, 0x9F14, 0xC5C8,
+    0x09A1, 0x537D, 0xBC19, 0xE6C5, 0x6AC0, 0x301C, 0xDF78, 0x85A4,
+    0xCF63, 0x95BF, 0x7ADB, 0x2007, 0xAC02, 0xF6DE, 0x19BA, 0x4366,
+    0x8C34, 0xD6E8, 0x398C, 0x6350, 0xEF55, 0xB589, 0x5AED, 0x0031,
+    0x4AF6, 0x102A, 0xFF4E, 0xA592, 0x2997, 0x734B, 0x9C2F, 0xC6F3
+};
+
+/**
+ * @brief crc_a table 3
+ */
+static const uint16_t gsc_ntag21x_crc_table_3[256] =
+{
+    0x0000, 0x1CBB, 0x3976, 0x25CD, 0x72EC, 0x6E57, 0x4B9A, 0x5721,
+    0xE5D8, 0xF963, 0xDCAE, 0xC015, 0x9734, 0x8B8F, 0xAE42, 0xB2F9,
+    0xC3A1, 0xDF1A, 0xFAD7, 0xE66C, 0xB14D, 0xADF6, 0x883B, 0x9480,
+    0x2679, 0x3AC2, 0x1F0F, 0x03B4, 0x5495, 0x482E, 0x6DE3, 0x7158,
+    0x8F53, 0x93E8, 0xB625, 0xAA9E, 0xFDBF, 0xE104, 0xC4C9, 0xD872,
+    0x6A8B, 0x7630, 0x53FD, 0x4F46, 0x1867, 0x04DC, 0x2111, 0x3DAA,
+    0x4CF2, 0x5049, 0x7584, 0x693F, 0x3E1E, 0x22A5, 0x0768, 0x1BD3,
+    0xA92A, 0xB591, 0x905C, 0x8CE7, 0xDBC6, 0xC77D, 0xE2B0, 0xFE0B,
+    0x16B7, 0x0A0C, 0x2FC1, 0x337A, 0x645B, 0x78E0, 0x5D2D, 0x4196,
+    0xF36F, 0xEFD4, 0xCA19, 0xD6A2, 0x8183, 0x9D38, 0xB8F5, 0xA44E,
+    0xD516, 0xC9AD, 0xEC60, 0xF0DB, 0xA7FA, 0xBB41, 0x9E8C, 0x8237,
+    0x30CE, 0x2C75, 0x09B8, 0x1503, 0x4222, 0x5E99, 0x7B54, 0x67EF,
+    0x99E4, 0x855F, 0xA092, 0xBC29, 0xEB08, 0xF7B3, 0xD27E, 0xCEC5,
+    0x7C3C, 0x6087, 0x454A, 0x59F1, 0x0ED0, 0x126B, 0x37A6, 0x2B1D,
+    0x5A45, 0x46FE, 0x6333, 0x7F88, 0x28A9, 0x3412, 0x11DF, 0x0D64,
+    0xBF9D, 0xA326, 0x86EB, 0x9A50, 0xCD71, 0xD1CA, 0xF407, 0xE8BC,
+    0x2D6E, 0x31D5, 0x1418, 0x08A3, 0x5F82, 0x4339, 0x66F4, 0x7A4F,
+    0xC8B6, 0xD40D, 0xF1C0, 0xED7B, 0xBA5A, 0xA6E1, 0x832C, 0x9F97,
+    0xEECF, 0xF274, 0xD7B9, 0xCB02, 0x9C23, 0x8098, 0xA555, 0xB9EE,
+    0x0B17, 0x17AC, 0x3261, 0x2EDA, 0x79FB, 0x6540, 0x408D, 0x5C36,
+    0xA23D, 0xBE86, 0x9B4B, 0x87F0, 0xD0D1, 0xCC6A, 0xE9A7, 0xF51C,
+    0x47E5, 0x5B5E, 0x7E93, 0x6228, 0x3509, 0x29B2, 0x0C7F, 0x10C4,
+    0x619C, 0x7D27, 0x58EA, 0x4451, 0x1370, 0x0FCB, 0x2A06, 0x36BD,
+    0x8444, 0x98FF, 0xBD32, 0xA189, 0xF6A8, 0xEA13, 0xCFDE, 0xD365,
+    0x3BD9, 0x2762, 0x02AF, 0x1E14, 0x4935, 0x558E, 0x7043, 0x6CF8,
+    0xDE01, 0xC2BA, 0xE777, 0xFBCC, 0xACED, 0xB056, 0x959B, 0x8920,
+    0xF878, 0xE4C3, 0xC10E, 0xDDB5, 0x8A94, 0x962F, 0xB3E2, 0xAF59,
+    0x1DA0, 0x011B, 0x24D6, 0x386D, 0x6F4C, 0x73F7, 0x563A, 0x4A81,
+    0xB48A, 0xA831, 0x8DFC, 0x9147, 0xC666, 0xDADD, 0xFF10, 0xE3AB,
+    0x5152, 0x4DE9, 0x6824, 0x749F, 0x23BE, 0x3F05, 0x1AC8, 0x0673,
+    0x772B, 0x6B90, 0x4E5D, 0x52E6, 0x05C7, 0x197C, 0x3CB1, 0x200A,
+    0x92F3, 0x8E48, 0xAB85, 0xB73E, 0xE01F, 0xFCA4, 0xD969, 0xC5D2
+};
+#endif
+
+#if (NTAG21X_CRC_BACKEND == NTAG21X_CRC_BACKEND_SLICE_BY_8)
+/**
+ * @brief crc_a table 4
+ */
+static const uint16_t gsc_ntag21x_crc_table_4[256] =
+{
+    0x0000, 0x0B44, 0x1688, 0x1DCC, 0x2D10, 0x2654, 0x3B98, 0x30DC,
+    0x5A20, 0x5164, 0x4CA8, 0x47EC, 0x7730, 0x7C74, 0x61B8, 0x6AFC,
+    0xB440, 0xBF04, 0xA2C8, 0xA98C, 0x9950, 0x9214, 0x8FD8, 0x849C,
+    0xEE60, 0xE524, 0xF8E8, 0xF3AC, 0xC370, 0xC834, 0xD5F8, 0xDEBC,
+    0x6091, 0x6BD5, 0x7619, 0x7D5D, 0x4D81, 0x46C5, 0x5B09, 0x504D,
+    0x3AB1, 0x31F5, 0x2C39, 0x277D, 0x17A1, 0x1CE5, 0x0129, 0x0A6D,
+    0xD4D1, 0xDF95, 0xC259, 0xC91D, 0xF9C1, 0xF285, 0xEF49, 0xE40D,
+    0x8EF1, 0x85B5, 0x9879, 0x933D, 0xA3E1, 0xA8A5, 0xB569, 0xBE2D,
+    0xC122, 0xCA66, 0xD7AA, 0xDCEE, 0xEC32, 0xE776, 0xFABA, 0xF1FE,
+    0x9B02, 0x9046, 0x8D8A, 0x86CE, 0xB612, 0xBD56, 0xA09A, 0xABDE,
+    0x7562, 0x7E26, 0x63EA, 0x68AE, 0x5872, 0x5336, 0x4EFA, 0x45BE,
+    0x2F42, 0x2406, 0x39CA, 0x328E, 0x0252, 0x0916, 0x14DA, 0x1F9E,
+    0xA1B3, 0xAAF7, 0xB73B, 0xBC7F, 0x8CA3, 0x87E7, 0x9A2B, 0x916F,
+    0xFB93, 0xF0D7, 0xED1B, 0xE65F, 0xD683, 0xDDC7, 0xC00B, 0xCB4F,
+    0x15F3, 0x1EB7, 0x037B, 0x083F, 0x38E3, 0x33A7, 0x2E6B, 0x252F,
+    0x4FD3, 0x4497, 0x595B, 0x521F, 0x62C3, 0x6987, 0x744B, 0x7F0F,
+    0x8A55, 0x8111, 0x9CDD, 0x9799, 0xA745, 0xAC01, 0xB1CD, 0xBA89,
+    0xD075, 0xDB31, 0xC6FD, 0xCDB9, 0xFD65, 0xF621, 0xEBED, 0xE0A9,
+    0x3E15, 0x3551, 0x289D, 0x23D9, 0x1305, 0x1841, 0x058D, 0x0EC9,
+    0x6435, 0x6F71, 0x72BD, 0x79F9, 0x4925, 0x4261, 0x5FAD, 0x54E9,
+    0xEAC4, 0xE180, 0xFC4C, 0xF708, 0xC7D4, 0xCC90, 0xD15C, 0xDA18,
+    0xB0E4, 0xBBA0, 0xA66C, 0xAD28, 0x9DF4, 0x96B0, 0x8B7C, 0x8038,
+    0x5E84, 0x55C0, 0x480C, 0x4348, 0x7394, 0x78D0, 0x651C, 0x6E58,
+    0x04A4, 0x0FE0, 0x122C, 0x1968, 0x29B4, 0x22F0, 0x3F3C, 0x3478,
+    0x4B77, 0x4033, 0x5DFF, 0x56BB, 0x6667, 0x6D23, 0x70EF, 0x7BAB,
+    0x1157, 0x1A13, 0x07DF, 0x0C9B, 0x3C47, 0x3703, 0x2ACF, 0x218B,
+    0xFF37, 0xF473, 0xE9BF, 0xE2FB, 0xD227, 0xD963, 0xC4AF, 0xCFEB,
+    0xA517, 0xAE53, 0xB39F, 0xB8DB, 0x8807, 0x8343, 0x9E8F, 0x95CB,
+    0x2BE6, 0x20A2, 0x3D6E, 0x362A, 0x06F6, 0x0DB2, 0x107E, 0x1B3A,
+    0x71C6, 0x7A82, 0x674E, 0x6C0A, 0x5CD6, 0x5792, 0x4A5E, 0x411A,
+    0x9FA6, 0x94E2, 0x892E, 0x826A, 0xB2B6, 0xB9F2, 0xA43E, 0xAF7A,
+    0xC586, 0xCEC2, 0xD30E, 0xD84A, 0xE896, 0xE3D2, 0xFE1E, 0xF55A
+};
+
+/**
+ * @brief crc_a table 5
+ */
+static const uint16_t gsc_ntag21x_crc_table_5[256] =
+{
+    0x0000, 0x042B, 0x0856, 0x0C7D, 0x10AC, 0x1487, 0x18FA, 0x1CD1,
+    0x2158, 0x2573, 0x290E, 0x2D25, 0x31F4, 0x35DF, 0x39A2, 0x3D89,
+    0x42B0, 0x469B, 0x4AE6, 0x4ECD, 0x521C, 0x5637, 0x5A4A, 0x5E61,
+    0x63E8, 0x67C3, 0x6BBE, 0x6F95, 0x7344, 0x776F, 0x7B12, 0x7F39,
+    0x8560, 0x814B, 0x8D36, 0x891D, 0x95CC, 0x91E7, 0x9D9A, 0x99B1,
+    0xA438, 0xA013, 0xAC6E, 0xA845, 0xB494, 0xB0BF, 0xBCC2, 0xB8E9,
+    0xC7D0, 0xC3FB, 0xCF86, 0xCBAD, 0xD77C, 0xD357, 0xDF2A, 0xDB01,
+    0xE688, 0xE2A3, 0xEEDE, 0xEAF5, 0xF624, 0xF20F, 0xFE72, 0xFA59,
+    0x02D1, 0x06FA, 0x0A87, 0x0EAC, 0x127D, 0x1656, 0x1A2B, 0x1E00,
+    0x2389, 0x27A2, 0x2BDF, 0x2FF4, 0x3325, 0x370E, 0x3B73, 0x3F58,
+    0x4061, 0x444A, 0x4837, 0x4C1C, 0x50CD, 0x54E6, 0x589B, 0x5CB0,
+    0x6139, 0x6512, 0x696F, 0x6D44, 0x7195, 0x75BE, 0x79C3, 0x7DE8,
+    0x87B1, 0x839A, 0x8FE7, 0x8BCC, 0x971D, 0x9336, 0x9F4B, 0x9B60,
+    0xA6E9, 0xA2C2, 0xAEBF, 0xAA94, 0xB645, 0xB26E, 0xBE13, 0xBA38,
+    0xC501, 0xC12A, 0xCD57, 0xC97C, 0xD5AD, 0xD186, 0xDDFB, 0xD9D0,
+    0xE459, 0xE072, 0xEC0F, 0xE824, 0xF4F5, 0xF0DE, 0xFCA3, 0xF888,
+    0x05A2, 0x0189, 0x0DF4, 0x09DF, 0x150E, 0x1125, 0x1D58, 0x1973,
+    0x24FA, 0x20D1, 0x2CAC, 0x2887, 0x3456, 0x307D, 0x3C00, 0x382B,
+    0x4712, 0x4339, 0x4F44, 0x4B6F, 0x57BE, 0x5395, 0x5FE8, 0x5BC3,
+    0x664A, 0x6261, 0x6E1C, 0x6A37, 0x76E6, 0x72CD, 0x7EB0, 0x7A9B,
+    0x80C2, 0x84E9, 0x8894, 0x8CBF, 0x906E, 0x9445, 0x9838, 0x9C13,
+    0xA19A, 0xA5B1, 0xA9CC, 0xADE7, 0xB136, 0xB51D, 0xB960, 0xBD4B,
+    0xC272, 0xC659, 0xCA24, 0xCE0F, 0xD2DE, 0xD6F5, 0xDA88, 0xDEA3,
+    0xE32A, 0xE701, 0xEB7C, 0xEF57, 0xF386, 0xF7AD, 0xFBD0, 0xFFFB,
+    0x0773, 0x0358, 0x0F25, 0x0B0E, 0x17DF, 0x13F4, 0x1F89, 0x1BA2,
+    0x262B, 0x2200, 0x2E7D, 0x2A56, 0x3687, 0x32AC, 0x3ED1, 0x3AFA,
+    0x45C3, 0x41E8, 0x4D95, 0x49BE, 0x556F, 0x5144, 0x5D39, 0x5912,
+    0x649B, 0x60B0, 0x6CCD, 0x68E6, 0x7437, 0x701C, 0x7C61, 0x784A,
+    0x8213, 0x8638, 0x8A45, 0x8E6E, 0x92BF, 0x9694, 0x9AE9, 0x9EC2,
+    0xA34B, 0xA760, 0xAB1D, 0xAF36, 0xB3E7, 0xB7CC, 0xBBB1, 0xBF9A,
+    0xC0A3, 0xC488, 0xC8F5, 0xCCDE, 0xD00F, 0xD424, 0xD859, 0xDC72,
+    0xE1FB, 0xE5D0, 0xE9AD, 0xED86, 0xF157, 0xF57C, 0xF901, 0xFD2A
+};
+
+/**
+ * @brief crc_a table 6
+ */
+static const uint16_t gsc_ntag21x_crc_table_6[256] =
+{
+    0x0000, 0x9FD5, 0x37BB, 0xA86E, 0x6F76, 0xF0A3, 0x58CD, 0xC718,
+    0xDEEC, 0x4139, 0xE957, 0x7682, 0xB19A, 0x2E4F, 0x8621, 0x19F4,
+    0xB5C9, 0x2A1C, 0x8272, 0x1DA7, 0xDABF, 0x456A, 0xED04, 0x72D1,
+    0x6B25, 0xF4F0, 0x5C9E, 0xC34B, 0x0453, 0x9B86, 0x33E8, 0xAC3D,
+    0x6383, 0xFC56, 0x5438, 0xCBED, 0x0CF5, 0x9320, 0x3B4E, 0xA49B,
+    0xBD6F, 0x22BA, 0x8AD4, 0x1501, 0xD219, 0x4DCC, 0xE5A2, 0x7A77,
+    0xD64A, 0x499F, 0xE1F1, 0x7E24, 0xB93C, 0x26E9, 0x8E87, 0x1152,
+    0x08A6, 0x9773, 0x3F1D, 0xA0C8, 0x67D0, 0xF805, 0x506B, 0xCFBE,
+    0xC706, 0x58D3, 0xF0BD, 0x6F68, 0xA870, 0x37A5, 0x9FCB, 0x001E,
+    0x19EA, 0x863F, 0x2E51, 0xB184, 0x769C, 0xE949, 0x4127, 0xDEF2,
+    0x72CF, 0xED1A, 0x4574, 0xDAA1, 0x1DB9, 0x826C, 0x2A02, 0xB5D7,
+    0xAC23, 0x33F6, 0x9B98, 0x044D, 0xC355, 0x5C80, 0xF4EE, 0x6B3B,
+    0xA485, 0x3B50, 0x933E, 0x0CEB, 0xCBF3, 0x5426, 0xFC48, 0x639D,
+    0x7A69, 0xE5BC, 0x4DD2, 0xD207, 0x151F, 0x8ACA, 0x22A4, 0xBD71,
+    0x114C, 0x8E99, 0x26F7, 0xB922, 0x7E3A, 0xE1EF, 0x4981, 0xD654,
+    0xCFA0, 0x5075, 0xF81B, 0x67CE, 0xA0D6, 0x3F03, 0x976D, 0x08B8,
+    0x861D, 0x19C8, 0xB1A6, 0x2E73, 0xE96B, 0x76BE, 0xDED0, 0x4105,
+    0x58F1, 0xC724, 0x6F4A, 0xF09F, 0x3787, 0xA852, 0x003C, 0x9FE9,
+    0x33D4, 0xAC01, 0x046F, 0x9BBA, 0x5CA2, 0xC377, 0x6B19, 0xF4CC,
+    0xED38, 0x72ED, 0xDA83, 0x4556, 0x824E, 0x1D9B, 0xB5F5, 0x2A20,
+    0xE59E, 0x7A4B, 0xD225, 0x4DF0, 0x8AE8, 0x153D, 0xBD53, 0x2286,
+    0x3B72, 0xA4A7, 0x0CC9, 0x931C, 0x5404, 0xCBD1, 0x63BF, 0xFC6A,
+    0x5057, 0xCF82, 0x67EC, 0xF839, 0x3F21, 0xA0F4, 0x089A, 0x974F,
+    0x8EBB, 0x116E, 0xB900, 0x26D5, 0xE1CD, 0x7E18, 0xD676, 0x49A3,
+    0x411B, 0xDECE, 0x76A0, 0xE975, 0x2E6D, 0xB1B8, 0x19D6, 0x8603,
+    0x9FF7, 0x0022, 0xA84C, 0x3799, 0xF081, 0x6F54, 0xC73A, 0x58EF,
+    0xF4D2, 0x6B07, 0xC369, 0x5CBC, 0x9BA4, 0x0471, 0xAC1F, 0x33CA,
+    0x2A3E, 0xB5EB, 0x1D85, 0x8250, 0x4548, 0xDA9D, 0x72F3, 0xED26,
+    0x2298, 0xBD4D, 0x1523, 0x8AF6, 0x4DEE, 0xD23B, 0x7A55, 0xE580,
+    0xFC74, 0x63A1, 0xCBCF, 0x541A, 0x9302, 0x0CD7, 0xA4B9, 0x3B6C,
+    0x9751, 0x0884, 0xA0EA, 0x3F3F, 0xF827, 0x67F2, 0xCF9C, 0x5049,
+    0x49BD, 0xD668, 0x7E06, 0xE1D3, 0x26CB, 0xB91E, 0x1170, 0x8EA5
+};
+
+/**
+ * @brief crc_a table 7
+ */
+static const uint16_t gsc_ntag21x_crc_table_7[256] =
+{
+    0x0000, 0x81BF, 0x0B6F, 0x8AD0, 0x16DE, 0x9761, 0x1DB1, 0x9C0E,
+    0x2DBC, 0xAC03, 0x26D3, 0xA76C, 0x3B62, 0xBADD, 0x300D, 0xB1B2,
+    0x5B78, 0xDAC7, 0x5017, 0xD1A8, 0x4DA6, 0xCC19, 0x46C9, 0xC776,
+    0x76C4, 0xF77B, 0x7DAB, 0xFC14, 0x601A, 0xE1A5, 0x6B75, 0xEACA,
+    0xB6F0, 0x374F, 0xBD9F, 0x3C20, 0xA02E, 0x2191, 0xAB41, 0x2AFE,
+    0x9B4C, 0x1AF3, 0x9023, 0x119C, 0x8D92, 0x0C2D, 0x86FD, 0x0742,
+    0xED88, 0x6C37, 0xE6E7, 0x6758, 0xFB56, 0x7AE9, 0xF039, 0x7186,
+    0xC034, 0x418B, 0xCB5B, 0x4AE4, 0xD6EA, 0x5755, 0xDD85, 0x5C3A,
+    0x65F1, 0xE44E, 0x6E9E, 0xEF21, 0x732F, 0xF290, 0x7840, 0xF9FF,
+    0x484D, 0xC9F2, 0x4322, 0xC29D, 0x5E93, 0xDF2C, 0x55FC, 0xD443,
+    0x3E89, 0xBF36, 0x35E6, 0xB459, 0x2857, 0xA9E8, 0x2338, 0xA287,
+    0x1335, 0x928A, 0x185A, 0x99E5, 0x05EB, 0x8454, 0x0E84, 0x8F3B,
+    0xD301, 0x52BE, 0xD86E, 0x59D1, 0xC5DF, 0x4460, 0xCEB0, 0x4F0F,
+    0xFEBD, 0x7F02, 0xF5D2, 0x746D, 0xE863, 0x69DC, 0xE30C, 0x62B3,
+    0x8879, 0x09C6, 0x8316, 0x02A9, 0x9EA7, 0x1F18, 0x95C8, 0x1477,
+    0xA5C5, 0x247A, 0xAEAA, 0x2F15, 0xB31B, 0x32A4, 0xB874, 0x39CB,
+    0xCBE2, 0x4A5D, 0xC08D, 0x4132, 0xDD3C, 0x5C83, 0xD653, 0x57EC,
+    0xE65E, 0x67E1, 0xED31, 0x6C8E, 0xF080, 0x713F, 0xFBEF, 0x7A50,
+    0x909A, 0x1125, 0x9BF5, 0x1A4A, 0x8644, 0x07FB, 0x8D2B, 0x0C94,
+    0xBD26, 0x3C99, 0xB649, 0x37F6, 0xABF8, 0x2A47, 0xA097, 0x2128,
+    0x7D12, 0xFCAD, 0x767D, 0xF7C2, 0x6BCC, 0xEA73, 0x60A3, 0xE11C,
+    0x50AE, 0xD111, 0x5BC1, 0xDA7E, 0x4670, 0xC7CF, 0x4D1F, 0xCCA0,
+    0x266A, 0xA7D5, 0x2D05, 0xACBA, 0x30B4, 0xB10B, 0x3BDB, 0xBA64,
+    0x0BD6, 0x8A69, 0x00B9, 0x8106, 0x1D08, 0x9CB7, 0x1667, 0x97D8,
+    0xAE13, 0x2FAC, 0xA57C, 0x24C3, 0xB8CD, 0x3972, 0xB3A2, 0x321D,
+    0x83AF, 0x0210, 0x88C0, 0x097F, 0x9571, 0x14CE, 0x9E1E, 0x1FA1,
+    0xF56B, 0x74D4, 0xFE04, 0x7FBB, 0xE3B5, 0x620A, 0xE8DA, 0x6965,
+    0xD8D7, 0x5968, 0xD3B8, 0x5207, 0xCE09, 0x4FB6, 0xC566, 0x44D9,
+    0x18E3, 0x995C, 0x138C, 0x9233, 0x0E3D, 0x8F82, 0x0552, 0x84ED,
+    0x355F, 0xB4E0, 0x3E30, 0xBF8F, 0x2381, 0xA23E, 0x28EE, 0xA951,
+    0x439B, 0xC224, 0x48F4, 0xC94B, 0x5545, 0xD4FA, 0x5E2A, 0xDF95,
+    0x6E27, 0xEF98, 0x6548, 0xE4F7, 0x78F9, 0xF946, 0x7396, 0xF229
+};
+#endif
+
+/**
+ * @brief     crc update
+ * @param[in] crc current crc
+ * @param[in] *p pointer to a data buffer
+ * @param[in] len data length
+ * @return    updated crc
+ * @note      the backend is chosen by NTAG21X_CRC_BACKEND
+ */
+static uint16_t a_ntag21x_iso14443a_crc_update(uint16_t crc, uint8_t *p, uint16_t len)
+{
+#if (NTAG21X_CRC_BACKEND == NTAG21X_CRC_BACKEND_SLICE_BY_8)
+    while (len >= 8)                                                                       /* 8 bytes per step */
+    {
+        crc = gsc_ntag21x_crc_table_7[(p[0] ^ crc) & 0xFF] ^
+              gsc_ntag21x_crc_table_6[(p[1] ^ (crc >> 8)) & 0xFF] ^
+              gsc_ntag21x_crc_table_5[p[2]] ^ gsc_ntag21x_crc_table_4[p[3]] ^
+              gsc_ntag21x_crc_table_3[p[4]] ^ gsc_ntag21x_crc_table_2[p[5]] ^
+              gsc_ntag21x_crc_table_1[p[6]] ^ gsc_ntag21x_crc_table_0[p[7]];             /* fold 8 bytes */
+        p += 8;                                                                            /* next 8 bytes */
+        len -= 8;                                                                          /* len - 8 */
+    }
+#endif
+#if (NTAG21X_CRC_BACKEND == NTAG21X_CRC_BACKEND_SLICE_BY_4) || (NTAG21X_CRC_BACKEND == NTAG21X_CRC_BACKEND_SLICE_BY_8)
+    while (len >= 4)                                                                       /* 4 bytes per step */
+    {
+        crc = gsc_ntag21x_crc_table_3[(p[0] ^ crc) & 0xFF] ^
+              gsc_ntag21x_crc_table_2[(p[1] ^ (crc >> 8)) & 0xFF] ^
+              gsc_ntag21x_crc_table_1[p[2]] ^ gsc_ntag21x_crc_table_0[p[3]];             /* fold 4 bytes */
+        p += 4;                                                                            /* next 4 bytes */
+        len -= 4;                                                                          /* len - 4 */
+    }
+#endif
+#if (NTAG21X_CRC_BACKEND != NTAG21X_CRC_BACKEND_BITWISE)
+    while (len != 0)                                                                       /* tail bytes */
+    {
+        crc = (uint16_t)((crc >> 8) ^ gsc_ntag21x_crc_table_0[(crc ^ *p++) & 0xFF]);      /* one byte */
+        len--;                                                                             /* len-- */
+    }
+#else
+    while (len != 0)                                                                       /* all bytes */
+    {
+        uint8_t bt;
+        
+        bt = *p++;                                                                         /* get one byte */
+        bt = (bt ^ (uint8_t)(crc & 0x00FF));                                               /* xor */
+        bt = (bt ^ (bt << 4));                                                             /* xor */
+        crc = (uint16_t)((crc >> 8) ^ ((uint16_t)bt << 8) ^
+                         ((uint16_t)bt << 3) ^ ((uint16_t)bt >> 4));                       /* get the crc */
+        len--;                                                                             /* len-- */
+    }
+#endif
+
+    return crc;                                                                            /* return the crc */
+}
+
 /**
  * @brief     crc calculation
  * @param[in] *p pointer to a data buffer
  * @param[in] len data length
  * @note      none
  */
-static void a_ntag21x_iso14443a_crc(uint8_t *p, uint8_t len, uint8_t output[2])
+static void a_ntag21x_iso14443a_crc(uint8_t *p, uint8_t len, uint8_t output[2])
+{
+    uint16_t crc;
+    
+    crc = a_ntag21x_iso14443a_crc_update(NTAG21X_ISO14443A_CRC_INIT, p, len);        /* get the crc */
+    output[0] = (uint8_t)(crc & 0xFF);                                                /* lsb */
+    output[1] = (uint8_t)((crc >> 8) & 0xFF);                                         /* msb */
+}
+
+/**
+ * @brief     call the linked contactless init function
+ * @param[in] *handle pointer to an ntag21x handle structure
+ * @return    contactless init result
+ * @note      the context variant is used when it is linked
+ */
+static uint8_t a_ntag21x_contactless_init(ntag21x_handle_t *handle)
+{
+    if (handle->contactless_init_ctx != NULL)                     /* context variant */
+    {
+        return handle->contactless_init_ctx(handle->user);        /* contactless init */
+    }
+    
+    return handle->contactless_init();                            /* contactless init */
+}
+
+/**
+ * @brief     call the linked contactless deinit function
+ * @param[in] *handle pointer to an ntag21x handle structure
+ * @return    contactless deinit result
+ * @note      the context variant is used when it is linked
+ */
+static uint8_t a_ntag21x_contactless_deinit(ntag21x_handle_t *handle)
+{
+    if (handle->contactless_deinit_ctx != NULL)                     /* context variant */
+    {
+        return handle->contactless_deinit_ctx(handle->user);        /* contactless deinit */
+    }
+    
+    return handle->contactless_deinit();                            /* contactless deinit */
+}
+
+/**
+ * @brief         call the linked contactless transceiver function
+ * @param[in]     *handle pointer to an ntag21x handle structure
+ * @param[in]     *in_buf pointer to an input buffer
+ * @param[in]     in_len input length
+ * @param[out]    *out_buf pointer to an output buffer
+ * @param[in,out] *out_len pointer to an output length buffer
+ * @return        contactless transceiver result
+ * @note          an attached trace goes first, the context variant is used when it is linked
+ */
+static uint8_t a_ntag21x_contactless_transceiver(ntag21x_handle_t *handle, uint8_t *in_buf, uint8_t in_len,
+                                                 uint8_t *out_buf, uint8_t *out_len)
+{
+    if (handle->trace_transceiver != NULL)                                                                 /* attached trace */
+    {
+        return handle->trace_transceiver(handle->trace, in_buf, in_len, out_buf, out_len);                 /* transceiver */
+    }
+    if (handle->contactless_transceiver_ctx != NULL)                                                       /* context variant */
+    {
+        return handle->contactless_transceiver_ctx(handle->user, in_buf, in_len, out_buf, out_len);        /* transceiver */
+    }
+    
+    return handle->contactless_transceiver(in_buf, in_len, out_buf, out_len);                              /* transceiver */
+}
+
+/**
+ * @brief      call the linked contactless bit oriented transceiver function
+ * @param[in]  *handle pointer to an ntag21x handle structure
+ * @param[in]  *in_buf pointer to an input buffer
+ * @param[in]  in_bits input length in bits
+ * @param[out] *out_buf pointer to an output buffer
+ * @param[out] *out_bits pointer to an output bits buffer
+ * @param[out] *collision pointer to a collision flag buffer
+ * @return     contactless transceiver result
+ * @note       an attached trace goes first, the context variant is used when it is linked
+ */
+static uint8_t a_ntag21x_contactless_transceiver_bits(ntag21x_handle_t *handle, uint8_t *in_buf, uint8_t in_bits,
+                                                      uint8_t *out_buf, uint8_t *out_bits, uint8_t *collision)
+{
+    if (handle->trace_transceiver_bits != NULL)                                                                              /* attached trace */
+    {
+        return handle->trace_transceiver_bits(handle->trace, in_buf, in_bits, out_buf, out_bits, collision);                 /* transceiver */
+    }
+    if (handle->contactless_transceiver_bits_ctx != NULL)                                                                    /* context variant */
+    {
+        return handle->contactless_transceiver_bits_ctx(handle->user, in_buf, in_bits, out_buf, out_bits, collision);        /* transceiver */
+    }
+    
+    return handle->contactless_transceiver_bits(in_buf, in_bits, out_buf, out_bits, collision);                              /* transceiver */
+}
+
+/**
+ * @brief     call the linked delay ms function
+ * @param[in] *handle pointer to an ntag21x handle structure
+ * @param[in] ms time
+ * @note      the context variant is used when it is linked
+ */
+static void a_ntag21x_delay_ms(ntag21x_handle_t *handle, uint32_t ms)
+{
+    if (handle->delay_ms_ctx != NULL)                  /* context variant */
+    {
+        handle->delay_ms_ctx(handle->user, ms);        /* delay */
+        
+        return;                                        /* return */
+    }
+    
+    handle->delay_ms(ms);                              /* delay */
+}
+
+#if (NTAG21X_STATISTICS == 1)
+/**
+ * @brief     call the linked timestamp us function
+ * @param[in] *handle pointer to an ntag21x handle structure
+ * @return    timestamp in us
+ * @note      the context variant is used when it is linked
+ */
+static uint32_t a_ntag21x_timestamp_us(ntag21x_handle_t *handle)
+{
+    if (handle->timestamp_us_ctx != NULL)                     /* context variant */
+    {
+        return handle->timestamp_us_ctx(handle->user);        /* timestamp */
+    }
+    
+    return handle->timestamp_us();                            /* timestamp */
+}
+#endif
+
+#if (NTAG21X_STATISTICS == 1)
+/**
+ * @brief     get the statistics command of a frame
+ * @param[in] *in_buf pointer to an input buffer
+ * @param[in] in_len input length
+ * @return    statistics command
+ * @note      the second comp write frame is the only 18 bytes frame
+ */
+static uint8_t a_ntag21x_statistics_command(uint8_t *in_buf, uint8_t in_len)
+{
+    if (in_len == 18)                                                                  /* comp write data frame */
+    {
+        return NTAG21X_STATISTICS_COMMAND_COMP_WRITE;                                  /* comp write */
+    }
+    switch (in_buf[0])                                                                 /* check the command */
+    {
+        case NTAG21X_COMMAND_REQUEST :
+        {
+            return NTAG21X_STATISTICS_COMMAND_REQUEST;                                 /* request */
+        }
+        case NTAG21X_COMMAND_WAKE_UP :
+        {
+            return NTAG21X_STATISTICS_COMMAND_WAKE_UP;                                 /* wake up */
+        }
+        case (NTAG21X_COMMAND_HALT >> 8) :
+        {
+            return NTAG21X_STATISTICS_COMMAND_HALT;                                    /* halt */
+        }
+        case (NTAG21X_COMMAND_ANTICOLLISION_CL1 >> 8) :
+        case (NTAG21X_COMMAND_ANTICOLLISION_CL2 >> 8) :
+        {
+            if ((in_len > 1) && (in_buf[1] == (NTAG21X_COMMAND_SELECT_CL1 & 0xFF)))    /* select */
+            {
+                return NTAG21X_STATISTICS_COMMAND_SELECT;                              /* select */
+            }
+            
+            return NTAG21X_STATISTICS_COMMAND_ANTICOLLISION;                           /* anti collision */
+        }
+        case NTAG21X_COMMAND_GET_VERSION :
+        {
+            return NTAG21X_STATISTICS_COMMAND_GET_VERSION;                             /* get version */
+        }
+        case NTAG21X_COMMAND_READ :
+        {
+            return NTAG21X_STATISTICS_COMMAND_READ;                                    /* read */
+        }
+        case NTAG21X_COMMAND_FAST_READ :
+        {
+            return NTAG21X_STATISTICS_COMMAND_FAST_READ;                               /* fast read */
+        }
+        case NTAG21X_COMMAND_WRITE :
+        {
+            return NTAG21X_STATISTICS_COMMAND_WRITE;                                   /* write */
+        }
+        case NTAG21X_COMMAND_COMP_WRITE :
+        {
+            return NTAG21X_STATISTICS_COMMAND_COMP_WRITE;                              /* comp write */
+        }
+        case NTAG21X_COMMAND_READ_CNT :
+        {
+            return NTAG21X_STATISTICS_COMMAND_READ_CNT;                                /* read cnt */
+        }
+        case NTAG21X_COMMAND_PWD_AUTH :
+        {
+            return NTAG21X_STATISTICS_COMMAND_PWD_AUTH;                                /* pwd auth */
+        }
+        case NTAG21X_COMMAND_READ_SIG :
+        {
+            return NTAG21X_STATISTICS_COMMAND_READ_SIG;                                /* read sig */
+        }
+        default :
+        {
+            return NTAG21X_STATISTICS_COMMAND_OTHER;                                   /* other */
+        }
+    }
+}
+
+/**
+ * @brief     get the histogram bucket of a latency
+ * @param[in] us latency in us
+ * @return    bucket index
+ * @note      none
+ */
+static uint8_t a_ntag21x_statistics_bucket(uint32_t us)
+{
+    uint8_t bucket = 0;
+    
+    while ((us != 0) && (bucket < (NTAG21X_STATISTICS_HISTOGRAM_BUCKETS - 1)))        /* find the highest bit */
+    {
+        us >>= 1;                                                                     /* next bit */
+        bucket++;                                                                     /* next bucket */
+    }
+    
+    return bucket;                                                                    /* return the bucket */
+}
+#endif
+
+/**
+ * @brief     drop the session of the selected tag
+ * @param[in] *handle pointer to an ntag21x handle structure
+ * @note      the tag left the active state, the uid and the learned configuration are kept
+ */
+static void a_ntag21x_session_drop(ntag21x_handle_t *handle)
+{
+    handle->session.selected = 0;             /* not selected */
+    handle->session.authenticated = 0;        /* not authenticated */
+}
+
+/**
+ * @brief     update the session uid on a select
+ * @param[in] *handle pointer to an ntag21x handle structure
+ * @param[in] offset first uid byte
+ * @param[in] *id pointer to a uid part
+ * @param[in] len uid part length
+ * @note      a different uid forgets the learned configuration and the derived password
+ */
+static void a_ntag21x_session_select(ntag21x_handle_t *handle, uint8_t offset, uint8_t *id, uint8_t len)
+{
+    if (memcmp(&handle->session.uid[offset], id, len) != 0)        /* another tag */
+    {
+        memcpy(&handle->session.uid[offset], id, len);             /* save the uid */
+        handle->session.known = 0;                                 /* configuration is unknown */
+        handle->session_key_valid = 0;                             /* password is unknown */
+    }
+}
+
+/**
+ * @brief     learn the access configuration from a page
+ * @param[in] *handle pointer to an ntag21x handle structure
+ * @param[in] page page of the data
+ * @param[in] *data pointer to a 4 bytes page buffer
+ * @note      only cfg0 and cfg1 are used
+ */
+static void a_ntag21x_session_learn(ntag21x_handle_t *handle, uint16_t page, uint8_t *data)
+{
+    if (NTAG21X_END_PAGE(handle) == 0xFF)                               /* end page is unknown */
+    {
+        return;                                                         /* return */
+    }
+    if (page == (uint16_t)NTAG21X_PAGE_CFG0(handle))                    /* cfg0 */
+    {
+        handle->session.auth0 = data[3];                                /* get the auth0 */
+        handle->session.known |= 1 << 0;                                /* auth0 is known */
+    }
+    else if (page == (uint16_t)NTAG21X_PAGE_CFG1(handle))               /* cfg1 */
+    {
+        handle->session.prot = (uint8_t)((data[0] >> 7) & 0x01);        /* get the prot */
+        handle->session.known |= 1 << 1;                                /* prot is known */
+    }
+}
+
+/**
+ * @brief     read the access configuration of the selected tag
+ * @param[in] *handle pointer to an ntag21x handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 read failed
+ * @note      one fast read of cfg0 and cfg1, nothing is printed because a read protected
+ *            tag refuses it before the authentication
+ */
+static uint8_t a_ntag21x_session_load(ntag21x_handle_t *handle)
+{
+    uint8_t res;
+    uint8_t input_buf[5];
+    uint8_t output_len;
+    uint8_t output_buf[10];
+    uint8_t crc_buf[2];
+    
+    input_buf[0] = NTAG21X_COMMAND_FAST_READ;                                                      /* set the command */
+    input_buf[1] = (uint8_t)NTAG21X_PAGE_CFG0(handle);                                             /* set the start page */
+    input_buf[2] = (uint8_t)NTAG21X_PAGE_CFG1(handle);                                             /* set the stop page */
+    a_ntag21x_iso14443a_crc(input_buf, 3, input_buf + 3);                                          /* get the crc */
+    output_len = 10;                                                                               /* set the output length */
+    res = a_ntag21x_contactless_transceiver(handle, input_buf, 5, output_buf, &output_len);        /* transceiver */
+    if ((res != 0) || (output_len != 10))                                                          /* check the result */
+    {
+        return 1;                                                                                  /* return error */
+    }
+    a_ntag21x_iso14443a_crc(output_buf, 8, crc_buf);                                               /* get the crc */
+    if ((output_buf[8] != crc_buf[0]) || (output_buf[9] != crc_buf[1]))                            /* check the crc */
+    {
+        return 1;                                                                                  /* return error */
+    }
+    a_ntag21x_session_learn(handle, NTAG21X_PAGE_CFG0(handle), output_buf);                        /* learn cfg0 */
+    a_ntag21x_session_learn(handle, NTAG21X_PAGE_CFG1(handle), output_buf + 4);                    /* learn cfg1 */
+    
+    return 0;                                                                                      /* success return 0 */
+}
+
+/**
+ * @brief     authenticate before a frame that needs it
+ * @param[in] *handle pointer to an ntag21x handle structure
+ * @param[in] *in_buf pointer to an input buffer
+ * @param[in] in_len input length
+ * @return    status code
+ *            - 0 success
+ *            - 1 authenticate failed
+ * @note      only active with a linked derive_password function, reads and writes of the
+ *            protected pages authenticate once per selection, an unknown configuration is
+ *            read first and a read protected tag is selected again and authenticated
+ */
+static uint8_t a_ntag21x_session_prepare(ntag21x_handle_t *handle, uint8_t *in_buf, uint8_t in_len)
+{
+    uint8_t res;
+    uint8_t write;
+    uint8_t uid[7];
+    uint16_t last;
+    
+    if (((handle->derive_password == NULL) && (handle->derive_password_ctx == NULL)) ||
+        (handle->session.selected == 0) || (handle->session.authenticated != 0) ||
+        (NTAG21X_END_PAGE(handle) == 0xFF))                                                     /* nothing to do */
+    {
+        return 0;                                                                               /* success return 0 */
+    }
+    if ((in_buf[0] == NTAG21X_COMMAND_READ) && (in_len == 4))                                   /* read */
+    {
+        last = (uint16_t)(in_buf[1] + 3);                                                       /* 4 pages */
+        write = 0;                                                                              /* read */
+    }
+    else if ((in_buf[0] == NTAG21X_COMMAND_FAST_READ) && (in_len == 5))                         /* fast read */
+    {
+        last = in_buf[2];                                                                       /* stop page */
+        write = 0;                                                                              /* read */
+    }
+    else if (((in_buf[0] == NTAG21X_COMMAND_WRITE) && (in_len == 8)) ||
+             ((in_buf[0] == NTAG21X_COMMAND_COMP_WRITE) && (in_len == 4)))                      /* write */
+    {
+        last = in_buf[1];                                                                       /* page */
+        write = 1;                                                                              /* write */
+    }
+    else
+    {
+        return 0;                                                                               /* no memory access */
+    }
+    
+    if ((handle->session.known != 0x03) && (a_ntag21x_session_load(handle) != 0))               /* read protected configuration */
+    {
+        memcpy(uid, handle->session.uid, 7);                                                    /* save the uid */
+        res = ntag21x_reselect(handle, uid);                                                    /* the refused read halted the tag */
+        if ((res != 0) || (memcmp(uid, handle->session.uid, 7) != 0))                           /* check the tag */
+        {
+            return 1;                                                                           /* return error */
+        }
+        if (ntag21x_session_authenticate(handle) != 0)                                          /* authenticate */
+        {
+            return 1;                                                                           /* return error */
+        }
+        (void)a_ntag21x_session_load(handle);                                                   /* readable now */
+        
+        return 0;                                                                               /* success return 0 */
+    }
+    if ((last < handle->session.auth0) || ((write == 0) && (handle->session.prot == 0)))        /* not protected */
+    {
+        return 0;                                                                               /* success return 0 */
+    }
+    
+    return (ntag21x_session_authenticate(handle) == 0) ? 0 : 1;                                 /* authenticate */
+}
+
+/**
+ * @brief         transceiver a driver frame
+ * @param[in]     *handle pointer to an ntag21x handle structure
+ * @param[in]     *in_buf pointer to an input buffer
+ * @param[in]     in_len input length
+ * @param[out]    *out_buf pointer to an output buffer
+ * @param[in,out] *out_len pointer to an output length buffer
+ * @return        contactless transceiver result
+ * @note          every driver frame goes through here, the statistics are recorded when enabled
+ *                and the session authenticates before a protected memory access
+ */
+static uint8_t a_ntag21x_transceiver(ntag21x_handle_t *handle, uint8_t *in_buf, uint8_t in_len,
+                                     uint8_t *out_buf, uint8_t *out_len)
+{
+#if (NTAG21X_STATISTICS == 1)
+    uint8_t res;
+    uint8_t command;
+    uint8_t expect;
+    uint8_t clock;
+    uint32_t start = 0;
+    uint32_t us;
+    ntag21x_command_statistics_t *s;
+    
+    if (a_ntag21x_session_prepare(handle, in_buf, in_len) != 0)                                     /* authenticate */
+    {
+        return 1;                                                                                   /* return error */
+    }
+    command = a_ntag21x_statistics_command(in_buf, in_len);                                         /* get the command */
+    handle->statistics_command = command;                                                           /* save the command */
+    s = &handle->statistics.command[command];                                                       /* get the statistics */
+    expect = *out_len;                                                                              /* save the expected length */
+    clock = (uint8_t)((handle->timestamp_us != NULL) || (handle->timestamp_us_ctx != NULL));        /* check the clock */
+    if (clock != 0)                                                                                 /* clock linked */
+    {
+        start = a_ntag21x_timestamp_us(handle);                                                     /* start time */
+    }
+    res = a_ntag21x_contactless_transceiver(handle, in_buf, in_len, out_buf, out_len);              /* transceiver */
+    if (clock != 0)                                                                                 /* clock linked */
+    {
+        us = a_ntag21x_timestamp_us(handle) - start;                                                /* get the latency */
+        s->histogram[a_ntag21x_statistics_bucket(us)]++;                                            /* update the histogram */
+        s->latency_total_us += us;                                                                  /* update the total */
+        if (us > s->latency_max_us)                                                                 /* check the max */
+        {
+            s->latency_max_us = us;                                                                 /* update the max */
+        }
+    }
+    s->calls++;                                                                                     /* update the calls */
+    s->bytes_out += in_len;                                                                         /* update the bytes out */
+    if (res != 0)                                                                                   /* check the result */
+    {
+        if (command != NTAG21X_STATISTICS_COMMAND_HALT)                                             /* halt is never answered */
+        {
+            s->transceiver_errors++;                                                                /* transceiver error */
+        }
+        
+        return res;                                                                                 /* return the result */
+    }
+    s->bytes_in += *out_len;                                                                        /* update the bytes in */
+    if ((*out_len == 1) && (out_buf[0] != 0x0A) && ((out_buf[0] & 0xF0) == 0) &&
+        (command >= NTAG21X_STATISTICS_COMMAND_GET_VERSION))                                        /* 4 bits nak */
+    {
+        s->naks++;                                                                                  /* nak */
+    }
+    else if (*out_len != expect)                                                                    /* check the output_len */
+    {
+        s->output_len_errors++;                                                                     /* output_len error */
+    }
+    
+    return res;                                                                                     /* return the result */
+#else
+    if (a_ntag21x_session_prepare(handle, in_buf, in_len) != 0)                                     /* authenticate */
+    {
+        return 1;                                                                                   /* return error */
+    }
+    
+    return a_ntag21x_contactless_transceiver(handle, in_buf, in_len, out_buf, out_len);             /* transceiver */
+#endif
+}
+
+/**
+ * @brief     record a crc error of the last frame
+ * @param[in] *handle pointer to an ntag21x handle structure
+ * @note      none
+ */
+static void a_ntag21x_statistics_crc_error(ntag21x_handle_t *handle)
+{
+#if (NTAG21X_STATISTICS == 1)
+    handle->statistics.command[handle->statistics_command].crc_errors++;        /* crc error */
+#else
+    (void)handle;                                                                /* not used */
+#endif
+}
+
+/**
+ * @brief     record a pack mismatch of the last frame
+ * @param[in] *handle pointer to an ntag21x handle structure
+ * @note      none
+ */
+static void a_ntag21x_statistics_pack_error(ntag21x_handle_t *handle)
+{
+#if (NTAG21X_STATISTICS == 1)
+    handle->statistics.command[handle->statistics_command].pack_errors++;        /* pack error */
+#else
+    (void)handle;                                                                 /* not used */
+#endif
+}
+
+/**
+ * @brief     get the number of cacheable pages
+ * @param[in] *handle pointer to an ntag21x handle structure
+ * @return    page count
+ * @note      nothing is cached until the end page is known
+ */
+static uint16_t a_ntag21x_cache_pages(ntag21x_handle_t *handle)
+{
+    uint16_t pages;
+    
+    if ((handle->page_cache == NULL) || (NTAG21X_END_PAGE(handle) == 0xFF))         /* check the cache */
+    {
+        return 0;                                                                   /* no cache */
+    }
+    pages = handle->page_cache_pages;                                               /* buffer pages */
+    if (pages > (uint16_t)(NTAG21X_END_PAGE(handle) + 1))                           /* check the end page */
+    {
+        pages = (uint16_t)(NTAG21X_END_PAGE(handle) + 1);                           /* clamp to the tag */
+    }
+    
+    return pages;                                                                   /* return the pages */
+}
+
+/**
+ * @brief      read pages from the cache
+ * @param[in]  *handle pointer to an ntag21x handle structure
+ * @param[in]  page first page
+ * @param[in]  num page number
+ * @param[out] *data pointer to a data buffer
+ * @return     1 if every page is cached, 0 otherwise
+ * @note       none
+ */
+static uint8_t a_ntag21x_cache_read(ntag21x_handle_t *handle, uint16_t page, uint16_t num, uint8_t *data)
+{
+    uint16_t i;
+    
+    if ((uint16_t)(page + num) > a_ntag21x_cache_pages(handle))                     /* check the range */
+    {
+        return 0;                                                                   /* miss */
+    }
+    for (i = page; i < page + num; i++)                                             /* check all pages */
+    {
+        if ((handle->page_cache_valid[i / 8] & (1 << (i % 8))) == 0)                /* check the valid bit */
+        {
+            return 0;                                                               /* miss */
+        }
+    }
+    memcpy(data, handle->page_cache + page * 4, num * 4);                           /* copy the data */
+    
+    return 1;                                                                       /* hit */
+}
+
+/**
+ * @brief     fill pages into the cache
+ * @param[in] *handle pointer to an ntag21x handle structure
+ * @param[in] page first page
+ * @param[in] *data pointer to a data buffer
+ * @param[in] num page number
+ * @note      pages the cache can not hold are skipped
+ */
+static void a_ntag21x_cache_fill(ntag21x_handle_t *handle, uint16_t page, uint8_t *data, uint16_t num)
+{
+    uint16_t i;
+    uint16_t pages;
+    
+    pages = a_ntag21x_cache_pages(handle);                                          /* get the cache pages */
+    for (i = 0; i < num; i++)                                                       /* all pages */
+    {
+        a_ntag21x_session_learn(handle, (uint16_t)(page + i), data + i * 4);        /* learn the configuration */
+        if ((page + i) >= pages)                                                    /* check the range */
+        {
+            continue;                                                               /* next page */
+        }
+        memcpy(handle->page_cache + (page + i) * 4, data + i * 4, 4);               /* copy the page */
+        handle->page_cache_valid[(page + i) / 8] |= (uint8_t)(1 << ((page + i) % 8));    /* set the valid bit */
+    }
+}
+
+/**
+ * @brief     fill a read response into the cache
+ * @param[in] *handle pointer to an ntag21x handle structure
+ * @param[in] page first page
+ * @param[in] *data pointer to a 16 bytes data buffer
+ * @note      the read command rolls over to page 0 after the end page,
+ *            a read protected tag rolls over at auth0 before the authentication
+ *            so the pages from auth0 are not filled, the configuration is learned
+ *            even without a cache
+ */
+static void a_ntag21x_cache_fill_read(ntag21x_handle_t *handle, uint8_t page, uint8_t data[16])
+{
+    uint8_t i;
+    uint8_t stop;
+    uint16_t end;
+    
+    end = (uint16_t)(NTAG21X_END_PAGE(handle) + 1);                                  /* roll over page */
+    stop = 0;                                                                        /* roll over */
+    if ((handle->session.authenticated == 0) && 
+        (((handle->session.known & (1 << 1)) == 0) || (handle->session.prot != 0)))  /* reads may be protected */
+    {
+        if ((handle->session.known & (1 << 0)) == 0)                                 /* auth0 is unknown */
+        {
+            end = (uint16_t)(page + 1);                                              /* only the first page */
+            stop = 1;                                                                /* stop */
+        }
+        else if (handle->session.auth0 < end)                                        /* auth0 is in the memory */
+        {
+            end = handle->session.auth0;                                             /* stop at auth0 */
+            stop = 1;                                                                /* stop */
+        }
+    }
+    for (i = 0; i < 4; i++)                                                          /* 4 pages */
+    {
+        if ((stop != 0) && ((page + i) >= end))                                      /* wrapped page */
+        {
+            break;                                                                   /* break */
+        }
+        a_ntag21x_cache_fill(handle, (uint16_t)((page + i) % end), 
+                             data + i * 4, 1);                                       /* fill one page */
+    }
+}
+
+/**
+ * @brief     drop one page from the cache
+ * @param[in] *handle pointer to an ntag21x handle structure
+ * @param[in] page dropped page
+ * @note      none
+ */
+static void a_ntag21x_cache_drop(ntag21x_handle_t *handle, uint8_t page)
 {
-    uint32_t w_crc = 0x6363;
+    handle->page_cache_valid[page / 8] &= (uint8_t)(~(1 << (page % 8)));            /* clear the valid bit */
+}
+
+/**
+ * @brief     drop the pages behind auth0 from the cache
+ * @param[in] *handle pointer to an ntag21x handle structure
+ * @note      an unknown auth0 drops the whole cache
+ */
+static void a_ntag21x_cache_drop_protected(ntag21x_handle_t *handle)
+{
+    uint16_t i;
+    uint16_t pages;
     
-    do 
+    if ((handle->session.known & (1 << 0)) == 0)                                    /* auth0 is unknown */
     {
-        uint8_t  bt;
+        memset(handle->page_cache_valid, 0, sizeof(handle->page_cache_valid));      /* drop all */
         
-        bt = *p++;                                                                                        /* get one byte */
-        bt = (bt ^ (uint8_t)(w_crc & 0x00FF));                                                            /* xor */
-        bt = (bt ^ (bt << 4));                                                                            /* xor */
-        w_crc = (w_crc >> 8) ^ ((uint32_t) bt << 8) ^ ((uint32_t) bt << 3) ^ ((uint32_t) bt >> 4);        /* get the crc */
-    } while (--len);                                                                                      /* len-- */
+        return;                                                                     /* return */
+    }
+    pages = a_ntag21x_cache_pages(handle);                                          /* get the cache pages */
+    for (i = handle->session.auth0; i < pages; i++)                                 /* all protected pages */
+    {
+        a_ntag21x_cache_drop(handle, (uint8_t)i);                                   /* drop the page */
+    }
+}
 
-    output[0] = (uint8_t)(w_crc & 0xFF);                                                                  /* lsb */
-    output[1] = (uint8_t)((w_crc >> 8) & 0xFF);                                                           /* msb */
+/**
+ * @brief     update the cache after a page is written
+ * @param[in] *handle pointer to an ntag21x handle structure
+ * @param[in] page written page
+ * @param[in] *data pointer to a data buffer
+ * @note      otp, lock, password and pack pages are dropped because the tag
+ *            does not read back what was written, the configuration pages
+ *            change the mirror and the access so the whole cache is dropped
+ */
+static void a_ntag21x_cache_write(ntag21x_handle_t *handle, uint8_t page, uint8_t data[4])
+{
+    a_ntag21x_session_learn(handle, page, data);                                           /* learn the configuration */
+    if ((page == NTAG21X_PAGE_CFG0(handle)) || (page == NTAG21X_PAGE_CFG1(handle)))        /* configuration pages */
+    {
+        memset(handle->page_cache_valid, 0, sizeof(handle->page_cache_valid));             /* drop all */
+    }
+    else if ((page < 4) || (page >= NTAG21X_PAGE_DYNAMIC_LOCK(handle)))                    /* otp, lock, pwd and pack */
+    {
+        a_ntag21x_cache_drop(handle, page);                                                /* drop the page */
+    }
+    else
+    {
+        a_ntag21x_cache_fill(handle, page, data, 1);                                       /* write through */
+    }
 }
 
 /**
@@ -110,22 +1156,26 @@ static uint8_t a_ntag21x_conf_read(ntag21x_handle_t *handle, uint8_t page, uint8
     uint8_t output_buf[6];
     uint8_t crc_buf[2];
     
+    if (a_ntag21x_cache_read(handle, page, 1, data) != 0)                                       /* read from the cache */
+    {
+        return 0;                                                                                /* success return 0 */
+    }
     input_len = 5;                                                                               /* set the input length */
     input_buf[0] = NTAG21X_COMMAND_FAST_READ;                                                    /* set the command */
     input_buf[1] = page;                                                                         /* set the start page */
     input_buf[2] = page;                                                                         /* set the stop page */
     a_ntag21x_iso14443a_crc(input_buf , 3, input_buf + 3);                                       /* get the crc */
     output_len = 6;                                                                              /* set the output length */
-    res = handle->contactless_transceiver(input_buf, input_len, output_buf, &output_len);        /* transceiver */
+    res = a_ntag21x_transceiver(handle, input_buf, input_len, output_buf, &output_len);          /* transceiver */
     if (res != 0)                                                                                /* check the result */
     {
-        handle->debug_print("ntag21x: contactless transceiver failed.\n");                       /* contactless transceiver failed */
+        NTAG21X_PRINT(handle, "ntag21x: contactless transceiver failed.\n");                     /* contactless transceiver failed */
         
         return 1;                                                                                /* return error */
     }
     if (output_len != 6)                                                                         /* check the output_len */
     {
-        handle->debug_print("ntag21x: output_len is invalid.\n");                                /* output_len is invalid */
+        NTAG21X_PRINT(handle, "ntag21x: output_len is invalid.\n");                              /* output_len is invalid */
         
         return 1;                                                                                /* return error */
     }
@@ -133,12 +1183,14 @@ static uint8_t a_ntag21x_conf_read(ntag21x_handle_t *handle, uint8_t page, uint8
     if ((output_buf[4] == crc_buf[0]) && (output_buf[5] == crc_buf[1]))                          /* check the crc */
     {
         memcpy(data, output_buf, 4);                                                             /* copy the data */
+        a_ntag21x_cache_fill(handle, page, output_buf, 1);                                       /* fill the cache */
         
         return 0;                                                                                /* success return 0 */
     }
     else
     {
-        handle->debug_print("ntag21x: crc error.\n");                                            /* crc error */
+        a_ntag21x_statistics_crc_error(handle);                                                  /* record the crc error */
+        NTAG21X_PRINT(handle, "ntag21x: crc error.\n");                                          /* crc error */
         
         return 1;                                                                                /* return error */
     }
@@ -162,6 +1214,7 @@ static uint8_t a_ntag21x_conf_write(ntag21x_handle_t *handle, uint8_t page, uint
     uint8_t output_len;
     uint8_t output_buf[1];
     
+    a_ntag21x_cache_drop(handle, page);                                                          /* drop the cached page */
     input_len = 8;                                                                               /* set the input length */
     input_buf[0] = NTAG21X_COMMAND_WRITE;                                                        /* set the command */
     input_buf[1] = page;                                                                         /* set the setting page */
@@ -171,25 +1224,26 @@ static uint8_t a_ntag21x_conf_write(ntag21x_handle_t *handle, uint8_t page, uint
     input_buf[5] = data[3];                                                                      /* set data3 */
     a_ntag21x_iso14443a_crc(input_buf, 6, input_buf + 6);                                        /* get the crc */
     output_len = 1;                                                                              /* set the output length */
-    res = handle->contactless_transceiver(input_buf, input_len, output_buf, &output_len);        /* transceiver */
+    res = a_ntag21x_transceiver(handle, input_buf, input_len, output_buf, &output_len);          /* transceiver */
     if (res != 0)                                                                                /* check the result */
     {
-        handle->debug_print("ntag21x: contactless transceiver failed.\n");                       /* contactless transceiver failed */
+        NTAG21X_PRINT(handle, "ntag21x: contactless transceiver failed.\n");                     /* contactless transceiver failed */
         
         return 1;                                                                                /* return error */
     }
     if (output_len != 1)                                                                         /* check the output_len */
     {
-        handle->debug_print("ntag21x: output_len is invalid.\n");                                /* output_len is invalid */
+        NTAG21X_PRINT(handle, "ntag21x: output_len is invalid.\n");                              /* output_len is invalid */
         
         return 1;                                                                                /* return error */
     }
     if (output_buf[0] != 0xA)                                                                    /* check the result */
     {
-        handle->debug_print("ntag21x: ack error.\n");                                            /* ack error */
+        NTAG21X_PRINT(handle, "ntag21x: ack error.\n");                                          /* ack error */
         
         return 1;                                                                                /* return error */
     }
+    a_ntag21x_cache_write(handle, page, data);                                                   /* update the cache */
     
     return 0;                                                                                    /* success return 0 */
 }
@@ -208,51 +1262,63 @@ uint8_t ntag21x_init(ntag21x_handle_t *handle)
 {
     uint8_t res;
     
-    if (handle == NULL)                                                            /* check handle */
+    if (handle == NULL)                                                                                    /* check handle */
     {
-        return 2;                                                                  /* return error */
+        return 2;                                                                                          /* return error */
     }
-    if (handle->debug_print == NULL)                                               /* check debug_print */
+    if ((handle->debug_print == NULL) && (handle->debug_print_ctx == NULL))                                /* check debug_print */
     {
-        return 3;                                                                  /* return error */
+        return 3;                                                                                          /* return error */
     }
-    if (handle->contactless_init == NULL)                                          /* check contactless_init */
+    if ((handle->contactless_init == NULL) && (handle->contactless_init_ctx == NULL))                      /* check contactless_init */
     {
-        handle->debug_print("ntag21x: contactless_init is null.\n");               /* contactless_init is null */
+        NTAG21X_PRINT(handle, "ntag21x: contactless_init is null.\n");                                     /* contactless_init is null */
         
-        return 3;                                                                  /* return error */
+        return 3;                                                                                          /* return error */
     }
-    if (handle->contactless_deinit == NULL)                                        /* check contactless_deinit */
+    if ((handle->contactless_deinit == NULL) && (handle->contactless_deinit_ctx == NULL))                  /* check contactless_deinit */
     {
-        handle->debug_print("ntag21x: contactless_deinit is null.\n");             /* contactless_deinit is null */
+        NTAG21X_PRINT(handle, "ntag21x: contactless_deinit is null.\n");                                   /* contactless_deinit is null */
         
-        return 3;                                                                  /* return error */
+        return 3;                                                                                          /* return error */
     }
-    if (handle->contactless_transceiver == NULL)                                   /* check contactless_transceiver */
+    if ((handle->contactless_transceiver == NULL) && (handle->contactless_transceiver_ctx == NULL) &&
+        (handle->trace_transceiver == NULL))                                                               /* check contactless_transceiver */
     {
-        handle->debug_print("ntag21x: contactless_transceiver is null.\n");        /* contactless_transceiver is null */
+        NTAG21X_PRINT(handle, "ntag21x: contactless_transceiver is null.\n");                              /* contactless_transceiver is null */
         
-        return 3;                                                                  /* return error */
+        return 3;                                                                                          /* return error */
     }
-    if (handle->delay_ms == NULL)                                                  /* check delay_ms */
+    if ((handle->delay_ms == NULL) && (handle->delay_ms_ctx == NULL))                                      /* check delay_ms */
     {
-        handle->debug_print("ntag21x: delay_ms is null.\n");                       /* delay_ms is null */
+        NTAG21X_PRINT(handle, "ntag21x: delay_ms is null.\n");                                             /* delay_ms is null */
         
-        return 3;                                                                  /* return error */
+        return 3;                                                                                          /* return error */
     }
     
-    res = handle->contactless_init();                                              /* contactless init */
-    if (res != 0)                                                                  /* check the result */
+    res = a_ntag21x_contactless_init(handle);                                                              /* contactless init */
+    if (res != 0)                                                                                          /* check the result */
     {
-        handle->debug_print("ntag21x: contactless init failed.\n");                /* contactless init failed */
+        NTAG21X_PRINT(handle, "ntag21x: contactless init failed.\n");                                      /* contactless init failed */
         
-        return 1;                                                                  /* return error */
-    }
-    handle->type = NTAG21X_TYPE_INVALID;                                           /* set the invalid type */
-    handle->end_page = 0xFF;                                                       /* set 0xFF */
-    handle->inited = 1;                                                            /* flag inited */
+        return 1;                                                                                          /* return error */
+    }
+    handle->type = NTAG21X_TYPE_INVALID;                                                                   /* set the invalid type */
+#if (NTAG21X_VARIANT == NTAG21X_VARIANT_GENERIC)
+    handle->end_page = 0xFF;                                                                               /* set 0xFF */
+#else
+    handle->end_page = NTAG21X_VARIANT_END_PAGE;                                                           /* set the built variant */
+#endif
+    handle->max_frame_len = NTAG21X_DEFAULT_MAX_FRAME_LEN;                                                 /* set the default frame length */
+    memset(handle->page_cache_valid, 0, sizeof(handle->page_cache_valid));                                 /* invalidate the page cache */
+    memset(&handle->session, 0, sizeof(ntag21x_session_t));                                                /* no session */
+    handle->session_key_valid = 0;                                                                         /* no password */
+#if (NTAG21X_STATISTICS == 1)
+    memset(&handle->statistics, 0, sizeof(ntag21x_statistics_t));                                          /* clear the statistics */
+#endif
+    handle->inited = 1;                                                                                    /* flag inited */
     
-    return 0;                                                                      /* success return 0 */
+    return 0;                                                                                              /* success return 0 */
 }
 
 /**
@@ -269,25 +1335,25 @@ uint8_t ntag21x_deinit(ntag21x_handle_t *handle)
 {
     uint8_t res;
     
-    if (handle == NULL)                                                      /* check handle */
+    if (handle == NULL)                                                        /* check handle */
     {
-        return 2;                                                            /* return error */
+        return 2;                                                              /* return error */
     }
-    if (handle->inited != 1)                                                 /* check handle initialization */
+    if (handle->inited != 1)                                                   /* check handle initialization */
     {
-        return 3;                                                            /* return error */
+        return 3;                                                              /* return error */
     }
     
-    res = handle->contactless_deinit();                                      /* contactless deinit */
-    if (res != 0)                                                            /* check the result */
+    res = a_ntag21x_contactless_deinit(handle);                                /* contactless deinit */
+    if (res != 0)                                                              /* check the result */
     {
-        handle->debug_print("ntag21x: contactless deinit failed.\n");        /* contactless deinit failed */
+        NTAG21X_PRINT(handle, "ntag21x: contactless deinit failed.\n");        /* contactless deinit failed */
         
-        return 1;                                                            /* return error */
+        return 1;                                                              /* return error */
     }
-    handle->inited = 0;                                                      /* flag closed */
+    handle->inited = 0;                                                        /* flag closed */
     
-    return 0;                                                                /* success return 0 */
+    return 0;                                                                  /* success return 0 */
 }
 
 /**
@@ -320,19 +1386,20 @@ uint8_t ntag21x_request(ntag21x_handle_t *handle, ntag21x_type_t *type)
         return 3;                                                                                /* return error */
     }
     
+    a_ntag21x_session_drop(handle);                                                              /* a new anti collision loop */
     input_len = 1;                                                                               /* set the input length */
     input_buf[0] = NTAG21X_COMMAND_REQUEST;                                                      /* set the command */
     output_len = 2;                                                                              /* set the output length */
-    res = handle->contactless_transceiver(input_buf, input_len, output_buf, &output_len);        /* transceiver */
+    res = a_ntag21x_transceiver(handle, input_buf, input_len, output_buf, &output_len);          /* transceiver */
     if (res != 0)                                                                                /* check the result */
     {
-        handle->debug_print("ntag21x: contactless transceiver failed.\n");                       /* contactless transceiver failed */
+        NTAG21X_PRINT(handle, "ntag21x: contactless transceiver failed.\n");                     /* contactless transceiver failed */
         
         return 1;                                                                                /* return error */
     }
     if (output_len != 2)                                                                         /* check the output_len */
     {
-        handle->debug_print("ntag21x: output_len is invalid.\n");                                /* output_len is invalid */
+        NTAG21X_PRINT(handle, "ntag21x: output_len is invalid.\n");                              /* output_len is invalid */
         
         return 4;                                                                                /* return error */
     }
@@ -347,7 +1414,7 @@ uint8_t ntag21x_request(ntag21x_handle_t *handle, ntag21x_type_t *type)
     {
         *type = NTAG21X_TYPE_INVALID;                                                            /* invalid */
         handle->type = *type;                                                                    /* save the type */
-        handle->debug_print("ntag21x: type is invalid.\n");                                      /* type is invalid */
+        NTAG21X_PRINT(handle, "ntag21x: type is invalid.\n");                                    /* type is invalid */
         
         return 5;                                                                                /* return error */
     }
@@ -374,46 +1441,47 @@ uint8_t ntag21x_wake_up(ntag21x_handle_t *handle, ntag21x_type_t *type)
     uint8_t output_len;
     uint8_t output_buf[2];
     
-    if (handle == NULL)                                                                          /* check handle */
+    if (handle == NULL)                                                                        /* check handle */
     {
-        return 2;                                                                                /* return error */
+        return 2;                                                                              /* return error */
     }
-    if (handle->inited != 1)                                                                     /* check handle initialization */
+    if (handle->inited != 1)                                                                   /* check handle initialization */
     {
-        return 3;                                                                                /* return error */
+        return 3;                                                                              /* return error */
     }
     
-    handle->delay_ms(1);                                                                         /* delay 1ms */
-    input_len = 1;                                                                               /* set the input length */
-    input_buf[0] = NTAG21X_COMMAND_WAKE_UP;                                                      /* set the command */
-    output_len = 2;                                                                              /* set the output length */
-    res = handle->contactless_transceiver(input_buf, input_len, output_buf, &output_len);        /* transceiver */
-    if (res != 0)                                                                                /* check the result */
-    {
-        handle->debug_print("ntag21x: contactless transceiver failed.\n");                       /* contactless transceiver failed */
+    a_ntag21x_delay_ms(handle, 1);                                                             /* delay 1ms */
+    a_ntag21x_session_drop(handle);                                                            /* a new anti collision loop */
+    input_len = 1;                                                                             /* set the input length */
+    input_buf[0] = NTAG21X_COMMAND_WAKE_UP;                                                    /* set the command */
+    output_len = 2;                                                                            /* set the output length */
+    res = a_ntag21x_transceiver(handle, input_buf, input_len, output_buf, &output_len);        /* transceiver */
+    if (res != 0)                                                                              /* check the result */
+    {
+        NTAG21X_PRINT(handle, "ntag21x: contactless transceiver failed.\n");                   /* contactless transceiver failed */
         
-        return 1;                                                                                /* return error */
+        return 1;                                                                              /* return error */
     }
-    if (output_len != 2)                                                                         /* check the output_len */
+    if (output_len != 2)                                                                       /* check the output_len */
     {
-        handle->debug_print("ntag21x: output_len is invalid.\n");                                /* output_len is invalid */
+        NTAG21X_PRINT(handle, "ntag21x: output_len is invalid.\n");                            /* output_len is invalid */
         
-        return 4;                                                                                /* return error */
+        return 4;                                                                              /* return error */
     }
-    if ((output_buf[0] == 0x44) && (output_buf[1] == 0x00))                                      /* check classic type */
+    if ((output_buf[0] == 0x44) && (output_buf[1] == 0x00))                                    /* check classic type */
     {
-        *type = NTAG21X_TYPE_213_5_6;                                                            /* ntag213/5/6 */
-        handle->type = *type;                                                                    /* save the type */
+        *type = NTAG21X_TYPE_213_5_6;                                                          /* ntag213/5/6 */
+        handle->type = *type;                                                                  /* save the type */
         
-        return 0;                                                                                /* success return 0 */
+        return 0;                                                                              /* success return 0 */
     }
     else
     {
-        *type = NTAG21X_TYPE_INVALID;                                                            /* invalid */
-        handle->type = *type;                                                                    /* save the type */
-        handle->debug_print("ntag21x: type is invalid.\n");                                      /* type is invalid */
+        *type = NTAG21X_TYPE_INVALID;                                                          /* invalid */
+        handle->type = *type;                                                                  /* save the type */
+        NTAG21X_PRINT(handle, "ntag21x: type is invalid.\n");                                  /* type is invalid */
         
-        return 5;                                                                                /* return error */
+        return 5;                                                                              /* return error */
     }
 }
 
@@ -443,12 +1511,14 @@ uint8_t ntag21x_halt(ntag21x_handle_t *handle)
         return 3;                                                                                /* return error */
     }
     
+    memset(handle->page_cache_valid, 0, sizeof(handle->page_cache_valid));                       /* invalidate the page cache */
+    a_ntag21x_session_drop(handle);                                                              /* the tag leaves the active state */
     input_len = 4;                                                                               /* set the input length */
     input_buf[0] = (NTAG21X_COMMAND_HALT >> 8) & 0xFF;                                           /* set the command */
     input_buf[1] = (NTAG21X_COMMAND_HALT >> 0) & 0xFF;                                           /* set the command */
     a_ntag21x_iso14443a_crc(input_buf, 2, input_buf + 2);                                        /* get the crc */
     output_len = 1;                                                                              /* set the output length */
-    (void)handle->contactless_transceiver(input_buf, input_len, output_buf, &output_len);        /* transceiver */
+    (void)a_ntag21x_transceiver(handle, input_buf, input_len, output_buf, &output_len);          /* transceiver */
     
     return 0;                                                                                    /* success return 0 */
 }
@@ -489,16 +1559,16 @@ uint8_t ntag21x_anticollision_cl1(ntag21x_handle_t *handle, uint8_t id[4])
     input_buf[0] = (NTAG21X_COMMAND_ANTICOLLISION_CL1 >> 8) & 0xFF;                              /* set the command */
     input_buf[1] = (NTAG21X_COMMAND_ANTICOLLISION_CL1 >> 0) & 0xFF;                              /* set the command */
     output_len = 5;                                                                              /* set the output length */
-    res = handle->contactless_transceiver(input_buf, input_len, output_buf, &output_len);        /* transceiver */
+    res = a_ntag21x_transceiver(handle, input_buf, input_len, output_buf, &output_len);          /* transceiver */
     if (res != 0)                                                                                /* check the result */
     {
-        handle->debug_print("ntag21x: contactless transceiver failed.\n");                       /* contactless transceiver failed */
+        NTAG21X_PRINT(handle, "ntag21x: contactless transceiver failed.\n");                     /* contactless transceiver failed */
         
         return 1;                                                                                /* return error */
     }
     if (output_len != 5)                                                                         /* check the output_len */
     {
-        handle->debug_print("ntag21x: output_len is invalid.\n");                                /* output_len is invalid */
+        NTAG21X_PRINT(handle, "ntag21x: output_len is invalid.\n");                              /* output_len is invalid */
         
         return 4;                                                                                /* return error */
     }
@@ -510,7 +1580,7 @@ uint8_t ntag21x_anticollision_cl1(ntag21x_handle_t *handle, uint8_t id[4])
     }
     if (check != output_buf[4])                                                                  /* check the result */
     {
-        handle->debug_print("ntag21x: check error.\n");                                          /* check error */
+        NTAG21X_PRINT(handle, "ntag21x: check error.\n");                                        /* check error */
         
         return 5;                                                                                /* return error */
     }
@@ -554,16 +1624,16 @@ uint8_t ntag21x_anticollision_cl2(ntag21x_handle_t *handle, uint8_t id[4])
     input_buf[0] = (NTAG21X_COMMAND_ANTICOLLISION_CL2 >> 8) & 0xFF;                              /* set the command */
     input_buf[1] = (NTAG21X_COMMAND_ANTICOLLISION_CL2 >> 0) & 0xFF;                              /* set the command */
     output_len = 5;                                                                              /* set the output length */
-    res = handle->contactless_transceiver(input_buf, input_len, output_buf, &output_len);        /* transceiver */
+    res = a_ntag21x_transceiver(handle, input_buf, input_len, output_buf, &output_len);          /* transceiver */
     if (res != 0)                                                                                /* check the result */
     {
-        handle->debug_print("ntag21x: contactless transceiver failed.\n");                       /* contactless transceiver failed */
+        NTAG21X_PRINT(handle, "ntag21x: contactless transceiver failed.\n");                     /* contactless transceiver failed */
         
         return 1;                                                                                /* return error */
     }
     if (output_len != 5)                                                                         /* check the output_len */
     {
-        handle->debug_print("ntag21x: output_len is invalid.\n");                                /* output_len is invalid */
+        NTAG21X_PRINT(handle, "ntag21x: output_len is invalid.\n");                              /* output_len is invalid */
         
         return 4;                                                                                /* return error */
     }
@@ -575,10 +1645,125 @@ uint8_t ntag21x_anticollision_cl2(ntag21x_handle_t *handle, uint8_t id[4])
     }
     if (check != output_buf[4])                                                                  /* check the result */
     {
-        handle->debug_print("ntag21x: check error.\n");                                          /* check error */
+        NTAG21X_PRINT(handle, "ntag21x: check error.\n");                                        /* check error */
+        
+        return 5;                                                                                /* return error */
+    }
+    
+    return 0;                                                                                    /* success return 0 */
+}
+
+/**
+ * @brief         ntag21x bit oriented anti collision
+ * @param[in]     *handle pointer to an ntag21x handle structure
+ * @param[in]     level cascade level
+ * @param[in,out] *id pointer to a 5 bytes id buffer
+ * @param[in,out] *bits pointer to a known bits buffer
+ * @param[out]    *collision pointer to a collision flag buffer
+ * @return        status code
+ *                - 0 success
+ *                - 1 anti collision failed
+ *                - 2 handle is NULL
+ *                - 3 handle is not initialized
+ *                - 4 bits is invalid
+ *                - 5 output bits is invalid
+ *                - 6 check error
+ *                - 7 contactless_transceiver_bits is not linked
+ * @note          the first bits of id are sent as the known part of the uid, the answered
+ *                bits are merged into id and bits is advanced, when collision is set the
+ *                bit at position bits differs between the tags and must be chosen by the caller,
+ *                id holds the cascade tag or uid and bcc when bits reaches 40
+ */
+uint8_t ntag21x_anticollision_bits(ntag21x_handle_t *handle, ntag21x_cascade_level_t level,
+                                   uint8_t id[5], uint8_t *bits, uint8_t *collision)
+{
+    uint8_t res;
+    uint8_t i;
+    uint8_t known;
+    uint8_t check;
+    uint8_t input_bits;
+    uint8_t input_buf[7];
+    uint8_t output_bits;
+    uint8_t output_buf[5];
+    uint8_t pos;
+    
+    if (handle == NULL)                                                                          /* check handle */
+    {
+        return 2;                                                                                /* return error */
+    }
+    if (handle->inited != 1)                                                                     /* check handle initialization */
+    {
+        return 3;                                                                                /* return error */
+    }
+    if ((handle->contactless_transceiver_bits == NULL) && (handle->contactless_transceiver_bits_ctx == NULL) &&
+        (handle->trace_transceiver_bits == NULL))                                                /* check contactless_transceiver_bits */
+    {
+        NTAG21X_PRINT(handle, "ntag21x: contactless_transceiver_bits is null.\n");               /* contactless_transceiver_bits is null */
+        
+        return 7;                                                                                /* return error */
+    }
+    if ((id == NULL) || (bits == NULL) || (collision == NULL) || (*bits >= 40) ||
+        ((level != NTAG21X_CASCADE_LEVEL_1) && (level != NTAG21X_CASCADE_LEVEL_2)))              /* check the bits */
+    {
+        NTAG21X_PRINT(handle, "ntag21x: bits is invalid.\n");                                    /* bits is invalid */
+        
+        return 4;                                                                                /* return error */
+    }
+    
+    known = *bits;                                                                               /* known bits */
+    input_buf[0] = (uint8_t)level;                                                               /* set the command */
+    input_buf[1] = (uint8_t)(((2 + known / 8) << 4) | (known % 8));                              /* set the nvb */
+    for (i = 0; i < (known + 7) / 8; i++)                                                        /* copy the known bytes */
+    {
+        input_buf[2 + i] = id[i];                                                                /* set one byte */
+    }
+    if ((known % 8) != 0)                                                                        /* partial byte */
+    {
+        input_buf[2 + known / 8] &= (uint8_t)((1 << (known % 8)) - 1);                           /* clear the unknown bits */
+    }
+    input_bits = (uint8_t)(16 + known);                                                          /* set the input bits */
+    output_bits = 0;                                                                             /* init 0 */
+    *collision = 0;                                                                              /* init 0 */
+    res = a_ntag21x_contactless_transceiver_bits(handle, input_buf, input_bits, 
+                                                 output_buf, &output_bits, collision);           /* transceiver */
+    if (res != 0)                                                                                /* check the result */
+    {
+        return 1;                                                                                /* return error */
+    }
+    if ((output_bits > 40 - known) || ((*collision == 0) && (output_bits != 40 - known)))        /* check the output bits */
+    {
+        NTAG21X_PRINT(handle, "ntag21x: output bits is invalid.\n");                             /* output bits is invalid */
         
         return 5;                                                                                /* return error */
     }
+    for (i = 0; i < output_bits; i++)                                                            /* merge the received bits */
+    {
+        pos = (uint8_t)(known + i);                                                              /* uid bit position */
+        if ((output_buf[(known % 8 + i) / 8] & (1 << ((known % 8 + i) % 8))) != 0)               /* bit is set */
+        {
+            id[pos / 8] |= (uint8_t)(1 << (pos % 8));                                            /* set the bit */
+        }
+        else
+        {
+            id[pos / 8] &= (uint8_t)(~(1 << (pos % 8)));                                         /* clear the bit */
+        }
+    }
+    *bits = (uint8_t)(known + output_bits);                                                      /* advance the bits */
+    if (*collision != 0)                                                                         /* collision */
+    {
+        return 0;                                                                                /* success return 0 */
+    }
+    check = 0;                                                                                   /* init 0 */
+    for (i = 0; i < 4; i++)                                                                      /* run 4 times */
+    {
+        check ^= id[i];                                                                          /* xor */
+    }
+    if (check != id[4])                                                                          /* check the result */
+    {
+        NTAG21X_PRINT(handle, "ntag21x: check error.\n");                                        /* check error */
+        
+        return 6;                                                                                /* return error */
+    }
     
     return 0;                                                                                    /* success return 0 */
 }
@@ -596,14 +1781,152 @@ uint8_t ntag21x_anticollision_cl2(ntag21x_handle_t *handle, uint8_t id[4])
  *            - 5 sak error
  * @note      none
  */
-uint8_t ntag21x_select_cl1(ntag21x_handle_t *handle, uint8_t id[4])
+uint8_t ntag21x_select_cl1(ntag21x_handle_t *handle, uint8_t id[4])
+{
+    uint8_t res;
+    uint8_t i;
+    uint8_t input_len;
+    uint8_t input_buf[9];
+    uint8_t output_len;
+    uint8_t output_buf[1];
+    
+    if (handle == NULL)                                                                          /* check handle */
+    {
+        return 2;                                                                                /* return error */
+    }
+    if (handle->inited != 1)                                                                     /* check handle initialization */
+    {
+        return 3;                                                                                /* return error */
+    }
+    
+    memset(handle->page_cache_valid, 0, sizeof(handle->page_cache_valid));                       /* invalidate the page cache */
+    a_ntag21x_session_drop(handle);                                                              /* a new selection */
+    input_len = 9;                                                                               /* set the input length */
+    input_buf[0] = (NTAG21X_COMMAND_SELECT_CL1 >> 8) & 0xFF;                                     /* set the command */
+    input_buf[1] = (NTAG21X_COMMAND_SELECT_CL1 >> 0) & 0xFF;                                     /* set the command */
+    input_buf[6] = 0;                                                                            /* init 0 */
+    for (i = 0; i < 4; i++)                                                                      /* run 4 times */
+    {
+        input_buf[2 + i] = id[i];                                                                /* get one id */
+        input_buf[6] ^= id[i];                                                                   /* xor */
+    }
+    a_ntag21x_iso14443a_crc(input_buf, 7, input_buf + 7);                                        /* get the crc */
+    output_len = 1;                                                                              /* set the output length */
+    res = a_ntag21x_transceiver(handle, input_buf, input_len, output_buf, &output_len);          /* transceiver */
+    if (res != 0)                                                                                /* check the result */
+    {
+        NTAG21X_PRINT(handle, "ntag21x: contactless transceiver failed.\n");                     /* contactless transceiver failed */
+        
+        return 1;                                                                                /* return error */
+    }
+    if (output_len != 1)                                                                         /* check the output_len */
+    {
+        NTAG21X_PRINT(handle, "ntag21x: output_len is invalid.\n");                              /* output_len is invalid */
+        
+        return 4;                                                                                /* return error */
+    }
+    if (output_buf[0] == 0x04)                                                                   /* check the sak */
+    {
+        a_ntag21x_session_select(handle, 0, id + 1, 3);                                          /* uid0 - uid2 */
+        
+        return 0;                                                                                /* success return 0 */
+    }
+    else
+    {
+        NTAG21X_PRINT(handle, "ntag21x: sak error.\n");                                          /* sak error */
+        
+        return 5;                                                                                /* return error */
+    }
+}
+
+/**
+ * @brief     ntag21x select cl2
+ * @param[in] *handle pointer to an ntag21x handle structure
+ * @param[in] *id pointer to an id buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 select cl2 failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 output_len is invalid
+ *            - 5 sak error
+ * @note      none
+ */
+uint8_t ntag21x_select_cl2(ntag21x_handle_t *handle, uint8_t id[4])
+{
+    uint8_t res;
+    uint8_t i;
+    uint8_t input_len;
+    uint8_t input_buf[9];
+    uint8_t output_len;
+    uint8_t output_buf[1];
+    
+    if (handle == NULL)                                                                          /* check handle */
+    {
+        return 2;                                                                                /* return error */
+    }
+    if (handle->inited != 1)                                                                     /* check handle initialization */
+    {
+        return 3;                                                                                /* return error */
+    }
+    
+    memset(handle->page_cache_valid, 0, sizeof(handle->page_cache_valid));                       /* invalidate the page cache */
+    input_len = 9;                                                                               /* set the input length */
+    input_buf[0] = (NTAG21X_COMMAND_SELECT_CL2 >> 8) & 0xFF;                                     /* set the command */
+    input_buf[1] = (NTAG21X_COMMAND_SELECT_CL2 >> 0) & 0xFF;                                     /* set the command */
+    input_buf[6] = 0;                                                                            /* init 0 */
+    for (i = 0; i < 4; i++)                                                                      /* run 4 times */
+    {
+        input_buf[2 + i] = id[i];                                                                /* get one id */
+        input_buf[6] ^= id[i];                                                                   /* xor */
+    }
+    a_ntag21x_iso14443a_crc(input_buf, 7, input_buf + 7);                                        /* get the crc */
+    output_len = 1;                                                                              /* set the output length */
+    res = a_ntag21x_transceiver(handle, input_buf, input_len, output_buf, &output_len);          /* transceiver */
+    if (res != 0)                                                                                /* check the result */
+    {
+        NTAG21X_PRINT(handle, "ntag21x: contactless transceiver failed.\n");                     /* contactless transceiver failed */
+        
+        return 1;                                                                                /* return error */
+    }
+    if (output_len != 1)                                                                         /* check the output_len */
+    {
+        NTAG21X_PRINT(handle, "ntag21x: output_len is invalid.\n");                              /* output_len is invalid */
+        
+        return 4;                                                                                /* return error */
+    }
+    if (output_buf[0] == 0x00)                                                                   /* check the sak */
+    {
+        a_ntag21x_session_select(handle, 3, id, 4);                                              /* uid3 - uid6 */
+        handle->session.selected = 1;                                                            /* the tag is active */
+        
+        return 0;                                                                                /* success return 0 */
+    }
+    else
+    {
+        NTAG21X_PRINT(handle, "ntag21x: sak error.\n");                                          /* sak error */
+        
+        return 5;                                                                                /* return error */
+    }
+}
+
+/**
+ * @brief         ntag21x reselect a known tag
+ * @param[in]     *handle pointer to an ntag21x handle structure
+ * @param[in,out] *uid pointer to a 7 bytes uid buffer
+ * @return        status code
+ *                - 0 success
+ *                - 1 reselect failed
+ *                - 2 handle is NULL
+ *                - 3 handle is not initialized
+ * @note          wakes up the tag and selects both cascade levels with the known uid,
+ *                if the tag does not answer the anti collision runs and uid is updated
+ */
+uint8_t ntag21x_reselect(ntag21x_handle_t *handle, uint8_t uid[7])
 {
     uint8_t res;
-    uint8_t i;
-    uint8_t input_len;
-    uint8_t input_buf[9];
-    uint8_t output_len;
-    uint8_t output_buf[1];
+    uint8_t id[4];
+    ntag21x_type_t type;
     
     if (handle == NULL)                                                                          /* check handle */
     {
@@ -614,63 +1937,79 @@ uint8_t ntag21x_select_cl1(ntag21x_handle_t *handle, uint8_t id[4])
         return 3;                                                                                /* return error */
     }
     
-    input_len = 9;                                                                               /* set the input length */
-    input_buf[0] = (NTAG21X_COMMAND_SELECT_CL1 >> 8) & 0xFF;                                     /* set the command */
-    input_buf[1] = (NTAG21X_COMMAND_SELECT_CL1 >> 0) & 0xFF;                                     /* set the command */
-    input_buf[6] = 0;                                                                            /* init 0 */
-    for (i = 0; i < 4; i++)                                                                      /* run 4 times */
-    {
-        input_buf[2 + i] = id[i];                                                                /* get one id */
-        input_buf[6] ^= id[i];                                                                   /* xor */
-    }
-    a_ntag21x_iso14443a_crc(input_buf, 7, input_buf + 7);                                        /* get the crc */
-    output_len = 1;                                                                              /* set the output length */
-    res = handle->contactless_transceiver(input_buf, input_len, output_buf, &output_len);        /* transceiver */
+    res = ntag21x_wake_up(handle, &type);                                                        /* wake up */
     if (res != 0)                                                                                /* check the result */
     {
-        handle->debug_print("ntag21x: contactless transceiver failed.\n");                       /* contactless transceiver failed */
-        
         return 1;                                                                                /* return error */
     }
-    if (output_len != 1)                                                                         /* check the output_len */
+    id[0] = 0x88;                                                                                /* cascade tag */
+    id[1] = uid[0];                                                                              /* uid0 */
+    id[2] = uid[1];                                                                              /* uid1 */
+    id[3] = uid[2];                                                                              /* uid2 */
+    res = ntag21x_select_cl1(handle, id);                                                        /* select cl1 */
+    if (res != 0)                                                                                /* another tag */
     {
-        handle->debug_print("ntag21x: output_len is invalid.\n");                                /* output_len is invalid */
-        
-        return 4;                                                                                /* return error */
+        res = ntag21x_anticollision_cl1(handle, id);                                             /* anti collision cl1 */
+        if (res != 0)                                                                            /* check the result */
+        {
+            return 1;                                                                            /* return error */
+        }
+        res = ntag21x_select_cl1(handle, id);                                                    /* select cl1 */
+        if (res != 0)                                                                            /* check the result */
+        {
+            return 1;                                                                            /* return error */
+        }
+        uid[0] = id[1];                                                                          /* uid0 */
+        uid[1] = id[2];                                                                          /* uid1 */
+        uid[2] = id[3];                                                                          /* uid2 */
+        res = 1;                                                                                 /* cl2 is unknown too */
     }
-    if (output_buf[0] == 0x04)                                                                   /* check the sak */
+    if (res == 0)                                                                                /* known cl2 */
     {
-        return 0;                                                                                /* success return 0 */
+        memcpy(id, uid + 3, 4);                                                                  /* uid3 - uid6 */
+        res = ntag21x_select_cl2(handle, id);                                                    /* select cl2 */
     }
-    else
+    if (res != 0)                                                                                /* another tag */
     {
-        handle->debug_print("ntag21x: sak error.\n");                                            /* sak error */
-        
-        return 5;                                                                                /* return error */
+        res = ntag21x_anticollision_cl2(handle, id);                                             /* anti collision cl2 */
+        if (res != 0)                                                                            /* check the result */
+        {
+            return 1;                                                                            /* return error */
+        }
+        res = ntag21x_select_cl2(handle, id);                                                    /* select cl2 */
+        if (res != 0)                                                                            /* check the result */
+        {
+            return 1;                                                                            /* return error */
+        }
+        memcpy(uid + 3, id, 4);                                                                  /* uid3 - uid6 */
     }
+    
+    return 0;                                                                                    /* success return 0 */
 }
 
 /**
- * @brief     ntag21x select cl2
+ * @brief     ntag21x check that the selected tag is still in the field
  * @param[in] *handle pointer to an ntag21x handle structure
- * @param[in] *id pointer to an id buffer
+ * @param[in] *uid pointer to a 7 bytes uid buffer
  * @return    status code
  *            - 0 success
- *            - 1 select cl2 failed
+ *            - 1 no answer
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  *            - 4 output_len is invalid
- *            - 5 sak error
- * @note      none
+ *            - 5 crc error
+ *            - 6 uid is different
+ * @note      one read of page 0 over the air, the cache is bypassed and the uid is compared,
+ *            a missing answer is not printed because it is the expected result of a removal
  */
-uint8_t ntag21x_select_cl2(ntag21x_handle_t *handle, uint8_t id[4])
+uint8_t ntag21x_check_presence(ntag21x_handle_t *handle, uint8_t uid[7])
 {
     uint8_t res;
-    uint8_t i;
     uint8_t input_len;
-    uint8_t input_buf[9];
+    uint8_t input_buf[4];
     uint8_t output_len;
-    uint8_t output_buf[1];
+    uint8_t output_buf[18];
+    uint8_t crc_buf[2];
     
     if (handle == NULL)                                                                          /* check handle */
     {
@@ -681,40 +2020,38 @@ uint8_t ntag21x_select_cl2(ntag21x_handle_t *handle, uint8_t id[4])
         return 3;                                                                                /* return error */
     }
     
-    input_len = 9;                                                                               /* set the input length */
-    input_buf[0] = (NTAG21X_COMMAND_SELECT_CL2 >> 8) & 0xFF;                                     /* set the command */
-    input_buf[1] = (NTAG21X_COMMAND_SELECT_CL2 >> 0) & 0xFF;                                     /* set the command */
-    input_buf[6] = 0;                                                                            /* init 0 */
-    for (i = 0; i < 4; i++)                                                                      /* run 4 times */
-    {
-        input_buf[2 + i] = id[i];                                                                /* get one id */
-        input_buf[6] ^= id[i];                                                                   /* xor */
-    }
-    a_ntag21x_iso14443a_crc(input_buf, 7, input_buf + 7);                                        /* get the crc */
-    output_len = 1;                                                                              /* set the output length */
-    res = handle->contactless_transceiver(input_buf, input_len, output_buf, &output_len);        /* transceiver */
+    input_len = 4;                                                                               /* set the input length */
+    input_buf[0] = NTAG21X_COMMAND_READ;                                                         /* set the command */
+    input_buf[1] = 0x00;                                                                         /* uid page */
+    a_ntag21x_iso14443a_crc(input_buf , 2, input_buf + 2);                                       /* get the crc */
+    output_len = 18;                                                                             /* set the output length */
+    res = a_ntag21x_transceiver(handle, input_buf, input_len, output_buf, &output_len);          /* transceiver */
     if (res != 0)                                                                                /* check the result */
     {
-        handle->debug_print("ntag21x: contactless transceiver failed.\n");                       /* contactless transceiver failed */
-        
         return 1;                                                                                /* return error */
     }
-    if (output_len != 1)                                                                         /* check the output_len */
+    if (output_len != 18)                                                                        /* check the output_len */
     {
-        handle->debug_print("ntag21x: output_len is invalid.\n");                                /* output_len is invalid */
+        NTAG21X_PRINT(handle, "ntag21x: output_len is invalid.\n");                              /* output_len is invalid */
         
         return 4;                                                                                /* return error */
     }
-    if (output_buf[0] == 0x00)                                                                   /* check the sak */
+    a_ntag21x_iso14443a_crc(output_buf, 16, crc_buf);                                            /* get the crc */
+    if ((output_buf[16] != crc_buf[0]) || (output_buf[17] != crc_buf[1]))                        /* check the crc */
     {
-        return 0;                                                                                /* success return 0 */
+        a_ntag21x_statistics_crc_error(handle);                                                  /* record the crc error */
+        NTAG21X_PRINT(handle, "ntag21x: crc error.\n");                                          /* crc error */
+        
+        return 5;                                                                                /* return error */
     }
-    else
+    if ((memcmp(output_buf, uid, 3) != 0) || (memcmp(output_buf + 4, uid + 3, 4) != 0))          /* check the uid */
     {
-        handle->debug_print("ntag21x: sak error.\n");                                            /* sak error */
+        NTAG21X_PRINT(handle, "ntag21x: uid is different.\n");                                   /* uid is different */
         
-        return 5;                                                                                /* return error */
+        return 6;                                                                                /* return error */
     }
+    
+    return 0;                                                                                    /* success return 0 */
 }
 
 /**
@@ -728,7 +2065,8 @@ uint8_t ntag21x_select_cl2(ntag21x_handle_t *handle, uint8_t id[4])
  *             - 3 handle is not initialized
  *             - 4 output_len is invalid
  *             - 5 crc error
- * @note       none
+ *             - 6 tag is not the built variant
+ * @note       a single variant build returns 6 for a storage size of another variant
  */
 uint8_t ntag21x_get_version(ntag21x_handle_t *handle, ntag21x_version_t *version)
 {
@@ -752,16 +2090,16 @@ uint8_t ntag21x_get_version(ntag21x_handle_t *handle, ntag21x_version_t *version
     input_buf[0] = NTAG21X_COMMAND_GET_VERSION;                                                  /* set the command */
     a_ntag21x_iso14443a_crc(input_buf, 1, input_buf + 1);                                        /* get the crc */
     output_len = 10;                                                                             /* set the output length */
-    res = handle->contactless_transceiver(input_buf, input_len, output_buf, &output_len);        /* transceiver */
+    res = a_ntag21x_transceiver(handle, input_buf, input_len, output_buf, &output_len);          /* transceiver */
     if (res != 0)                                                                                /* check the result */
     {
-        handle->debug_print("ntag21x: contactless transceiver failed.\n");                       /* contactless transceiver failed */
+        NTAG21X_PRINT(handle, "ntag21x: contactless transceiver failed.\n");                     /* contactless transceiver failed */
         
         return 1;                                                                                /* return error */
     }
     if (output_len != 10)                                                                        /* check the output_len */
     {
-        handle->debug_print("ntag21x: output_len is invalid.\n");                                /* output_len is invalid */
+        NTAG21X_PRINT(handle, "ntag21x: output_len is invalid.\n");                              /* output_len is invalid */
         
         return 4;                                                                                /* return error */
     }
@@ -775,6 +2113,7 @@ uint8_t ntag21x_get_version(ntag21x_handle_t *handle, ntag21x_version_t *version
         version->major_product_version = output_buf[4];                                          /* major product version */
         version->minor_product_version = output_buf[5];                                          /* minor product version */
         version->storage_size = output_buf[6];                                                   /* storage size */
+#if (NTAG21X_VARIANT == NTAG21X_VARIANT_GENERIC)
         if (version->storage_size == 0x0F)                                                       /* ntag213 */
         {
             handle->end_page = 0x2C;                                                             /* set the last page */
@@ -791,13 +2130,22 @@ uint8_t ntag21x_get_version(ntag21x_handle_t *handle, ntag21x_version_t *version
         {
             handle->end_page = 0xFF;                                                             /* set 0xFF */
         }
+#else
+        if (version->storage_size != NTAG21X_VARIANT_STORAGE_SIZE)                               /* check the built variant */
+        {
+            NTAG21X_PRINT(handle, "ntag21x: tag is not the built variant.\n");                   /* tag is not the built variant */
+            
+            return 6;                                                                            /* return error */
+        }
+#endif
         version->protocol_type = output_buf[7];                                                  /* protocol type */
         
         return 0;                                                                                /* success return 0 */
     }
     else
     {
-        handle->debug_print("ntag21x: crc error.\n");                                            /* crc error */
+        a_ntag21x_statistics_crc_error(handle);                                                  /* record the crc error */
+        NTAG21X_PRINT(handle, "ntag21x: crc error.\n");                                          /* crc error */
         
         return 5;                                                                                /* return error */
     }
@@ -839,16 +2187,16 @@ uint8_t ntag21x_read_counter(ntag21x_handle_t *handle, uint32_t *cnt)
     input_buf[1] = 0x02;                                                                         /* set the address */
     a_ntag21x_iso14443a_crc(input_buf, 2, input_buf + 2);                                        /* get the crc */
     output_len = 5;                                                                              /* set the output length */
-    res = handle->contactless_transceiver(input_buf, input_len, output_buf, &output_len);        /* transceiver */
+    res = a_ntag21x_transceiver(handle, input_buf, input_len, output_buf, &output_len);          /* transceiver */
     if (res != 0)                                                                                /* check the result */
     {
-        handle->debug_print("ntag21x: contactless transceiver failed.\n");                       /* contactless transceiver failed */
+        NTAG21X_PRINT(handle, "ntag21x: contactless transceiver failed.\n");                     /* contactless transceiver failed */
         
         return 1;                                                                                /* return error */
     }
     if (output_len != 5)                                                                         /* check the output_len */
     {
-        handle->debug_print("ntag21x: output_len is invalid.\n");                                /* output_len is invalid */
+        NTAG21X_PRINT(handle, "ntag21x: output_len is invalid.\n");                              /* output_len is invalid */
         
         return 4;                                                                                /* return error */
     }
@@ -862,7 +2210,8 @@ uint8_t ntag21x_read_counter(ntag21x_handle_t *handle, uint32_t *cnt)
     }
     else
     {
-        handle->debug_print("ntag21x: crc error.\n");                                            /* crc error */
+        a_ntag21x_statistics_crc_error(handle);                                                  /* record the crc error */
+        NTAG21X_PRINT(handle, "ntag21x: crc error.\n");                                          /* crc error */
         
         return 5;                                                                                /* return error */
     }
@@ -904,16 +2253,16 @@ uint8_t ntag21x_read_signature(ntag21x_handle_t *handle, uint8_t signature[32])
     input_buf[1] = 0x00;                                                                         /* set the address */
     a_ntag21x_iso14443a_crc(input_buf, 2, input_buf + 2);                                        /* get the crc */
     output_len = 34;                                                                             /* set the output length */
-    res = handle->contactless_transceiver(input_buf, input_len, output_buf, &output_len);        /* transceiver */
+    res = a_ntag21x_transceiver(handle, input_buf, input_len, output_buf, &output_len);          /* transceiver */
     if (res != 0)                                                                                /* check the result */
     {
-        handle->debug_print("ntag21x: contactless transceiver failed.\n");                       /* contactless transceiver failed */
+        NTAG21X_PRINT(handle, "ntag21x: contactless transceiver failed.\n");                     /* contactless transceiver failed */
         
         return 1;                                                                                /* return error */
     }
     if (output_len != 34)                                                                        /* check the output_len */
     {
-        handle->debug_print("ntag21x: output_len is invalid.\n");                                /* output_len is invalid */
+        NTAG21X_PRINT(handle, "ntag21x: output_len is invalid.\n");                              /* output_len is invalid */
         
         return 4;                                                                                /* return error */
     }
@@ -926,7 +2275,8 @@ uint8_t ntag21x_read_signature(ntag21x_handle_t *handle, uint8_t signature[32])
     }
     else
     {
-        handle->debug_print("ntag21x: crc error.\n");                                            /* crc error */
+        a_ntag21x_statistics_crc_error(handle);                                                  /* record the crc error */
+        NTAG21X_PRINT(handle, "ntag21x: crc error.\n");                                          /* crc error */
         
         return 5;                                                                                /* return error */
     }
@@ -943,7 +2293,7 @@ uint8_t ntag21x_read_signature(ntag21x_handle_t *handle, uint8_t signature[32])
  *             - 3 handle is not initialized
  *             - 4 output_len is invalid
  *             - 5 crc error
- * @note       none
+ * @note       pages 0 and 1 are served from and filled into the page cache
  */
 uint8_t ntag21x_get_serial_number(ntag21x_handle_t *handle, uint8_t number[7])
 {
@@ -963,21 +2313,28 @@ uint8_t ntag21x_get_serial_number(ntag21x_handle_t *handle, uint8_t number[7])
         return 3;                                                                                /* return error */
     }
     
+    if (a_ntag21x_cache_read(handle, 0x00, 2, output_buf) != 0)                                  /* read from the cache */
+    {
+        memcpy(number, output_buf, 3);                                                           /* set the number 0 - 2 */
+        memcpy(number + 3, output_buf + 4, 4);                                                   /* set the number 3 - 6 */
+        
+        return 0;                                                                                /* success return 0 */
+    }
     input_len = 4;                                                                               /* set the input length */
     input_buf[0] = NTAG21X_COMMAND_READ;                                                         /* set the command */
     input_buf[1] = 0x00;                                                                         /* set the read page */
     a_ntag21x_iso14443a_crc(input_buf , 2, input_buf + 2);                                       /* get the crc */
     output_len = 18;                                                                             /* set the output length */
-    res = handle->contactless_transceiver(input_buf, input_len, output_buf, &output_len);        /* transceiver */
+    res = a_ntag21x_transceiver(handle, input_buf, input_len, output_buf, &output_len);          /* transceiver */
     if (res != 0)                                                                                /* check the result */
     {
-        handle->debug_print("ntag21x: contactless transceiver failed.\n");                       /* contactless transceiver failed */
+        NTAG21X_PRINT(handle, "ntag21x: contactless transceiver failed.\n");                     /* contactless transceiver failed */
         
         return 1;                                                                                /* return error */
     }
     if (output_len != 18)                                                                        /* check the output_len */
     {
-        handle->debug_print("ntag21x: output_len is invalid.\n");                                /* output_len is invalid */
+        NTAG21X_PRINT(handle, "ntag21x: output_len is invalid.\n");                              /* output_len is invalid */
         
         return 4;                                                                                /* return error */
     }
@@ -991,12 +2348,14 @@ uint8_t ntag21x_get_serial_number(ntag21x_handle_t *handle, uint8_t number[7])
         number[4] = output_buf[5];                                                               /* set the number 4 */
         number[5] = output_buf[6];                                                               /* set the number 5 */
         number[6] = output_buf[7];                                                               /* set the number 6 */
+        a_ntag21x_cache_fill_read(handle, 0x00, output_buf);                                     /* fill the cache */
         
         return 0;                                                                                /* success return 0 */
     }
     else
     {
-        handle->debug_print("ntag21x: crc error.\n");                                            /* crc error */
+        a_ntag21x_statistics_crc_error(handle);                                                  /* record the crc error */
+        NTAG21X_PRINT(handle, "ntag21x: crc error.\n");                                          /* crc error */
         
         return 5;                                                                                /* return error */
     }
@@ -1014,7 +2373,8 @@ uint8_t ntag21x_get_serial_number(ntag21x_handle_t *handle, uint8_t number[7])
  *             - 4 output_len is invalid
  *             - 5 crc error
  *             - 6 data is invalid
- * @note       none
+ * @note       sets the end page, a single variant build also returns 6 for a tag of another variant,
+ *             page 0 is always read over the air and pages 0 - 3 are filled into the page cache
  */
 uint8_t ntag21x_get_capability_container(ntag21x_handle_t *handle, ntag21x_capability_container_t *container)
 {
@@ -1039,16 +2399,16 @@ uint8_t ntag21x_get_capability_container(ntag21x_handle_t *handle, ntag21x_capab
     input_buf[1] = 0x00;                                                                         /* set the read page */
     a_ntag21x_iso14443a_crc(input_buf , 2, input_buf + 2);                                       /* get the crc */
     output_len = 18;                                                                             /* set the output length */
-    res = handle->contactless_transceiver(input_buf, input_len, output_buf, &output_len);        /* transceiver */
+    res = a_ntag21x_transceiver(handle, input_buf, input_len, output_buf, &output_len);          /* transceiver */
     if (res != 0)                                                                                /* check the result */
     {
-        handle->debug_print("ntag21x: contactless transceiver failed.\n");                       /* contactless transceiver failed */
+        NTAG21X_PRINT(handle, "ntag21x: contactless transceiver failed.\n");                     /* contactless transceiver failed */
         
         return 1;                                                                                /* return error */
     }
     if (output_len != 18)                                                                        /* check the output_len */
     {
-        handle->debug_print("ntag21x: output_len is invalid.\n");                                /* output_len is invalid */
+        NTAG21X_PRINT(handle, "ntag21x: output_len is invalid.\n");                              /* output_len is invalid */
         
         return 4;                                                                                /* return error */
     }
@@ -1059,6 +2419,7 @@ uint8_t ntag21x_get_capability_container(ntag21x_handle_t *handle, ntag21x_capab
             (output_buf[15] == 0x00)                                                             /* check the data */
            )
         {
+#if (NTAG21X_VARIANT == NTAG21X_VARIANT_GENERIC)
             if (output_buf[14] == 0x12)                                                          /* ntag213 */
             {
                 *container = NTAG21X_CAPABILITY_CONTAINER_144_BYTE_NTAG213;                      /* set the ntag213 */
@@ -1076,23 +2437,37 @@ uint8_t ntag21x_get_capability_container(ntag21x_handle_t *handle, ntag21x_capab
             }
             else
             {
-                handle->debug_print("ntag21x: data is invalid.\n");                              /* data is invalid */
+                NTAG21X_PRINT(handle, "ntag21x: data is invalid.\n");                            /* data is invalid */
+                
+                return 6;                                                                        /* return error */
+            }
+#else
+            if (output_buf[14] == NTAG21X_VARIANT_CC_SIZE)                                       /* the built variant */
+            {
+                *container = NTAG21X_VARIANT_CAPABILITY_CONTAINER;                               /* set the container */
+            }
+            else
+            {
+                NTAG21X_PRINT(handle, "ntag21x: tag is not the built variant.\n");               /* tag is not the built variant */
                 
                 return 6;                                                                        /* return error */
             }
+#endif
+            a_ntag21x_cache_fill_read(handle, 0x00, output_buf);                                 /* fill the cache */
             
             return 0;                                                                            /* success return 0 */
         }
         else
         {
-            handle->debug_print("ntag21x: data is invalid.\n");                                  /* data is invalid */
+            NTAG21X_PRINT(handle, "ntag21x: data is invalid.\n");                                /* data is invalid */
             
             return 6;                                                                            /* return error */
         }
     }
     else
     {
-        handle->debug_print("ntag21x: crc error.\n");                                            /* crc error */
+        a_ntag21x_statistics_crc_error(handle);                                                  /* record the crc error */
+        NTAG21X_PRINT(handle, "ntag21x: crc error.\n");                                          /* crc error */
         
         return 5;                                                                                /* return error */
     }
@@ -1130,21 +2505,26 @@ uint8_t ntag21x_read_four_pages(ntag21x_handle_t *handle, uint8_t start_page, ui
         return 3;                                                                                /* return error */
     }
     
+    if ((start_page + 3 <= NTAG21X_END_PAGE(handle)) && 
+        (a_ntag21x_cache_read(handle, start_page, 4, data) != 0))                               /* read from the cache */
+    {
+        return 0;                                                                                /* success return 0 */
+    }
     input_len = 4;                                                                               /* set the input length */
     input_buf[0] = NTAG21X_COMMAND_READ;                                                         /* set the command */
     input_buf[1] = start_page;                                                                   /* set the page */
     a_ntag21x_iso14443a_crc(input_buf , 2, input_buf + 2);                                       /* get the crc */
     output_len = 18;                                                                             /* set the output length */
-    res = handle->contactless_transceiver(input_buf, input_len, output_buf, &output_len);        /* transceiver */
+    res = a_ntag21x_transceiver(handle, input_buf, input_len, output_buf, &output_len);          /* transceiver */
     if (res != 0)                                                                                /* check the result */
     {
-        handle->debug_print("ntag21x: contactless transceiver failed.\n");                       /* contactless transceiver failed */
+        NTAG21X_PRINT(handle, "ntag21x: contactless transceiver failed.\n");                     /* contactless transceiver failed */
         
         return 1;                                                                                /* return error */
     }
     if (output_len != 18)                                                                        /* check the output_len */
     {
-        handle->debug_print("ntag21x: output_len is invalid.\n");                                /* output_len is invalid */
+        NTAG21X_PRINT(handle, "ntag21x: output_len is invalid.\n");                              /* output_len is invalid */
         
         return 4;                                                                                /* return error */
     }
@@ -1152,12 +2532,14 @@ uint8_t ntag21x_read_four_pages(ntag21x_handle_t *handle, uint8_t start_page, ui
     if ((output_buf[16] == crc_buf[0]) && (output_buf[17] == crc_buf[1]))                        /* check the crc */
     {
         memcpy(data, output_buf, 16);                                                            /* copy the data */
+        a_ntag21x_cache_fill_read(handle, start_page, output_buf);                               /* fill the cache */
         
         return 0;                                                                                /* success return 0 */
     }
     else
     {
-        handle->debug_print("ntag21x: crc error.\n");                                            /* crc error */
+        a_ntag21x_statistics_crc_error(handle);                                                  /* record the crc error */
+        NTAG21X_PRINT(handle, "ntag21x: crc error.\n");                                          /* crc error */
         
         return 5;                                                                                /* return error */
     }
@@ -1195,21 +2577,25 @@ uint8_t ntag21x_read_page(ntag21x_handle_t *handle, uint8_t page, uint8_t data[4
         return 3;                                                                                /* return error */
     }
     
+    if (a_ntag21x_cache_read(handle, page, 1, data) != 0)                                       /* read from the cache */
+    {
+        return 0;                                                                                /* success return 0 */
+    }
     input_len = 4;                                                                               /* set the input length */
     input_buf[0] = NTAG21X_COMMAND_READ;                                                         /* set the command */
     input_buf[1] = page;                                                                         /* set the page */
     a_ntag21x_iso14443a_crc(input_buf , 2, input_buf + 2);                                       /* get the crc */
     output_len = 18;                                                                             /* set the output length */
-    res = handle->contactless_transceiver(input_buf, input_len, output_buf, &output_len);        /* transceiver */
+    res = a_ntag21x_transceiver(handle, input_buf, input_len, output_buf, &output_len);          /* transceiver */
     if (res != 0)                                                                                /* check the result */
     {
-        handle->debug_print("ntag21x: contactless transceiver failed.\n");                       /* contactless transceiver failed */
+        NTAG21X_PRINT(handle, "ntag21x: contactless transceiver failed.\n");                     /* contactless transceiver failed */
         
         return 1;                                                                                /* return error */
     }
     if (output_len != 18)                                                                        /* check the output_len */
     {
-        handle->debug_print("ntag21x: output_len is invalid.\n");                                /* output_len is invalid */
+        NTAG21X_PRINT(handle, "ntag21x: output_len is invalid.\n");                              /* output_len is invalid */
         
         return 4;                                                                                /* return error */
     }
@@ -1217,12 +2603,14 @@ uint8_t ntag21x_read_page(ntag21x_handle_t *handle, uint8_t page, uint8_t data[4
     if ((output_buf[16] == crc_buf[0]) && (output_buf[17] == crc_buf[1]))                        /* check the crc */
     {
         memcpy(data, output_buf, 4);                                                             /* copy the data */
+        a_ntag21x_cache_fill_read(handle, page, output_buf);                                     /* fill the cache */
         
         return 0;                                                                                /* success return 0 */
     }
     else
     {
-        handle->debug_print("ntag21x: crc error.\n");                                            /* crc error */
+        a_ntag21x_statistics_crc_error(handle);                                                  /* record the crc error */
+        NTAG21X_PRINT(handle, "ntag21x: crc error.\n");                                          /* crc error */
         
         return 5;                                                                                /* return error */
     }
@@ -1268,22 +2656,28 @@ uint8_t ntag21x_fast_read_page(ntag21x_handle_t *handle, uint8_t start_page, uin
     }
     if (stop_page < start_page)                                                                  /* check start and stop page */
     {
-        handle->debug_print("ntag21x: stop_page < start_page.\n");                               /* stop_page < start_page */
+        NTAG21X_PRINT(handle, "ntag21x: stop_page < start_page.\n");                             /* stop_page < start_page */
         
         return 4;                                                                                /* return error */
     }
     if (stop_page - start_page + 1 > 15)                                                         /* check start and stop page */
     {
-        handle->debug_print("ntag21x: stop_page - start_page + 1 is over 15.\n");                /* stop_page - start_page + 1 is over 15 */
+        NTAG21X_PRINT(handle, "ntag21x: stop_page - start_page + 1 is over 15.\n");              /* stop_page - start_page + 1 is over 15 */
         
         return 5;                                                                                /* return error */
     }
     if ((*len) < (4 * (stop_page - start_page + 1)))                                             /* check the length */
     {
-        handle->debug_print("ntag21x: len < %d.\n", 4 * (stop_page - start_page + 1));           /* len is invalid */
+        NTAG21X_PRINT(handle, "ntag21x: len < %d.\n", 4 * (stop_page - start_page + 1));         /* len is invalid */
         
         return 6;                                                                                /* return error */
     }
+    if (a_ntag21x_cache_read(handle, start_page, (uint16_t)(stop_page - start_page + 1), data) != 0)        /* read from the cache */
+    {
+        *len = (uint16_t)(4 * (stop_page - start_page + 1));                                    /* set the length */
+        
+        return 0;                                                                                /* success return 0 */
+    }
     
     input_len = 5;                                                                               /* set the input length */
     input_buf[0] = NTAG21X_COMMAND_FAST_READ;                                                    /* set the command */
@@ -1292,33 +2686,296 @@ uint8_t ntag21x_fast_read_page(ntag21x_handle_t *handle, uint8_t start_page, uin
     a_ntag21x_iso14443a_crc(input_buf , 3, input_buf + 3);                                       /* get the crc */
     cal_len = 4 * (stop_page - start_page + 1);                                                  /* set the cal length */
     output_len = (uint8_t)(cal_len + 2);                                                         /* set the output length */
-    res = handle->contactless_transceiver(input_buf, input_len, output_buf, &output_len);        /* transceiver */
+    res = a_ntag21x_transceiver(handle, input_buf, input_len, output_buf, &output_len);          /* transceiver */
     if (res != 0)                                                                                /* check the result */
     {
-        handle->debug_print("ntag21x: contactless transceiver failed.\n");                       /* contactless transceiver failed */
+        NTAG21X_PRINT(handle, "ntag21x: contactless transceiver failed.\n");                     /* contactless transceiver failed */
         
         return 1;                                                                                /* return error */
     }
     if (output_len != (cal_len + 2))                                                             /* check the output_len */
     {
-        handle->debug_print("ntag21x: output_len is invalid.\n");                                /* output_len is invalid */
+        NTAG21X_PRINT(handle, "ntag21x: output_len is invalid.\n");                              /* output_len is invalid */
         
         return 7;                                                                                /* return error */
     }
     a_ntag21x_iso14443a_crc(output_buf, (uint8_t)cal_len, crc_buf);                              /* get the crc */
     if ((output_buf[cal_len] == crc_buf[0]) && (output_buf[cal_len + 1] == crc_buf[1]))          /* check the crc */
     {
-        memcpy(data, output_buf, cal_len);                                                       /* copy the data */
-        *len = cal_len;                                                                          /* set the length */
-        
-        return 0;                                                                                /* success return 0 */
+        memcpy(data, output_buf, cal_len);                                                       /* copy the data */
+        a_ntag21x_cache_fill(handle, start_page, output_buf, (uint16_t)(cal_len / 4));           /* fill the cache */
+        *len = cal_len;                                                                          /* set the length */
+        
+        return 0;                                                                                /* success return 0 */
+    }
+    else
+    {
+        a_ntag21x_statistics_crc_error(handle);                                                  /* record the crc error */
+        NTAG21X_PRINT(handle, "ntag21x: crc error.\n");                                          /* crc error */
+        
+        return 8;                                                                                /* return error */
+    }
+}
+
+/**
+ * @brief         ntag21x dump memory
+ * @param[in]     *handle pointer to an ntag21x handle structure
+ * @param[in]     first_page first page
+ * @param[in]     last_page last page
+ * @param[out]    *data pointer to a data buffer
+ * @param[in,out] *len pointer to a data length buffer
+ * @return        status code
+ *                - 0 success
+ *                - 1 dump memory failed
+ *                - 2 handle is NULL
+ *                - 3 handle is not initialized
+ *                - 4 last_page < first_page
+ *                - 5 first_page is over the end page
+ *                - 6 len is invalid
+ *                - 7 output_len is invalid
+ *                - 8 crc error
+ * @note          last_page is clamped to the end page of the detected tag
+ *                the range is split into fast reads of the max frame length
+ *                with 2 more bytes in len the last frame needs no copy
+ */
+uint8_t ntag21x_dump_memory(ntag21x_handle_t *handle, uint8_t first_page, uint8_t last_page, uint8_t *data, uint16_t *len)
+{
+    uint8_t res;
+    uint8_t input_len;
+    uint8_t input_buf[5];
+    uint8_t output_len;
+    uint8_t output_buf[254];
+    uint8_t crc_buf[2];
+    uint8_t chunk;
+    uint8_t pages;
+    uint8_t cal_len;
+    uint8_t *out;
+    uint16_t total;
+    uint16_t offset;
+    uint16_t page;
+    
+    if (handle == NULL)                                                                          /* check handle */
+    {
+        return 2;                                                                                /* return error */
+    }
+    if (handle->inited != 1)                                                                     /* check handle initialization */
+    {
+        return 3;                                                                                /* return error */
+    }
+    if (last_page < first_page)                                                                  /* check first and last page */
+    {
+        NTAG21X_PRINT(handle, "ntag21x: last_page < first_page.\n");                            /* last_page < first_page */
+        
+        return 4;                                                                                /* return error */
+    }
+    if (first_page > NTAG21X_END_PAGE(handle))                                                   /* check first page */
+    {
+        NTAG21X_PRINT(handle, "ntag21x: first_page is over the end page.\n");                   /* first_page is over the end page */
+        
+        return 5;                                                                                /* return error */
+    }
+    if (last_page > NTAG21X_END_PAGE(handle))                                                    /* check last page */
+    {
+        last_page = NTAG21X_END_PAGE(handle);                                                    /* clamp to the end page */
+    }
+    total = (uint16_t)(4 * (last_page - first_page + 1));                                        /* set the total length */
+    if ((*len) < total)                                                                          /* check the length */
+    {
+        NTAG21X_PRINT(handle, "ntag21x: len < %d.\n", total);                                   /* len is invalid */
+        
+        return 6;                                                                                /* return error */
+    }
+    if (a_ntag21x_cache_read(handle, first_page, (uint16_t)(total / 4), data) != 0)              /* read from the cache */
+    {
+        *len = total;                                                                            /* set the length */
+        
+        return 0;                                                                                /* success return 0 */
+    }
+    
+    chunk = (uint8_t)((handle->max_frame_len - 2) / 4);                                          /* pages per frame */
+    offset = 0;                                                                                  /* init 0 */
+    page = first_page;                                                                           /* start page */
+    while (page <= last_page)                                                                    /* read all pages */
+    {
+        pages = (uint8_t)(last_page - page + 1);                                                 /* pages left */
+        if (pages > chunk)                                                                       /* check the frame size */
+        {
+            pages = chunk;                                                                       /* one full frame */
+        }
+        cal_len = (uint8_t)(4 * pages);                                                          /* set the cal length */
+        if ((uint16_t)(offset + cal_len + 2) <= (*len))                                          /* crc fits in the caller buffer */
+        {
+            out = data + offset;                                                                 /* receive in place */
+        }
+        else
+        {
+            out = output_buf;                                                                    /* last frame */
+        }
+        input_len = 5;                                                                           /* set the input length */
+        input_buf[0] = NTAG21X_COMMAND_FAST_READ;                                                /* set the command */
+        input_buf[1] = (uint8_t)page;                                                            /* set the start page */
+        input_buf[2] = (uint8_t)(page + pages - 1);                                              /* set the stop page */
+        a_ntag21x_iso14443a_crc(input_buf , 3, input_buf + 3);                                   /* get the crc */
+        output_len = (uint8_t)(cal_len + 2);                                                     /* set the output length */
+        res = a_ntag21x_transceiver(handle, input_buf, input_len, out, &output_len);             /* transceiver */
+        if (res != 0)                                                                            /* check the result */
+        {
+            NTAG21X_PRINT(handle, "ntag21x: contactless transceiver failed.\n");                 /* contactless transceiver failed */
+            
+            return 1;                                                                            /* return error */
+        }
+        if (output_len != (cal_len + 2))                                                         /* check the output_len */
+        {
+            NTAG21X_PRINT(handle, "ntag21x: output_len is invalid.\n");                          /* output_len is invalid */
+            
+            return 7;                                                                            /* return error */
+        }
+        a_ntag21x_iso14443a_crc(out, cal_len, crc_buf);                                          /* get the crc */
+        if ((out[cal_len] != crc_buf[0]) || (out[cal_len + 1] != crc_buf[1]))                    /* check the crc */
+        {
+            a_ntag21x_statistics_crc_error(handle);                                              /* record the crc error */
+            NTAG21X_PRINT(handle, "ntag21x: crc error.\n");                                      /* crc error */
+            
+            return 8;                                                                            /* return error */
+        }
+        if (out == output_buf)                                                                   /* last frame */
+        {
+            memcpy(data + offset, output_buf, cal_len);                                          /* copy the data */
+        }
+        a_ntag21x_cache_fill(handle, page, data + offset, pages);                                /* fill the cache */
+        offset = (uint16_t)(offset + cal_len);                                                   /* next frame */
+        page = (uint16_t)(page + pages);                                                         /* next page */
+    }
+    *len = total;                                                                                /* set the length */
+    
+    return 0;                                                                                    /* success return 0 */
+}
+
+/**
+ * @brief     ntag21x set the max frame length
+ * @param[in] *handle pointer to an ntag21x handle structure
+ * @param[in] len max frame length the reader can receive
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 len is invalid
+ * @note      6 <= len, the default is NTAG21X_DEFAULT_MAX_FRAME_LEN
+ */
+uint8_t ntag21x_set_max_frame_length(ntag21x_handle_t *handle, uint8_t len)
+{
+    if (handle == NULL)                                                   /* check handle */
+    {
+        return 2;                                                         /* return error */
+    }
+    if (handle->inited != 1)                                              /* check handle initialization */
+    {
+        return 3;                                                         /* return error */
+    }
+    if (len < 6)                                                          /* check the length */
+    {
+        NTAG21X_PRINT(handle, "ntag21x: len < 6.\n");                     /* len is invalid */
+        
+        return 4;                                                         /* return error */
+    }
+    
+    handle->max_frame_len = len;                                          /* set the length */
+    
+    return 0;                                                             /* success return 0 */
+}
+
+/**
+ * @brief      ntag21x get the max frame length
+ * @param[in]  *handle pointer to an ntag21x handle structure
+ * @param[out] *len pointer to a max frame length buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t ntag21x_get_max_frame_length(ntag21x_handle_t *handle, uint8_t *len)
+{
+    if (handle == NULL)                                                   /* check handle */
+    {
+        return 2;                                                         /* return error */
+    }
+    if (handle->inited != 1)                                              /* check handle initialization */
+    {
+        return 3;                                                         /* return error */
+    }
+    
+    *len = handle->max_frame_len;                                         /* get the length */
+    
+    return 0;                                                             /* success return 0 */
+}
+
+/**
+ * @brief     ntag21x set the page cache
+ * @param[in] *handle pointer to an ntag21x handle structure
+ * @param[in] *buf pointer to a cache buffer, NULL disables the cache
+ * @param[in] len buffer length
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 len is invalid
+ * @note      len >= 4, NTAG21X_PAGE_CACHE_MAX_LEN covers every variant
+ *            pages beyond the end page of the detected tag are never cached
+ *            the cache is filled by reads, updated by writes and cleared by halt and select
+ *            with the read protection enabled, authenticate before reading through the cache
+ */
+uint8_t ntag21x_set_page_cache(ntag21x_handle_t *handle, uint8_t *buf, uint16_t len)
+{
+    if (handle == NULL)                                                             /* check handle */
+    {
+        return 2;                                                                   /* return error */
+    }
+    if (handle->inited != 1)                                                        /* check handle initialization */
+    {
+        return 3;                                                                   /* return error */
+    }
+    if ((buf != NULL) && (len < 4))                                                 /* check the length */
+    {
+        NTAG21X_PRINT(handle, "ntag21x: len < 4.\n");                               /* len is invalid */
+        
+        return 4;                                                                   /* return error */
+    }
+    
+    handle->page_cache = buf;                                                       /* set the buffer */
+    handle->page_cache_pages = (buf != NULL) ? (uint16_t)(len / 4) : 0;            /* set the pages */
+    if (handle->page_cache_pages > 256)                                             /* check the pages */
+    {
+        handle->page_cache_pages = 256;                                             /* 8 bits page address */
+    }
+    memset(handle->page_cache_valid, 0, sizeof(handle->page_cache_valid));         /* invalidate the page cache */
+    
+    return 0;                                                                       /* success return 0 */
+}
+
+/**
+ * @brief     ntag21x invalidate the page cache
+ * @param[in] *handle pointer to an ntag21x handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t ntag21x_invalidate_page_cache(ntag21x_handle_t *handle)
+{
+    if (handle == NULL)                                                             /* check handle */
+    {
+        return 2;                                                                   /* return error */
     }
-    else
+    if (handle->inited != 1)                                                        /* check handle initialization */
     {
-        handle->debug_print("ntag21x: crc error.\n");                                            /* crc error */
-        
-        return 8;                                                                                /* return error */
+        return 3;                                                                   /* return error */
     }
+    
+    memset(handle->page_cache_valid, 0, sizeof(handle->page_cache_valid));         /* invalidate the page cache */
+    
+    return 0;                                                                       /* success return 0 */
 }
 
 /**
@@ -1353,27 +3010,28 @@ uint8_t ntag21x_compatibility_write_page(ntag21x_handle_t *handle, uint8_t page,
         return 3;                                                                                /* return error */
     }
     
+    a_ntag21x_cache_drop(handle, page);                                                          /* drop the cached page */
     input_len = 4;                                                                               /* set the input length */
     input_buf[0] = NTAG21X_COMMAND_COMP_WRITE;                                                   /* set the command */
     input_buf[1] = page;                                                                         /* set the page */
     a_ntag21x_iso14443a_crc(input_buf, 2, input_buf + 2);                                        /* get the crc */
     output_len = 1;                                                                              /* set the output length */
-    res = handle->contactless_transceiver(input_buf, input_len, output_buf, &output_len);        /* transceiver */
+    res = a_ntag21x_transceiver(handle, input_buf, input_len, output_buf, &output_len);          /* transceiver */
     if (res != 0)                                                                                /* check the result */
     {
-        handle->debug_print("ntag21x: contactless transceiver failed.\n");                       /* contactless transceiver failed */
+        NTAG21X_PRINT(handle, "ntag21x: contactless transceiver failed.\n");                     /* contactless transceiver failed */
         
         return 1;                                                                                /* return error */
     }
     if (output_len != 1)                                                                         /* check the output_len */
     {
-        handle->debug_print("ntag21x: output_len is invalid.\n");                                /* output_len is invalid */
+        NTAG21X_PRINT(handle, "ntag21x: output_len is invalid.\n");                              /* output_len is invalid */
         
         return 4;                                                                                /* return error */
     }
     if (output_buf[0] != 0xA)                                                                    /* check the result */
     {
-        handle->debug_print("ntag21x: ack error.\n");                                            /* ack error */
+        NTAG21X_PRINT(handle, "ntag21x: ack error.\n");                                          /* ack error */
         
         return 5;                                                                                /* return error */
     }
@@ -1389,19 +3047,20 @@ uint8_t ntag21x_compatibility_write_page(ntag21x_handle_t *handle, uint8_t page,
     a_ntag21x_iso14443a_crc(input_buf, 16, input_buf + 16);                                      /* get the crc */
     input_len = 18;                                                                              /* set the input length */
     output_len = 1;                                                                              /* set the output length */
-    res = handle->contactless_transceiver(input_buf, input_len, output_buf, &output_len);        /* transceiver */
+    res = a_ntag21x_transceiver(handle, input_buf, input_len, output_buf, &output_len);          /* transceiver */
     if (res != 0)                                                                                /* check the result */
     {
-        handle->debug_print("ntag21x: contactless transceiver failed.\n");                       /* contactless transceiver failed */
+        NTAG21X_PRINT(handle, "ntag21x: contactless transceiver failed.\n");                     /* contactless transceiver failed */
         
         return 1;                                                                                /* return error */
     }
     if (output_buf[0] != 0xA)                                                                    /* check the result */
     {
-        handle->debug_print("ntag21x: ack error.\n");                                            /* ack error */
+        NTAG21X_PRINT(handle, "ntag21x: ack error.\n");                                          /* ack error */
         
         return 5;                                                                                /* return error */
     }
+    a_ntag21x_cache_write(handle, page, data);                                                   /* update the cache */
     
     return 0;                                                                                    /* success return 0 */
 }
@@ -1437,6 +3096,7 @@ uint8_t ntag21x_write_page(ntag21x_handle_t *handle, uint8_t page, uint8_t data[
         return 3;                                                                                /* return error */
     }
     
+    a_ntag21x_cache_drop(handle, page);                                                          /* drop the cached page */
     input_len = 8;                                                                               /* set the input length */
     input_buf[0] = NTAG21X_COMMAND_WRITE;                                                        /* set the command */
     input_buf[1] = page;                                                                         /* set the page */
@@ -1446,25 +3106,145 @@ uint8_t ntag21x_write_page(ntag21x_handle_t *handle, uint8_t page, uint8_t data[
     input_buf[5] = data[3];                                                                      /* set data3 */
     a_ntag21x_iso14443a_crc(input_buf, 6, input_buf + 6);                                        /* get the crc */
     output_len = 1;                                                                              /* set the output length */
-    res = handle->contactless_transceiver(input_buf, input_len, output_buf, &output_len);        /* transceiver */
+    res = a_ntag21x_transceiver(handle, input_buf, input_len, output_buf, &output_len);          /* transceiver */
     if (res != 0)                                                                                /* check the result */
     {
-        handle->debug_print("ntag21x: contactless transceiver failed.\n");                       /* contactless transceiver failed */
+        NTAG21X_PRINT(handle, "ntag21x: contactless transceiver failed.\n");                     /* contactless transceiver failed */
         
         return 1;                                                                                /* return error */
     }
     if (output_len != 1)                                                                         /* check the output_len */
     {
-        handle->debug_print("ntag21x: output_len is invalid.\n");                                /* output_len is invalid */
+        NTAG21X_PRINT(handle, "ntag21x: output_len is invalid.\n");                              /* output_len is invalid */
         
         return 4;                                                                                /* return error */
     }
     if (output_buf[0] != 0xA)                                                                    /* check the result */
     {
-        handle->debug_print("ntag21x: ack error.\n");                                            /* ack error */
+        NTAG21X_PRINT(handle, "ntag21x: ack error.\n");                                          /* ack error */
         
         return 5;                                                                                /* return error */
     }
+    a_ntag21x_cache_write(handle, page, data);                                                   /* update the cache */
+    
+    return 0;                                                                                    /* success return 0 */
+}
+
+/**
+ * @brief     ntag21x write an image
+ * @param[in] *handle pointer to an ntag21x handle structure
+ * @param[in] start_page start page
+ * @param[in] *image pointer to an image buffer
+ * @param[in] len image length
+ * @param[in] flags ntag21x_write_image_flag_t flags
+ * @return    status code
+ *            - 0 success
+ *            - 1 write image failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 len is invalid
+ *            - 5 verify failed
+ * @note      the current contents are read with fast read and only the pages
+ *            that differ are written, a partial last page keeps its other bytes
+ */
+uint8_t ntag21x_write_image(ntag21x_handle_t *handle, uint8_t start_page, uint8_t *image, uint16_t len, uint8_t flags)
+{
+    uint8_t res;
+    uint8_t i;
+    uint8_t chunk;
+    uint8_t pages;
+    uint8_t bytes;
+    uint8_t buf[256];
+    uint16_t buf_len;
+    uint16_t offset;
+    uint16_t page;
+    uint16_t last_page;
+    
+    if (handle == NULL)                                                                          /* check handle */
+    {
+        return 2;                                                                                /* return error */
+    }
+    if (handle->inited != 1)                                                                     /* check handle initialization */
+    {
+        return 3;                                                                                /* return error */
+    }
+    last_page = (uint16_t)(start_page + (len + 3) / 4 - 1);                                      /* set the last page */
+    if ((len == 0) || (last_page > NTAG21X_END_PAGE(handle)))                                    /* check the length */
+    {
+        NTAG21X_PRINT(handle, "ntag21x: len is invalid.\n");                                     /* len is invalid */
+        
+        return 4;                                                                                /* return error */
+    }
+    
+    chunk = (uint8_t)((handle->max_frame_len - 2) / 4);                                          /* pages per frame */
+    offset = 0;                                                                                  /* init 0 */
+    for (page = start_page; page <= last_page; page = (uint16_t)(page + pages))                 /* all chunks */
+    {
+        pages = (uint8_t)(((last_page - page + 1) > chunk) ? chunk : (last_page - page + 1));   /* pages of this chunk */
+        if (((flags & NTAG21X_WRITE_IMAGE_FLAG_FORCE) == 0) ||
+            ((page + pages - 1 == last_page) && ((len % 4) != 0)))                               /* need the current data */
+        {
+            buf_len = sizeof(buf);                                                               /* set the length */
+            res = ntag21x_dump_memory(handle, (uint8_t)page, (uint8_t)(page + pages - 1), 
+                                      buf, &buf_len);                                            /* read the current data */
+            if (res != 0)                                                                        /* check the result */
+            {
+                NTAG21X_PRINT(handle, "ntag21x: dump memory failed.\n");                         /* dump memory failed */
+                
+                return 1;                                                                        /* return error */
+            }
+        }
+        for (i = 0; i < pages; i++)                                                              /* all pages */
+        {
+            bytes = (uint8_t)(((len - offset) > 4) ? 4 : (len - offset));                        /* bytes of this page */
+            if (((flags & NTAG21X_WRITE_IMAGE_FLAG_FORCE) == 0) &&
+                (memcmp(buf + i * 4, image + offset, bytes) == 0))                               /* unchanged */
+            {
+                offset = (uint16_t)(offset + bytes);                                             /* next page */
+                
+                continue;                                                                        /* skip the page */
+            }
+            memcpy(buf + i * 4, image + offset, bytes);                                          /* merge the page */
+            res = ntag21x_write_page(handle, (uint8_t)(page + i), buf + i * 4);                  /* write the page */
+            if (res != 0)                                                                        /* check the result */
+            {
+                NTAG21X_PRINT(handle, "ntag21x: write page failed.\n");                          /* write page failed */
+                
+                return 1;                                                                        /* return error */
+            }
+            offset = (uint16_t)(offset + bytes);                                                 /* next page */
+        }
+    }
+    
+    if ((flags & NTAG21X_WRITE_IMAGE_FLAG_VERIFY) != 0)                                          /* verify */
+    {
+        for (page = start_page; page <= last_page; page++)                                       /* all pages */
+        {
+            a_ntag21x_cache_drop(handle, (uint8_t)page);                                         /* read back from the tag */
+        }
+        offset = 0;                                                                              /* init 0 */
+        for (page = start_page; page <= last_page; page = (uint16_t)(page + pages))             /* all chunks */
+        {
+            pages = (uint8_t)(((last_page - page + 1) > chunk) ? chunk : (last_page - page + 1));   /* pages of this chunk */
+            buf_len = sizeof(buf);                                                               /* set the length */
+            res = ntag21x_dump_memory(handle, (uint8_t)page, (uint8_t)(page + pages - 1), 
+                                      buf, &buf_len);                                            /* read back */
+            if (res != 0)                                                                        /* check the result */
+            {
+                NTAG21X_PRINT(handle, "ntag21x: dump memory failed.\n");                         /* dump memory failed */
+                
+                return 1;                                                                        /* return error */
+            }
+            bytes = (uint8_t)(((len - offset) > (pages * 4)) ? (pages * 4) : (len - offset));    /* bytes of this chunk */
+            if (memcmp(buf, image + offset, bytes) != 0)                                         /* compare */
+            {
+                NTAG21X_PRINT(handle, "ntag21x: verify failed.\n");                              /* verify failed */
+                
+                return 5;                                                                        /* return error */
+            }
+            offset = (uint16_t)(offset + bytes);                                                 /* next chunk */
+        }
+    }
     
     return 0;                                                                                    /* success return 0 */
 }
@@ -1482,7 +3262,8 @@ uint8_t ntag21x_write_page(ntag21x_handle_t *handle, uint8_t page, uint8_t data[
  *            - 4 output_len is invalid
  *            - 5 crc error
  *            - 6 pack check failed
- * @note      none
+ * @note      the session counts as authenticated until the next select,
+ *            only the cached pages behind auth0 are dropped
  */
 uint8_t ntag21x_authenticate(ntag21x_handle_t *handle, uint8_t pwd[4], uint8_t pack[2])
 {
@@ -1510,16 +3291,19 @@ uint8_t ntag21x_authenticate(ntag21x_handle_t *handle, uint8_t pwd[4], uint8_t p
     input_buf[4] = pwd[3];                                                                       /* set pwd3 */
     a_ntag21x_iso14443a_crc(input_buf, 5, input_buf + 5);                                        /* get the crc */
     output_len = 4;                                                                              /* set the output length */
-    res = handle->contactless_transceiver(input_buf, input_len, output_buf, &output_len);        /* transceiver */
+    handle->session.authenticated = 0;                                                           /* not authenticated */
+    res = a_ntag21x_transceiver(handle, input_buf, input_len, output_buf, &output_len);          /* transceiver */
     if (res != 0)                                                                                /* check the result */
     {
-        handle->debug_print("ntag21x: contactless transceiver failed.\n");                       /* contactless transceiver failed */
+        a_ntag21x_session_drop(handle);                                                          /* the tag is halted */
+        NTAG21X_PRINT(handle, "ntag21x: contactless transceiver failed.\n");                     /* contactless transceiver failed */
         
         return 1;                                                                                /* return error */
     }
     if (output_len != 4)                                                                         /* check the output_len */
     {
-        handle->debug_print("ntag21x: output_len is invalid.\n");                                /* output_len is invalid */
+        a_ntag21x_session_drop(handle);                                                          /* nak halts the tag */
+        NTAG21X_PRINT(handle, "ntag21x: output_len is invalid.\n");                              /* output_len is invalid */
         
         return 4;                                                                                /* return error */
     }
@@ -1528,21 +3312,127 @@ uint8_t ntag21x_authenticate(ntag21x_handle_t *handle, uint8_t pwd[4], uint8_t p
     {
         if ((output_buf[0] != pack[0]) || (output_buf[1] != pack[1]))                            /* check the pack */
         {
-            handle->debug_print("ntag21x: pack check failed.\n");                                /* pack check failed. */
+            a_ntag21x_statistics_pack_error(handle);                                             /* record the pack error */
+            NTAG21X_PRINT(handle, "ntag21x: pack check failed.\n");                              /* pack check failed. */
             
             return 6;                                                                            /* return error */
         }
+        a_ntag21x_cache_drop_protected(handle);                                                  /* the protected pages become readable */
+        handle->session.authenticated = 1;                                                       /* authenticated until the next select */
         
         return 0;                                                                                /* success return 0 */
     }
     else
     {
-        handle->debug_print("ntag21x: crc error.\n");                                            /* crc error */
+        a_ntag21x_statistics_crc_error(handle);                                                  /* record the crc error */
+        NTAG21X_PRINT(handle, "ntag21x: crc error.\n");                                          /* crc error */
         
         return 5;                                                                                /* return error */
     }
 }
 
+/**
+ * @brief     ntag21x authenticate the selected tag once per selection
+ * @param[in] *handle pointer to an ntag21x handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 authenticate failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 no tag is selected
+ *            - 5 derive_password is null
+ *            - 6 derive password failed
+ *            - 7 pack check failed
+ * @note      nothing is sent when the selection is already authenticated, the password
+ *            and pack are derived from the uid once and kept until another tag is selected
+ */
+uint8_t ntag21x_session_authenticate(ntag21x_handle_t *handle)
+{
+    uint8_t res;
+    
+    if (handle == NULL)                                                                                           /* check handle */
+    {
+        return 2;                                                                                                 /* return error */
+    }
+    if (handle->inited != 1)                                                                                      /* check handle initialization */
+    {
+        return 3;                                                                                                 /* return error */
+    }
+    if (handle->session.authenticated != 0)                                                                       /* already authenticated */
+    {
+        return 0;                                                                                                 /* success return 0 */
+    }
+    if (handle->session.selected == 0)                                                                            /* check the selection */
+    {
+        NTAG21X_PRINT(handle, "ntag21x: no tag is selected.\n");                                                  /* no tag is selected */
+        
+        return 4;                                                                                                 /* return error */
+    }
+    if ((handle->derive_password == NULL) && (handle->derive_password_ctx == NULL))                               /* check derive_password */
+    {
+        NTAG21X_PRINT(handle, "ntag21x: derive_password is null.\n");                                             /* derive_password is null */
+        
+        return 5;                                                                                                 /* return error */
+    }
+    
+    if (handle->session_key_valid == 0)                                                                           /* derive once per uid */
+    {
+        if (handle->derive_password_ctx != NULL)                                                                  /* context variant */
+        {
+            res = handle->derive_password_ctx(handle->user, handle->session.uid,
+                                              handle->session_pwd, handle->session_pack);                         /* derive the password */
+        }
+        else
+        {
+            res = handle->derive_password(handle->session.uid, handle->session_pwd, handle->session_pack);        /* derive the password */
+        }
+        if (res != 0)                                                                                             /* check the result */
+        {
+            NTAG21X_PRINT(handle, "ntag21x: derive password failed.\n");                                          /* derive password failed */
+            
+            return 6;                                                                                             /* return error */
+        }
+        handle->session_key_valid = 1;                                                                            /* password is derived */
+    }
+    res = ntag21x_authenticate(handle, handle->session_pwd, handle->session_pack);                                /* authenticate */
+    if (res == 6)                                                                                                 /* pack check failed */
+    {
+        return 7;                                                                                                 /* return error */
+    }
+    if (res != 0)                                                                                                 /* check the result */
+    {
+        return 1;                                                                                                 /* return error */
+    }
+    
+    return 0;                                                                                                     /* success return 0 */
+}
+
+/**
+ * @brief      ntag21x get the session of the selected tag
+ * @param[in]  *handle pointer to an ntag21x handle structure
+ * @param[out] *session pointer to a session structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t ntag21x_get_session(ntag21x_handle_t *handle, ntag21x_session_t *session)
+{
+    if ((handle == NULL) || (session == NULL))        /* check handle */
+    {
+        return 2;                                     /* return error */
+    }
+    if (handle->inited != 1)                          /* check handle initialization */
+    {
+        return 3;                                     /* return error */
+    }
+    
+    *session = handle->session;                       /* get the session */
+    
+    return 0;                                         /* success return 0 */
+}
+
 /**
  * @brief     ntag21x set the password
  * @param[in] *handle pointer to an ntag21x handle structure
@@ -1573,31 +3463,32 @@ uint8_t ntag21x_set_password(ntag21x_handle_t *handle, uint8_t pwd[4])
         return 3;                                                                                /* return error */
     }
     
+    a_ntag21x_cache_drop(handle, NTAG21X_PAGE_PWD(handle));                                      /* drop the cached page */
     input_len = 8;                                                                               /* set the input length */
     input_buf[0] = NTAG21X_COMMAND_WRITE;                                                        /* set the command */
-    input_buf[1] = handle->end_page - 1;                                                         /* set the last page */
+    input_buf[1] = NTAG21X_PAGE_PWD(handle);                                                     /* set the last page */
     input_buf[2] = pwd[0];                                                                       /* set pwd0 */
     input_buf[3] = pwd[1];                                                                       /* set pwd1 */
     input_buf[4] = pwd[2];                                                                       /* set pwd2 */
     input_buf[5] = pwd[3];                                                                       /* set pwd3 */
     a_ntag21x_iso14443a_crc(input_buf, 6, input_buf + 6);                                        /* get the crc */
     output_len = 1;                                                                              /* set the output length */
-    res = handle->contactless_transceiver(input_buf, input_len, output_buf, &output_len);        /* transceiver */
+    res = a_ntag21x_transceiver(handle, input_buf, input_len, output_buf, &output_len);          /* transceiver */
     if (res != 0)                                                                                /* check the result */
     {
-        handle->debug_print("ntag21x: contactless transceiver failed.\n");                       /* contactless transceiver failed */
+        NTAG21X_PRINT(handle, "ntag21x: contactless transceiver failed.\n");                     /* contactless transceiver failed */
         
         return 1;                                                                                /* return error */
     }
     if (output_len != 1)                                                                         /* check the output_len */
     {
-        handle->debug_print("ntag21x: output_len is invalid.\n");                                /* output_len is invalid */
+        NTAG21X_PRINT(handle, "ntag21x: output_len is invalid.\n");                              /* output_len is invalid */
         
         return 4;                                                                                /* return error */
     }
     if (output_buf[0] != 0xA)                                                                    /* check the result */
     {
-        handle->debug_print("ntag21x: ack error.\n");                                            /* ack error */
+        NTAG21X_PRINT(handle, "ntag21x: ack error.\n");                                          /* ack error */
         
         return 5;                                                                                /* return error */
     }
@@ -1635,31 +3526,32 @@ uint8_t ntag21x_set_pack(ntag21x_handle_t *handle, uint8_t pack[2])
         return 3;                                                                                /* return error */
     }
     
+    a_ntag21x_cache_drop(handle, NTAG21X_PAGE_PACK(handle));                                     /* drop the cached page */
     input_len = 8;                                                                               /* set the input length */
     input_buf[0] = NTAG21X_COMMAND_WRITE;                                                        /* set the command */
-    input_buf[1] = handle->end_page;                                                             /* set the last page */
+    input_buf[1] = NTAG21X_PAGE_PACK(handle);                                                    /* set the last page */
     input_buf[2] = pack[0];                                                                      /* set pack0 */
     input_buf[3] = pack[1];                                                                      /* set pack1 */
     input_buf[4] = 0x00;                                                                         /* set 0x00 */
     input_buf[5] = 0x00;                                                                         /* set 0x00 */
     a_ntag21x_iso14443a_crc(input_buf, 6, input_buf + 6);                                        /* get the crc */
     output_len = 1;                                                                              /* set the output length */
-    res = handle->contactless_transceiver(input_buf, input_len, output_buf, &output_len);        /* transceiver */
+    res = a_ntag21x_transceiver(handle, input_buf, input_len, output_buf, &output_len);          /* transceiver */
     if (res != 0)                                                                                /* check the result */
     {
-        handle->debug_print("ntag21x: contactless transceiver failed.\n");                       /* contactless transceiver failed */
+        NTAG21X_PRINT(handle, "ntag21x: contactless transceiver failed.\n");                     /* contactless transceiver failed */
         
         return 1;                                                                                /* return error */
     }
     if (output_len != 1)                                                                         /* check the output_len */
     {
-        handle->debug_print("ntag21x: output_len is invalid.\n");                                /* output_len is invalid */
+        NTAG21X_PRINT(handle, "ntag21x: output_len is invalid.\n");                              /* output_len is invalid */
         
         return 4;                                                                                /* return error */
     }
     if (output_buf[0] != 0xA)                                                                    /* check the result */
     {
-        handle->debug_print("ntag21x: ack error.\n");                                            /* ack error */
+        NTAG21X_PRINT(handle, "ntag21x: ack error.\n");                                          /* ack error */
         
         return 5;                                                                                /* return error */
     }
@@ -1678,7 +3570,8 @@ uint8_t ntag21x_set_pack(ntag21x_handle_t *handle, uint8_t pack[2])
  *            - 3 handle is not initialized
  *            - 4 output_len is invalid
  *            - 5 ack error
- * @note                                                               ntag213                                                                                    
+ * @note      a single variant build clears the lock bits the built variant does not have
+ *                                                                     ntag213                                                                                    
  *                                                                     byte0                                                                                      
  *            bit7               bit6               bit5               bit4               bit3               bit2              bit1              bit0             
  *            lock_page_30_31    lock_page_28_29    lock_page_26_27    lock_page_24_25    lock_page_22_23    lock_page_20_21   lock_page_18_19   lock_page_16_17  
@@ -1726,31 +3619,38 @@ uint8_t ntag21x_set_dynamic_lock(ntag21x_handle_t *handle, uint8_t lock[3])
         return 3;                                                                                /* return error */
     }
     
+    a_ntag21x_cache_drop(handle, NTAG21X_PAGE_DYNAMIC_LOCK(handle));                             /* drop the cached page */
     input_len = 8;                                                                               /* set the input length */
     input_buf[0] = NTAG21X_COMMAND_WRITE;                                                        /* set the command */
-    input_buf[1] = handle->end_page - 4;                                                         /* set the setting page */
+    input_buf[1] = NTAG21X_PAGE_DYNAMIC_LOCK(handle);                                            /* set the setting page */
+#if (NTAG21X_VARIANT == NTAG21X_VARIANT_GENERIC)
     input_buf[2] = lock[0];                                                                      /* set lock0 */
     input_buf[3] = lock[1];                                                                      /* set lock1 */
     input_buf[4] = lock[2];                                                                      /* set lock2 */
+#else
+    input_buf[2] = lock[0] & NTAG21X_VARIANT_DYNAMIC_LOCK_MASK0;                                 /* set lock0 */
+    input_buf[3] = lock[1] & NTAG21X_VARIANT_DYNAMIC_LOCK_MASK1;                                 /* set lock1 */
+    input_buf[4] = lock[2] & NTAG21X_VARIANT_DYNAMIC_LOCK_MASK2;                                 /* set lock2 */
+#endif
     input_buf[5] = 0x00;                                                                         /* set 0x00 */
     a_ntag21x_iso14443a_crc(input_buf, 6, input_buf + 6);                                        /* get the crc */
     output_len = 1;                                                                              /* set the output length */
-    res = handle->contactless_transceiver(input_buf, input_len, output_buf, &output_len);        /* transceiver */
+    res = a_ntag21x_transceiver(handle, input_buf, input_len, output_buf, &output_len);          /* transceiver */
     if (res != 0)                                                                                /* check the result */
     {
-        handle->debug_print("ntag21x: contactless transceiver failed.\n");                       /* contactless transceiver failed */
+        NTAG21X_PRINT(handle, "ntag21x: contactless transceiver failed.\n");                     /* contactless transceiver failed */
         
         return 1;                                                                                /* return error */
     }
     if (output_len != 1)                                                                         /* check the output_len */
     {
-        handle->debug_print("ntag21x: output_len is invalid.\n");                                /* output_len is invalid */
+        NTAG21X_PRINT(handle, "ntag21x: output_len is invalid.\n");                              /* output_len is invalid */
         
         return 4;                                                                                /* return error */
     }
     if (output_buf[0] != 0xA)                                                                    /* check the result */
     {
-        handle->debug_print("ntag21x: ack error.\n");                                            /* ack error */
+        NTAG21X_PRINT(handle, "ntag21x: ack error.\n");                                          /* ack error */
         
         return 5;                                                                                /* return error */
     }
@@ -1791,20 +3691,20 @@ uint8_t ntag21x_get_dynamic_lock(ntag21x_handle_t *handle, uint8_t lock[3])
     
     input_len = 5;                                                                               /* set the input length */
     input_buf[0] = NTAG21X_COMMAND_FAST_READ;                                                    /* set the command */
-    input_buf[1] = handle->end_page - 4;                                                         /* set the start page */
-    input_buf[2] = handle->end_page - 4;                                                         /* set the stop page */
+    input_buf[1] = NTAG21X_PAGE_DYNAMIC_LOCK(handle);                                            /* set the start page */
+    input_buf[2] = NTAG21X_PAGE_DYNAMIC_LOCK(handle);                                            /* set the stop page */
     a_ntag21x_iso14443a_crc(input_buf , 3, input_buf + 3);                                       /* get the crc */
     output_len = 6;                                                                              /* set the output length */
-    res = handle->contactless_transceiver(input_buf, input_len, output_buf, &output_len);        /* transceiver */
+    res = a_ntag21x_transceiver(handle, input_buf, input_len, output_buf, &output_len);          /* transceiver */
     if (res != 0)                                                                                /* check the result */
     {
-        handle->debug_print("ntag21x: contactless transceiver failed.\n");                       /* contactless transceiver failed */
+        NTAG21X_PRINT(handle, "ntag21x: contactless transceiver failed.\n");                     /* contactless transceiver failed */
         
         return 1;                                                                                /* return error */
     }
     if (output_len != 6)                                                                         /* check the output_len */
     {
-        handle->debug_print("ntag21x: output_len is invalid.\n");                                /* output_len is invalid */
+        NTAG21X_PRINT(handle, "ntag21x: output_len is invalid.\n");                              /* output_len is invalid */
         
         return 4;                                                                                /* return error */
     }
@@ -1817,7 +3717,8 @@ uint8_t ntag21x_get_dynamic_lock(ntag21x_handle_t *handle, uint8_t lock[3])
     }
     else
     {
-        handle->debug_print("ntag21x: crc error.\n");                                            /* crc error */
+        a_ntag21x_statistics_crc_error(handle);                                                  /* record the crc error */
+        NTAG21X_PRINT(handle, "ntag21x: crc error.\n");                                          /* crc error */
         
         return 5;                                                                                /* return error */
     }
@@ -1858,6 +3759,7 @@ uint8_t ntag21x_set_static_lock(ntag21x_handle_t *handle, uint8_t lock[2])
         return 3;                                                                                /* return error */
     }
     
+    a_ntag21x_cache_drop(handle, 2);                                                             /* drop the cached page */
     input_len = 8;                                                                               /* set the input length */
     input_buf[0] = NTAG21X_COMMAND_WRITE;                                                        /* set the command */
     input_buf[1] = 0x02;                                                                         /* set the setting page */
@@ -1867,22 +3769,22 @@ uint8_t ntag21x_set_static_lock(ntag21x_handle_t *handle, uint8_t lock[2])
     input_buf[5] = lock[1];                                                                      /* set lock1 */
     a_ntag21x_iso14443a_crc(input_buf, 6, input_buf + 6);                                        /* get the crc */
     output_len = 1;                                                                              /* set the output length */
-    res = handle->contactless_transceiver(input_buf, input_len, output_buf, &output_len);        /* transceiver */
+    res = a_ntag21x_transceiver(handle, input_buf, input_len, output_buf, &output_len);          /* transceiver */
     if (res != 0)                                                                                /* check the result */
     {
-        handle->debug_print("ntag21x: contactless transceiver failed.\n");                       /* contactless transceiver failed */
+        NTAG21X_PRINT(handle, "ntag21x: contactless transceiver failed.\n");                     /* contactless transceiver failed */
         
         return 1;                                                                                /* return error */
     }
     if (output_len != 1)                                                                         /* check the output_len */
     {
-        handle->debug_print("ntag21x: output_len is invalid.\n");                                /* output_len is invalid */
+        NTAG21X_PRINT(handle, "ntag21x: output_len is invalid.\n");                              /* output_len is invalid */
         
         return 4;                                                                                /* return error */
     }
     if (output_buf[0] != 0xA)                                                                    /* check the result */
     {
-        handle->debug_print("ntag21x: ack error.\n");                                            /* ack error */
+        NTAG21X_PRINT(handle, "ntag21x: ack error.\n");                                          /* ack error */
         
         return 5;                                                                                /* return error */
     }
@@ -1927,16 +3829,16 @@ uint8_t ntag21x_get_static_lock(ntag21x_handle_t *handle, uint8_t lock[2])
     input_buf[2] = 2;                                                                            /* set the stop page */
     a_ntag21x_iso14443a_crc(input_buf , 3, input_buf + 3);                                       /* get the crc */
     output_len = 6;                                                                              /* set the output length */
-    res = handle->contactless_transceiver(input_buf, input_len, output_buf, &output_len);        /* transceiver */
+    res = a_ntag21x_transceiver(handle, input_buf, input_len, output_buf, &output_len);          /* transceiver */
     if (res != 0)                                                                                /* check the result */
     {
-        handle->debug_print("ntag21x: contactless transceiver failed.\n");                       /* contactless transceiver failed */
+        NTAG21X_PRINT(handle, "ntag21x: contactless transceiver failed.\n");                     /* contactless transceiver failed */
         
         return 1;                                                                                /* return error */
     }
     if (output_len != 6)                                                                         /* check the output_len */
     {
-        handle->debug_print("ntag21x: output_len is invalid.\n");                                /* output_len is invalid */
+        NTAG21X_PRINT(handle, "ntag21x: output_len is invalid.\n");                              /* output_len is invalid */
         
         return 4;                                                                                /* return error */
     }
@@ -1949,7 +3851,8 @@ uint8_t ntag21x_get_static_lock(ntag21x_handle_t *handle, uint8_t lock[2])
     }
     else
     {
-        handle->debug_print("ntag21x: crc error.\n");                                            /* crc error */
+        a_ntag21x_statistics_crc_error(handle);                                                  /* record the crc error */
+        NTAG21X_PRINT(handle, "ntag21x: crc error.\n");                                          /* crc error */
         
         return 5;                                                                                /* return error */
     }
@@ -1981,19 +3884,19 @@ uint8_t ntag21x_set_mirror(ntag21x_handle_t *handle, ntag21x_mirror_t mirror)
     }
     
     memset(conf, 0, sizeof(uint8_t) * 4);                                  /* clear the conf */
-    res = a_ntag21x_conf_read(handle, handle->end_page - 3, conf);         /* read conf */
+    res = a_ntag21x_conf_read(handle, NTAG21X_PAGE_CFG0(handle), conf);    /* read conf */
     if (res != 0)                                                          /* check the result */
     {
-        handle->debug_print("ntag21x: conf read failed.\n");               /* conf read failed */
+        NTAG21X_PRINT(handle, "ntag21x: conf read failed.\n");             /* conf read failed */
         
         return 1;                                                          /* return error */
     }
     conf[0] &= ~(3 << 6);                                                  /* clear the settings */
     conf[0] |= mirror << 6;                                                /* set the mirror */
-    res = a_ntag21x_conf_write(handle, handle->end_page - 3, conf);        /* write conf */
+    res = a_ntag21x_conf_write(handle, NTAG21X_PAGE_CFG0(handle), conf);   /* write conf */
     if (res != 0)                                                          /* check the result */
     {
-        handle->debug_print("ntag21x: conf write failed.\n");              /* conf write failed */
+        NTAG21X_PRINT(handle, "ntag21x: conf write failed.\n");            /* conf write failed */
         
         return 1;                                                          /* return error */
     }
@@ -2027,10 +3930,10 @@ uint8_t ntag21x_get_mirror(ntag21x_handle_t *handle, ntag21x_mirror_t *mirror)
     }
     
     memset(conf, 0, sizeof(uint8_t) * 4);                                  /* clear the conf */
-    res = a_ntag21x_conf_read(handle, handle->end_page - 3, conf);         /* read conf */
+    res = a_ntag21x_conf_read(handle, NTAG21X_PAGE_CFG0(handle), conf);    /* read conf */
     if (res != 0)                                                          /* check the result */
     {
-        handle->debug_print("ntag21x: conf read failed.\n");               /* conf read failed */
+        NTAG21X_PRINT(handle, "ntag21x: conf read failed.\n");             /* conf read failed */
         
         return 1;                                                          /* return error */
     }
@@ -2065,19 +3968,19 @@ uint8_t ntag21x_set_mirror_byte(ntag21x_handle_t *handle, ntag21x_mirror_byte_t
     }
     
     memset(conf, 0, sizeof(uint8_t) * 4);                                  /* clear the conf */
-    res = a_ntag21x_conf_read(handle, handle->end_page - 3, conf);         /* read conf */
+    res = a_ntag21x_conf_read(handle, NTAG21X_PAGE_CFG0(handle), conf);    /* read conf */
     if (res != 0)                                                          /* check the result */
     {
-        handle->debug_print("ntag21x: conf read failed.\n");               /* conf read failed */
+        NTAG21X_PRINT(handle, "ntag21x: conf read failed.\n");             /* conf read failed */
         
         return 1;                                                          /* return error */
     }
     conf[0] &= ~(3 << 4);                                                  /* clear the settings */
     conf[0] |= byte << 4;                                                  /* set the byte */
-    res = a_ntag21x_conf_write(handle, handle->end_page - 3, conf);        /* write conf */
+    res = a_ntag21x_conf_write(handle, NTAG21X_PAGE_CFG0(handle), conf);   /* write conf */
     if (res != 0)                                                          /* check the result */
     {
-        handle->debug_print("ntag21x: conf write failed.\n");              /* conf write failed */
+        NTAG21X_PRINT(handle, "ntag21x: conf write failed.\n");            /* conf write failed */
         
         return 1;                                                          /* return error */
     }
@@ -2111,10 +4014,10 @@ uint8_t ntag21x_get_mirror_byte(ntag21x_handle_t *handle, ntag21x_mirror_byte_t
     }
     
     memset(conf, 0, sizeof(uint8_t) * 4);                                  /* clear the conf */
-    res = a_ntag21x_conf_read(handle, handle->end_page - 3, conf);         /* read conf */
+    res = a_ntag21x_conf_read(handle, NTAG21X_PAGE_CFG0(handle), conf);    /* read conf */
     if (res != 0)                                                          /* check the result */
     {
-        handle->debug_print("ntag21x: conf read failed.\n");               /* conf read failed */
+        NTAG21X_PRINT(handle, "ntag21x: conf read failed.\n");             /* conf read failed */
         
         return 1;                                                          /* return error */
     }
@@ -2149,19 +4052,19 @@ uint8_t ntag21x_set_modulation_mode(ntag21x_handle_t *handle, ntag21x_modulation
     }
     
     memset(conf, 0, sizeof(uint8_t) * 4);                                  /* clear the conf */
-    res = a_ntag21x_conf_read(handle, handle->end_page - 3, conf);         /* read conf */
+    res = a_ntag21x_conf_read(handle, NTAG21X_PAGE_CFG0(handle), conf);    /* read conf */
     if (res != 0)                                                          /* check the result */
     {
-        handle->debug_print("ntag21x: conf read failed.\n");               /* conf read failed */
+        NTAG21X_PRINT(handle, "ntag21x: conf read failed.\n");             /* conf read failed */
         
         return 1;                                                          /* return error */
     }
     conf[0] &= ~(1 << 2);                                                  /* clear the settings */
     conf[0] |= mode << 2;                                                  /* set the mode */
-    res = a_ntag21x_conf_write(handle, handle->end_page - 3, conf);        /* write conf */
+    res = a_ntag21x_conf_write(handle, NTAG21X_PAGE_CFG0(handle), conf);   /* write conf */
     if (res != 0)                                                          /* check the result */
     {
-        handle->debug_print("ntag21x: conf write failed.\n");              /* conf write failed */
+        NTAG21X_PRINT(handle, "ntag21x: conf write failed.\n");            /* conf write failed */
         
         return 1;                                                          /* return error */
     }
@@ -2195,10 +4098,10 @@ uint8_t ntag21x_get_modulation_mode(ntag21x_handle_t *handle, ntag21x_modulation
     }
     
     memset(conf, 0, sizeof(uint8_t) * 4);                                  /* clear the conf */
-    res = a_ntag21x_conf_read(handle, handle->end_page - 3, conf);         /* read conf */
+    res = a_ntag21x_conf_read(handle, NTAG21X_PAGE_CFG0(handle), conf);    /* read conf */
     if (res != 0)                                                          /* check the result */
     {
-        handle->debug_print("ntag21x: conf read failed.\n");               /* conf read failed */
+        NTAG21X_PRINT(handle, "ntag21x: conf read failed.\n");             /* conf read failed */
         
         return 1;                                                          /* return error */
     }
@@ -2233,18 +4136,18 @@ uint8_t ntag21x_set_mirror_page(ntag21x_handle_t *handle, uint8_t page)
     }
     
     memset(conf, 0, sizeof(uint8_t) * 4);                                  /* clear the conf */
-    res = a_ntag21x_conf_read(handle, handle->end_page - 3, conf);         /* read conf */
+    res = a_ntag21x_conf_read(handle, NTAG21X_PAGE_CFG0(handle), conf);    /* read conf */
     if (res != 0)                                                          /* check the result */
     {
-        handle->debug_print("ntag21x: conf read failed.\n");               /* conf read failed */
+        NTAG21X_PRINT(handle, "ntag21x: conf read failed.\n");             /* conf read failed */
         
         return 1;                                                          /* return error */
     }
     conf[2] = page;                                                        /* set the page */
-    res = a_ntag21x_conf_write(handle, handle->end_page - 3, conf);        /* write conf */
+    res = a_ntag21x_conf_write(handle, NTAG21X_PAGE_CFG0(handle), conf);   /* write conf */
     if (res != 0)                                                          /* check the result */
     {
-        handle->debug_print("ntag21x: conf write failed.\n");              /* conf write failed */
+        NTAG21X_PRINT(handle, "ntag21x: conf write failed.\n");            /* conf write failed */
         
         return 1;                                                          /* return error */
     }
@@ -2278,10 +4181,10 @@ uint8_t ntag21x_get_mirror_page(ntag21x_handle_t *handle, uint8_t *page)
     }
     
     memset(conf, 0, sizeof(uint8_t) * 4);                                  /* clear the conf */
-    res = a_ntag21x_conf_read(handle, handle->end_page - 3, conf);         /* read conf */
+    res = a_ntag21x_conf_read(handle, NTAG21X_PAGE_CFG0(handle), conf);    /* read conf */
     if (res != 0)                                                          /* check the result */
     {
-        handle->debug_print("ntag21x: conf read failed.\n");               /* conf read failed */
+        NTAG21X_PRINT(handle, "ntag21x: conf read failed.\n");             /* conf read failed */
         
         return 1;                                                          /* return error */
     }
@@ -2316,18 +4219,18 @@ uint8_t ntag21x_set_protect_start_page(ntag21x_handle_t *handle, uint8_t page)
     }
     
     memset(conf, 0, sizeof(uint8_t) * 4);                                  /* clear the conf */
-    res = a_ntag21x_conf_read(handle, handle->end_page - 3, conf);         /* read conf */
+    res = a_ntag21x_conf_read(handle, NTAG21X_PAGE_CFG0(handle), conf);    /* read conf */
     if (res != 0)                                                          /* check the result */
     {
-        handle->debug_print("ntag21x: conf read failed.\n");               /* conf read failed */
+        NTAG21X_PRINT(handle, "ntag21x: conf read failed.\n");             /* conf read failed */
         
         return 1;                                                          /* return error */
     }
     conf[3] = page;                                                        /* set the page */
-    res = a_ntag21x_conf_write(handle, handle->end_page - 3, conf);        /* write conf */
+    res = a_ntag21x_conf_write(handle, NTAG21X_PAGE_CFG0(handle), conf);   /* write conf */
     if (res != 0)                                                          /* check the result */
     {
-        handle->debug_print("ntag21x: conf write failed.\n");              /* conf write failed */
+        NTAG21X_PRINT(handle, "ntag21x: conf write failed.\n");            /* conf write failed */
         
         return 1;                                                          /* return error */
     }
@@ -2361,10 +4264,10 @@ uint8_t ntag21x_get_protect_start_page(ntag21x_handle_t *handle, uint8_t *page)
     }
     
     memset(conf, 0, sizeof(uint8_t) * 4);                                  /* clear the conf */
-    res = a_ntag21x_conf_read(handle, handle->end_page - 3, conf);         /* read conf */
+    res = a_ntag21x_conf_read(handle, NTAG21X_PAGE_CFG0(handle), conf);    /* read conf */
     if (res != 0)                                                          /* check the result */
     {
-        handle->debug_print("ntag21x: conf read failed.\n");               /* conf read failed */
+        NTAG21X_PRINT(handle, "ntag21x: conf read failed.\n");             /* conf read failed */
         
         return 1;                                                          /* return error */
     }
@@ -2400,19 +4303,19 @@ uint8_t ntag21x_set_access(ntag21x_handle_t *handle, ntag21x_access_t access, nt
     }
     
     memset(conf, 0, sizeof(uint8_t) * 4);                                  /* clear the conf */
-    res = a_ntag21x_conf_read(handle, handle->end_page - 2, conf);         /* read conf */
+    res = a_ntag21x_conf_read(handle, NTAG21X_PAGE_CFG1(handle), conf);    /* read conf */
     if (res != 0)                                                          /* check the result */
     {
-        handle->debug_print("ntag21x: conf read failed.\n");               /* conf read failed */
+        NTAG21X_PRINT(handle, "ntag21x: conf read failed.\n");             /* conf read failed */
         
         return 1;                                                          /* return error */
     }
     conf[0] &= ~(1 << access);                                             /* clear the settings */
     conf[0] |= enable << access;                                           /* set the access */
-    res = a_ntag21x_conf_write(handle, handle->end_page - 2, conf);        /* write conf */
+    res = a_ntag21x_conf_write(handle, NTAG21X_PAGE_CFG1(handle), conf);   /* write conf */
     if (res != 0)                                                          /* check the result */
     {
-        handle->debug_print("ntag21x: conf write failed.\n");              /* conf write failed */
+        NTAG21X_PRINT(handle, "ntag21x: conf write failed.\n");            /* conf write failed */
         
         return 1;                                                          /* return error */
     }
@@ -2447,10 +4350,10 @@ uint8_t ntag21x_get_access(ntag21x_handle_t *handle, ntag21x_access_t access, nt
     }
     
     memset(conf, 0, sizeof(uint8_t) * 4);                                  /* clear the conf */
-    res = a_ntag21x_conf_read(handle, handle->end_page - 2, conf);         /* read conf */
+    res = a_ntag21x_conf_read(handle, NTAG21X_PAGE_CFG1(handle), conf);    /* read conf */
     if (res != 0)                                                          /* check the result */
     {
-        handle->debug_print("ntag21x: conf read failed.\n");               /* conf read failed */
+        NTAG21X_PRINT(handle, "ntag21x: conf read failed.\n");             /* conf read failed */
         
         return 1;                                                          /* return error */
     }
@@ -2486,25 +4389,25 @@ uint8_t ntag21x_set_authenticate_limitation(ntag21x_handle_t *handle, uint8_t li
     }
     if (limit > 7)                                                         /* check the limit */
     {
-        handle->debug_print("ntag21x: limit > 7.\n");                      /* limit > 7 */
+        NTAG21X_PRINT(handle, "ntag21x: limit > 7.\n");                    /* limit > 7 */
         
         return 4;                                                          /* return error */
     }
     
     memset(conf, 0, sizeof(uint8_t) * 4);                                  /* clear the conf */
-    res = a_ntag21x_conf_read(handle, handle->end_page - 2, conf);         /* read conf */
+    res = a_ntag21x_conf_read(handle, NTAG21X_PAGE_CFG1(handle), conf);    /* read conf */
     if (res != 0)                                                          /* check the result */
     {
-        handle->debug_print("ntag21x: conf read failed.\n");               /* conf read failed */
+        NTAG21X_PRINT(handle, "ntag21x: conf read failed.\n");             /* conf read failed */
         
         return 1;                                                          /* return error */
     }
     conf[0] &= ~(7 << 0);                                                  /* clear the settings */
     conf[0] |= limit << 0;                                                 /* set the limit */
-    res = a_ntag21x_conf_write(handle, handle->end_page - 2, conf);        /* write conf */
+    res = a_ntag21x_conf_write(handle, NTAG21X_PAGE_CFG1(handle), conf);   /* write conf */
     if (res != 0)                                                          /* check the result */
     {
-        handle->debug_print("ntag21x: conf write failed.\n");              /* conf write failed */
+        NTAG21X_PRINT(handle, "ntag21x: conf write failed.\n");            /* conf write failed */
         
         return 1;                                                          /* return error */
     }
@@ -2538,10 +4441,10 @@ uint8_t ntag21x_get_authenticate_limitation(ntag21x_handle_t *handle, uint8_t *l
     }
     
     memset(conf, 0, sizeof(uint8_t) * 4);                                  /* clear the conf */
-    res = a_ntag21x_conf_read(handle, handle->end_page - 2, conf);         /* read conf */
+    res = a_ntag21x_conf_read(handle, NTAG21X_PAGE_CFG1(handle), conf);    /* read conf */
     if (res != 0)                                                          /* check the result */
     {
-        handle->debug_print("ntag21x: conf read failed.\n");               /* conf read failed */
+        NTAG21X_PRINT(handle, "ntag21x: conf read failed.\n");             /* conf read failed */
         
         return 1;                                                          /* return error */
     }
@@ -2550,6 +4453,215 @@ uint8_t ntag21x_get_authenticate_limitation(ntag21x_handle_t *handle, uint8_t *l
     return 0;                                                              /* success return 0 */
 }
 
+/**
+ * @brief      ntag21x begin a config transaction
+ * @param[in]  *handle pointer to an ntag21x handle structure
+ * @param[out] *config pointer to a config structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 config begin failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 output_len is invalid
+ *             - 5 crc error
+ * @note       reads cfg0 and cfg1 with one fast read
+ */
+uint8_t ntag21x_config_begin(ntag21x_handle_t *handle, ntag21x_config_t *config)
+{
+    uint8_t res;
+    uint8_t input_len;
+    uint8_t input_buf[5];
+    uint8_t output_len;
+    uint8_t output_buf[10];
+    uint8_t crc_buf[2];
+    
+    if (handle == NULL)                                                                          /* check handle */
+    {
+        return 2;                                                                                /* return error */
+    }
+    if (handle->inited != 1)                                                                     /* check handle initialization */
+    {
+        return 3;                                                                                /* return error */
+    }
+    
+    if (a_ntag21x_cache_read(handle, NTAG21X_PAGE_CFG0(handle), 2, output_buf) == 0)            /* read from the cache */
+    {
+        input_len = 5;                                                                           /* set the input length */
+        input_buf[0] = NTAG21X_COMMAND_FAST_READ;                                                /* set the command */
+        input_buf[1] = NTAG21X_PAGE_CFG0(handle);                                                /* set the start page */
+        input_buf[2] = NTAG21X_PAGE_CFG1(handle);                                                /* set the stop page */
+        a_ntag21x_iso14443a_crc(input_buf , 3, input_buf + 3);                                   /* get the crc */
+        output_len = 10;                                                                         /* set the output length */
+        res = a_ntag21x_transceiver(handle, input_buf, input_len, output_buf, &output_len);      /* transceiver */
+        if (res != 0)                                                                            /* check the result */
+        {
+            NTAG21X_PRINT(handle, "ntag21x: contactless transceiver failed.\n");                 /* contactless transceiver failed */
+            
+            return 1;                                                                            /* return error */
+        }
+        if (output_len != 10)                                                                    /* check the output_len */
+        {
+            NTAG21X_PRINT(handle, "ntag21x: output_len is invalid.\n");                          /* output_len is invalid */
+            
+            return 4;                                                                            /* return error */
+        }
+        a_ntag21x_iso14443a_crc(output_buf, 8, crc_buf);                                         /* get the crc */
+        if ((output_buf[8] != crc_buf[0]) || (output_buf[9] != crc_buf[1]))                      /* check the crc */
+        {
+            a_ntag21x_statistics_crc_error(handle);                                              /* record the crc error */
+            NTAG21X_PRINT(handle, "ntag21x: crc error.\n");                                      /* crc error */
+            
+            return 5;                                                                            /* return error */
+        }
+        a_ntag21x_cache_fill(handle, NTAG21X_PAGE_CFG0(handle), output_buf, 2);                  /* fill the cache */
+    }
+    
+    memcpy(config->raw, output_buf, 8);                                                          /* save the raw pages */
+    config->mirror = (ntag21x_mirror_t)((output_buf[0] >> 6) & 0x3);                            /* get the mirror */
+    config->mirror_byte = (ntag21x_mirror_byte_t)((output_buf[0] >> 4) & 0x3);                  /* get the mirror byte */
+    config->modulation_mode = (ntag21x_modulation_mode_t)((output_buf[0] >> 2) & 0x1);          /* get the modulation mode */
+    config->mirror_page = output_buf[2];                                                         /* get the mirror page */
+    config->protect_start_page = output_buf[3];                                                  /* get the auth0 */
+    config->read_protection = (ntag21x_bool_t)((output_buf[4] >> 7) & 0x1);                     /* get the read protection */
+    config->user_conf_protection = (ntag21x_bool_t)((output_buf[4] >> 6) & 0x1);                /* get the conf protection */
+    config->nfc_counter = (ntag21x_bool_t)((output_buf[4] >> 4) & 0x1);                         /* get the nfc counter */
+    config->nfc_counter_password_protection = (ntag21x_bool_t)((output_buf[4] >> 3) & 0x1);     /* get the nfc counter protection */
+    config->authenticate_limitation = output_buf[4] & 0x7;                                       /* get the limitation */
+    
+    return 0;                                                                                    /* success return 0 */
+}
+
+/**
+ * @brief         ntag21x commit a config transaction
+ * @param[in]     *handle pointer to an ntag21x handle structure
+ * @param[in,out] *config pointer to a config structure
+ * @return        status code
+ *                - 0 success
+ *                - 1 config commit failed
+ *                - 2 handle is NULL
+ *                - 3 handle is not initialized
+ *                - 4 authenticate limitation > 7
+ * @note          only the changed pages are written, cfg1 goes first because a
+ *                lower auth0 would protect it, unless cfg1 sets the user
+ *                configuration protection which would lock cfg0
+ */
+uint8_t ntag21x_config_commit(ntag21x_handle_t *handle, ntag21x_config_t *config)
+{
+    uint8_t res;
+    uint8_t i;
+    uint8_t index;
+    uint8_t conf[8];
+    
+    if (handle == NULL)                                                                          /* check handle */
+    {
+        return 2;                                                                                /* return error */
+    }
+    if (handle->inited != 1)                                                                     /* check handle initialization */
+    {
+        return 3;                                                                                /* return error */
+    }
+    if (config->authenticate_limitation > 7)                                                     /* check the limit */
+    {
+        NTAG21X_PRINT(handle, "ntag21x: limit > 7.\n");                                          /* limit > 7 */
+        
+        return 4;                                                                                /* return error */
+    }
+    
+    memcpy(conf, config->raw, 8);                                                                /* keep the rfui bits */
+    conf[0] &= (uint8_t)(~((3 << 6) | (3 << 4) | (1 << 2)));                                     /* clear the settings */
+    conf[0] |= (uint8_t)((config->mirror & 0x3) << 6);                                           /* set the mirror */
+    conf[0] |= (uint8_t)((config->mirror_byte & 0x3) << 4);                                      /* set the mirror byte */
+    conf[0] |= (uint8_t)((config->modulation_mode & 0x1) << 2);                                  /* set the modulation mode */
+    conf[2] = config->mirror_page;                                                               /* set the mirror page */
+    conf[3] = config->protect_start_page;                                                        /* set the auth0 */
+    conf[4] &= (uint8_t)(~((1 << 7) | (1 << 6) | (1 << 4) | (1 << 3) | (7 << 0)));              /* clear the settings */
+    conf[4] |= (uint8_t)((config->read_protection & 0x1) << 7);                                  /* set the read protection */
+    conf[4] |= (uint8_t)((config->user_conf_protection & 0x1) << 6);                             /* set the conf protection */
+    conf[4] |= (uint8_t)((config->nfc_counter & 0x1) << 4);                                      /* set the nfc counter */
+    conf[4] |= (uint8_t)((config->nfc_counter_password_protection & 0x1) << 3);                  /* set the nfc counter protection */
+    conf[4] |= config->authenticate_limitation;                                                  /* set the limitation */
+    
+    for (i = 0; i < 2; i++)                                                                      /* two pages */
+    {
+        if ((conf[4] & (1 << 6)) != 0)                                                           /* cfglck locks cfg0 */
+        {
+            index = i;                                                                           /* cfg0 then cfg1 */
+        }
+        else
+        {
+            index = (uint8_t)(1 - i);                                                            /* auth0 may protect cfg1 */
+        }
+        if (memcmp(conf + index * 4, config->raw + index * 4, 4) == 0)                           /* unchanged */
+        {
+            continue;                                                                            /* skip the page */
+        }
+        res = a_ntag21x_conf_write(handle, (uint8_t)(NTAG21X_PAGE_CFG0(handle) + index), 
+                                   conf + index * 4);                                            /* write conf */
+        if (res != 0)                                                                            /* check the result */
+        {
+            NTAG21X_PRINT(handle, "ntag21x: conf write failed.\n");                              /* conf write failed */
+            
+            return 1;                                                                            /* return error */
+        }
+        memcpy(config->raw + index * 4, conf + index * 4, 4);                                    /* update the raw page */
+    }
+    
+    return 0;                                                                                    /* success return 0 */
+}
+
+#if (NTAG21X_STATISTICS == 1)
+/**
+ * @brief      get a snapshot of the statistics
+ * @param[in]  *handle pointer to an ntag21x handle structure
+ * @param[out] *statistics pointer to a statistics structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       latency is only measured when a timestamp_us function is linked
+ */
+uint8_t ntag21x_get_statistics(ntag21x_handle_t *handle, ntag21x_statistics_t *statistics)
+{
+    if (handle == NULL)                                                           /* check handle */
+    {
+        return 2;                                                                 /* return error */
+    }
+    if (handle->inited != 1)                                                      /* check handle initialization */
+    {
+        return 3;                                                                 /* return error */
+    }
+    
+    memcpy(statistics, &handle->statistics, sizeof(ntag21x_statistics_t));        /* copy the statistics */
+    
+    return 0;                                                                     /* success return 0 */
+}
+
+/**
+ * @brief     clear the statistics
+ * @param[in] *handle pointer to an ntag21x handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t ntag21x_clear_statistics(ntag21x_handle_t *handle)
+{
+    if (handle == NULL)                                                  /* check handle */
+    {
+        return 2;                                                        /* return error */
+    }
+    if (handle->inited != 1)                                             /* check handle initialization */
+    {
+        return 3;                                                        /* return error */
+    }
+    
+    memset(&handle->statistics, 0, sizeof(ntag21x_statistics_t));        /* clear the statistics */
+    
+    return 0;                                                            /* success return 0 */
+}
+#endif
+
 /**
  * @brief         transceiver data
  * @param[in]     *handle pointer to an ntag21x handle structure
@@ -2564,24 +4676,46 @@ uint8_t ntag21x_get_authenticate_limitation(ntag21x_handle_t *handle, uint8_t *l
  */
 uint8_t ntag21x_transceiver(ntag21x_handle_t *handle, uint8_t *in_buf, uint8_t in_len, uint8_t *out_buf, uint8_t *out_len)
 {
-    if (handle == NULL)                                                /* check handle */
+    if (handle == NULL)                                                  /* check handle */
     {
-        return 2;                                                      /* return error */
+        return 2;                                                        /* return error */
     }
-    if (handle->inited != 1)                                           /* check handle initialization */
+    if (handle->inited != 1)                                             /* check handle initialization */
     {
-        return 3;                                                      /* return error */
+        return 3;                                                        /* return error */
     }
     
-    if (handle->contactless_transceiver(in_buf, in_len, 
-                                        out_buf, out_len) != 0)        /* transceiver data */
+    if (a_ntag21x_contactless_transceiver(handle, in_buf, in_len, 
+                                          out_buf, out_len) != 0)        /* transceiver data */
     {
-        return 1;                                                      /* return error */
+        return 1;                                                        /* return error */
     }
     else
     {
-        return 0;                                                      /* success return 0 */
+        return 0;                                                        /* success return 0 */
+    }
+}
+
+/**
+ * @brief         update an iso14443a crc
+ * @param[in,out] *crc pointer to a crc buffer
+ * @param[in]     *buf pointer to a data buffer
+ * @param[in]     len data length
+ * @return        status code
+ *                - 0 success
+ *                - 1 crc or buf is NULL
+ * @note          start with NTAG21X_ISO14443A_CRC_INIT, the crc is sent lsb first
+ */
+uint8_t ntag21x_iso14443a_crc_update(uint16_t *crc, uint8_t *buf, uint16_t len)
+{
+    if ((crc == NULL) || (buf == NULL))                                 /* check the buffer */
+    {
+        return 1;                                                       /* return error */
     }
+    
+    *crc = a_ntag21x_iso14443a_crc_update(*crc, buf, len);              /* update the crc */
+    
+    return 0;                                                           /* success return 0 */
 }
 
 /**
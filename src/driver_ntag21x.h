@@ -56,6 +56,106 @@ extern "C"{
  * @{
  */
 
+/**
+ * @brief ntag21x crc backend definition
+ */
+#define NTAG21X_CRC_BACKEND_BITWISE        0        /**< shift based, no table */
+#define NTAG21X_CRC_BACKEND_TABLE          1        /**< one 256 entries table, 512 bytes */
+#define NTAG21X_CRC_BACKEND_SLICE_BY_4     2        /**< four 256 entries tables, 2 KB */
+#define NTAG21X_CRC_BACKEND_SLICE_BY_8     3        /**< eight 256 entries tables, 4 KB */
+
+/**
+ * @brief ntag21x crc backend selection
+ * @note  bitwise by default so that no table is added to the flash,
+ *        opt in with -DNTAG21X_CRC_BACKEND=NTAG21X_CRC_BACKEND_xxx
+ */
+#ifndef NTAG21X_CRC_BACKEND
+    #define NTAG21X_CRC_BACKEND NTAG21X_CRC_BACKEND_BITWISE
+#endif
+
+/**
+ * @brief ntag21x default max frame length definition
+ * @note  the reader fifo size, 15 pages and crc
+ */
+#define NTAG21X_DEFAULT_MAX_FRAME_LEN        64
+
+/**
+ * @brief ntag21x variant definition
+ */
+#define NTAG21X_VARIANT_GENERIC        0        /**< end page learned from the tag, mixed fleets */
+#define NTAG21X_VARIANT_213            1        /**< ntag213 only */
+#define NTAG21X_VARIANT_215            2        /**< ntag215 only */
+#define NTAG21X_VARIANT_216            3        /**< ntag216 only */
+
+/**
+ * @brief ntag21x variant selection
+ * @note  override with -DNTAG21X_VARIANT=NTAG21X_VARIANT_xxx, a single variant build turns
+ *        the page map into constants and refuses the capability container of other variants
+ */
+#ifndef NTAG21X_VARIANT
+    #define NTAG21X_VARIANT NTAG21X_VARIANT_GENERIC
+#endif
+
+/**
+ * @brief ntag21x variant page map and lock layout definition
+ */
+#if (NTAG21X_VARIANT == NTAG21X_VARIANT_213)
+    #define NTAG21X_VARIANT_END_PAGE                   0x2C                                                /**< pack page */
+    #define NTAG21X_VARIANT_STORAGE_SIZE               0x0F                                                /**< get version storage size */
+    #define NTAG21X_VARIANT_CC_SIZE                    0x12                                                /**< capability container size byte */
+    #define NTAG21X_VARIANT_CAPABILITY_CONTAINER       NTAG21X_CAPABILITY_CONTAINER_144_BYTE_NTAG213       /**< capability container */
+    #define NTAG21X_VARIANT_DYNAMIC_LOCK_MASK0         0xFF                                                /**< lock0 valid bits */
+    #define NTAG21X_VARIANT_DYNAMIC_LOCK_MASK1         0x0F                                                /**< lock1 valid bits */
+    #define NTAG21X_VARIANT_DYNAMIC_LOCK_MASK2         0x3F                                                /**< lock2 valid bits */
+#elif (NTAG21X_VARIANT == NTAG21X_VARIANT_215)
+    #define NTAG21X_VARIANT_END_PAGE                   0x86                                                /**< pack page */
+    #define NTAG21X_VARIANT_STORAGE_SIZE               0x11                                                /**< get version storage size */
+    #define NTAG21X_VARIANT_CC_SIZE                    0x3E                                                /**< capability container size byte */
+    #define NTAG21X_VARIANT_CAPABILITY_CONTAINER       NTAG21X_CAPABILITY_CONTAINER_496_BYTE_NTAG215       /**< capability container */
+    #define NTAG21X_VARIANT_DYNAMIC_LOCK_MASK0         0xFF                                                /**< lock0 valid bits */
+    #define NTAG21X_VARIANT_DYNAMIC_LOCK_MASK1         0x00                                                /**< lock1 valid bits */
+    #define NTAG21X_VARIANT_DYNAMIC_LOCK_MASK2         0x0F                                                /**< lock2 valid bits */
+#elif (NTAG21X_VARIANT == NTAG21X_VARIANT_216)
+    #define NTAG21X_VARIANT_END_PAGE                   0xE6                                                /**< pack page */
+    #define NTAG21X_VARIANT_STORAGE_SIZE               0x13                                                /**< get version storage size */
+    #define NTAG21X_VARIANT_CC_SIZE                    0x6D                                                /**< capability container size byte */
+    #define NTAG21X_VARIANT_CAPABILITY_CONTAINER       NTAG21X_CAPABILITY_CONTAINER_872_BYTE_NTAG216       /**< capability container */
+    #define NTAG21X_VARIANT_DYNAMIC_LOCK_MASK0         0xFF                                                /**< lock0 valid bits */
+    #define NTAG21X_VARIANT_DYNAMIC_LOCK_MASK1         0x3F                                                /**< lock1 valid bits */
+    #define NTAG21X_VARIANT_DYNAMIC_LOCK_MASK2         0x7F                                                /**< lock2 valid bits */
+#elif (NTAG21X_VARIANT != NTAG21X_VARIANT_GENERIC)
+    #error "NTAG21X_VARIANT is invalid"
+#endif
+
+/**
+ * @brief ntag21x page cache length definition
+ * @note  enough for the 231 pages of an ntag216, or for the pages of the built variant
+ */
+#if (NTAG21X_VARIANT == NTAG21X_VARIANT_GENERIC)
+    #define NTAG21X_PAGE_CACHE_MAX_LEN        (231 * 4)
+#else
+    #define NTAG21X_PAGE_CACHE_MAX_LEN        ((NTAG21X_VARIANT_END_PAGE + 1) * 4)
+#endif
+
+/**
+ * @brief ntag21x iso14443a crc initial value definition
+ */
+#define NTAG21X_ISO14443A_CRC_INIT        0x6363U
+
+/**
+ * @brief ntag21x statistics selection
+ * @note  override with -DNTAG21X_STATISTICS=1 to add the instrumentation block to the handle
+ */
+#ifndef NTAG21X_STATISTICS
+    #define NTAG21X_STATISTICS 0
+#endif
+
+/**
+ * @brief ntag21x statistics histogram bucket definition
+ * @note  bucket 0 counts 0 us, bucket n counts [2^(n-1), 2^n) us and the last bucket is open ended
+ */
+#define NTAG21X_STATISTICS_HISTOGRAM_BUCKETS        24
+
 /**
  * @brief ntag21x bool enumeration definition
  */
@@ -74,6 +174,15 @@ typedef enum
     NTAG21X_TYPE_213_5_6 = 0x01,        /**< ntag213/5/6 */
 } ntag21x_type_t;
 
+/**
+ * @brief ntag21x cascade level enumeration definition
+ */
+typedef enum
+{
+    NTAG21X_CASCADE_LEVEL_1 = 0x93,        /**< cascade level 1 */
+    NTAG21X_CASCADE_LEVEL_2 = 0x95,        /**< cascade level 2 */
+} ntag21x_cascade_level_t;
+
 /**
  * @brief ntag21x capability container enumeration definition
  */
@@ -141,6 +250,97 @@ typedef struct ntag21x_version_s
     uint8_t protocol_type;                /**< protocol type */
 } ntag21x_version_t;
 
+/**
+ * @brief ntag21x write image flag enumeration definition
+ */
+typedef enum
+{
+    NTAG21X_WRITE_IMAGE_FLAG_NONE   = 0x00,        /**< write the changed pages only */
+    NTAG21X_WRITE_IMAGE_FLAG_VERIFY = 0x01,        /**< read back and compare the image */
+    NTAG21X_WRITE_IMAGE_FLAG_FORCE  = 0x02,        /**< write every page without comparing */
+} ntag21x_write_image_flag_t;
+
+/**
+ * @brief ntag21x config structure definition
+ */
+typedef struct ntag21x_config_s
+{
+    ntag21x_mirror_t mirror;                                        /**< mirror */
+    ntag21x_mirror_byte_t mirror_byte;                              /**< mirror byte */
+    ntag21x_modulation_mode_t modulation_mode;                      /**< modulation mode */
+    uint8_t mirror_page;                                            /**< mirror page */
+    uint8_t protect_start_page;                                     /**< auth0 */
+    ntag21x_bool_t read_protection;                                 /**< read access protection */
+    ntag21x_bool_t user_conf_protection;                            /**< user configuration protection */
+    ntag21x_bool_t nfc_counter;                                     /**< nfc counter */
+    ntag21x_bool_t nfc_counter_password_protection;                 /**< nfc counter password protection */
+    uint8_t authenticate_limitation;                                /**< authenticate limitation */
+    uint8_t raw[8];                                                 /**< cfg0 and cfg1 as read from the tag */
+} ntag21x_config_t;
+
+#if (NTAG21X_STATISTICS == 1)
+/**
+ * @brief ntag21x statistics command enumeration definition
+ */
+typedef enum
+{
+    NTAG21X_STATISTICS_COMMAND_REQUEST       = 0x00,        /**< request */
+    NTAG21X_STATISTICS_COMMAND_WAKE_UP       = 0x01,        /**< wake up */
+    NTAG21X_STATISTICS_COMMAND_HALT          = 0x02,        /**< halt */
+    NTAG21X_STATISTICS_COMMAND_ANTICOLLISION = 0x03,        /**< anti collision cl1 and cl2 */
+    NTAG21X_STATISTICS_COMMAND_SELECT        = 0x04,        /**< select cl1 and cl2 */
+    NTAG21X_STATISTICS_COMMAND_GET_VERSION   = 0x05,        /**< get version */
+    NTAG21X_STATISTICS_COMMAND_READ          = 0x06,        /**< read */
+    NTAG21X_STATISTICS_COMMAND_FAST_READ     = 0x07,        /**< fast read */
+    NTAG21X_STATISTICS_COMMAND_WRITE         = 0x08,        /**< write */
+    NTAG21X_STATISTICS_COMMAND_COMP_WRITE    = 0x09,        /**< comp write, both frames */
+    NTAG21X_STATISTICS_COMMAND_READ_CNT      = 0x0A,        /**< read cnt */
+    NTAG21X_STATISTICS_COMMAND_PWD_AUTH      = 0x0B,        /**< pwd auth */
+    NTAG21X_STATISTICS_COMMAND_READ_SIG      = 0x0C,        /**< read sig */
+    NTAG21X_STATISTICS_COMMAND_OTHER         = 0x0D,        /**< unknown frame */
+    NTAG21X_STATISTICS_COMMAND_MAX           = 0x0E,        /**< number of commands */
+} ntag21x_statistics_command_t;
+
+/**
+ * @brief ntag21x command statistics structure definition
+ */
+typedef struct ntag21x_command_statistics_s
+{
+    uint32_t calls;                                                     /**< frames sent */
+    uint32_t bytes_out;                                                 /**< bytes sent to the tag */
+    uint32_t bytes_in;                                                  /**< bytes received from the tag */
+    uint32_t transceiver_errors;                                        /**< contactless transceiver failures */
+    uint32_t output_len_errors;                                         /**< unexpected response lengths */
+    uint32_t crc_errors;                                                /**< response crc errors */
+    uint32_t naks;                                                      /**< nak responses */
+    uint32_t pack_errors;                                               /**< pack mismatches */
+    uint32_t latency_max_us;                                            /**< longest transceiver call */
+    uint64_t latency_total_us;                                          /**< sum of all transceiver calls */
+    uint32_t histogram[NTAG21X_STATISTICS_HISTOGRAM_BUCKETS];           /**< log2 latency histogram */
+} ntag21x_command_statistics_t;
+
+/**
+ * @brief ntag21x statistics structure definition
+ */
+typedef struct ntag21x_statistics_s
+{
+    ntag21x_command_statistics_t command[NTAG21X_STATISTICS_COMMAND_MAX];        /**< per command statistics */
+} ntag21x_statistics_t;
+#endif
+
+/**
+ * @brief ntag21x session structure definition
+ */
+typedef struct ntag21x_session_s
+{
+    uint8_t uid[7];                /**< uid of the last selected tag */
+    uint8_t selected;              /**< the tag is selected and active */
+    uint8_t authenticated;         /**< authenticated since the last select */
+    uint8_t known;                 /**< bit 0 auth0 is known, bit 1 prot is known */
+    uint8_t auth0;                 /**< first protected page */
+    uint8_t prot;                  /**< read access is protected too */
+} ntag21x_session_t;
+
 /**
  * @brief ntag21x handle structure definition
  */
@@ -152,9 +352,42 @@ typedef struct ntag21x_handle_s
                                        uint8_t *out_buf, uint8_t *out_len);        /**< point to a contactless_transceiver function address */
     void (*delay_ms)(uint32_t ms);                                                 /**< point to a delay_ms function address */
     void (*debug_print)(const char *const fmt, ...);                               /**< point to a debug_print function address */
+    void *user;                                                                    /**< user context passed to the context functions */
+    uint8_t (*contactless_init_ctx)(void *user);                                   /**< point to a contactless_init_ctx function address */
+    uint8_t (*contactless_deinit_ctx)(void *user);                                 /**< point to a contactless_deinit_ctx function address */
+    uint8_t (*contactless_transceiver_ctx)(void *user, uint8_t *in_buf, uint8_t in_len, 
+                                           uint8_t *out_buf, uint8_t *out_len);    /**< point to a contactless_transceiver_ctx function address */
+    void (*delay_ms_ctx)(void *user, uint32_t ms);                                 /**< point to a delay_ms_ctx function address */
+    void (*debug_print_ctx)(void *user, const char *const fmt, ...);               /**< point to a debug_print_ctx function address */
+    uint8_t (*contactless_transceiver_bits)(uint8_t *in_buf, uint8_t in_bits, uint8_t *out_buf, 
+                                            uint8_t *out_bits, uint8_t *collision);                /**< point to a contactless_transceiver_bits function address */
+    uint8_t (*contactless_transceiver_bits_ctx)(void *user, uint8_t *in_buf, uint8_t in_bits, uint8_t *out_buf, 
+                                                uint8_t *out_bits, uint8_t *collision);            /**< point to a contactless_transceiver_bits_ctx function address */
+    void *trace;                                                                   /**< attached trace handle, set by ntag21x_trace_init */
+    uint8_t (*trace_transceiver)(void *trace, uint8_t *in_buf, uint8_t in_len, 
+                                 uint8_t *out_buf, uint8_t *out_len);              /**< transceiver of the attached trace */
+    uint8_t (*trace_transceiver_bits)(void *trace, uint8_t *in_buf, uint8_t in_bits, uint8_t *out_buf, 
+                                      uint8_t *out_bits, uint8_t *collision);      /**< bit oriented transceiver of the attached trace */
     uint8_t type;                                                                  /**< ntag type */
     uint8_t inited;                                                                /**< inited flag */
     uint8_t end_page;                                                              /**< end page */
+    uint8_t max_frame_len;                                                         /**< max reader frame length */
+    uint8_t *page_cache;                                                           /**< page cache buffer */
+    uint16_t page_cache_pages;                                                     /**< page cache size in pages */
+    uint8_t page_cache_valid[32];                                                  /**< page cache valid bitmap */
+    uint8_t (*derive_password)(uint8_t uid[7], uint8_t pwd[4], uint8_t pack[2]);   /**< point to a derive_password function address */
+    uint8_t (*derive_password_ctx)(void *user, uint8_t uid[7], 
+                                   uint8_t pwd[4], uint8_t pack[2]);               /**< point to a derive_password_ctx function address */
+    ntag21x_session_t session;                                                     /**< session of the selected tag */
+    uint8_t session_key_valid;                                                     /**< pwd and pack are derived for the session uid */
+    uint8_t session_pwd[4];                                                        /**< derived password */
+    uint8_t session_pack[2];                                                       /**< derived pack */
+#if (NTAG21X_STATISTICS == 1)
+    uint32_t (*timestamp_us)(void);                                                /**< point to a timestamp_us function address */
+    uint32_t (*timestamp_us_ctx)(void *user);                                      /**< point to a timestamp_us_ctx function address */
+    uint8_t statistics_command;                                                    /**< command of the last frame */
+    ntag21x_statistics_t statistics;                                               /**< statistics */
+#endif
 } ntag21x_handle_t;
 
 /**
@@ -232,6 +465,117 @@ typedef struct ntag21x_info_s
  */
 #define DRIVER_NTAG21X_LINK_DEBUG_PRINT(HANDLE, FUC)                (HANDLE)->debug_print = FUC
 
+/**
+ * @brief     link the user context
+ * @param[in] HANDLE pointer to an ntag21x handle structure
+ * @param[in] USER pointer to a user context passed to the context functions
+ * @note      none
+ */
+#define DRIVER_NTAG21X_LINK_USER(HANDLE, USER)                       (HANDLE)->user = USER
+
+/**
+ * @brief     link contactless_init_ctx function
+ * @param[in] HANDLE pointer to an ntag21x handle structure
+ * @param[in] FUC pointer to a contactless_init_ctx function address
+ * @note      used instead of contactless_init when linked
+ */
+#define DRIVER_NTAG21X_LINK_CONTACTLESS_INIT_CTX(HANDLE, FUC)        (HANDLE)->contactless_init_ctx = FUC
+
+/**
+ * @brief     link contactless_deinit_ctx function
+ * @param[in] HANDLE pointer to an ntag21x handle structure
+ * @param[in] FUC pointer to a contactless_deinit_ctx function address
+ * @note      used instead of contactless_deinit when linked
+ */
+#define DRIVER_NTAG21X_LINK_CONTACTLESS_DEINIT_CTX(HANDLE, FUC)      (HANDLE)->contactless_deinit_ctx = FUC
+
+/**
+ * @brief     link contactless_transceiver_ctx function
+ * @param[in] HANDLE pointer to an ntag21x handle structure
+ * @param[in] FUC pointer to a contactless_transceiver_ctx function address
+ * @note      used instead of contactless_transceiver when linked
+ */
+#define DRIVER_NTAG21X_LINK_CONTACTLESS_TRANSCEIVER_CTX(HANDLE, FUC) (HANDLE)->contactless_transceiver_ctx = FUC
+
+/**
+ * @brief     link delay_ms_ctx function
+ * @param[in] HANDLE pointer to an ntag21x handle structure
+ * @param[in] FUC pointer to a delay_ms_ctx function address
+ * @note      used instead of delay_ms when linked
+ */
+#define DRIVER_NTAG21X_LINK_DELAY_MS_CTX(HANDLE, FUC)                (HANDLE)->delay_ms_ctx = FUC
+
+/**
+ * @brief     link debug_print_ctx function
+ * @param[in] HANDLE pointer to an ntag21x handle structure
+ * @param[in] FUC pointer to a debug_print_ctx function address
+ * @note      used instead of debug_print when linked
+ */
+#define DRIVER_NTAG21X_LINK_DEBUG_PRINT_CTX(HANDLE, FUC)             (HANDLE)->debug_print_ctx = FUC
+
+/**
+ * @brief     link contactless_transceiver_bits function
+ * @param[in] HANDLE pointer to an ntag21x handle structure
+ * @param[in] FUC pointer to a contactless_transceiver_bits function address
+ * @note      optional, only needed by the bit oriented anti collision,
+ *            the first received bit is stored at bit in_bits % 8 of out_buf[0]
+ *            and the reader stops before the first collision
+ */
+#define DRIVER_NTAG21X_LINK_CONTACTLESS_TRANSCEIVER_BITS(HANDLE, FUC)     (HANDLE)->contactless_transceiver_bits = FUC
+
+/**
+ * @brief     link contactless_transceiver_bits_ctx function
+ * @param[in] HANDLE pointer to an ntag21x handle structure
+ * @param[in] FUC pointer to a contactless_transceiver_bits_ctx function address
+ * @note      used instead of contactless_transceiver_bits when linked
+ */
+#define DRIVER_NTAG21X_LINK_CONTACTLESS_TRANSCEIVER_BITS_CTX(HANDLE, FUC) (HANDLE)->contactless_transceiver_bits_ctx = FUC
+
+/**
+ * @brief     link derive_password function
+ * @param[in] HANDLE pointer to an ntag21x handle structure
+ * @param[in] FUC pointer to a derive_password function address
+ * @note      optional, returns the password and pack of a uid and 0 on success,
+ *            protected reads and writes authenticate by themselves when linked
+ */
+#define DRIVER_NTAG21X_LINK_DERIVE_PASSWORD(HANDLE, FUC)                  (HANDLE)->derive_password = FUC
+
+/**
+ * @brief     link derive_password_ctx function
+ * @param[in] HANDLE pointer to an ntag21x handle structure
+ * @param[in] FUC pointer to a derive_password_ctx function address
+ * @note      used instead of derive_password when linked
+ */
+#define DRIVER_NTAG21X_LINK_DERIVE_PASSWORD_CTX(HANDLE, FUC)              (HANDLE)->derive_password_ctx = FUC
+
+/**
+ * @brief     print with the linked debug_print_ctx or debug_print function
+ * @param[in] HANDLE pointer to an ntag21x handle structure
+ * @note      used by the driver and its extension modules, a macro because
+ *            variadic arguments can not be forwarded by a function
+ */
+#define NTAG21X_PRINT(HANDLE, ...)                                   (((HANDLE)->debug_print_ctx != NULL) ?                    \
+                                                                      (HANDLE)->debug_print_ctx((HANDLE)->user, __VA_ARGS__) : \
+                                                                      (HANDLE)->debug_print(__VA_ARGS__))
+
+#if (NTAG21X_STATISTICS == 1)
+/**
+ * @brief     link timestamp_us function
+ * @param[in] HANDLE pointer to an ntag21x handle structure
+ * @param[in] FUC pointer to a timestamp_us function address
+ * @note      optional, a free running microsecond counter, wrap around is allowed
+ */
+#define DRIVER_NTAG21X_LINK_TIMESTAMP_US(HANDLE, FUC)               (HANDLE)->timestamp_us = FUC
+
+/**
+ * @brief     link timestamp_us_ctx function
+ * @param[in] HANDLE pointer to an ntag21x handle structure
+ * @param[in] FUC pointer to a timestamp_us_ctx function address
+ * @note      used instead of timestamp_us when linked
+ */
+#define DRIVER_NTAG21X_LINK_TIMESTAMP_US_CTX(HANDLE, FUC)           (HANDLE)->timestamp_us_ctx = FUC
+#endif
+
 /**
  * @}
  */
@@ -349,6 +693,30 @@ uint8_t ntag21x_anticollision_cl1(ntag21x_handle_t *handle, uint8_t id[4]);
  */
 uint8_t ntag21x_anticollision_cl2(ntag21x_handle_t *handle, uint8_t id[4]);
 
+/**
+ * @brief         ntag21x bit oriented anti collision
+ * @param[in]     *handle pointer to an ntag21x handle structure
+ * @param[in]     level cascade level
+ * @param[in,out] *id pointer to a 5 bytes id buffer
+ * @param[in,out] *bits pointer to a known bits buffer
+ * @param[out]    *collision pointer to a collision flag buffer
+ * @return        status code
+ *                - 0 success
+ *                - 1 anti collision failed
+ *                - 2 handle is NULL
+ *                - 3 handle is not initialized
+ *                - 4 bits is invalid
+ *                - 5 output bits is invalid
+ *                - 6 check error
+ *                - 7 contactless_transceiver_bits is not linked
+ * @note          the first bits of id are sent as the known part of the uid, the answered
+ *                bits are merged into id and bits is advanced, when collision is set the
+ *                bit at position bits differs between the tags and must be chosen by the caller,
+ *                id holds the cascade tag or uid and bcc when bits reaches 40
+ */
+uint8_t ntag21x_anticollision_bits(ntag21x_handle_t *handle, ntag21x_cascade_level_t level,
+                                   uint8_t id[5], uint8_t *bits, uint8_t *collision);
+
 /**
  * @brief     ntag21x select cl1
  * @param[in] *handle pointer to an ntag21x handle structure
@@ -379,6 +747,37 @@ uint8_t ntag21x_select_cl1(ntag21x_handle_t *handle, uint8_t id[4]);
  */
 uint8_t ntag21x_select_cl2(ntag21x_handle_t *handle, uint8_t id[4]);
 
+/**
+ * @brief         ntag21x reselect a known tag
+ * @param[in]     *handle pointer to an ntag21x handle structure
+ * @param[in,out] *uid pointer to a 7 bytes uid buffer
+ * @return        status code
+ *                - 0 success
+ *                - 1 reselect failed
+ *                - 2 handle is NULL
+ *                - 3 handle is not initialized
+ * @note          wakes up the tag and selects both cascade levels with the known uid,
+ *                if the tag does not answer the anti collision runs and uid is updated
+ */
+uint8_t ntag21x_reselect(ntag21x_handle_t *handle, uint8_t uid[7]);
+
+/**
+ * @brief     ntag21x check that the selected tag is still in the field
+ * @param[in] *handle pointer to an ntag21x handle structure
+ * @param[in] *uid pointer to a 7 bytes uid buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 no answer
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 output_len is invalid
+ *            - 5 crc error
+ *            - 6 uid is different
+ * @note      one read of page 0 over the air, the cache is bypassed and the uid is compared,
+ *            a missing answer is not printed because it is the expected result of a removal
+ */
+uint8_t ntag21x_check_presence(ntag21x_handle_t *handle, uint8_t uid[7]);
+
 /**
  * @brief      ntag21x get the version
  * @param[in]  *handle pointer to an ntag21x handle structure
@@ -390,7 +789,8 @@ uint8_t ntag21x_select_cl2(ntag21x_handle_t *handle, uint8_t id[4]);
  *             - 3 handle is not initialized
  *             - 4 output_len is invalid
  *             - 5 crc error
- * @note       none
+ *             - 6 tag is not the built variant
+ * @note       a single variant build returns 6 for a storage size of another variant
  */
 uint8_t ntag21x_get_version(ntag21x_handle_t *handle, ntag21x_version_t *version);
 
@@ -448,6 +848,82 @@ uint8_t ntag21x_read_page(ntag21x_handle_t *handle, uint8_t page, uint8_t data[4
  */
 uint8_t ntag21x_fast_read_page(ntag21x_handle_t *handle, uint8_t start_page, uint8_t stop_page, uint8_t *data, uint16_t *len);
 
+/**
+ * @brief         ntag21x dump memory
+ * @param[in]     *handle pointer to an ntag21x handle structure
+ * @param[in]     first_page first page
+ * @param[in]     last_page last page
+ * @param[out]    *data pointer to a data buffer
+ * @param[in,out] *len pointer to a data length buffer
+ * @return        status code
+ *                - 0 success
+ *                - 1 dump memory failed
+ *                - 2 handle is NULL
+ *                - 3 handle is not initialized
+ *                - 4 last_page < first_page
+ *                - 5 first_page is over the end page
+ *                - 6 len is invalid
+ *                - 7 output_len is invalid
+ *                - 8 crc error
+ * @note          last_page is clamped to the end page of the detected tag
+ *                the range is split into fast reads of the max frame length
+ *                with 2 more bytes in len the last frame needs no copy
+ */
+uint8_t ntag21x_dump_memory(ntag21x_handle_t *handle, uint8_t first_page, uint8_t last_page, uint8_t *data, uint16_t *len);
+
+/**
+ * @brief     ntag21x set the max frame length
+ * @param[in] *handle pointer to an ntag21x handle structure
+ * @param[in] len max frame length the reader can receive
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 len is invalid
+ * @note      6 <= len, the default is NTAG21X_DEFAULT_MAX_FRAME_LEN
+ */
+uint8_t ntag21x_set_max_frame_length(ntag21x_handle_t *handle, uint8_t len);
+
+/**
+ * @brief      ntag21x get the max frame length
+ * @param[in]  *handle pointer to an ntag21x handle structure
+ * @param[out] *len pointer to a max frame length buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t ntag21x_get_max_frame_length(ntag21x_handle_t *handle, uint8_t *len);
+
+/**
+ * @brief     ntag21x set the page cache
+ * @param[in] *handle pointer to an ntag21x handle structure
+ * @param[in] *buf pointer to a cache buffer, NULL disables the cache
+ * @param[in] len buffer length
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 len is invalid
+ * @note      len >= 4, NTAG21X_PAGE_CACHE_MAX_LEN covers every variant
+ *            pages beyond the end page of the detected tag are never cached
+ *            the cache is filled by reads, updated by writes and cleared by halt and select
+ *            with the read protection enabled, authenticate before reading through the cache
+ */
+uint8_t ntag21x_set_page_cache(ntag21x_handle_t *handle, uint8_t *buf, uint16_t len);
+
+/**
+ * @brief     ntag21x invalidate the page cache
+ * @param[in] *handle pointer to an ntag21x handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t ntag21x_invalidate_page_cache(ntag21x_handle_t *handle);
+
 /**
  * @brief     ntag21x compatibility write page
  * @param[in] *handle pointer to an ntag21x handle structure
@@ -480,6 +956,25 @@ uint8_t ntag21x_compatibility_write_page(ntag21x_handle_t *handle, uint8_t page,
  */
 uint8_t ntag21x_write_page(ntag21x_handle_t *handle, uint8_t page, uint8_t data[4]);
 
+/**
+ * @brief     ntag21x write an image
+ * @param[in] *handle pointer to an ntag21x handle structure
+ * @param[in] start_page start page
+ * @param[in] *image pointer to an image buffer
+ * @param[in] len image length
+ * @param[in] flags ntag21x_write_image_flag_t flags
+ * @return    status code
+ *            - 0 success
+ *            - 1 write image failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 len is invalid
+ *            - 5 verify failed
+ * @note      the current contents are read with fast read and only the pages
+ *            that differ are written, a partial last page keeps its other bytes
+ */
+uint8_t ntag21x_write_image(ntag21x_handle_t *handle, uint8_t start_page, uint8_t *image, uint16_t len, uint8_t flags);
+
 /**
  * @brief      ntag21x read the counter
  * @param[in]  *handle pointer to an ntag21x handle structure
@@ -521,7 +1016,7 @@ uint8_t ntag21x_read_signature(ntag21x_handle_t *handle, uint8_t signature[32]);
  *             - 3 handle is not initialized
  *             - 4 output_len is invalid
  *             - 5 crc error
- * @note       none
+ * @note       pages 0 and 1 are served from and filled into the page cache
  */
 uint8_t ntag21x_get_serial_number(ntag21x_handle_t *handle, uint8_t number[7]);
 
@@ -537,10 +1032,40 @@ uint8_t ntag21x_get_serial_number(ntag21x_handle_t *handle, uint8_t number[7]);
  *             - 4 output_len is invalid
  *             - 5 crc error
  *             - 6 data is invalid
- * @note       none
+ * @note       sets the end page, a single variant build also returns 6 for a tag of another variant,
+ *             page 0 is always read over the air and pages 0 - 3 are filled into the page cache
  */
 uint8_t ntag21x_get_capability_container(ntag21x_handle_t *handle, ntag21x_capability_container_t *container);
 
+/**
+ * @brief     ntag21x authenticate the selected tag once per selection
+ * @param[in] *handle pointer to an ntag21x handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 authenticate failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 no tag is selected
+ *            - 5 derive_password is null
+ *            - 6 derive password failed
+ *            - 7 pack check failed
+ * @note      nothing is sent when the selection is already authenticated, the password
+ *            and pack are derived from the uid once and kept until another tag is selected
+ */
+uint8_t ntag21x_session_authenticate(ntag21x_handle_t *handle);
+
+/**
+ * @brief      ntag21x get the session of the selected tag
+ * @param[in]  *handle pointer to an ntag21x handle structure
+ * @param[out] *session pointer to a session structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t ntag21x_get_session(ntag21x_handle_t *handle, ntag21x_session_t *session);
+
 /**
  * @brief     ntag21x set the password
  * @param[in] *handle pointer to an ntag21x handle structure
@@ -584,7 +1109,8 @@ uint8_t ntag21x_set_pack(ntag21x_handle_t *handle, uint8_t pack[2]);
  *            - 4 output_len is invalid
  *            - 5 crc error
  *            - 6 pack check failed
- * @note      none
+ * @note      the session counts as authenticated until the next select,
+ *            only the cached pages behind auth0 are dropped
  */
 uint8_t ntag21x_authenticate(ntag21x_handle_t *handle, uint8_t pwd[4], uint8_t pack[2]);
 
@@ -599,7 +1125,8 @@ uint8_t ntag21x_authenticate(ntag21x_handle_t *handle, uint8_t pwd[4], uint8_t p
  *            - 3 handle is not initialized
  *            - 4 output_len is invalid
  *            - 5 ack error
- * @note                                                               ntag213                                                                                    
+ * @note      a single variant build clears the lock bits the built variant does not have
+ *                                                                     ntag213                                                                                    
  *                                                                     byte0                                                                                      
  *            bit7               bit6               bit5               bit4               bit3               bit2              bit1              bit0             
  *            lock_page_30_31    lock_page_28_29    lock_page_26_27    lock_page_24_25    lock_page_22_23    lock_page_20_21   lock_page_18_19   lock_page_16_17  
@@ -867,6 +1394,62 @@ uint8_t ntag21x_set_authenticate_limitation(ntag21x_handle_t *handle, uint8_t li
  */
 uint8_t ntag21x_get_authenticate_limitation(ntag21x_handle_t *handle, uint8_t *limit);
 
+/**
+ * @brief      ntag21x begin a config transaction
+ * @param[in]  *handle pointer to an ntag21x handle structure
+ * @param[out] *config pointer to a config structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 config begin failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 output_len is invalid
+ *             - 5 crc error
+ * @note       reads cfg0 and cfg1 with one fast read
+ */
+uint8_t ntag21x_config_begin(ntag21x_handle_t *handle, ntag21x_config_t *config);
+
+/**
+ * @brief         ntag21x commit a config transaction
+ * @param[in]     *handle pointer to an ntag21x handle structure
+ * @param[in,out] *config pointer to a config structure
+ * @return        status code
+ *                - 0 success
+ *                - 1 config commit failed
+ *                - 2 handle is NULL
+ *                - 3 handle is not initialized
+ *                - 4 authenticate limitation > 7
+ * @note          only the changed pages are written, cfg1 goes first because a
+ *                lower auth0 would protect it, unless cfg1 sets the user
+ *                configuration protection which would lock cfg0
+ */
+uint8_t ntag21x_config_commit(ntag21x_handle_t *handle, ntag21x_config_t *config);
+
+#if (NTAG21X_STATISTICS == 1)
+/**
+ * @brief      get a snapshot of the statistics
+ * @param[in]  *handle pointer to an ntag21x handle structure
+ * @param[out] *statistics pointer to a statistics structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       latency is only measured when a timestamp_us function is linked
+ */
+uint8_t ntag21x_get_statistics(ntag21x_handle_t *handle, ntag21x_statistics_t *statistics);
+
+/**
+ * @brief     clear the statistics
+ * @param[in] *handle pointer to an ntag21x handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t ntag21x_clear_statistics(ntag21x_handle_t *handle);
+#endif
+
 /**
  * @}
  */
@@ -892,6 +1475,18 @@ uint8_t ntag21x_get_authenticate_limitation(ntag21x_handle_t *handle, uint8_t *l
  */
 uint8_t ntag21x_transceiver(ntag21x_handle_t *handle, uint8_t *in_buf, uint8_t in_len, uint8_t *out_buf, uint8_t *out_len);
 
+/**
+ * @brief         update an iso14443a crc
+ * @param[in,out] *crc pointer to a crc buffer
+ * @param[in]     *buf pointer to a data buffer
+ * @param[in]     len data length
+ * @return        status code
+ *                - 0 success
+ *                - 1 crc or buf is NULL
+ * @note          start with NTAG21X_ISO14443A_CRC_INIT, the crc is sent lsb first
+ */
+uint8_t ntag21x_iso14443a_crc_update(uint16_t *crc, uint8_t *buf, uint16_t len);
+
 /**
  * @}
  */
@@ -0,0 +1,604 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file      driver_ntag21x.hpp
+ * @brief     driver ntag21x c++ header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_NTAG21X_HPP
+#define DRIVER_NTAG21X_HPP
+
+#include "driver_ntag21x.h"
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <version>
+#if defined(__cpp_lib_expected) && (__cpp_lib_expected >= 202202L)
+#include <expected>
+#endif
+
+/**
+ * @defgroup ntag21x_cpp_driver ntag21x c++ driver function
+ * @brief    ntag21x c++ driver modules
+ * @ingroup  ntag21x_driver
+ * @note     header only, every member is an inline forward to the c function so a
+ *           reader is an ntag21x_handle_t and a session is one pointer
+ * @{
+ */
+
+namespace ntag21x
+{
+
+/**
+ * @brief ntag21x error enumeration definition
+ * @note  carries the status code of the c function, codes from 4 are function specific
+ *        and documented with the c function
+ */
+enum class error : uint8_t
+{
+    failed          = 1,        /**< operation failed */
+    handle_null     = 2,        /**< handle is NULL */
+    not_initialized = 3,        /**< handle is not initialized */
+};
+
+#if defined(__cpp_lib_expected) && (__cpp_lib_expected >= 202202L)
+using std::expected;
+using std::unexpected;
+#else
+/**
+ * @brief ntag21x unexpected class definition
+ * @note  subset of std::unexpected for c++20
+ */
+template <class E>
+class unexpected
+{
+  public:
+    constexpr explicit unexpected(E e) noexcept : m_error(e) {}
+    constexpr E error() const noexcept { return m_error; }
+    
+  private:
+    E m_error;        /**< error */
+};
+
+/**
+ * @brief ntag21x expected class definition
+ * @note  subset of std::expected for c++20 without exceptions,
+ *        value() and operator* require has_value()
+ */
+template <class T, class E>
+class expected
+{
+    static_assert(std::is_trivially_copyable_v<E>, "E must be trivially copyable");
+    
+  public:
+    using value_type = T;
+    using error_type = E;
+    
+    expected(const T &value) noexcept(std::is_nothrow_copy_constructible_v<T>) : m_has(true) { ::new (&m_value) T(value); }
+    expected(T &&value) noexcept(std::is_nothrow_move_constructible_v<T>) : m_has(true) { ::new (&m_value) T(std::move(value)); }
+    constexpr expected(const unexpected<E> &e) noexcept : m_error(e.error()), m_has(false) {}
+    expected(const expected &other) noexcept(std::is_nothrow_copy_constructible_v<T>) : m_has(other.m_has)
+    {
+        if (m_has)
+        {
+            ::new (&m_value) T(other.m_value);
+        }
+        else
+        {
+            m_error = other.m_error;
+        }
+    }
+    expected(expected &&other) noexcept(std::is_nothrow_move_constructible_v<T>) : m_has(other.m_has)
+    {
+        if (m_has)
+        {
+            ::new (&m_value) T(std::move(other.m_value));
+        }
+        else
+        {
+            m_error = other.m_error;
+        }
+    }
+    expected &operator=(expected other) noexcept(std::is_nothrow_move_constructible_v<T>)
+    {
+        this->~expected();
+        ::new (this) expected(std::move(other));
+        
+        return *this;
+    }
+    ~expected()
+    {
+        if (m_has)
+        {
+            m_value.~T();
+        }
+    }
+    
+    constexpr bool has_value() const noexcept { return m_has; }
+    constexpr explicit operator bool() const noexcept { return m_has; }
+    constexpr T &value() & noexcept { return m_value; }
+    constexpr const T &value() const & noexcept { return m_value; }
+    constexpr T &&value() && noexcept { return std::move(m_value); }
+    constexpr T &operator*() & noexcept { return m_value; }
+    constexpr const T &operator*() const & noexcept { return m_value; }
+    constexpr T &&operator*() && noexcept { return std::move(m_value); }
+    constexpr T *operator->() noexcept { return &m_value; }
+    constexpr const T *operator->() const noexcept { return &m_value; }
+    constexpr E error() const noexcept { return m_error; }
+    template <class U>
+    constexpr T value_or(U &&other) const & { return m_has ? m_value : static_cast<T>(std::forward<U>(other)); }
+    
+  private:
+    union
+    {
+        T m_value;        /**< value */
+        E m_error;        /**< error */
+    };
+    bool m_has;           /**< has value flag */
+};
+
+/**
+ * @brief ntag21x expected class definition for void
+ */
+template <class E>
+class expected<void, E>
+{
+    static_assert(std::is_trivially_copyable_v<E>, "E must be trivially copyable");
+    
+  public:
+    using value_type = void;
+    using error_type = E;
+    
+    constexpr expected() noexcept : m_error(), m_has(true) {}
+    constexpr expected(const unexpected<E> &e) noexcept : m_error(e.error()), m_has(false) {}
+    
+    constexpr bool has_value() const noexcept { return m_has; }
+    constexpr explicit operator bool() const noexcept { return m_has; }
+    constexpr void value() const noexcept {}
+    constexpr void operator*() const noexcept {}
+    constexpr E error() const noexcept { return m_error; }
+    
+  private:
+    E m_error;        /**< error */
+    bool m_has;       /**< has value flag */
+};
+#endif
+
+/**
+ * @brief ntag21x result alias definition
+ */
+template <class T>
+using result = expected<T, error>;
+
+namespace detail
+{
+
+/**
+ * @brief     convert a status code
+ * @param[in] res status code of the c function
+ * @return    empty result or the error
+ * @note      none
+ */
+inline result<void> check(uint8_t res) noexcept
+{
+    if (res != 0)
+    {
+        return unexpected<error>(static_cast<error>(res));
+    }
+    
+    return {};
+}
+
+/**
+ * @brief     convert a status code and a value
+ * @param[in] res status code of the c function
+ * @param[in] value value written by the c function
+ * @return    the value or the error
+ * @note      none
+ */
+template <class T>
+inline result<T> check(uint8_t res, const T &value) noexcept
+{
+    if (res != 0)
+    {
+        return unexpected<error>(static_cast<error>(res));
+    }
+    
+    return value;
+}
+
+}
+
+class session;
+
+/**
+ * @brief ntag21x reader class definition
+ * @note  owns one ntag21x_handle_t, link the functions through native() with the
+ *        DRIVER_NTAG21X_LINK_xxx macros before open(), the destructor deinits an open reader,
+ *        a reader must not be moved while one of its sessions is alive
+ */
+class reader
+{
+  public:
+    reader() noexcept { DRIVER_NTAG21X_LINK_INIT(&m_handle, ntag21x_handle_t); }
+    reader(const reader &) = delete;
+    reader &operator=(const reader &) = delete;
+    reader(reader &&other) noexcept : m_handle(other.m_handle) { other.m_handle.inited = 0; }
+    reader &operator=(reader &&other) noexcept
+    {
+        if (this != &other)
+        {
+            close();
+            m_handle = other.m_handle;
+            other.m_handle.inited = 0;
+        }
+        
+        return *this;
+    }
+    ~reader() { close(); }
+    
+    /**
+     * @brief  get the c handle
+     * @return pointer to the ntag21x handle structure
+     * @note   for linking and for the c functions without a wrapper
+     */
+    ntag21x_handle_t *native() noexcept { return &m_handle; }
+    
+    /**
+     * @brief  open the reader
+     * @return empty result or the ntag21x_init error
+     * @note   none
+     */
+    result<void> open() noexcept { return detail::check(ntag21x_init(&m_handle)); }
+    
+    /**
+     * @brief close the reader
+     * @note  calls ntag21x_deinit once, nothing is done when the reader is not open
+     */
+    void close() noexcept
+    {
+        if (m_handle.inited == 1)
+        {
+            (void)ntag21x_deinit(&m_handle);
+        }
+    }
+    
+    /**
+     * @brief  check the reader is open
+     * @return true if open
+     * @note   none
+     */
+    bool is_open() const noexcept { return m_handle.inited == 1; }
+    
+    /**
+     * @brief  wake up and select the tag in the field
+     * @return the session or the error of the failed step
+     * @note   wake up, anti collision and select of both cascade levels,
+     *         then the capability container is read to set the end page
+     */
+    inline result<session> select() noexcept;
+    
+    /**
+     * @brief         select a known tag again
+     * @param[in,out] uid 7 bytes uid, updated when another tag answers the anti collision
+     * @return        the session or the error of the failed step
+     * @note          ntag21x_reselect, then the capability container is read to set the end page
+     */
+    inline result<session> select(std::span<uint8_t, 7> uid) noexcept;
+    
+  private:
+    /**
+     * @brief  open a session on the selected tag
+     * @return the session or the ntag21x_get_capability_container error
+     * @note   none
+     */
+    inline result<session> open_session() noexcept;
+    
+    ntag21x_handle_t m_handle;        /**< c handle */
+};
+
+/**
+ * @brief ntag21x session class definition
+ * @note  scopes one selected tag, the destructor halts it,
+ *        every buffer is caller memory filled or read by the c function directly
+ */
+class session
+{
+  public:
+    session(const session &) = delete;
+    session &operator=(const session &) = delete;
+    session(session &&other) noexcept : m_handle(std::exchange(other.m_handle, nullptr)) {}
+    session &operator=(session &&other) noexcept
+    {
+        if (this != &other)
+        {
+            (void)halt();
+            m_handle = std::exchange(other.m_handle, nullptr);
+        }
+        
+        return *this;
+    }
+    ~session() { (void)halt(); }
+    
+    /**
+     * @brief  halt the tag and end the session
+     * @return empty result or the ntag21x_halt error
+     * @note   nothing is done when the session already ended
+     */
+    result<void> halt() noexcept
+    {
+        ntag21x_handle_t *handle = std::exchange(m_handle, nullptr);
+        
+        if (handle == nullptr)
+        {
+            return {};
+        }
+        
+        return detail::check(ntag21x_halt(handle));
+    }
+    
+    /**
+     * @brief  check the session is active
+     * @return true if active
+     * @note   none
+     */
+    bool active() const noexcept { return m_handle != nullptr; }
+    
+    /**
+     * @brief  get the c handle
+     * @return pointer to the ntag21x handle structure
+     * @note   none
+     */
+    ntag21x_handle_t *native() noexcept { return m_handle; }
+    
+    /**
+     * @brief      read one page
+     * @param[in]  page page
+     * @param[out] data 4 bytes buffer
+     * @return     empty result or the ntag21x_read_page error
+     * @note       none
+     */
+    result<void> read_page(uint8_t page, std::span<uint8_t, 4> data) noexcept
+    {
+        return detail::check(ntag21x_read_page(m_handle, page, data.data()));
+    }
+    
+    /**
+     * @brief      read four pages
+     * @param[in]  page start page
+     * @param[out] data 16 bytes buffer
+     * @return     empty result or the ntag21x_read_four_pages error
+     * @note       none
+     */
+    result<void> read_four_pages(uint8_t page, std::span<uint8_t, 16> data) noexcept
+    {
+        return detail::check(ntag21x_read_four_pages(m_handle, page, data.data()));
+    }
+    
+    /**
+     * @brief      read a page range
+     * @param[in]  first_page first page
+     * @param[in]  last_page last page
+     * @param[out] data buffer of at least 4 * (last_page - first_page + 1) bytes
+     * @return     the filled part of data or the ntag21x_dump_memory error
+     * @note       split into fast reads of the max frame length, last_page is clamped to the tag
+     */
+    result<std::span<uint8_t>> read(uint8_t first_page, uint8_t last_page, std::span<uint8_t> data) noexcept
+    {
+        uint16_t len = (data.size() > 0xFFFFU) ? 0xFFFFU : static_cast<uint16_t>(data.size());
+        uint8_t res = ntag21x_dump_memory(m_handle, first_page, last_page, data.data(), &len);
+        
+        return detail::check(res, data.first(len));
+    }
+    
+    /**
+     * @brief     write one page
+     * @param[in] page page
+     * @param[in] data 4 bytes buffer
+     * @return    empty result or the ntag21x_write_page error
+     * @note      none
+     */
+    result<void> write_page(uint8_t page, std::span<const uint8_t, 4> data) noexcept
+    {
+        return detail::check(ntag21x_write_page(m_handle, page, const_cast<uint8_t *>(data.data())));
+    }
+    
+    /**
+     * @brief     write an image
+     * @param[in] page start page
+     * @param[in] image image buffer
+     * @param[in] flags ntag21x_write_image_flag_t flags
+     * @return    empty result or the ntag21x_write_image error
+     * @note      only the pages that differ are written
+     */
+    result<void> write(uint8_t page, std::span<const uint8_t> image, uint8_t flags = 0) noexcept
+    {
+        if (image.size() > 0xFFFFU)
+        {
+            return unexpected<error>(static_cast<error>(4));
+        }
+        
+        return detail::check(ntag21x_write_image(m_handle, page, const_cast<uint8_t *>(image.data()),
+                                                 static_cast<uint16_t>(image.size()), flags));
+    }
+    
+    /**
+     * @brief     authenticate with a password
+     * @param[in] pwd 4 bytes password
+     * @param[in] pack 2 bytes expected pack
+     * @return    empty result or the ntag21x_authenticate error
+     * @note      none
+     */
+    result<void> authenticate(std::span<const uint8_t, 4> pwd, std::span<const uint8_t, 2> pack) noexcept
+    {
+        return detail::check(ntag21x_authenticate(m_handle, const_cast<uint8_t *>(pwd.data()),
+                                                  const_cast<uint8_t *>(pack.data())));
+    }
+    
+    /**
+     * @brief      read the originality signature
+     * @param[out] signature 32 bytes buffer
+     * @return     empty result or the ntag21x_read_signature error
+     * @note       none
+     */
+    result<void> read_signature(std::span<uint8_t, 32> signature) noexcept
+    {
+        return detail::check(ntag21x_read_signature(m_handle, signature.data()));
+    }
+    
+    /**
+     * @brief      read the serial number
+     * @param[out] number 7 bytes buffer
+     * @return     empty result or the ntag21x_get_serial_number error
+     * @note       none
+     */
+    result<void> serial_number(std::span<uint8_t, 7> number) noexcept
+    {
+        return detail::check(ntag21x_get_serial_number(m_handle, number.data()));
+    }
+    
+    /**
+     * @brief  read the nfc counter
+     * @return the counter or the ntag21x_read_counter error
+     * @note   none
+     */
+    result<uint32_t> read_counter() noexcept
+    {
+        uint32_t cnt = 0;
+        uint8_t res = ntag21x_read_counter(m_handle, &cnt);
+        
+        return detail::check(res, cnt);
+    }
+    
+    /**
+     * @brief  get the version
+     * @return the version or the ntag21x_get_version error
+     * @note   none
+     */
+    result<ntag21x_version_t> version() noexcept
+    {
+        ntag21x_version_t version{};
+        uint8_t res = ntag21x_get_version(m_handle, &version);
+        
+        return detail::check(res, version);
+    }
+    
+    /**
+     * @brief  get the capability container
+     * @return the container or the ntag21x_get_capability_container error
+     * @note   sets the end page of the handle
+     */
+    result<ntag21x_capability_container_t> capability_container() noexcept
+    {
+        ntag21x_capability_container_t container{};
+        uint8_t res = ntag21x_get_capability_container(m_handle, &container);
+        
+        return detail::check(res, container);
+    }
+    
+  private:
+    friend class reader;
+    
+    explicit session(ntag21x_handle_t *handle) noexcept : m_handle(handle) {}
+    
+    ntag21x_handle_t *m_handle;        /**< handle of the reader, nullptr after the halt */
+};
+
+static_assert(sizeof(reader) == sizeof(ntag21x_handle_t), "reader must be the c handle");
+static_assert(sizeof(session) == sizeof(ntag21x_handle_t *), "session must be one pointer");
+
+inline result<session> reader::select() noexcept
+{
+    ntag21x_type_t type;
+    uint8_t id[8];
+    uint8_t res;
+    
+    res = ntag21x_wake_up(&m_handle, &type);
+    if (res == 0)
+    {
+        res = ntag21x_anticollision_cl1(&m_handle, id);
+    }
+    if (res == 0)
+    {
+        res = ntag21x_select_cl1(&m_handle, id);
+    }
+    if (res == 0)
+    {
+        res = ntag21x_anticollision_cl2(&m_handle, id + 4);
+    }
+    if (res == 0)
+    {
+        res = ntag21x_select_cl2(&m_handle, id + 4);
+    }
+    if (res != 0)
+    {
+        return unexpected<error>(static_cast<error>(res));
+    }
+    
+    return open_session();
+}
+
+inline result<session> reader::select(std::span<uint8_t, 7> uid) noexcept
+{
+    uint8_t res = ntag21x_reselect(&m_handle, uid.data());
+    
+    if (res != 0)
+    {
+        return unexpected<error>(static_cast<error>(res));
+    }
+    
+    return open_session();
+}
+
+inline result<session> reader::open_session() noexcept
+{
+    ntag21x_capability_container_t container;
+    uint8_t res = ntag21x_get_capability_container(&m_handle, &container);
+    
+    if (res != 0)
+    {
+        return unexpected<error>(static_cast<error>(res));
+    }
+    
+    return session(&m_handle);
+}
+
+}
+
+/**
+ * @}
+ */
+
+#endif
@@ -0,0 +1,1087 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file      driver_ntag21x_async.c
+ * @brief     driver ntag21x async source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_ntag21x_async.h"
+
+/**
+ * @brief chip frame definition
+ */
+#define NTAG21X_ASYNC_FRAME_WAKE_UP              0x52        /**< wake up command */
+#define NTAG21X_ASYNC_FRAME_CL1                  0x93        /**< cascade level 1 */
+#define NTAG21X_ASYNC_FRAME_CL2                  0x95        /**< cascade level 2 */
+#define NTAG21X_ASYNC_FRAME_ANTICOLLISION        0x20        /**< anti collision nvb */
+#define NTAG21X_ASYNC_FRAME_SELECT               0x70        /**< select nvb */
+#define NTAG21X_ASYNC_FRAME_READ                 0x30        /**< read command */
+#define NTAG21X_ASYNC_FRAME_FAST_READ            0x3A        /**< fast read command */
+#define NTAG21X_ASYNC_FRAME_WRITE                0xA2        /**< write command */
+#define NTAG21X_ASYNC_FRAME_COMP_WRITE           0xA0        /**< comp write command */
+#define NTAG21X_ASYNC_FRAME_PWD_AUTH             0x1B        /**< pwd auth command */
+
+/**
+ * @brief async step result definition
+ */
+#define NTAG21X_ASYNC_CONTINUE                   0xFF        /**< next frame submitted */
+
+/**
+ * @brief      crc calculation
+ * @param[in]  *p pointer to a data buffer
+ * @param[in]  len data length
+ * @param[out] *output pointer to a crc buffer
+ * @note       none
+ */
+static void a_ntag21x_async_crc(uint8_t *p, uint8_t len, uint8_t output[2])
+{
+    uint16_t crc = NTAG21X_ISO14443A_CRC_INIT;
+    
+    (void)ntag21x_iso14443a_crc_update(&crc, p, len);        /* get the crc */
+    output[0] = (uint8_t)(crc & 0xFF);                       /* lsb */
+    output[1] = (uint8_t)((crc >> 8) & 0xFF);                /* msb */
+}
+
+/**
+ * @brief     check the crc of a response
+ * @param[in] *p pointer to a response buffer
+ * @param[in] len data length without the crc
+ * @return    1 if the crc is valid, 0 otherwise
+ * @note      none
+ */
+static uint8_t a_ntag21x_async_crc_valid(uint8_t *p, uint8_t len)
+{
+    uint8_t crc_buf[2];
+    
+    a_ntag21x_async_crc(p, len, crc_buf);                                          /* get the crc */
+    
+    return (uint8_t)((p[len] == crc_buf[0]) && (p[len + 1] == crc_buf[1]));        /* compare */
+}
+
+/**
+ * @brief     submit the frame in the handle
+ * @param[in] *handle pointer to an ntag21x async handle structure
+ * @param[in] in_len input length
+ * @param[in] out_len expected output length
+ * @param[in] crc bool value, append the crc
+ * @return    NTAG21X_ASYNC_CONTINUE on success, 1 if the submit failed
+ * @note      none
+ */
+static uint8_t a_ntag21x_async_send(ntag21x_async_handle_t *handle, uint8_t in_len, uint8_t out_len, ntag21x_bool_t crc)
+{
+    if (crc == NTAG21X_BOOL_TRUE)                                                    /* append the crc */
+    {
+        a_ntag21x_async_crc(handle->in_buf, in_len, handle->in_buf + in_len);        /* get the crc */
+        in_len += 2;                                                                 /* crc length */
+    }
+    handle->in_len = in_len;                                                         /* set the input length */
+    handle->out_len = out_len;                                                       /* set the output length */
+    if (handle->submit(handle->in_buf, in_len, out_len) != 0)                        /* submit the frame */
+    {
+        handle->debug_print("ntag21x_async: submit failed.\n");                      /* submit failed */
+        
+        return 1;                                                                    /* return error */
+    }
+    
+    return NTAG21X_ASYNC_CONTINUE;                                                   /* in flight */
+}
+
+/**
+ * @brief      build the first frame of a command
+ * @param[in]  command command
+ * @param[in]  page page or start page
+ * @param[in]  stop_page fast read stop page
+ * @param[in]  *arg pointer to the write data or the password
+ * @param[out] *buf pointer to a frame buffer
+ * @param[out] *out_len pointer to an expected output length buffer
+ * @return     frame length including the crc, 0 if the command is invalid
+ * @note       none
+ */
+static uint8_t a_ntag21x_async_frame(ntag21x_async_command_t command, uint8_t page, uint8_t stop_page,
+                                     uint8_t *arg, uint8_t *buf, uint8_t *out_len)
+{
+    uint8_t len;
+    
+    switch (command)                                                     /* check the command */
+    {
+        case NTAG21X_ASYNC_COMMAND_READ :
+        {
+            buf[0] = NTAG21X_ASYNC_FRAME_READ;                           /* set the command */
+            buf[1] = page;                                               /* set the page */
+            len = 2;                                                     /* 2 bytes */
+            *out_len = 18;                                               /* 16 bytes and crc */
+            
+            break;
+        }
+        case NTAG21X_ASYNC_COMMAND_FAST_READ :
+        {
+            buf[0] = NTAG21X_ASYNC_FRAME_FAST_READ;                      /* set the command */
+            buf[1] = page;                                               /* set the start page */
+            buf[2] = stop_page;                                          /* set the stop page */
+            len = 3;                                                     /* 3 bytes */
+            *out_len = (uint8_t)((stop_page - page + 1) * 4 + 2);        /* pages and crc */
+            
+            break;
+        }
+        case NTAG21X_ASYNC_COMMAND_WRITE :
+        {
+            buf[0] = NTAG21X_ASYNC_FRAME_WRITE;                          /* set the command */
+            buf[1] = page;                                               /* set the page */
+            memcpy(buf + 2, arg, 4);                                     /* set the data */
+            len = 6;                                                     /* 6 bytes */
+            *out_len = 1;                                                /* ack */
+            
+            break;
+        }
+        case NTAG21X_ASYNC_COMMAND_COMP_WRITE :
+        {
+            buf[0] = NTAG21X_ASYNC_FRAME_COMP_WRITE;                     /* set the command */
+            buf[1] = page;                                               /* set the page */
+            len = 2;                                                     /* 2 bytes */
+            *out_len = 1;                                                /* ack */
+            
+            break;
+        }
+        case NTAG21X_ASYNC_COMMAND_PWD_AUTH :
+        {
+            buf[0] = NTAG21X_ASYNC_FRAME_PWD_AUTH;                       /* set the command */
+            memcpy(buf + 1, arg, 4);                                     /* set the password */
+            len = 5;                                                     /* 5 bytes */
+            *out_len = 4;                                                /* pack and crc */
+            
+            break;
+        }
+        case NTAG21X_ASYNC_COMMAND_ANTICOLLISION :
+        {
+            buf[0] = NTAG21X_ASYNC_FRAME_WAKE_UP;                        /* set the command */
+            *out_len = 2;                                                /* atqa */
+            
+            return 1;                                                    /* short frame without crc */
+        }
+        default :
+        {
+            return 0;                                                    /* invalid */
+        }
+    }
+    a_ntag21x_async_crc(buf, len, buf + len);                            /* get the crc */
+    
+    return (uint8_t)(len + 2);                                           /* frame length */
+}
+
+/**
+ * @brief     start a command
+ * @param[in] *handle pointer to an ntag21x async handle structure
+ * @param[in] command started command
+ * @param[in] *callback pointer to a completion function
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 a command is running
+ * @note      none
+ */
+static uint8_t a_ntag21x_async_start(ntag21x_async_handle_t *handle, ntag21x_async_command_t command,
+                                     void (*callback)(ntag21x_async_handle_t *handle, ntag21x_async_command_t command, uint8_t res))
+{
+    if (handle == NULL)                                                       /* check handle */
+    {
+        return 2;                                                             /* return error */
+    }
+    if (handle->inited != 1)                                                  /* check handle initialization */
+    {
+        return 3;                                                             /* return error */
+    }
+    if (handle->command != NTAG21X_ASYNC_COMMAND_NONE)                        /* check the running command */
+    {
+        handle->debug_print("ntag21x_async: a command is running.\n");        /* a command is running */
+        
+        return 4;                                                             /* return error */
+    }
+    
+    handle->command = (uint8_t)command;                                       /* set the command */
+    handle->step = 0;                                                         /* first step */
+    handle->callback = callback;                                              /* set the callback */
+    
+    return 0;                                                                 /* success return 0 */
+}
+
+/**
+ * @brief     submit the first frame of a started command
+ * @param[in] *handle pointer to an ntag21x async handle structure
+ * @param[in] page page or start page
+ * @param[in] stop_page fast read stop page
+ * @param[in] *arg pointer to the write data or the password
+ * @return    status code
+ *            - 0 success
+ *            - 1 submit failed
+ * @note      the command is dropped without a callback when the submit fails
+ */
+static uint8_t a_ntag21x_async_first(ntag21x_async_handle_t *handle, uint8_t page, uint8_t stop_page, uint8_t *arg)
+{
+    uint8_t in_len;
+    uint8_t out_len;
+    
+    in_len = a_ntag21x_async_frame((ntag21x_async_command_t)handle->command, page, stop_page,
+                                   arg, handle->in_buf, &out_len);                                          /* build the frame */
+    if (a_ntag21x_async_send(handle, in_len, out_len, NTAG21X_BOOL_FALSE) != NTAG21X_ASYNC_CONTINUE)        /* submit the frame */
+    {
+        handle->command = NTAG21X_ASYNC_COMMAND_NONE;                                                       /* drop the command */
+        
+        return 1;                                                                                           /* return error */
+    }
+    
+    return 0;                                                                                               /* success return 0 */
+}
+
+/**
+ * @brief     check an ack response
+ * @param[in] *handle pointer to an ntag21x async handle structure
+ * @param[in] len response length
+ * @return    status code
+ *            - 0 ack
+ *            - 4 output_len is invalid
+ *            - 5 ack error
+ * @note      none
+ */
+static uint8_t a_ntag21x_async_ack(ntag21x_async_handle_t *handle, uint8_t len)
+{
+    if (len != 1)                                                              /* check the output_len */
+    {
+        handle->debug_print("ntag21x_async: output_len is invalid.\n");        /* output_len is invalid */
+        
+        return 4;                                                              /* return error */
+    }
+    if (handle->out_buf[0] != 0xA)                                             /* check the result */
+    {
+        handle->debug_print("ntag21x_async: ack error.\n");                    /* ack error */
+        
+        return 5;                                                              /* return error */
+    }
+    
+    return 0;                                                                  /* success return 0 */
+}
+
+/**
+ * @brief     check a response protected by a crc
+ * @param[in] *handle pointer to an ntag21x async handle structure
+ * @param[in] len response length
+ * @return    status code
+ *            - 0 success
+ *            - 4 output_len is invalid
+ *            - 5 crc error
+ * @note      the expected length is the one given at submit
+ */
+static uint8_t a_ntag21x_async_data(ntag21x_async_handle_t *handle, uint8_t len)
+{
+    if (len != handle->out_len)                                                     /* check the output_len */
+    {
+        handle->debug_print("ntag21x_async: output_len is invalid.\n");             /* output_len is invalid */
+        
+        return 4;                                                                   /* return error */
+    }
+    if (a_ntag21x_async_crc_valid(handle->out_buf, (uint8_t)(len - 2)) == 0)        /* check the crc */
+    {
+        handle->debug_print("ntag21x_async: crc error.\n");                         /* crc error */
+        
+        return 5;                                                                   /* return error */
+    }
+    
+    return 0;                                                                       /* success return 0 */
+}
+
+/**
+ * @brief     run the anti collision state machine
+ * @param[in] *handle pointer to an ntag21x async handle structure
+ * @param[in] len response length
+ * @return    result code or NTAG21X_ASYNC_CONTINUE
+ * @note      wake up -> anti collision cl1 -> select cl1 -> anti collision cl2 -> select cl2
+ */
+static uint8_t a_ntag21x_async_anticollision_step(ntag21x_async_handle_t *handle, uint8_t len)
+{
+    uint8_t i;
+    uint8_t check;
+    
+    if ((handle->step == 1) || (handle->step == 3))                                                         /* anti collision response */
+    {
+        if (len != 5)                                                                                       /* check the output_len */
+        {
+            handle->debug_print("ntag21x_async: output_len is invalid.\n");                                 /* output_len is invalid */
+            
+            return 4;                                                                                       /* return error */
+        }
+        check = 0;                                                                                          /* init 0 */
+        for (i = 0; i < 4; i++)                                                                             /* run 4 times */
+        {
+            handle->arg[i] = handle->out_buf[i];                                                            /* save the id */
+            check ^= handle->out_buf[i];                                                                    /* xor */
+        }
+        if (check != handle->out_buf[4])                                                                    /* check the bcc */
+        {
+            handle->debug_print("ntag21x_async: check error.\n");                                           /* check error */
+            
+            return 5;                                                                                       /* return error */
+        }
+        if (handle->step == 1)                                                                              /* cascade level 1 */
+        {
+            memcpy(handle->data, handle->arg + 1, 3);                                                       /* uid0 - uid2 after the cascade tag */
+        }
+        else
+        {
+            memcpy(handle->data + 3, handle->arg, 4);                                                       /* uid3 - uid6 */
+        }
+        handle->in_buf[0] = (handle->step == 1) ? NTAG21X_ASYNC_FRAME_CL1 : NTAG21X_ASYNC_FRAME_CL2;        /* set the level */
+        handle->in_buf[1] = NTAG21X_ASYNC_FRAME_SELECT;                                                     /* select */
+        memcpy(handle->in_buf + 2, handle->arg, 4);                                                         /* set the id */
+        handle->in_buf[6] = check;                                                                          /* set the bcc */
+        handle->step++;                                                                                     /* next step */
+        
+        return a_ntag21x_async_send(handle, 7, 1, NTAG21X_BOOL_TRUE);                                       /* select */
+    }
+    if (handle->step == 0)                                                                                  /* wake up response */
+    {
+        if (len != 2)                                                                                       /* check the output_len */
+        {
+            handle->debug_print("ntag21x_async: output_len is invalid.\n");                                 /* output_len is invalid */
+            
+            return 4;                                                                                       /* return error */
+        }
+        if ((handle->out_buf[0] != 0x44) || (handle->out_buf[1] != 0x00))                                   /* check the type */
+        {
+            handle->debug_print("ntag21x_async: type is invalid.\n");                                       /* type is invalid */
+            
+            return 5;                                                                                       /* return error */
+        }
+    }
+    else
+    {
+        if (len != 1)                                                                                       /* check the output_len */
+        {
+            handle->debug_print("ntag21x_async: output_len is invalid.\n");                                 /* output_len is invalid */
+            
+            return 4;                                                                                       /* return error */
+        }
+        if (handle->out_buf[0] != ((handle->step == 2) ? 0x04 : 0x00))                                      /* check the sak */
+        {
+            handle->debug_print("ntag21x_async: sak error.\n");                                             /* sak error */
+            
+            return 5;                                                                                       /* return error */
+        }
+        if (handle->step == 4)                                                                              /* select cl2 done */
+        {
+            return 0;                                                                                       /* success return 0 */
+        }
+    }
+    handle->in_buf[0] = (handle->step == 0) ? NTAG21X_ASYNC_FRAME_CL1 : NTAG21X_ASYNC_FRAME_CL2;            /* set the level */
+    handle->in_buf[1] = NTAG21X_ASYNC_FRAME_ANTICOLLISION;                                                  /* anti collision */
+    handle->step++;                                                                                         /* next step */
+    
+    return a_ntag21x_async_send(handle, 2, 5, NTAG21X_BOOL_FALSE);                                          /* anti collision */
+}
+
+/**
+ * @brief     run one step of the running command
+ * @param[in] *handle pointer to an ntag21x async handle structure
+ * @param[in] len response length
+ * @return    result code or NTAG21X_ASYNC_CONTINUE
+ * @note      none
+ */
+static uint8_t a_ntag21x_async_step(ntag21x_async_handle_t *handle, uint8_t len)
+{
+    uint8_t res;
+    
+    switch (handle->command)                                                                             /* check the command */
+    {
+        case NTAG21X_ASYNC_COMMAND_READ :
+        case NTAG21X_ASYNC_COMMAND_FAST_READ :
+        {
+            res = a_ntag21x_async_data(handle, len);                                                     /* check the response */
+            if (res == 0)                                                                                /* check the result */
+            {
+                memcpy(handle->data, handle->out_buf, (size_t)(len - 2));                                /* copy the data */
+            }
+            
+            return res;                                                                                  /* return the result */
+        }
+        case NTAG21X_ASYNC_COMMAND_WRITE :
+        {
+            return a_ntag21x_async_ack(handle, len);                                                     /* check the ack */
+        }
+        case NTAG21X_ASYNC_COMMAND_COMP_WRITE :
+        {
+            res = a_ntag21x_async_ack(handle, len);                                                      /* check the ack */
+            if ((res != 0) || (handle->step != 0))                                                       /* failed or data frame acked */
+            {
+                return res;                                                                              /* return the result */
+            }
+            memcpy(handle->in_buf, handle->arg, 4);                                                      /* set the data */
+            memset(handle->in_buf + 4, 0, 12);                                                           /* pad to 16 bytes */
+            handle->step = 1;                                                                            /* data frame */
+            
+            return a_ntag21x_async_send(handle, 16, 1, NTAG21X_BOOL_TRUE);                               /* send the data */
+        }
+        case NTAG21X_ASYNC_COMMAND_PWD_AUTH :
+        {
+            res = a_ntag21x_async_data(handle, len);                                                     /* check the response */
+            if (res != 0)                                                                                /* check the result */
+            {
+                return res;                                                                              /* return the result */
+            }
+            if ((handle->out_buf[0] != handle->arg[0]) || (handle->out_buf[1] != handle->arg[1]))        /* check the pack */
+            {
+                handle->debug_print("ntag21x_async: pack check failed.\n");                              /* pack check failed */
+                
+                return 6;                                                                                /* return error */
+            }
+            
+            return 0;                                                                                    /* success return 0 */
+        }
+        case NTAG21X_ASYNC_COMMAND_ANTICOLLISION :
+        {
+            return a_ntag21x_async_anticollision_step(handle, len);                                      /* anti collision */
+        }
+        default :
+        {
+            return 1;                                                                                    /* return error */
+        }
+    }
+}
+
+/**
+ * @brief     build the frame of the next queue entry
+ * @param[in] *handle pointer to an ntag21x async handle structure
+ * @note      runs while the current frame is in flight
+ */
+static void a_ntag21x_async_queue_prepare(ntag21x_async_handle_t *handle)
+{
+    ntag21x_async_entry_t *entry;
+    
+    if ((handle->queue == NULL) || (handle->next_in_len != 0) ||
+        ((handle->queue_index + 1) >= handle->queue_len))                                        /* nothing to build */
+    {
+        return;                                                                                  /* return */
+    }
+    
+    entry = &handle->queue[handle->queue_index + 1];                                             /* next entry */
+    handle->next_in_len = a_ntag21x_async_frame(entry->command, entry->page, entry->stop_page, entry->arg,
+                                                handle->next_buf, &handle->next_out_len);        /* build the frame */
+}
+
+/**
+ * @brief     start the current queue entry
+ * @param[in] *handle pointer to an ntag21x async handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 submit failed
+ * @note      the prepared frame is used when there is one
+ */
+static uint8_t a_ntag21x_async_queue_begin(ntag21x_async_handle_t *handle)
+{
+    uint8_t in_len;
+    uint8_t out_len;
+    ntag21x_async_entry_t *entry;
+    
+    entry = &handle->queue[handle->queue_index];                                                            /* current entry */
+    handle->command = (uint8_t)entry->command;                                                              /* set the command */
+    handle->step = 0;                                                                                       /* first step */
+    handle->data = entry->data;                                                                             /* set the result buffer */
+    if (entry->command == NTAG21X_ASYNC_COMMAND_PWD_AUTH)                                                   /* authentication */
+    {
+        handle->arg[0] = entry->pack[0];                                                                    /* keep pack0 */
+        handle->arg[1] = entry->pack[1];                                                                    /* keep pack1 */
+    }
+    else
+    {
+        memcpy(handle->arg, entry->arg, 4);                                                                 /* keep the write data */
+    }
+    if (handle->next_in_len != 0)                                                                           /* frame already built */
+    {
+        memcpy(handle->in_buf, handle->next_buf, handle->next_in_len);                                      /* take the frame */
+        in_len = handle->next_in_len;                                                                       /* set the input length */
+        out_len = handle->next_out_len;                                                                     /* set the output length */
+        handle->next_in_len = 0;                                                                            /* consumed */
+    }
+    else
+    {
+        in_len = a_ntag21x_async_frame(entry->command, entry->page, entry->stop_page, entry->arg,
+                                       handle->in_buf, &out_len);                                           /* build the frame */
+    }
+    if (a_ntag21x_async_send(handle, in_len, out_len, NTAG21X_BOOL_FALSE) != NTAG21X_ASYNC_CONTINUE)        /* submit the frame */
+    {
+        handle->command = NTAG21X_ASYNC_COMMAND_NONE;                                                       /* drop the command */
+        
+        return 1;                                                                                           /* return error */
+    }
+    
+    return 0;                                                                                               /* success return 0 */
+}
+
+/**
+ * @brief     complete the current queue entry
+ * @param[in] *handle pointer to an ntag21x async handle structure
+ * @param[in] res entry result
+ * @note      starts the next entry or ends the queue
+ */
+static void a_ntag21x_async_queue_done(ntag21x_async_handle_t *handle, uint8_t res)
+{
+    uint16_t num;
+    
+    handle->queue[handle->queue_index].status = res;                    /* save the status */
+    handle->queue_index++;                                              /* next entry */
+    if ((res == 0) && (handle->queue_index < handle->queue_len))        /* more entries */
+    {
+        res = a_ntag21x_async_queue_begin(handle);                      /* start the next entry */
+        if (res == 0)                                                   /* in flight */
+        {
+            return;                                                     /* return */
+        }
+        handle->queue[handle->queue_index].status = res;                /* save the status */
+        handle->queue_index++;                                          /* count the failed entry */
+    }
+    
+    num = handle->queue_index;                                          /* entries run */
+    handle->queue = NULL;                                               /* queue done */
+    handle->next_in_len = 0;                                            /* drop the prepared frame */
+    if (handle->queue_callback != NULL)                                 /* check the callback */
+    {
+        handle->queue_callback(handle, num, res);                       /* completion */
+    }
+}
+
+/**
+ * @brief     update the linked synchronous handle after a command
+ * @param[in] *handle pointer to an ntag21x async handle structure
+ * @param[in] command completed command
+ * @param[in] res command result
+ * @note      writes drop the page cache and the learned configuration, anti collision and
+ *            authentication update the session the way the synchronous functions do
+ */
+static void a_ntag21x_async_sync(ntag21x_async_handle_t *handle, ntag21x_async_command_t command, uint8_t res)
+{
+    ntag21x_handle_t *ntag = handle->ntag;
+    
+    if ((ntag == NULL) || (command == NTAG21X_ASYNC_COMMAND_READ) ||
+        (command == NTAG21X_ASYNC_COMMAND_FAST_READ))                                      /* nothing changed */
+    {
+        return;                                                                            /* return */
+    }
+    
+    (void)ntag21x_invalidate_page_cache(ntag);                                             /* invalidate the page cache */
+    if ((command == NTAG21X_ASYNC_COMMAND_WRITE) || (command == NTAG21X_ASYNC_COMMAND_COMP_WRITE))
+    {
+        ntag->session.known = 0;                                                           /* the configuration may have changed */
+    }
+    else if (command == NTAG21X_ASYNC_COMMAND_ANTICOLLISION)                               /* a new selection */
+    {
+        ntag->session.selected = 0;                                                        /* not selected */
+        ntag->session.authenticated = 0;                                                   /* not authenticated */
+        if ((res == 0) && (handle->data != NULL))                                          /* selected */
+        {
+            if (memcmp(ntag->session.uid, handle->data, 7) != 0)                           /* another tag */
+            {
+                memcpy(ntag->session.uid, handle->data, 7);                                /* save the uid */
+                ntag->session.known = 0;                                                   /* configuration is unknown */
+                ntag->session_key_valid = 0;                                               /* password is unknown */
+            }
+            ntag->session.selected = 1;                                                    /* the tag is active */
+        }
+    }
+    else                                                                                   /* authentication */
+    {
+        if (res == 0)                                                                      /* success */
+        {
+            ntag->session.authenticated = ntag->session.selected;                          /* authenticated until the next select */
+        }
+        else
+        {
+            ntag->session.selected = 0;                                                    /* the tag is halted */
+            ntag->session.authenticated = 0;                                               /* not authenticated */
+        }
+    }
+}
+
+/**
+ * @brief     initialize the async handle
+ * @param[in] *handle pointer to an ntag21x async handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 linked functions is NULL
+ * @note      none
+ */
+uint8_t ntag21x_async_init(ntag21x_async_handle_t *handle)
+{
+    if (handle == NULL)                                                 /* check handle */
+    {
+        return 2;                                                       /* return error */
+    }
+    if (handle->debug_print == NULL)                                    /* check debug_print */
+    {
+        return 3;                                                       /* return error */
+    }
+    if (handle->submit == NULL)                                         /* check submit */
+    {
+        handle->debug_print("ntag21x_async: submit is null.\n");        /* submit is null */
+        
+        return 3;                                                       /* return error */
+    }
+    if (handle->poll == NULL)                                           /* check poll */
+    {
+        handle->debug_print("ntag21x_async: poll is null.\n");          /* poll is null */
+        
+        return 3;                                                       /* return error */
+    }
+    
+    handle->command = NTAG21X_ASYNC_COMMAND_NONE;                       /* idle */
+    handle->step = 0;                                                   /* no step */
+    handle->inited = 1;                                                 /* flag inited */
+    
+    return 0;                                                           /* success return 0 */
+}
+
+/**
+ * @brief     close the async handle
+ * @param[in] *handle pointer to an ntag21x async handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 a command is running
+ * @note      none
+ */
+uint8_t ntag21x_async_deinit(ntag21x_async_handle_t *handle)
+{
+    if (handle == NULL)                                                       /* check handle */
+    {
+        return 2;                                                             /* return error */
+    }
+    if (handle->inited != 1)                                                  /* check handle initialization */
+    {
+        return 3;                                                             /* return error */
+    }
+    if (handle->command != NTAG21X_ASYNC_COMMAND_NONE)                        /* check the running command */
+    {
+        handle->debug_print("ntag21x_async: a command is running.\n");        /* a command is running */
+        
+        return 4;                                                             /* return error */
+    }
+    
+    handle->inited = 0;                                                       /* flag closed */
+    
+    return 0;                                                                 /* success return 0 */
+}
+
+/**
+ * @brief      check if a command is running
+ * @param[in]  *handle pointer to an ntag21x async handle structure
+ * @param[out] *busy pointer to a bool buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t ntag21x_async_is_busy(ntag21x_async_handle_t *handle, ntag21x_bool_t *busy)
+{
+    if (handle == NULL)                                                                                      /* check handle */
+    {
+        return 2;                                                                                            /* return error */
+    }
+    if (handle->inited != 1)                                                                                 /* check handle initialization */
+    {
+        return 3;                                                                                            /* return error */
+    }
+    
+    *busy = (handle->command != NTAG21X_ASYNC_COMMAND_NONE) ? NTAG21X_BOOL_TRUE : NTAG21X_BOOL_FALSE;        /* get the state */
+    
+    return 0;                                                                                                /* success return 0 */
+}
+
+/**
+ * @brief     drive the running command
+ * @param[in] *handle pointer to an ntag21x async handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      call from the main loop or the reader interrupt, it polls once, sends the next
+ *            frame of the state machine and runs the callback when the command completes
+ */
+uint8_t ntag21x_async_process(ntag21x_async_handle_t *handle)
+{
+    uint8_t res;
+    uint8_t len;
+    ntag21x_async_command_t command;
+    
+    if (handle == NULL)                                                                 /* check handle */
+    {
+        return 2;                                                                       /* return error */
+    }
+    if (handle->inited != 1)                                                            /* check handle initialization */
+    {
+        return 3;                                                                       /* return error */
+    }
+    if (handle->command == NTAG21X_ASYNC_COMMAND_NONE)                                  /* idle */
+    {
+        return 0;                                                                       /* success return 0 */
+    }
+    
+    len = sizeof(handle->out_buf);                                                      /* set the buffer length */
+    res = handle->poll(handle->out_buf, &len);                                          /* poll the transport */
+    if (res == NTAG21X_ASYNC_POLL_BUSY)                                                 /* in flight */
+    {
+        a_ntag21x_async_queue_prepare(handle);                                          /* build the next frame meanwhile */
+        
+        return 0;                                                                       /* success return 0 */
+    }
+    if (res != NTAG21X_ASYNC_POLL_DONE)                                                 /* check the result */
+    {
+        handle->debug_print("ntag21x_async: contactless transceiver failed.\n");        /* contactless transceiver failed */
+        res = 1;                                                                        /* transceiver failed */
+    }
+    else
+    {
+        res = a_ntag21x_async_step(handle, len);                                        /* run the state machine */
+        if (res == NTAG21X_ASYNC_CONTINUE)                                              /* next frame in flight */
+        {
+            return 0;                                                                   /* success return 0 */
+        }
+    }
+    
+    command = (ntag21x_async_command_t)handle->command;                                 /* save the command */
+    handle->command = NTAG21X_ASYNC_COMMAND_NONE;                                       /* idle before the callback so it can start the next one */
+    handle->step = 0;                                                                   /* no step */
+    a_ntag21x_async_sync(handle, command, res);                                         /* update the linked handle */
+    if (handle->queue != NULL)                                                          /* queue entry */
+    {
+        a_ntag21x_async_queue_done(handle, res);                                        /* next entry */
+        
+        return 0;                                                                       /* success return 0 */
+    }
+    if (handle->callback != NULL)                                                       /* check the callback */
+    {
+        handle->callback(handle, command, res);                                         /* completion */
+    }
+    
+    return 0;                                                                           /* success return 0 */
+}
+
+/**
+ * @brief      start reading four pages
+ * @param[in]  *handle pointer to an ntag21x async handle structure
+ * @param[in]  start_page start page
+ * @param[out] *data pointer to a 16 bytes buffer, valid when the callback runs
+ * @param[in]  *callback pointer to a completion function
+ * @return     status code
+ *             - 0 success
+ *             - 1 submit failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 a command is running
+ * @note       callback res: 0 success, 1 transceiver failed, 4 output_len is invalid, 5 crc error
+ */
+uint8_t ntag21x_async_read(ntag21x_async_handle_t *handle, uint8_t start_page, uint8_t data[16],
+                           void (*callback)(ntag21x_async_handle_t *handle, ntag21x_async_command_t command, uint8_t res))
+{
+    uint8_t res;
+    
+    if (data == NULL)                                                                 /* check the buffer */
+    {
+        return 2;                                                                     /* return error */
+    }
+    res = a_ntag21x_async_start(handle, NTAG21X_ASYNC_COMMAND_READ, callback);        /* start the command */
+    if (res != 0)                                                                     /* check the result */
+    {
+        return res;                                                                   /* return error */
+    }
+    
+    handle->data = data;                                                              /* set the result buffer */
+    
+    return a_ntag21x_async_first(handle, start_page, 0, NULL);                        /* submit */
+}
+
+/**
+ * @brief      start a fast read
+ * @param[in]  *handle pointer to an ntag21x async handle structure
+ * @param[in]  start_page start page
+ * @param[in]  stop_page stop page
+ * @param[out] *data pointer to a 4 * (stop_page - start_page + 1) bytes buffer, valid when the callback runs
+ * @param[in]  *callback pointer to a completion function
+ * @return     status code
+ *             - 0 success
+ *             - 1 submit failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 a command is running
+ *             - 5 stop_page < start_page
+ *             - 6 stop_page - start_page + 1 is over 15
+ * @note       callback res: 0 success, 1 transceiver failed, 4 output_len is invalid, 5 crc error
+ */
+uint8_t ntag21x_async_fast_read(ntag21x_async_handle_t *handle, uint8_t start_page, uint8_t stop_page, uint8_t *data,
+                                void (*callback)(ntag21x_async_handle_t *handle, ntag21x_async_command_t command, uint8_t res))
+{
+    uint8_t res;
+    
+    if (data == NULL)                                                                      /* check the buffer */
+    {
+        return 2;                                                                          /* return error */
+    }
+    if (stop_page < start_page)                                                            /* check start and stop page */
+    {
+        return 5;                                                                          /* return error */
+    }
+    if (stop_page - start_page + 1 > 15)                                                   /* check start and stop page */
+    {
+        return 6;                                                                          /* return error */
+    }
+    res = a_ntag21x_async_start(handle, NTAG21X_ASYNC_COMMAND_FAST_READ, callback);        /* start the command */
+    if (res != 0)                                                                          /* check the result */
+    {
+        return res;                                                                        /* return error */
+    }
+    
+    handle->data = data;                                                                   /* set the result buffer */
+    
+    return a_ntag21x_async_first(handle, start_page, stop_page, NULL);                     /* submit */
+}
+
+/**
+ * @brief     start writing a page
+ * @param[in] *handle pointer to an ntag21x async handle structure
+ * @param[in] page written page
+ * @param[in] *data pointer to a 4 bytes buffer, copied at once
+ * @param[in] *callback pointer to a completion function
+ * @return    status code
+ *            - 0 success
+ *            - 1 submit failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 a command is running
+ * @note      callback res: 0 success, 1 transceiver failed, 4 output_len is invalid, 5 ack error
+ */
+uint8_t ntag21x_async_write(ntag21x_async_handle_t *handle, uint8_t page, uint8_t data[4],
+                            void (*callback)(ntag21x_async_handle_t *handle, ntag21x_async_command_t command, uint8_t res))
+{
+    uint8_t res;
+    
+    if (data == NULL)                                                                  /* check the buffer */
+    {
+        return 2;                                                                      /* return error */
+    }
+    res = a_ntag21x_async_start(handle, NTAG21X_ASYNC_COMMAND_WRITE, callback);        /* start the command */
+    if (res != 0)                                                                      /* check the result */
+    {
+        return res;                                                                    /* return error */
+    }
+    
+    return a_ntag21x_async_first(handle, page, 0, data);                               /* submit */
+}
+
+/**
+ * @brief     start a compatibility write
+ * @param[in] *handle pointer to an ntag21x async handle structure
+ * @param[in] page written page
+ * @param[in] *data pointer to a 4 bytes buffer, copied at once
+ * @param[in] *callback pointer to a completion function
+ * @return    status code
+ *            - 0 success
+ *            - 1 submit failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 a command is running
+ * @note      the data frame is sent after the ack of the command frame,
+ *            callback res: 0 success, 1 transceiver failed, 4 output_len is invalid, 5 ack error
+ */
+uint8_t ntag21x_async_compatibility_write(ntag21x_async_handle_t *handle, uint8_t page, uint8_t data[4],
+                                          void (*callback)(ntag21x_async_handle_t *handle, ntag21x_async_command_t command, uint8_t res))
+{
+    uint8_t res;
+    
+    if (data == NULL)                                                                       /* check the buffer */
+    {
+        return 2;                                                                           /* return error */
+    }
+    res = a_ntag21x_async_start(handle, NTAG21X_ASYNC_COMMAND_COMP_WRITE, callback);        /* start the command */
+    if (res != 0)                                                                           /* check the result */
+    {
+        return res;                                                                         /* return error */
+    }
+    
+    memcpy(handle->arg, data, 4);                                                           /* keep the data for the second frame */
+    
+    return a_ntag21x_async_first(handle, page, 0, NULL);                                    /* submit */
+}
+
+/**
+ * @brief     start a password authentication
+ * @param[in] *handle pointer to an ntag21x async handle structure
+ * @param[in] *pwd pointer to a 4 bytes password buffer, copied at once
+ * @param[in] *pack pointer to a 2 bytes expected pack buffer, copied at once
+ * @param[in] *callback pointer to a completion function
+ * @return    status code
+ *            - 0 success
+ *            - 1 submit failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 a command is running
+ * @note      callback res: 0 success, 1 transceiver failed, 4 output_len is invalid, 5 crc error,
+ *            6 pack check failed
+ */
+uint8_t ntag21x_async_authenticate(ntag21x_async_handle_t *handle, uint8_t pwd[4], uint8_t pack[2],
+                                   void (*callback)(ntag21x_async_handle_t *handle, ntag21x_async_command_t command, uint8_t res))
+{
+    uint8_t res;
+    
+    if ((pwd == NULL) || (pack == NULL))                                                  /* check the buffer */
+    {
+        return 2;                                                                         /* return error */
+    }
+    res = a_ntag21x_async_start(handle, NTAG21X_ASYNC_COMMAND_PWD_AUTH, callback);        /* start the command */
+    if (res != 0)                                                                         /* check the result */
+    {
+        return res;                                                                       /* return error */
+    }
+    
+    handle->arg[0] = pack[0];                                                             /* keep pack0 */
+    handle->arg[1] = pack[1];                                                             /* keep pack1 */
+    
+    return a_ntag21x_async_first(handle, 0, 0, pwd);                                      /* submit */
+}
+
+/**
+ * @brief      start waking up and selecting a tag
+ * @param[in]  *handle pointer to an ntag21x async handle structure
+ * @param[out] *uid pointer to a 7 bytes uid buffer, valid when the callback runs
+ * @param[in]  *callback pointer to a completion function
+ * @return     status code
+ *             - 0 success
+ *             - 1 submit failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 a command is running
+ * @note       runs wake up, anti collision cl1, select cl1, anti collision cl2 and select cl2,
+ *             callback res: 0 success, 1 transceiver failed, 4 output_len is invalid,
+ *             5 type, check or sak error
+ */
+uint8_t ntag21x_async_anticollision(ntag21x_async_handle_t *handle, uint8_t uid[7],
+                                    void (*callback)(ntag21x_async_handle_t *handle, ntag21x_async_command_t command, uint8_t res))
+{
+    uint8_t res;
+    
+    if (uid == NULL)                                                                           /* check the buffer */
+    {
+        return 2;                                                                              /* return error */
+    }
+    res = a_ntag21x_async_start(handle, NTAG21X_ASYNC_COMMAND_ANTICOLLISION, callback);        /* start the command */
+    if (res != 0)                                                                              /* check the result */
+    {
+        return res;                                                                            /* return error */
+    }
+    
+    handle->data = uid;                                                                        /* set the result buffer */
+    
+    return a_ntag21x_async_first(handle, 0, 0, NULL);                                          /* submit */
+}
+
+/**
+ * @brief         start a command queue
+ * @param[in]     *handle pointer to an ntag21x async handle structure
+ * @param[in,out] *queue pointer to an entry list, valid until the callback runs
+ * @param[in]     len entry number
+ * @param[in]     *callback pointer to a completion function
+ * @return        status code
+ *                - 0 success
+ *                - 1 submit failed
+ *                - 2 handle is NULL
+ *                - 3 handle is not initialized
+ *                - 4 a command is running
+ *                - 5 len is invalid
+ *                - 6 an entry is invalid
+ * @note          read, fast read and anti collision entries need a data buffer,
+ *                entries run back to back from ntag21x_async_process, the frame of the next entry
+ *                is built while the current one is in flight, config changes are queued as writes
+ *                of the config pages, the queue stops at the first failure and the callback gets
+ *                the number of entries run and the result of the last one
+ */
+uint8_t ntag21x_async_queue_run(ntag21x_async_handle_t *handle, ntag21x_async_entry_t *queue, uint16_t len,
+                                void (*callback)(ntag21x_async_handle_t *handle, uint16_t num, uint8_t res))
+{
+    uint8_t res;
+    uint16_t i;
+    
+    if ((queue == NULL) || (len == 0))                                                                      /* check the queue */
+    {
+        return 5;                                                                                           /* return error */
+    }
+    for (i = 0; i < len; i++)                                                                               /* check all entries */
+    {
+        if ((queue[i].command == NTAG21X_ASYNC_COMMAND_NONE) ||
+            (queue[i].command > NTAG21X_ASYNC_COMMAND_ANTICOLLISION))                                       /* check the command */
+        {
+            return 6;                                                                                       /* return error */
+        }
+        if ((queue[i].command == NTAG21X_ASYNC_COMMAND_FAST_READ) &&
+            ((queue[i].stop_page < queue[i].page) || (queue[i].stop_page - queue[i].page + 1 > 15)))        /* check the range */
+        {
+            return 6;                                                                                       /* return error */
+        }
+        if (((queue[i].command == NTAG21X_ASYNC_COMMAND_READ) ||
+             (queue[i].command == NTAG21X_ASYNC_COMMAND_FAST_READ) ||
+             (queue[i].command == NTAG21X_ASYNC_COMMAND_ANTICOLLISION)) && (queue[i].data == NULL))         /* check the result buffer */
+        {
+            return 6;                                                                                       /* return error */
+        }
+    }
+    res = a_ntag21x_async_start(handle, queue[0].command, NULL);                                            /* start the command */
+    if (res != 0)                                                                                           /* check the result */
+    {
+        return res;                                                                                         /* return error */
+    }
+    
+    for (i = 0; i < len; i++)                                                                               /* all entries */
+    {
+        queue[i].status = NTAG21X_ASYNC_STATUS_NOT_RUN;                                                     /* not run yet */
+    }
+    handle->queue = queue;                                                                                  /* set the queue */
+    handle->queue_len = len;                                                                                /* set the length */
+    handle->queue_index = 0;                                                                                /* first entry */
+    handle->queue_callback = callback;                                                                      /* set the callback */
+    handle->next_in_len = 0;                                                                                /* nothing prepared */
+    if (a_ntag21x_async_queue_begin(handle) != 0)                                                           /* start the first entry */
+    {
+        queue[0].status = 1;                                                                                /* submit failed */
+        handle->queue = NULL;                                                                               /* drop the queue */
+        
+        return 1;                                                                                           /* return error */
+    }
+    
+    return 0;                                                                                               /* success return 0 */
+}
@@ -0,0 +1,376 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file      driver_ntag21x_async.h
+ * @brief     driver ntag21x async header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_NTAG21X_ASYNC_H
+#define DRIVER_NTAG21X_ASYNC_H
+
+#include "driver_ntag21x.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup ntag21x_async_driver ntag21x async driver function
+ * @brief    ntag21x async driver modules
+ * @ingroup  ntag21x_driver
+ * @{
+ */
+
+/**
+ * @brief ntag21x async poll enumeration definition
+ */
+typedef enum
+{
+    NTAG21X_ASYNC_POLL_DONE  = 0x00,        /**< response received */
+    NTAG21X_ASYNC_POLL_ERROR = 0x01,        /**< no response or transceiver error */
+    NTAG21X_ASYNC_POLL_BUSY  = 0x02,        /**< exchange in flight */
+} ntag21x_async_poll_t;
+
+/**
+ * @brief ntag21x async command enumeration definition
+ */
+typedef enum
+{
+    NTAG21X_ASYNC_COMMAND_NONE          = 0x00,        /**< idle */
+    NTAG21X_ASYNC_COMMAND_READ          = 0x01,        /**< read four pages */
+    NTAG21X_ASYNC_COMMAND_FAST_READ     = 0x02,        /**< fast read */
+    NTAG21X_ASYNC_COMMAND_WRITE         = 0x03,        /**< write */
+    NTAG21X_ASYNC_COMMAND_COMP_WRITE    = 0x04,        /**< compatibility write */
+    NTAG21X_ASYNC_COMMAND_PWD_AUTH      = 0x05,        /**< password authentication */
+    NTAG21X_ASYNC_COMMAND_ANTICOLLISION = 0x06,        /**< wake up, anti collision and select of both cascade levels */
+} ntag21x_async_command_t;
+
+/**
+ * @brief ntag21x async queue entry status definition
+ */
+#define NTAG21X_ASYNC_STATUS_NOT_RUN        0xFF        /**< entry after a failed one */
+
+/**
+ * @brief ntag21x async queue entry structure definition
+ */
+typedef struct ntag21x_async_entry_s
+{
+    ntag21x_async_command_t command;        /**< command */
+    uint8_t page;                           /**< page or start page */
+    uint8_t stop_page;                      /**< fast read stop page */
+    uint8_t arg[4];                         /**< write data or password */
+    uint8_t pack[2];                        /**< expected pack */
+    uint8_t *data;                          /**< read or uid result buffer */
+    uint8_t status;                         /**< callback res of the single command or NTAG21X_ASYNC_STATUS_NOT_RUN */
+} ntag21x_async_entry_t;
+
+/**
+ * @brief ntag21x async handle structure definition
+ */
+typedef struct ntag21x_async_handle_s
+{
+    uint8_t (*submit)(uint8_t *in_buf, uint8_t in_len, uint8_t out_len);             /**< point to a submit function address */
+    uint8_t (*poll)(uint8_t *out_buf, uint8_t *out_len);                             /**< point to a poll function address */
+    void (*debug_print)(const char *const fmt, ...);                                 /**< point to a debug_print function address */
+    ntag21x_handle_t *ntag;                                                          /**< synchronous handle of the same tag, NULL if none */
+    void (*callback)(struct ntag21x_async_handle_s *handle,
+                     ntag21x_async_command_t command, uint8_t res);                  /**< completion of the running command */
+    uint8_t inited;                                                                  /**< inited flag */
+    uint8_t command;                                                                 /**< running command */
+    uint8_t step;                                                                    /**< state of the running command */
+    uint8_t in_buf[18];                                                              /**< frame in flight */
+    uint8_t in_len;                                                                  /**< frame length */
+    uint8_t out_buf[64];                                                             /**< response buffer */
+    uint8_t out_len;                                                                 /**< expected response length */
+    uint8_t arg[4];                                                                  /**< page, password or write data */
+    uint8_t *data;                                                                   /**< caller result buffer */
+    ntag21x_async_entry_t *queue;                                                    /**< running queue */
+    uint16_t queue_len;                                                              /**< queue entries */
+    uint16_t queue_index;                                                            /**< running entry */
+    void (*queue_callback)(struct ntag21x_async_handle_s *handle,
+                           uint16_t num, uint8_t res);                               /**< completion of the queue */
+    uint8_t next_buf[18];                                                            /**< next frame built while one is in flight */
+    uint8_t next_in_len;                                                             /**< next frame length, 0 if not built */
+    uint8_t next_out_len;                                                            /**< next frame expected response length */
+} ntag21x_async_handle_t;
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup ntag21x_async_link_driver ntag21x async link driver function
+ * @brief    ntag21x async link driver modules
+ * @ingroup  ntag21x_async_driver
+ * @{
+ */
+
+/**
+ * @brief     initialize ntag21x_async_handle_t structure
+ * @param[in] HANDLE pointer to an ntag21x async handle structure
+ * @param[in] STRUCTURE ntag21x_async_handle_t
+ * @note      none
+ */
+#define DRIVER_NTAG21X_ASYNC_LINK_INIT(HANDLE, STRUCTURE)           memset(HANDLE, 0, sizeof(STRUCTURE))
+
+/**
+ * @brief     link submit function
+ * @param[in] HANDLE pointer to an ntag21x async handle structure
+ * @param[in] FUC pointer to a submit function address
+ * @note      starts sending a frame and returns at once, 0 means the frame was accepted
+ */
+#define DRIVER_NTAG21X_ASYNC_LINK_SUBMIT(HANDLE, FUC)               (HANDLE)->submit = FUC
+
+/**
+ * @brief     link poll function
+ * @param[in] HANDLE pointer to an ntag21x async handle structure
+ * @param[in] FUC pointer to a poll function address
+ * @note      returns an ntag21x_async_poll_t value and never blocks
+ */
+#define DRIVER_NTAG21X_ASYNC_LINK_POLL(HANDLE, FUC)                 (HANDLE)->poll = FUC
+
+/**
+ * @brief     link debug_print function
+ * @param[in] HANDLE pointer to an ntag21x async handle structure
+ * @param[in] FUC pointer to a debug_print function address
+ * @note      none
+ */
+#define DRIVER_NTAG21X_ASYNC_LINK_DEBUG_PRINT(HANDLE, FUC)          (HANDLE)->debug_print = FUC
+
+/**
+ * @brief     link the synchronous handle of the same tag
+ * @param[in] HANDLE pointer to an ntag21x async handle structure
+ * @param[in] NTAG pointer to an ntag21x handle structure
+ * @note      optional, the page cache and the session of NTAG follow the completed async commands,
+ *            without it the synchronous handle must call ntag21x_invalidate_page_cache and select
+ *            again after async writes, authentications or anti collisions
+ */
+#define DRIVER_NTAG21X_ASYNC_LINK_NTAG(HANDLE, NTAG)                (HANDLE)->ntag = NTAG
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup ntag21x_async_basic_driver ntag21x async basic driver function
+ * @brief    ntag21x async basic driver modules
+ * @ingroup  ntag21x_async_driver
+ * @{
+ */
+
+/**
+ * @brief     initialize the async handle
+ * @param[in] *handle pointer to an ntag21x async handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 linked functions is NULL
+ * @note      none
+ */
+uint8_t ntag21x_async_init(ntag21x_async_handle_t *handle);
+
+/**
+ * @brief     close the async handle
+ * @param[in] *handle pointer to an ntag21x async handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 a command is running
+ * @note      none
+ */
+uint8_t ntag21x_async_deinit(ntag21x_async_handle_t *handle);
+
+/**
+ * @brief      check if a command is running
+ * @param[in]  *handle pointer to an ntag21x async handle structure
+ * @param[out] *busy pointer to a bool buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t ntag21x_async_is_busy(ntag21x_async_handle_t *handle, ntag21x_bool_t *busy);
+
+/**
+ * @brief     drive the running command
+ * @param[in] *handle pointer to an ntag21x async handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      call from the main loop or the reader interrupt, it polls once, sends the next
+ *            frame of the state machine and runs the callback when the command completes
+ */
+uint8_t ntag21x_async_process(ntag21x_async_handle_t *handle);
+
+/**
+ * @brief      start reading four pages
+ * @param[in]  *handle pointer to an ntag21x async handle structure
+ * @param[in]  start_page start page
+ * @param[out] *data pointer to a 16 bytes buffer, valid when the callback runs
+ * @param[in]  *callback pointer to a completion function
+ * @return     status code
+ *             - 0 success
+ *             - 1 submit failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 a command is running
+ * @note       callback res: 0 success, 1 transceiver failed, 4 output_len is invalid, 5 crc error
+ */
+uint8_t ntag21x_async_read(ntag21x_async_handle_t *handle, uint8_t start_page, uint8_t data[16],
+                           void (*callback)(ntag21x_async_handle_t *handle, ntag21x_async_command_t command, uint8_t res));
+
+/**
+ * @brief      start a fast read
+ * @param[in]  *handle pointer to an ntag21x async handle structure
+ * @param[in]  start_page start page
+ * @param[in]  stop_page stop page
+ * @param[out] *data pointer to a 4 * (stop_page - start_page + 1) bytes buffer, valid when the callback runs
+ * @param[in]  *callback pointer to a completion function
+ * @return     status code
+ *             - 0 success
+ *             - 1 submit failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 a command is running
+ *             - 5 stop_page < start_page
+ *             - 6 stop_page - start_page + 1 is over 15
+ * @note       callback res: 0 success, 1 transceiver failed, 4 output_len is invalid, 5 crc error
+ */
+uint8_t ntag21x_async_fast_read(ntag21x_async_handle_t *handle, uint8_t start_page, uint8_t stop_page, uint8_t *data,
+                                void (*callback)(ntag21x_async_handle_t *handle, ntag21x_async_command_t command, uint8_t res));
+
+/**
+ * @brief     start writing a page
+ * @param[in] *handle pointer to an ntag21x async handle structure
+ * @param[in] page written page
+ * @param[in] *data pointer to a 4 bytes buffer, copied at once
+ * @param[in] *callback pointer to a completion function
+ * @return    status code
+ *            - 0 success
+ *            - 1 submit failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 a command is running
+ * @note      callback res: 0 success, 1 transceiver failed, 4 output_len is invalid, 5 ack error
+ */
+uint8_t ntag21x_async_write(ntag21x_async_handle_t *handle, uint8_t page, uint8_t data[4],
+                            void (*callback)(ntag21x_async_handle_t *handle, ntag21x_async_command_t command, uint8_t res));
+
+/**
+ * @brief     start a compatibility write
+ * @param[in] *handle pointer to an ntag21x async handle structure
+ * @param[in] page written page
+ * @param[in] *data pointer to a 4 bytes buffer, copied at once
+ * @param[in] *callback pointer to a completion function
+ * @return    status code
+ *            - 0 success
+ *            - 1 submit failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 a command is running
+ * @note      the data frame is sent after the ack of the command frame,
+ *            callback res: 0 success, 1 transceiver failed, 4 output_len is invalid, 5 ack error
+ */
+uint8_t ntag21x_async_compatibility_write(ntag21x_async_handle_t *handle, uint8_t page, uint8_t data[4],
+                                          void (*callback)(ntag21x_async_handle_t *handle, ntag21x_async_command_t command, uint8_t res));
+
+/**
+ * @brief     start a password authentication
+ * @param[in] *handle pointer to an ntag21x async handle structure
+ * @param[in] *pwd pointer to a 4 bytes password buffer, copied at once
+ * @param[in] *pack pointer to a 2 bytes expected pack buffer, copied at once
+ * @param[in] *callback pointer to a completion function
+ * @return    status code
+ *            - 0 success
+ *            - 1 submit failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 a command is running
+ * @note      callback res: 0 success, 1 transceiver failed, 4 output_len is invalid, 5 crc error,
+ *            6 pack check failed
+ */
+uint8_t ntag21x_async_authenticate(ntag21x_async_handle_t *handle, uint8_t pwd[4], uint8_t pack[2],
+                                   void (*callback)(ntag21x_async_handle_t *handle, ntag21x_async_command_t command, uint8_t res));
+
+/**
+ * @brief      start waking up and selecting a tag
+ * @param[in]  *handle pointer to an ntag21x async handle structure
+ * @param[out] *uid pointer to a 7 bytes uid buffer, valid when the callback runs
+ * @param[in]  *callback pointer to a completion function
+ * @return     status code
+ *             - 0 success
+ *             - 1 submit failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 a command is running
+ * @note       runs wake up, anti collision cl1, select cl1, anti collision cl2 and select cl2,
+ *             callback res: 0 success, 1 transceiver failed, 4 output_len is invalid,
+ *             5 type, check or sak error
+ */
+uint8_t ntag21x_async_anticollision(ntag21x_async_handle_t *handle, uint8_t uid[7],
+                                    void (*callback)(ntag21x_async_handle_t *handle, ntag21x_async_command_t command, uint8_t res));
+
+/**
+ * @brief         start a command queue
+ * @param[in]     *handle pointer to an ntag21x async handle structure
+ * @param[in,out] *queue pointer to an entry list, valid until the callback runs
+ * @param[in]     len entry number
+ * @param[in]     *callback pointer to a completion function
+ * @return        status code
+ *                - 0 success
+ *                - 1 submit failed
+ *                - 2 handle is NULL
+ *                - 3 handle is not initialized
+ *                - 4 a command is running
+ *                - 5 len is invalid
+ *                - 6 an entry is invalid
+ * @note          read, fast read and anti collision entries need a data buffer,
+ *                entries run back to back from ntag21x_async_process, the frame of the next entry
+ *                is built while the current one is in flight, config changes are queued as writes
+ *                of the config pages, the queue stops at the first failure and the callback gets
+ *                the number of entries run and the result of the last one
+ */
+uint8_t ntag21x_async_queue_run(ntag21x_async_handle_t *handle, ntag21x_async_entry_t *queue, uint16_t len,
+                                void (*callback)(ntag21x_async_handle_t *handle, uint16_t num, uint8_t res));
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,368 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file      driver_ntag21x_inventory.c
+ * @brief     driver ntag21x inventory source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_ntag21x_inventory.h"
+
+/**
+ * @brief     push a branch
+ * @param[in] *handle pointer to an ntag21x inventory handle structure
+ * @param[in] level cascade level
+ * @param[in] bits known bits
+ * @param[in] *cl1 pointer to a cascade level 1 id buffer
+ * @param[in] *id pointer to a known id buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 stack overflow
+ * @note      none
+ */
+static uint8_t a_ntag21x_inventory_push(ntag21x_inventory_handle_t *handle, uint8_t level, uint8_t bits,
+                                        uint8_t cl1[5], uint8_t id[5])
+{
+    ntag21x_inventory_branch_t *branch;
+    
+    if (handle->depth >= NTAG21X_INVENTORY_MAX_DEPTH)        /* check the depth */
+    {
+        return 1;                                            /* return error */
+    }
+    
+    branch = &handle->stack[handle->depth];                  /* get the branch */
+    branch->level = level;                                   /* set the level */
+    branch->bits = bits;                                     /* set the bits */
+    memcpy(branch->cl1, cl1, 5);                             /* copy the cl1 */
+    memcpy(branch->id, id, 5);                               /* copy the id */
+    handle->depth++;                                         /* one more branch */
+    
+    return 0;                                                /* success return 0 */
+}
+
+/**
+ * @brief         resolve one cascade level
+ * @param[in]     *handle pointer to an ntag21x inventory handle structure
+ * @param[in]     level cascade level
+ * @param[in]     *cl1 pointer to a cascade level 1 id buffer
+ * @param[in,out] *id pointer to a known id buffer
+ * @param[in]     bits known bits
+ * @return        status code
+ *                - 0 success
+ *                - 1 no tag answered
+ *                - 5 stack overflow
+ * @note          takes the 1 branch of each collision and pushes the 0 branch
+ */
+static uint8_t a_ntag21x_inventory_resolve(ntag21x_inventory_handle_t *handle, uint8_t level,
+                                           uint8_t cl1[5], uint8_t id[5], uint8_t bits)
+{
+    uint8_t res;
+    uint8_t collision;
+    
+    while (bits < 40)                                                                                       /* until the id is complete */
+    {
+        handle->statistics.frames++;                                                                        /* one more frame */
+        res = ntag21x_anticollision_bits(handle->ntag, (ntag21x_cascade_level_t)level, id, &bits, &collision);
+        if (res != 0)                                                                                       /* check the result */
+        {
+            return 1;                                                                                       /* return error */
+        }
+        if (collision != 0)                                                                                 /* bit at bits collides */
+        {
+            handle->statistics.collisions++;                                                                /* one more collision */
+            id[bits / 8] &= (uint8_t)(~(1 << (bits % 8)));                                                  /* 0 branch */
+            if (a_ntag21x_inventory_push(handle, level, (uint8_t)(bits + 1), cl1, id) != 0)                 /* save the 0 branch */
+            {
+                NTAG21X_PRINT(handle->ntag, "ntag21x_inventory: stack overflow.\n");                        /* stack overflow */
+                
+                return 5;                                                                                   /* return error */
+            }
+            id[bits / 8] |= (uint8_t)(1 << (bits % 8));                                                     /* 1 branch */
+            bits++;                                                                                         /* one more known bit */
+        }
+    }
+    
+    return 0;                                                                                               /* success return 0 */
+}
+
+/**
+ * @brief     start an anti collision loop
+ * @param[in] *handle pointer to an ntag21x inventory handle structure
+ * @param[in] wake 1 wakes up halted tags too
+ * @return    status code
+ *            - 0 success
+ *            - 1 no tag answered
+ * @note      a request is sent twice, tags left in the ready state go back to idle on the first
+ */
+static uint8_t a_ntag21x_inventory_request(ntag21x_inventory_handle_t *handle, uint8_t wake)
+{
+    ntag21x_type_t type;
+    
+    if (wake != 0)                                                            /* wake up */
+    {
+        return (ntag21x_wake_up(handle->ntag, &type) == 0) ? 0 : 1;           /* wake up */
+    }
+    if (ntag21x_request(handle->ntag, &type) == 0)                            /* request */
+    {
+        return 0;                                                             /* success return 0 */
+    }
+    
+    return (ntag21x_request(handle->ntag, &type) == 0) ? 0 : 1;               /* request again */
+}
+
+/**
+ * @brief     initialize the inventory
+ * @param[in] *handle pointer to an ntag21x inventory handle structure
+ * @param[in] *ntag pointer to an inited ntag21x handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 linked functions is NULL
+ * @note      the ntag21x handle must link a contactless_transceiver_bits function
+ */
+uint8_t ntag21x_inventory_init(ntag21x_inventory_handle_t *handle, ntag21x_handle_t *ntag)
+{
+    if ((handle == NULL) || (ntag == NULL))                                                       /* check handle */
+    {
+        return 2;                                                                                 /* return error */
+    }
+    if (ntag->inited != 1)                                                                        /* check ntag handle */
+    {
+        return 3;                                                                                 /* return error */
+    }
+    if ((ntag->contactless_transceiver_bits == NULL) && (ntag->contactless_transceiver_bits_ctx == NULL) &&
+        (ntag->trace_transceiver_bits == NULL))                                                   /* check contactless_transceiver_bits */
+    {
+        NTAG21X_PRINT(ntag, "ntag21x_inventory: contactless_transceiver_bits is null.\n");        /* contactless_transceiver_bits is null */
+        
+        return 3;                                                                                 /* return error */
+    }
+    
+    handle->ntag = ntag;                                                                          /* save the ntag handle */
+    handle->depth = 0;                                                                            /* empty stack */
+    memset(&handle->statistics, 0, sizeof(ntag21x_inventory_statistics_t));                       /* clear the statistics */
+    handle->inited = 1;                                                                           /* flag inited */
+    
+    return 0;                                                                                     /* success return 0 */
+}
+
+/**
+ * @brief         list all tags in the field
+ * @param[in]     *handle pointer to an ntag21x inventory handle structure
+ * @param[out]    **uid pointer to a 7 bytes uid list
+ * @param[in,out] *num pointer to a list length buffer
+ * @param[in]     *process pointer to a callback run while each tag is selected, NULL to skip
+ * @return        status code
+ *                - 0 success
+ *                - 2 handle is NULL
+ *                - 3 handle is not initialized
+ *                - 4 list is full
+ *                - 5 stack overflow
+ * @note          the first round wakes up halted tags too, the collision tree is walked with bit
+ *                oriented anti collision and each tag is halted after the callback, the branches
+ *                left on the stack never match a halted tag, the later rounds use request and only
+ *                hear the tags that were missed, num returns the tags found even when an error is returned
+ */
+uint8_t ntag21x_inventory(ntag21x_inventory_handle_t *handle, uint8_t (*uid)[7], uint8_t *num,
+                          void (*process)(ntag21x_handle_t *ntag, uint8_t uid[7]))
+{
+    uint8_t res;
+    uint8_t wake;
+    uint8_t max;
+    uint8_t count;
+    uint8_t found;
+    uint8_t i;
+    uint8_t cl2[5];
+    uint8_t id[7];
+    ntag21x_inventory_branch_t branch;
+    
+    if ((handle == NULL) || (uid == NULL) || (num == NULL))                                         /* check handle */
+    {
+        return 2;                                                                                   /* return error */
+    }
+    if (handle->inited != 1)                                                                        /* check handle initialization */
+    {
+        return 3;                                                                                   /* return error */
+    }
+    
+    max = *num;                                                                                     /* list length */
+    count = 0;                                                                                      /* no tag */
+    wake = 1;                                                                                       /* wake up the halted tags */
+    do
+    {
+        found = 0;                                                                                  /* nothing found */
+        handle->depth = 0;                                                                          /* empty stack */
+        memset(&branch, 0, sizeof(ntag21x_inventory_branch_t));                                     /* clear the branch */
+        branch.level = NTAG21X_CASCADE_LEVEL_1;                                                     /* root branch */
+        (void)a_ntag21x_inventory_push(handle, branch.level, 0, branch.cl1, branch.id);             /* push the root */
+        handle->statistics.rounds++;                                                                /* one more round */
+        while (handle->depth > 0)                                                                   /* walk the tree */
+        {
+            handle->depth--;                                                                        /* pop */
+            branch = handle->stack[handle->depth];                                                  /* get the branch */
+            if (a_ntag21x_inventory_request(handle, wake) != 0)                                     /* no tag left */
+            {
+                handle->depth = 0;                                                                  /* empty stack */
+                
+                break;                                                                              /* break */
+            }
+            if (branch.level == NTAG21X_CASCADE_LEVEL_1)                                            /* level 1 branch */
+            {
+                res = a_ntag21x_inventory_resolve(handle, branch.level, branch.cl1,
+                                                  branch.id, branch.bits);                          /* resolve level 1 */
+                if (res == 0)                                                                       /* check the result */
+                {
+                    memcpy(branch.cl1, branch.id, 5);                                               /* level 1 is known */
+                    memset(cl2, 0, 5);                                                              /* no level 2 bits */
+                    branch.bits = 0;                                                                /* no level 2 bits */
+                }
+            }
+            else
+            {
+                memcpy(cl2, branch.id, 5);                                                          /* level 2 bits */
+                res = 0;                                                                            /* init 0 */
+            }
+            if (res == 0)                                                                           /* check the result */
+            {
+                res = ntag21x_select_cl1(handle->ntag, branch.cl1);                                 /* select cl1 */
+                if (res != 0)                                                                       /* check the result */
+                {
+                    (void)ntag21x_halt(handle->ntag);                                               /* drop a single size uid */
+                }
+            }
+            if (res == 0)                                                                           /* check the result */
+            {
+                res = a_ntag21x_inventory_resolve(handle, NTAG21X_CASCADE_LEVEL_2, branch.cl1,
+                                                  cl2, branch.bits);                                /* resolve level 2 */
+            }
+            if (res == 0)                                                                           /* check the result */
+            {
+                res = ntag21x_select_cl2(handle->ntag, cl2);                                        /* select cl2 */
+            }
+            if (res == 5)                                                                           /* stack overflow */
+            {
+                *num = count;                                                                       /* set the number */
+                
+                return 5;                                                                           /* return error */
+            }
+            if (res != 0)                                                                           /* no tag in this branch */
+            {
+                handle->statistics.dropped++;                                                       /* one more drop */
+                
+                continue;                                                                           /* next branch */
+            }
+            
+            memcpy(id, &branch.cl1[1], 3);                                                          /* uid0 - uid2 */
+            memcpy(&id[3], cl2, 4);                                                                 /* uid3 - uid6 */
+            for (i = 0; i < count; i++)                                                             /* check the list */
+            {
+                if (memcmp(uid[i], id, 7) == 0)                                                     /* already listed */
+                {
+                    break;                                                                          /* break */
+                }
+            }
+            if (i == count)                                                                         /* new tag */
+            {
+                if (count >= max)                                                                   /* check the list */
+                {
+                    (void)ntag21x_halt(handle->ntag);                                               /* halt */
+                    *num = count;                                                                   /* set the number */
+                    
+                    return 4;                                                                       /* return error */
+                }
+                memcpy(uid[count], id, 7);                                                          /* save the uid */
+                count++;                                                                            /* one more tag */
+                found++;                                                                            /* found in this round */
+                handle->statistics.tags++;                                                          /* one more tag */
+                if (process != NULL)                                                                /* check the callback */
+                {
+                    process(handle->ntag, id);                                                      /* process the tag */
+                }
+            }
+            (void)ntag21x_halt(handle->ntag);                                                       /* halt */
+        }
+        wake = 0;                                                                                   /* only the missed tags answer a request */
+    } while (found != 0);                                                                           /* until a round finds nothing new */
+    *num = count;                                                                                   /* set the number */
+    
+    return 0;                                                                                       /* success return 0 */
+}
+
+/**
+ * @brief      get the inventory statistics
+ * @param[in]  *handle pointer to an ntag21x inventory handle structure
+ * @param[out] *statistics pointer to a statistics structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t ntag21x_inventory_get_statistics(ntag21x_inventory_handle_t *handle, ntag21x_inventory_statistics_t *statistics)
+{
+    if ((handle == NULL) || (statistics == NULL))        /* check handle */
+    {
+        return 2;                                        /* return error */
+    }
+    if (handle->inited != 1)                             /* check handle initialization */
+    {
+        return 3;                                        /* return error */
+    }
+    
+    *statistics = handle->statistics;                    /* get the statistics */
+    
+    return 0;                                            /* success return 0 */
+}
+
+/**
+ * @brief     clear the inventory statistics
+ * @param[in] *handle pointer to an ntag21x inventory handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t ntag21x_inventory_clear_statistics(ntag21x_inventory_handle_t *handle)
+{
+    if (handle == NULL)                                                            /* check handle */
+    {
+        return 2;                                                                  /* return error */
+    }
+    if (handle->inited != 1)                                                       /* check handle initialization */
+    {
+        return 3;                                                                  /* return error */
+    }
+    
+    memset(&handle->statistics, 0, sizeof(ntag21x_inventory_statistics_t));        /* clear the statistics */
+    
+    return 0;                                                                      /* success return 0 */
+}
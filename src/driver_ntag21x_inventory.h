@@ -0,0 +1,189 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file      driver_ntag21x_inventory.h
+ * @brief     driver ntag21x inventory header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_NTAG21X_INVENTORY_H
+#define DRIVER_NTAG21X_INVENTORY_H
+
+#include "driver_ntag21x.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup ntag21x_inventory_driver ntag21x inventory driver function
+ * @brief    ntag21x inventory driver modules
+ * @ingroup  ntag21x_driver
+ * @{
+ */
+
+/**
+ * @brief ntag21x inventory max depth definition
+ * @note  one branch per collision bit of the current path, 32 uid bits of each cascade level
+ */
+#ifndef NTAG21X_INVENTORY_MAX_DEPTH
+    #define NTAG21X_INVENTORY_MAX_DEPTH 64
+#endif
+
+/**
+ * @brief ntag21x inventory branch structure definition
+ */
+typedef struct ntag21x_inventory_branch_s
+{
+    uint8_t level;         /**< cascade level */
+    uint8_t bits;          /**< known bits */
+    uint8_t cl1[5];        /**< cascade level 1 id of a level 2 branch */
+    uint8_t id[5];         /**< known id bits */
+} ntag21x_inventory_branch_t;
+
+/**
+ * @brief ntag21x inventory statistics structure definition
+ */
+typedef struct ntag21x_inventory_statistics_s
+{
+    uint32_t rounds;            /**< rounds started by request or wake up */
+    uint32_t frames;            /**< bit oriented anti collision frames */
+    uint32_t collisions;        /**< collisions resolved */
+    uint32_t tags;              /**< tags found */
+    uint32_t dropped;           /**< branches dropped because no tag answered */
+} ntag21x_inventory_statistics_t;
+
+/**
+ * @brief ntag21x inventory handle structure definition
+ */
+typedef struct ntag21x_inventory_handle_s
+{
+    ntag21x_handle_t *ntag;                                                  /**< ntag21x handle */
+    ntag21x_inventory_branch_t stack[NTAG21X_INVENTORY_MAX_DEPTH];           /**< branches left to walk */
+    uint8_t depth;                                                           /**< stack depth */
+    ntag21x_inventory_statistics_t statistics;                               /**< statistics */
+    uint8_t inited;                                                          /**< inited flag */
+} ntag21x_inventory_handle_t;
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup ntag21x_inventory_link_driver ntag21x inventory link driver function
+ * @brief    ntag21x inventory link driver modules
+ * @ingroup  ntag21x_inventory_driver
+ * @{
+ */
+
+/**
+ * @brief     initialize ntag21x_inventory_handle_t structure
+ * @param[in] HANDLE pointer to an ntag21x inventory handle structure
+ * @param[in] STRUCTURE ntag21x_inventory_handle_t
+ * @note      none
+ */
+#define DRIVER_NTAG21X_INVENTORY_LINK_INIT(HANDLE, STRUCTURE)       memset(HANDLE, 0, sizeof(STRUCTURE))
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup ntag21x_inventory_basic_driver ntag21x inventory basic driver function
+ * @brief    ntag21x inventory basic driver modules
+ * @ingroup  ntag21x_inventory_driver
+ * @{
+ */
+
+/**
+ * @brief     initialize the inventory
+ * @param[in] *handle pointer to an ntag21x inventory handle structure
+ * @param[in] *ntag pointer to an inited ntag21x handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 linked functions is NULL
+ * @note      the ntag21x handle must link a contactless_transceiver_bits function
+ */
+uint8_t ntag21x_inventory_init(ntag21x_inventory_handle_t *handle, ntag21x_handle_t *ntag);
+
+/**
+ * @brief         list all tags in the field
+ * @param[in]     *handle pointer to an ntag21x inventory handle structure
+ * @param[out]    **uid pointer to a 7 bytes uid list
+ * @param[in,out] *num pointer to a list length buffer
+ * @param[in]     *process pointer to a callback run while each tag is selected, NULL to skip
+ * @return        status code
+ *                - 0 success
+ *                - 2 handle is NULL
+ *                - 3 handle is not initialized
+ *                - 4 list is full
+ *                - 5 stack overflow
+ * @note          the first round wakes up halted tags too, the collision tree is walked with bit
+ *                oriented anti collision and each tag is halted after the callback, the branches
+ *                left on the stack never match a halted tag, the later rounds use request and only
+ *                hear the tags that were missed, num returns the tags found even when an error is returned
+ */
+uint8_t ntag21x_inventory(ntag21x_inventory_handle_t *handle, uint8_t (*uid)[7], uint8_t *num,
+                          void (*process)(ntag21x_handle_t *ntag, uint8_t uid[7]));
+
+/**
+ * @brief      get the inventory statistics
+ * @param[in]  *handle pointer to an ntag21x inventory handle structure
+ * @param[out] *statistics pointer to a statistics structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t ntag21x_inventory_get_statistics(ntag21x_inventory_handle_t *handle, ntag21x_inventory_statistics_t *statistics);
+
+/**
+ * @brief     clear the inventory statistics
+ * @param[in] *handle pointer to an ntag21x inventory handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t ntag21x_inventory_clear_statistics(ntag21x_inventory_handle_t *handle);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,994 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file      driver_ntag21x_kdf.c
+ * @brief     driver ntag21x kdf source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_ntag21x_kdf.h"
+
+#if (NTAG21X_KDF_AES_BACKEND == NTAG21X_KDF_AES_BACKEND_AESNI)
+#include <emmintrin.h>
+#include <wmmintrin.h>
+#endif
+
+/**
+ * @brief kdf constant definition
+ */
+#define NTAG21X_KDF_CMAC_DIV_CONSTANT        0x01        /**< AN10922 diversification constant of aes-128 */
+#define NTAG21X_KDF_CMAC_MSG_LEN             32          /**< AN10922 padded message length of aes-128 */
+#define NTAG21X_KDF_LANES                    4           /**< blocks in flight of the batch */
+
+/**
+ * @brief aes sbox
+ */
+static const uint8_t gsc_ntag21x_kdf_sbox[256] =
+{
+    0x63, 0x7C, 0x77, 0x7B, 0xF2, 0x6B, 0x6F, 0xC5, 0x30, 0x01, 0x67, 0x2B, 0xFE, 0xD7, 0xAB, 0x76,
+    0xCA, 0x82, 0xC9, 0x7D, 0xFA, 0x59, 0x47, 0xF0, 0xAD, 0xD4, 0xA2, 0xAF, 0x9C, 0xA4, 0x72, 0xC0,
+    0xB7, 0xFD, 0x93, 0x26, 0x36, 0x3F, 0xF7, 0xCC, 0x34, 0xA5, 0xE5, 0xF1, 0x71, 0xD8, 0x31, 0x15,
+    0x04, 0xC7, 0x23, 0xC3, 0x18, 0x96, 0x05, 0x9A, 0x07, 0x12, 0x80, 0xE2, 0xEB, 0x27, 0xB2, 0x75,
+    0x09, 0x83, 0x2C, 0x1A, 0x1B, 0x6E, 0x5A, 0xA0, 0x52, 0x3B, 0xD6, 0xB3, 0x29, 0xE3, 0x2F, 0x84,
+    0x53, 0xD1, 0x00, 0xED, 0x20, 0xFC, 0xB1, 0x5B, 0x6A, 0xCB, 0xBE, 0x39, 0x4A, 0x4C, 0x58, 0xCF,
+    0xD0, 0xEF, 0xAA, 0xFB, 0x43, 0x4D, 0x33, 0x85, 0x45, 0xF9, 0x02, 0x7F, 0x50, 0x3C, 0x9F, 0xA8,
+    0x51, 0xA3, 0x40, 0x8F, 0x92, 0x9D, 0x38, 0xF5, 0xBC, 0xB6, 0xDA, 0x21, 0x10, 0xFF, 0xF3, 0xD2,
+    0xCD, 0x0C, 0x13, 0xEC, 0x5F, 0x97, 0x44, 0x17, 0xC4, 0xA7, 0x7E, 0x3D, 0x64, 0x5D, 0x19, 0x73,
+    0x60, 0x81, 0x4F, 0xDC, 0x22, 0x2A, 0x90, 0x88, 0x46, 0xEE, 0xB8, 0x14, 0xDE, 0x5E, 0x0B, 0xDB,
+    0xE0, 0x32, 0x3A, 0x0A, 0x49, 0x06, 0x24, 0x5C, 0xC2, 0xD3, 0xAC, 0x62, 0x91, 0x95, 0xE4, 0x79,
+    0xE7, 0xC8, 0x37, 0x6D, 0x8D, 0xD5, 0x4E, 0xA9, 0x6C, 0x56, 0xF4, 0xEA, 0x65, 0x7A, 0xAE, 0x08,
+    0xBA, 0x78, 0x25, 0x2E, 0x1C, 0xA6, 0xB4, 0xC6, 0xE8, 0xDD, 0x74, 0x1F, 0x4B, 0xBD, 0x8B, 0x8A,
+    0x70, 0x3E, 0xB5, 0x66, 0x48, 0x03, 0xF6, 0x0E, 0x61, 0x35, 0x57, 0xB9, 0x86, 0xC1, 0x1D, 0x9E,
+    0xE1, 0xF8, 0x98, 0x11, 0x69, 0xD9, 0x8E, 0x94, 0x9B, 0x1E, 0x87, 0xE9, 0xCE, 0x55, 0x28, 0xDF,
+    0x8C, 0xA1, 0x89, 0x0D, 0xBF, 0xE6, 0x42, 0x68, 0x41, 0x99, 0x2D, 0x0F, 0xB0, 0x54, 0xBB, 0x16,
+};
+
+/**
+ * @brief aes key schedule round constants
+ */
+static const uint8_t gsc_ntag21x_kdf_rcon[10] =
+{
+    0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x1B, 0x36,
+};
+
+/**
+ * @brief sha256 round constants
+ */
+static const uint32_t gsc_ntag21x_kdf_sha256_k[64] =
+{
+    0x428A2F98U, 0x71374491U, 0xB5C0FBCFU, 0xE9B5DBA5U, 0x3956C25BU, 0x59F111F1U, 0x923F82A4U, 0xAB1C5ED5U,
+    0xD807AA98U, 0x12835B01U, 0x243185BEU, 0x550C7DC3U, 0x72BE5D74U, 0x80DEB1FEU, 0x9BDC06A7U, 0xC19BF174U,
+    0xE49B69C1U, 0xEFBE4786U, 0x0FC19DC6U, 0x240CA1CCU, 0x2DE92C6FU, 0x4A7484AAU, 0x5CB0A9DCU, 0x76F988DAU,
+    0x983E5152U, 0xA831C66DU, 0xB00327C8U, 0xBF597FC7U, 0xC6E00BF3U, 0xD5A79147U, 0x06CA6351U, 0x14292967U,
+    0x27B70A85U, 0x2E1B2138U, 0x4D2C6DFCU, 0x53380D13U, 0x650A7354U, 0x766A0ABBU, 0x81C2C92EU, 0x92722C85U,
+    0xA2BFE8A1U, 0xA81A664BU, 0xC24B8B70U, 0xC76C51A3U, 0xD192E819U, 0xD6990624U, 0xF40E3585U, 0x106AA070U,
+    0x19A4C116U, 0x1E376C08U, 0x2748774CU, 0x34B0BCB5U, 0x391C0CB3U, 0x4ED8AA4AU, 0x5B9CCA4FU, 0x682E6FF3U,
+    0x748F82EEU, 0x78A5636FU, 0x84C87814U, 0x8CC70208U, 0x90BEFFFAU, 0xA4506CEBU, 0xBEF9A3F7U, 0xC67178F2U,
+};
+
+/**
+ * @brief sha256 initial state
+ */
+static const uint32_t gsc_ntag21x_kdf_sha256_iv[8] =
+{
+    0x6A09E667U, 0xBB67AE85U, 0x3C6EF372U, 0xA54FF53AU, 0x510E527FU, 0x9B05688CU, 0x1F83D9ABU, 0x5BE0CD19U,
+};
+
+/**
+ * @brief     expand an aes-128 key
+ * @param[in] *key pointer to a 16 bytes key buffer
+ * @param[in] *rk pointer to a 176 bytes round key buffer
+ * @note      fips-197 key expansion, the aes-ni path uses the same round keys
+ */
+static void a_ntag21x_kdf_aes_expand(const uint8_t key[16], uint8_t rk[176])
+{
+    uint8_t i;
+    uint8_t t[4];
+    uint8_t tmp;
+    
+    memcpy(rk, key, 16);                                     /* round 0 */
+    for (i = 16; i < 176; i += 4)                            /* one word each */
+    {
+        memcpy(t, &rk[i - 4], 4);                            /* previous word */
+        if ((i % 16) == 0)                                   /* first word of a round */
+        {
+            tmp = t[0];                                      /* rot word */
+            t[0] = (uint8_t)(gsc_ntag21x_kdf_sbox[t[1]] ^ gsc_ntag21x_kdf_rcon[i / 16 - 1]);
+            t[1] = gsc_ntag21x_kdf_sbox[t[2]];               /* sub word */
+            t[2] = gsc_ntag21x_kdf_sbox[t[3]];               /* sub word */
+            t[3] = gsc_ntag21x_kdf_sbox[tmp];                /* sub word */
+        }
+        rk[i + 0] = (uint8_t)(rk[i - 16 + 0] ^ t[0]);        /* set byte 0 */
+        rk[i + 1] = (uint8_t)(rk[i - 16 + 1] ^ t[1]);        /* set byte 1 */
+        rk[i + 2] = (uint8_t)(rk[i - 16 + 2] ^ t[2]);        /* set byte 2 */
+        rk[i + 3] = (uint8_t)(rk[i - 16 + 3] ^ t[3]);        /* set byte 3 */
+    }
+}
+
+#if (NTAG21X_KDF_AES_BACKEND == NTAG21X_KDF_AES_BACKEND_PORTABLE)
+/**
+ * @brief     multiply by x in gf(2^8)
+ * @param[in] x input byte
+ * @return    product
+ * @note      none
+ */
+static uint8_t a_ntag21x_kdf_xtime(uint8_t x)
+{
+    return (uint8_t)((x << 1) ^ (((x >> 7) & 0x01) * 0x1B));
+}
+#endif
+
+/**
+ * @brief         encrypt one aes-128 block
+ * @param[in]     *rk pointer to a 176 bytes round key buffer
+ * @param[in,out] *block pointer to a 16 bytes block buffer
+ * @note          none
+ */
+static void a_ntag21x_kdf_aes_encrypt(const uint8_t rk[176], uint8_t block[16])
+{
+#if (NTAG21X_KDF_AES_BACKEND == NTAG21X_KDF_AES_BACKEND_AESNI)
+    uint8_t r;
+    __m128i b;
+    
+    b = _mm_xor_si128(_mm_loadu_si128((const __m128i *)block), _mm_loadu_si128((const __m128i *)rk));
+    for (r = 1; r < 10; r++)                                                                     /* 9 full rounds */
+    {
+        b = _mm_aesenc_si128(b, _mm_loadu_si128((const __m128i *)(rk + r * 16)));                /* one round */
+    }
+    b = _mm_aesenclast_si128(b, _mm_loadu_si128((const __m128i *)(rk + 160)));                   /* last round */
+    _mm_storeu_si128((__m128i *)block, b);                                                       /* store the block */
+#else
+    uint8_t r;
+    uint8_t c;
+    uint8_t i;
+    uint8_t t;
+    uint8_t s[16];
+    
+    for (i = 0; i < 16; i++)                                                                     /* add round key 0 */
+    {
+        block[i] ^= rk[i];                                                                       /* xor */
+    }
+    for (r = 1; r <= 10; r++)                                                                    /* 10 rounds */
+    {
+        for (c = 0; c < 4; c++)                                                                  /* sub bytes and shift rows */
+        {
+            for (i = 0; i < 4; i++)                                                              /* row i shifts by i */
+            {
+                s[c * 4 + i] = gsc_ntag21x_kdf_sbox[block[((c + i) % 4) * 4 + i]];               /* substitute */
+            }
+        }
+        if (r != 10)                                                                             /* mix columns */
+        {
+            for (c = 0; c < 4; c++)                                                              /* one column each */
+            {
+                t = (uint8_t)(s[c * 4 + 0] ^ s[c * 4 + 1] ^ s[c * 4 + 2] ^ s[c * 4 + 3]);        /* column sum */
+                block[c * 4 + 0] = (uint8_t)(s[c * 4 + 0] ^ t ^ a_ntag21x_kdf_xtime((uint8_t)(s[c * 4 + 0] ^ s[c * 4 + 1])));
+                block[c * 4 + 1] = (uint8_t)(s[c * 4 + 1] ^ t ^ a_ntag21x_kdf_xtime((uint8_t)(s[c * 4 + 1] ^ s[c * 4 + 2])));
+                block[c * 4 + 2] = (uint8_t)(s[c * 4 + 2] ^ t ^ a_ntag21x_kdf_xtime((uint8_t)(s[c * 4 + 2] ^ s[c * 4 + 3])));
+                block[c * 4 + 3] = (uint8_t)(s[c * 4 + 3] ^ t ^ a_ntag21x_kdf_xtime((uint8_t)(s[c * 4 + 3] ^ s[c * 4 + 0])));
+            }
+        }
+        else
+        {
+            memcpy(block, s, 16);                                                                /* no mix in the last round */
+        }
+        for (i = 0; i < 16; i++)                                                                 /* add round key */
+        {
+            block[i] ^= rk[r * 16 + i];                                                          /* xor */
+        }
+    }
+#endif
+}
+
+/**
+ * @brief         encrypt four independent aes-128 blocks
+ * @param[in]     *rk pointer to a 176 bytes round key buffer
+ * @param[in,out] **block pointer to four 16 bytes block buffers
+ * @note          aes-ni interleaves the blocks to hide the aesenc latency
+ */
+static void a_ntag21x_kdf_aes_encrypt4(const uint8_t rk[176], uint8_t (*block)[16])
+{
+#if (NTAG21X_KDF_AES_BACKEND == NTAG21X_KDF_AES_BACKEND_AESNI)
+    uint8_t r;
+    __m128i k;
+    __m128i b0;
+    __m128i b1;
+    __m128i b2;
+    __m128i b3;
+    
+    k = _mm_loadu_si128((const __m128i *)rk);                                  /* round key 0 */
+    b0 = _mm_xor_si128(_mm_loadu_si128((const __m128i *)block[0]), k);         /* block 0 */
+    b1 = _mm_xor_si128(_mm_loadu_si128((const __m128i *)block[1]), k);         /* block 1 */
+    b2 = _mm_xor_si128(_mm_loadu_si128((const __m128i *)block[2]), k);         /* block 2 */
+    b3 = _mm_xor_si128(_mm_loadu_si128((const __m128i *)block[3]), k);         /* block 3 */
+    for (r = 1; r < 10; r++)                                                   /* 9 full rounds */
+    {
+        k = _mm_loadu_si128((const __m128i *)(rk + r * 16));                   /* round key */
+        b0 = _mm_aesenc_si128(b0, k);                                          /* block 0 */
+        b1 = _mm_aesenc_si128(b1, k);                                          /* block 1 */
+        b2 = _mm_aesenc_si128(b2, k);                                          /* block 2 */
+        b3 = _mm_aesenc_si128(b3, k);                                          /* block 3 */
+    }
+    k = _mm_loadu_si128((const __m128i *)(rk + 160));                          /* last round key */
+    _mm_storeu_si128((__m128i *)block[0], _mm_aesenclast_si128(b0, k));        /* block 0 */
+    _mm_storeu_si128((__m128i *)block[1], _mm_aesenclast_si128(b1, k));        /* block 1 */
+    _mm_storeu_si128((__m128i *)block[2], _mm_aesenclast_si128(b2, k));        /* block 2 */
+    _mm_storeu_si128((__m128i *)block[3], _mm_aesenclast_si128(b3, k));        /* block 3 */
+#else
+    uint8_t i;
+    
+    for (i = 0; i < NTAG21X_KDF_LANES; i++)                                    /* one block each */
+    {
+        a_ntag21x_kdf_aes_encrypt(rk, block[i]);                               /* encrypt */
+    }
+#endif
+}
+
+/**
+ * @brief      shift a block left by one bit for the cmac subkeys
+ * @param[in]  *in pointer to a 16 bytes input buffer
+ * @param[out] *out pointer to a 16 bytes output buffer
+ * @note       rfc 4493 generate_subkey
+ */
+static void a_ntag21x_kdf_cmac_double(const uint8_t in[16], uint8_t out[16])
+{
+    uint8_t i;
+    uint8_t msb;
+    
+    msb = (uint8_t)(in[0] >> 7);                                    /* carry out */
+    for (i = 0; i < 15; i++)                                        /* shift */
+    {
+        out[i] = (uint8_t)((in[i] << 1) | (in[i + 1] >> 7));        /* one byte */
+    }
+    out[15] = (uint8_t)((in[15] << 1) ^ (msb * 0x87));              /* reduce */
+}
+
+/**
+ * @brief      get one cmac input block
+ * @param[in]  *handle pointer to an ntag21x kdf handle structure
+ * @param[in]  *msg pointer to a message buffer
+ * @param[in]  len message length
+ * @param[in]  index block index
+ * @param[out] *block pointer to a 16 bytes block buffer
+ * @return     1 for the last block, 0 otherwise
+ * @note       the last block is padded and masked with k1 or k2
+ */
+static uint8_t a_ntag21x_kdf_cmac_block(ntag21x_kdf_handle_t *handle, const uint8_t *msg, uint16_t len,
+                                        uint16_t index, uint8_t block[16])
+{
+    uint8_t i;
+    uint16_t n;
+    uint16_t offset;
+    uint16_t rest;
+    
+    n = (uint16_t)((len + 15) / 16);                                      /* block number */
+    if (n == 0)                                                           /* empty message */
+    {
+        n = 1;                                                            /* one padded block */
+    }
+    offset = (uint16_t)(index * 16);                                      /* block offset */
+    if ((index + 1) < n)                                                  /* middle block */
+    {
+        memcpy(block, msg + offset, 16);                                  /* copy */
+        
+        return 0;                                                         /* not the last */
+    }
+    rest = (uint16_t)(len - offset);                                      /* last block bytes */
+    if (rest == 16)                                                       /* complete block */
+    {
+        for (i = 0; i < 16; i++)                                          /* mask */
+        {
+            block[i] = (uint8_t)(msg[offset + i] ^ handle->k1[i]);        /* xor k1 */
+        }
+    }
+    else
+    {
+        memset(block, 0, 16);                                             /* clear */
+        memcpy(block, msg + offset, rest);                                /* copy */
+        block[rest] = 0x80;                                               /* pad */
+        for (i = 0; i < 16; i++)                                          /* mask */
+        {
+            block[i] ^= handle->k2[i];                                    /* xor k2 */
+        }
+    }
+    
+    return 1;                                                             /* last block */
+}
+
+/**
+ * @brief      compute an aes-cmac
+ * @param[in]  *handle pointer to an ntag21x kdf handle structure
+ * @param[in]  *msg pointer to a message buffer
+ * @param[in]  len message length
+ * @param[out] *mac pointer to a 16 bytes mac buffer
+ * @note       rfc 4493
+ */
+static void a_ntag21x_kdf_cmac(ntag21x_kdf_handle_t *handle, const uint8_t *msg, uint16_t len, uint8_t mac[16])
+{
+    uint8_t i;
+    uint8_t last;
+    uint8_t block[16];
+    uint16_t index;
+    
+    memset(mac, 0, 16);                                                         /* x = 0 */
+    index = 0;                                                                  /* first block */
+    do
+    {
+        last = a_ntag21x_kdf_cmac_block(handle, msg, len, index, block);        /* get the block */
+        for (i = 0; i < 16; i++)                                                /* chain */
+        {
+            mac[i] ^= block[i];                                                 /* xor */
+        }
+        a_ntag21x_kdf_aes_encrypt(handle->round_key, mac);                      /* encrypt */
+        index++;                                                                /* next block */
+    } while (last == 0);                                                        /* until the last block */
+}
+
+/**
+ * @brief         run the sha256 compression function
+ * @param[in,out] *state pointer to an 8 words state buffer
+ * @param[in]     *block pointer to a 64 bytes block buffer
+ * @note          fips 180-4
+ */
+static void a_ntag21x_kdf_sha256_compress(uint32_t state[8], const uint8_t block[64])
+{
+    uint8_t i;
+    uint32_t w[64];
+    uint32_t a[8];
+    uint32_t s0;
+    uint32_t s1;
+    uint32_t t1;
+    uint32_t t2;
+    
+    for (i = 0; i < 16; i++)                                              /* load big endian */
+    {
+        w[i] = ((uint32_t)block[i * 4] << 24) | ((uint32_t)block[i * 4 + 1] << 16) |
+               ((uint32_t)block[i * 4 + 2] << 8) | (uint32_t)block[i * 4 + 3];
+    }
+    for (i = 16; i < 64; i++)                                             /* message schedule */
+    {
+        s0 = ((w[i - 15] >> 7) | (w[i - 15] << 25)) ^ ((w[i - 15] >> 18) | (w[i - 15] << 14)) ^ (w[i - 15] >> 3);
+        s1 = ((w[i - 2] >> 17) | (w[i - 2] << 15)) ^ ((w[i - 2] >> 19) | (w[i - 2] << 13)) ^ (w[i - 2] >> 10);
+        w[i] = w[i - 16] + s0 + w[i - 7] + s1;                            /* set the word */
+    }
+    memcpy(a, state, sizeof(a));                                          /* working variables */
+    for (i = 0; i < 64; i++)                                              /* 64 rounds */
+    {
+        s1 = ((a[4] >> 6) | (a[4] << 26)) ^ ((a[4] >> 11) | (a[4] << 21)) ^ ((a[4] >> 25) | (a[4] << 7));
+        t1 = a[7] + s1 + ((a[4] & a[5]) ^ (~a[4] & a[6])) + gsc_ntag21x_kdf_sha256_k[i] + w[i];
+        s0 = ((a[0] >> 2) | (a[0] << 30)) ^ ((a[0] >> 13) | (a[0] << 19)) ^ ((a[0] >> 22) | (a[0] << 10));
+        t2 = s0 + ((a[0] & a[1]) ^ (a[0] & a[2]) ^ (a[1] & a[2]));        /* majority */
+        a[7] = a[6];                                                      /* rotate */
+        a[6] = a[5];                                                      /* rotate */
+        a[5] = a[4];                                                      /* rotate */
+        a[4] = a[3] + t1;                                                 /* rotate */
+        a[3] = a[2];                                                      /* rotate */
+        a[2] = a[1];                                                      /* rotate */
+        a[1] = a[0];                                                      /* rotate */
+        a[0] = t1 + t2;                                                   /* rotate */
+    }
+    for (i = 0; i < 8; i++)                                               /* add */
+    {
+        state[i] += a[i];                                                 /* add the variables */
+    }
+}
+
+/**
+ * @brief      finish a sha256 hash
+ * @param[in]  *state pointer to an 8 words state buffer
+ * @param[in]  *msg pointer to a message buffer
+ * @param[in]  len message length
+ * @param[in]  prefix bytes already compressed into state
+ * @param[out] *digest pointer to a 32 bytes digest buffer
+ * @note       prefix is a multiple of 64, the state is copied and not changed
+ */
+static void a_ntag21x_kdf_sha256_finish(const uint32_t state[8], const uint8_t *msg, uint32_t len,
+                                        uint32_t prefix, uint8_t digest[32])
+{
+    uint8_t i;
+    uint8_t block[64];
+    uint32_t s[8];
+    uint32_t rest;
+    uint64_t bits;
+    
+    memcpy(s, state, sizeof(s));                           /* copy the state */
+    while (len >= 64)                                      /* full blocks */
+    {
+        a_ntag21x_kdf_sha256_compress(s, msg);             /* compress */
+        msg += 64;                                         /* next block */
+        len -= 64;                                         /* 64 bytes less */
+        prefix += 64;                                      /* 64 bytes more */
+    }
+    rest = len;                                            /* tail bytes */
+    memset(block, 0, 64);                                  /* clear */
+    memcpy(block, msg, rest);                              /* copy the tail */
+    block[rest] = 0x80;                                    /* pad */
+    if (rest >= 56)                                        /* no room for the length */
+    {
+        a_ntag21x_kdf_sha256_compress(s, block);           /* compress */
+        memset(block, 0, 64);                              /* clear */
+    }
+    bits = ((uint64_t)prefix + rest) * 8;                  /* message bits */
+    for (i = 0; i < 8; i++)                                /* big endian length */
+    {
+        block[63 - i] = (uint8_t)(bits >> (i * 8));        /* one byte */
+    }
+    a_ntag21x_kdf_sha256_compress(s, block);               /* compress */
+    for (i = 0; i < 8; i++)                                /* big endian digest */
+    {
+        digest[i * 4 + 0] = (uint8_t)(s[i] >> 24);         /* byte 0 */
+        digest[i * 4 + 1] = (uint8_t)(s[i] >> 16);         /* byte 1 */
+        digest[i * 4 + 2] = (uint8_t)(s[i] >> 8);          /* byte 2 */
+        digest[i * 4 + 3] = (uint8_t)(s[i] >> 0);          /* byte 3 */
+    }
+}
+
+/**
+ * @brief      compute an hmac-sha256 with the precomputed pads
+ * @param[in]  *handle pointer to an ntag21x kdf handle structure
+ * @param[in]  *msg pointer to a message buffer
+ * @param[in]  len message length
+ * @param[out] *mac pointer to a 32 bytes mac buffer
+ * @note       rfc 2104, two compressions for a short message
+ */
+static void a_ntag21x_kdf_hmac(ntag21x_kdf_handle_t *handle, const uint8_t *msg, uint32_t len, uint8_t mac[32])
+{
+    uint8_t digest[32];
+    
+    a_ntag21x_kdf_sha256_finish(handle->inner, msg, len, 64, digest);        /* inner hash */
+    a_ntag21x_kdf_sha256_finish(handle->outer, digest, 32, 64, mac);         /* outer hash */
+}
+
+/**
+ * @brief      build the diversification message of a uid
+ * @param[in]  *handle pointer to an ntag21x kdf handle structure
+ * @param[in]  *uid pointer to a 7 bytes uid buffer
+ * @param[out] *msg pointer to a 32 bytes message buffer
+ * @return     message length
+ * @note       aes-cmac builds the AN10922 message 0x01 || uid || label padded with 0x80 0x00 ... to 32 bytes
+ */
+static uint8_t a_ntag21x_kdf_message(ntag21x_kdf_handle_t *handle, const uint8_t uid[7], uint8_t msg[32])
+{
+    if (handle->algorithm == NTAG21X_KDF_ALGORITHM_AES_CMAC)                                /* aes-cmac */
+    {
+        memset(msg, 0, NTAG21X_KDF_CMAC_MSG_LEN);                                           /* clear */
+        msg[0] = NTAG21X_KDF_CMAC_DIV_CONSTANT;                                             /* constant */
+        memcpy(&msg[1], uid, 7);                                                            /* uid */
+        memcpy(&msg[8], handle->label, handle->label_len);                                  /* label */
+        msg[8 + handle->label_len] = 0x80;                                                  /* pad */
+        
+        return NTAG21X_KDF_CMAC_MSG_LEN;                                                    /* padded length */
+    }
+    else
+    {
+        memcpy(msg, handle->label, handle->label_len);                                      /* label */
+        memcpy(&msg[handle->label_len], uid, 7);                                            /* uid */
+        
+        return (uint8_t)(handle->label_len + 7);                                            /* message length */
+    }
+}
+
+/**
+ * @brief      compute the AN10922 aes-128 diversified key
+ * @param[in]  *handle pointer to an ntag21x kdf handle structure
+ * @param[in]  *msg pointer to a 32 bytes padded message buffer
+ * @param[out] *mac pointer to a 16 bytes mac buffer
+ * @note       cmac of the two blocks, the message is always padded because the label is
+ *             at most 16 bytes so the last block is masked with k2
+ */
+static void a_ntag21x_kdf_an10922(ntag21x_kdf_handle_t *handle, const uint8_t msg[32], uint8_t mac[16])
+{
+    uint8_t i;
+    
+    memcpy(mac, msg, 16);                                                    /* first block */
+    a_ntag21x_kdf_aes_encrypt(handle->round_key, mac);                       /* encrypt */
+    for (i = 0; i < 16; i++)                                                 /* chain */
+    {
+        mac[i] ^= (uint8_t)(msg[16 + i] ^ handle->k2[i]);                    /* xor the last block and k2 */
+    }
+    a_ntag21x_kdf_aes_encrypt(handle->round_key, mac);                       /* encrypt */
+}
+
+/**
+ * @brief      derive one uid
+ * @param[in]  *handle pointer to an ntag21x kdf handle structure
+ * @param[in]  *uid pointer to a 7 bytes uid buffer
+ * @param[out] *pwd pointer to a 4 bytes password buffer
+ * @param[out] *pack pointer to a 2 bytes pack buffer
+ * @note       none
+ */
+static void a_ntag21x_kdf_derive(ntag21x_kdf_handle_t *handle, const uint8_t uid[7], uint8_t pwd[4], uint8_t pack[2])
+{
+    uint8_t len;
+    uint8_t msg[32];
+    uint8_t mac[32];
+    
+    len = a_ntag21x_kdf_message(handle, uid, msg);                  /* build the message */
+    if (handle->algorithm == NTAG21X_KDF_ALGORITHM_AES_CMAC)        /* aes-cmac */
+    {
+        a_ntag21x_kdf_an10922(handle, msg, mac);                    /* AN10922 */
+    }
+    else
+    {
+        a_ntag21x_kdf_hmac(handle, msg, len, mac);                  /* hmac */
+    }
+    memcpy(pwd, mac, 4);                                            /* bytes 0 - 3 */
+    memcpy(pack, mac + 4, 2);                                       /* bytes 4 - 5 */
+}
+
+/**
+ * @brief     initialize the key derivation with a master key
+ * @param[in] *handle pointer to an ntag21x kdf handle structure
+ * @param[in] algorithm derivation algorithm
+ * @param[in] *key pointer to a master key buffer
+ * @param[in] key_len master key length
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 4 algorithm is invalid
+ *            - 5 key_len is invalid
+ * @note      aes-cmac needs a 16 bytes key, hmac-sha256 takes 1 to 255 bytes,
+ *            the round keys, subkeys and hmac pads are computed once here, the label is cleared
+ */
+uint8_t ntag21x_kdf_init(ntag21x_kdf_handle_t *handle, ntag21x_kdf_algorithm_t algorithm, uint8_t *key, uint8_t key_len)
+{
+    uint8_t i;
+    uint8_t l[16];
+    uint8_t pad[64];
+    uint8_t digest[32];
+    
+    if ((handle == NULL) || (key == NULL))                                                           /* check handle */
+    {
+        return 2;                                                                                    /* return error */
+    }
+    if ((algorithm != NTAG21X_KDF_ALGORITHM_AES_CMAC) && 
+        (algorithm != NTAG21X_KDF_ALGORITHM_HMAC_SHA256))                                            /* check the algorithm */
+    {
+        return 4;                                                                                    /* return error */
+    }
+    if ((key_len == 0) || ((algorithm == NTAG21X_KDF_ALGORITHM_AES_CMAC) && (key_len != 16)))        /* check the key */
+    {
+        return 5;                                                                                    /* return error */
+    }
+    
+    memset(handle, 0, sizeof(ntag21x_kdf_handle_t));                                                 /* clear the handle */
+    handle->algorithm = (uint8_t)algorithm;                                                          /* set the algorithm */
+    if (algorithm == NTAG21X_KDF_ALGORITHM_AES_CMAC)                                                 /* aes-cmac */
+    {
+        a_ntag21x_kdf_aes_expand(key, handle->round_key);                                            /* expand the key */
+        memset(l, 0, 16);                                                                            /* zero block */
+        a_ntag21x_kdf_aes_encrypt(handle->round_key, l);                                             /* l = aes(k, 0) */
+        a_ntag21x_kdf_cmac_double(l, handle->k1);                                                    /* k1 */
+        a_ntag21x_kdf_cmac_double(handle->k1, handle->k2);                                           /* k2 */
+    }
+    else
+    {
+        memset(pad, 0, 64);                                                                          /* clear */
+        if (key_len > 64)                                                                            /* long key */
+        {
+            a_ntag21x_kdf_sha256_finish(gsc_ntag21x_kdf_sha256_iv, key, key_len, 0, digest);         /* hash the key */
+            memcpy(pad, digest, 32);                                                                 /* use the digest */
+        }
+        else
+        {
+            memcpy(pad, key, key_len);                                                               /* use the key */
+        }
+        for (i = 0; i < 64; i++)                                                                     /* ipad */
+        {
+            pad[i] ^= 0x36;                                                                          /* xor */
+        }
+        memcpy(handle->inner, gsc_ntag21x_kdf_sha256_iv, sizeof(handle->inner));                     /* iv */
+        a_ntag21x_kdf_sha256_compress(handle->inner, pad);                                           /* inner key block */
+        for (i = 0; i < 64; i++)                                                                     /* opad */
+        {
+            pad[i] ^= 0x36 ^ 0x5C;                                                                   /* xor */
+        }
+        memcpy(handle->outer, gsc_ntag21x_kdf_sha256_iv, sizeof(handle->outer));                     /* iv */
+        a_ntag21x_kdf_sha256_compress(handle->outer, pad);                                           /* outer key block */
+        memset(pad, 0, 64);                                                                          /* wipe */
+    }
+    handle->inited = 1;                                                                              /* flag inited */
+    
+    return 0;                                                                                        /* success return 0 */
+}
+
+/**
+ * @brief     set the diversification label
+ * @param[in] *handle pointer to an ntag21x kdf handle structure
+ * @param[in] *label pointer to a label buffer
+ * @param[in] len label length
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 len is invalid
+ * @note      e.g. an application or site identifier, len 0 clears it
+ */
+uint8_t ntag21x_kdf_set_label(ntag21x_kdf_handle_t *handle, uint8_t *label, uint8_t len)
+{
+    if ((handle == NULL) || ((label == NULL) && (len != 0)))        /* check handle */
+    {
+        return 2;                                                   /* return error */
+    }
+    if (handle->inited != 1)                                        /* check handle initialization */
+    {
+        return 3;                                                   /* return error */
+    }
+    if (len > NTAG21X_KDF_MAX_LABEL_LEN)                            /* check the length */
+    {
+        return 4;                                                   /* return error */
+    }
+    
+    if (len != 0)                                                   /* not empty */
+    {
+        memcpy(handle->label, label, len);                          /* copy the label */
+    }
+    handle->label_len = len;                                        /* set the length */
+    
+    return 0;                                                       /* success return 0 */
+}
+
+/**
+ * @brief      derive the password and pack of one uid
+ * @param[in]  *handle pointer to an ntag21x kdf handle structure
+ * @param[in]  *uid pointer to a 7 bytes uid buffer
+ * @param[out] *pwd pointer to a 4 bytes password buffer
+ * @param[out] *pack pointer to a 2 bytes pack buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       pwd is bytes 0 - 3 and pack is bytes 4 - 5 of the mac
+ */
+uint8_t ntag21x_kdf_derive(ntag21x_kdf_handle_t *handle, uint8_t uid[7], uint8_t pwd[4], uint8_t pack[2])
+{
+    if ((handle == NULL) || (uid == NULL) || (pwd == NULL) || (pack == NULL))        /* check handle */
+    {
+        return 2;                                                                    /* return error */
+    }
+    if (handle->inited != 1)                                                         /* check handle initialization */
+    {
+        return 3;                                                                    /* return error */
+    }
+    
+    a_ntag21x_kdf_derive(handle, uid, pwd, pack);                                    /* derive */
+    
+    return 0;                                                                        /* success return 0 */
+}
+
+/**
+ * @brief      derive the passwords and packs of a uid list
+ * @param[in]  *handle pointer to an ntag21x kdf handle structure
+ * @param[in]  **uid pointer to a 7 bytes uid list
+ * @param[out] **pwd pointer to a 4 bytes password list
+ * @param[out] **pack pointer to a 2 bytes pack list
+ * @param[in]  num list length
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       same result as ntag21x_kdf_derive for every uid, aes-cmac keeps four
+ *             blocks in flight so the aes-ni pipeline stays busy
+ */
+uint8_t ntag21x_kdf_derive_batch(ntag21x_kdf_handle_t *handle, uint8_t (*uid)[7], uint8_t (*pwd)[4],
+                                 uint8_t (*pack)[2], uint32_t num)
+{
+    uint8_t i;
+    uint8_t j;
+    uint8_t msg[NTAG21X_KDF_LANES][32];
+    uint8_t state[NTAG21X_KDF_LANES][16];
+    uint32_t n;
+    
+    if ((handle == NULL) || (((uid == NULL) || (pwd == NULL) || (pack == NULL)) && (num != 0)))        /* check handle */
+    {
+        return 2;                                                                                      /* return error */
+    }
+    if (handle->inited != 1)                                                                           /* check handle initialization */
+    {
+        return 3;                                                                                      /* return error */
+    }
+    
+    n = 0;                                                                                             /* first uid */
+    if (handle->algorithm == NTAG21X_KDF_ALGORITHM_AES_CMAC)                                           /* aes-cmac */
+    {
+        for (; (n + NTAG21X_KDF_LANES) <= num; n += NTAG21X_KDF_LANES)                                 /* four uids each */
+        {
+            for (i = 0; i < NTAG21X_KDF_LANES; i++)                                                    /* build the messages */
+            {
+                (void)a_ntag21x_kdf_message(handle, uid[n + i], msg[i]);                               /* padded message */
+                memcpy(state[i], msg[i], 16);                                                          /* first block */
+            }
+            a_ntag21x_kdf_aes_encrypt4(handle->round_key, state);                                      /* four blocks in flight */
+            for (i = 0; i < NTAG21X_KDF_LANES; i++)                                                    /* chain every lane */
+            {
+                for (j = 0; j < 16; j++)                                                               /* chain */
+                {
+                    state[i][j] ^= (uint8_t)(msg[i][16 + j] ^ handle->k2[j]);                          /* xor the last block and k2 */
+                }
+            }
+            a_ntag21x_kdf_aes_encrypt4(handle->round_key, state);                                      /* four blocks in flight */
+            for (i = 0; i < NTAG21X_KDF_LANES; i++)                                                    /* copy the results */
+            {
+                memcpy(pwd[n + i], state[i], 4);                                                       /* bytes 0 - 3 */
+                memcpy(pack[n + i], state[i] + 4, 2);                                                  /* bytes 4 - 5 */
+            }
+        }
+    }
+    for (; n < num; n++)                                                                               /* the rest one by one */
+    {
+        a_ntag21x_kdf_derive(handle, uid[n], pwd[n], pack[n]);                                         /* derive */
+    }
+    
+    return 0;                                                                                          /* success return 0 */
+}
+
+/**
+ * @brief      derive_password_ctx adapter
+ * @param[in]  *user pointer to an ntag21x kdf handle structure
+ * @param[in]  *uid pointer to a 7 bytes uid buffer
+ * @param[out] *pwd pointer to a 4 bytes password buffer
+ * @param[out] *pack pointer to a 2 bytes pack buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 derive failed
+ * @note       link with DRIVER_NTAG21X_LINK_DERIVE_PASSWORD_CTX and DRIVER_NTAG21X_LINK_USER
+ *             when the user context is free for the kdf handle
+ */
+uint8_t ntag21x_kdf_derive_password(void *user, uint8_t uid[7], uint8_t pwd[4], uint8_t pack[2])
+{
+    return (ntag21x_kdf_derive((ntag21x_kdf_handle_t *)user, uid, pwd, pack) == 0) ? 0 : 1;        /* derive */
+}
+
+/**
+ * @brief     write the derived password and pack to the selected tag
+ * @param[in] *handle pointer to an ntag21x kdf handle structure
+ * @param[in] *ntag pointer to an ntag21x handle structure
+ * @param[in] *uid pointer to a 7 bytes uid buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      calls ntag21x_set_password and ntag21x_set_pack
+ */
+uint8_t ntag21x_kdf_write_password(ntag21x_kdf_handle_t *handle, ntag21x_handle_t *ntag, uint8_t uid[7])
+{
+    uint8_t pwd[4];
+    uint8_t pack[2];
+    
+    if ((handle == NULL) || (ntag == NULL) || (uid == NULL))               /* check handle */
+    {
+        return 2;                                                          /* return error */
+    }
+    if (handle->inited != 1)                                               /* check handle initialization */
+    {
+        return 3;                                                          /* return error */
+    }
+    
+    a_ntag21x_kdf_derive(handle, uid, pwd, pack);                          /* derive */
+    if (ntag21x_set_password(ntag, pwd) != 0)                              /* set the password */
+    {
+        NTAG21X_PRINT(ntag, "ntag21x_kdf: set password failed.\n");        /* set password failed */
+        
+        return 1;                                                          /* return error */
+    }
+    if (ntag21x_set_pack(ntag, pack) != 0)                                 /* set the pack */
+    {
+        NTAG21X_PRINT(ntag, "ntag21x_kdf: set pack failed.\n");            /* set pack failed */
+        
+        return 1;                                                          /* return error */
+    }
+    
+    return 0;                                                              /* success return 0 */
+}
+
+/**
+ * @brief     authenticate the selected tag with the derived password
+ * @param[in] *handle pointer to an ntag21x kdf handle structure
+ * @param[in] *ntag pointer to an ntag21x handle structure
+ * @param[in] *uid pointer to a 7 bytes uid buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 authenticate failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 pack check failed
+ * @note      calls ntag21x_authenticate
+ */
+uint8_t ntag21x_kdf_authenticate(ntag21x_kdf_handle_t *handle, ntag21x_handle_t *ntag, uint8_t uid[7])
+{
+    uint8_t res;
+    uint8_t pwd[4];
+    uint8_t pack[2];
+    
+    if ((handle == NULL) || (ntag == NULL) || (uid == NULL))        /* check handle */
+    {
+        return 2;                                                   /* return error */
+    }
+    if (handle->inited != 1)                                        /* check handle initialization */
+    {
+        return 3;                                                   /* return error */
+    }
+    
+    a_ntag21x_kdf_derive(handle, uid, pwd, pack);                   /* derive */
+    res = ntag21x_authenticate(ntag, pwd, pack);                    /* authenticate */
+    if (res == 6)                                                   /* pack check failed */
+    {
+        return 4;                                                   /* return error */
+    }
+    
+    return (res == 0) ? 0 : 1;                                      /* return the result */
+}
+
+/**
+ * @brief  check the primitives against the published test vectors
+ * @return status code
+ *         - 0 success
+ *         - 1 aes failed
+ *         - 2 aes-cmac failed
+ *         - 3 hmac-sha256 failed
+ *         - 4 batch differs from the single derivation
+ *         - 5 AN10922 diversification failed
+ * @note   fips-197 c.1, rfc 4493 examples 1, 2 and 3, rfc 4231 test cases 1, 2 and 6,
+ *         AN10922 2.2.1 aes-128 example
+ */
+uint8_t ntag21x_kdf_self_test(void)
+{
+    static const uint8_t aes_key[16] = {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+                                        0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F};
+    static const uint8_t aes_in[16] = {0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77,
+                                       0x88, 0x99, 0xAA, 0xBB, 0xCC, 0xDD, 0xEE, 0xFF};
+    static const uint8_t aes_out[16] = {0x69, 0xC4, 0xE0, 0xD8, 0x6A, 0x7B, 0x04, 0x30,
+                                        0xD8, 0xCD, 0xB7, 0x80, 0x70, 0xB4, 0xC5, 0x5A};
+    static const uint8_t cmac_key[16] = {0x2B, 0x7E, 0x15, 0x16, 0x28, 0xAE, 0xD2, 0xA6,
+                                         0xAB, 0xF7, 0x15, 0x88, 0x09, 0xCF, 0x4F, 0x3C};
+    static const uint8_t cmac_msg[40] = {0x6B, 0xC1, 0xBE, 0xE2, 0x2E, 0x40, 0x9F, 0x96,
+                                         0xE9, 0x3D, 0x7E, 0x11, 0x73, 0x93, 0x17, 0x2A,
+                                         0xAE, 0x2D, 0x8A, 0x57, 0x1E, 0x03, 0xAC, 0x9C,
+                                         0x9E, 0xB7, 0x6F, 0xAC, 0x45, 0xAF, 0x8E, 0x51,
+                                         0x30, 0xC8, 0x1C, 0x46, 0xA3, 0x5C, 0xE4, 0x11};
+    static const uint8_t cmac_len[3] = {0, 16, 40};
+    static const uint8_t cmac_mac[3][16] = {{0xBB, 0x1D, 0x69, 0x29, 0xE9, 0x59, 0x37, 0x28,
+                                             0x7F, 0xA3, 0x7D, 0x12, 0x9B, 0x75, 0x67, 0x46},
+                                            {0x07, 0x0A, 0x16, 0xB4, 0x6B, 0x4D, 0x41, 0x44,
+                                             0xF7, 0x9B, 0xDD, 0x9D, 0xD0, 0x4A, 0x28, 0x7C},
+                                            {0xDF, 0xA6, 0x67, 0x47, 0xDE, 0x9A, 0xE6, 0x30,
+                                             0x30, 0xCA, 0x32, 0x61, 0x14, 0x97, 0xC8, 0x27}};
+    static const uint8_t hmac_mac[3][32] = {{0xB0, 0x34, 0x4C, 0x61, 0xD8, 0xDB, 0x38, 0x53,
+                                             0x5C, 0xA8, 0xAF, 0xCE, 0xAF, 0x0B, 0xF1, 0x2B,
+                                             0x88, 0x1D, 0xC2, 0x00, 0xC9, 0x83, 0x3D, 0xA7,
+                                             0x26, 0xE9, 0x37, 0x6C, 0x2E, 0x32, 0xCF, 0xF7},
+                                            {0x5B, 0xDC, 0xC1, 0x46, 0xBF, 0x60, 0x75, 0x4E,
+                                             0x6A, 0x04, 0x24, 0x26, 0x08, 0x95, 0x75, 0xC7,
+                                             0x5A, 0x00, 0x3F, 0x08, 0x9D, 0x27, 0x39, 0x83,
+                                             0x9D, 0xEC, 0x58, 0xB9, 0x64, 0xEC, 0x38, 0x43},
+                                            {0x60, 0xE4, 0x31, 0x59, 0x1E, 0xE0, 0xB6, 0x7F,
+                                             0x0D, 0x8A, 0x26, 0xAA, 0xCB, 0xF5, 0xB7, 0x7F,
+                                             0x8E, 0x0B, 0xC6, 0x21, 0x37, 0x28, 0xC5, 0x14,
+                                             0x05, 0x46, 0x04, 0x0F, 0x0E, 0xE3, 0x7F, 0x54}};
+    static const char *const hmac_msg[3] = {"Hi There", "what do ya want for nothing?",
+                                            "Test Using Larger Than Block-Size Key - Hash Key First"};
+    static const uint8_t div_key[16] = {0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77,
+                                        0x88, 0x99, 0xAA, 0xBB, 0xCC, 0xDD, 0xEE, 0xFF};
+    static const uint8_t div_uid[7] = {0x04, 0x78, 0x2E, 0x21, 0x80, 0x1D, 0x80};
+    static const uint8_t div_label[10] = {0x30, 0x42, 0xF5, 0x4E, 0x58, 0x50, 0x20, 0x41, 0x62, 0x75};
+    static const uint8_t div_mac[16] = {0xA8, 0xDD, 0x63, 0xA3, 0xB8, 0x9D, 0x54, 0xB3,
+                                        0x7C, 0xA8, 0x02, 0x47, 0x3F, 0xDA, 0x91, 0x75};
+    uint8_t i;
+    uint8_t j;
+    uint8_t key[131];
+    uint8_t key_len;
+    uint8_t block[16];
+    uint8_t msg[32];
+    uint8_t mac[32];
+    uint8_t uid[6][7];
+    uint8_t pwd[6][4];
+    uint8_t pack[6][2];
+    uint8_t one_pwd[4];
+    uint8_t one_pack[2];
+    ntag21x_kdf_handle_t handle;
+    
+    memcpy(block, aes_in, 16);                                                                       /* fips-197 c.1 */
+    a_ntag21x_kdf_aes_expand(aes_key, handle.round_key);                                             /* expand the key */
+    a_ntag21x_kdf_aes_encrypt(handle.round_key, block);                                              /* encrypt */
+    if (memcmp(block, aes_out, 16) != 0)                                                             /* check the result */
+    {
+        return 1;                                                                                    /* return error */
+    }
+    
+    (void)ntag21x_kdf_init(&handle, NTAG21X_KDF_ALGORITHM_AES_CMAC, (uint8_t *)cmac_key, 16);        /* rfc 4493 */
+    for (i = 0; i < 3; i++)                                                                          /* examples 1, 2 and 3 */
+    {
+        a_ntag21x_kdf_cmac(&handle, cmac_msg, cmac_len[i], mac);                                     /* cmac */
+        if (memcmp(mac, cmac_mac[i], 16) != 0)                                                       /* check the result */
+        {
+            return 2;                                                                                /* return error */
+        }
+    }
+    
+    (void)ntag21x_kdf_init(&handle, NTAG21X_KDF_ALGORITHM_AES_CMAC, (uint8_t *)div_key, 16);         /* AN10922 2.2.1 */
+    (void)ntag21x_kdf_set_label(&handle, (uint8_t *)div_label, 10);                                  /* aid || system identifier */
+    (void)a_ntag21x_kdf_message(&handle, div_uid, msg);                                              /* padded message */
+    a_ntag21x_kdf_an10922(&handle, msg, mac);                                                        /* diversify */
+    if (memcmp(mac, div_mac, 16) != 0)                                                               /* check the result */
+    {
+        return 5;                                                                                    /* return error */
+    }
+    
+    for (i = 0; i < 3; i++)                                                                          /* rfc 4231 */
+    {
+        if (i == 0)                                                                                  /* test case 1 */
+        {
+            memset(key, 0x0B, 20);                                                                   /* 20 bytes 0x0b */
+            key_len = 20;                                                                            /* set the length */
+        }
+        else if (i == 1)                                                                             /* test case 2 */
+        {
+            memcpy(key, "Jefe", 4);                                                                  /* jefe */
+            key_len = 4;                                                                             /* set the length */
+        }
+        else                                                                                         /* test case 6 */
+        {
+            memset(key, 0xAA, 131);                                                                  /* 131 bytes 0xaa */
+            key_len = 131;                                                                           /* set the length */
+        }
+        (void)ntag21x_kdf_init(&handle, NTAG21X_KDF_ALGORITHM_HMAC_SHA256, key, key_len);            /* init */
+        a_ntag21x_kdf_hmac(&handle, (const uint8_t *)hmac_msg[i], (uint32_t)strlen(hmac_msg[i]), mac);
+        if (memcmp(mac, hmac_mac[i], 32) != 0)                                                       /* check the result */
+        {
+            return 3;                                                                                /* return error */
+        }
+    }
+    
+    for (i = 0; i < 6; i++)                                                                          /* uid list */
+    {
+        for (j = 0; j < 7; j++)                                                                      /* one uid */
+        {
+            uid[i][j] = (uint8_t)(0x04 + i * 29 + j * 7);                                            /* any pattern */
+        }
+    }
+    (void)ntag21x_kdf_init(&handle, NTAG21X_KDF_ALGORITHM_AES_CMAC, (uint8_t *)cmac_key, 16);        /* aes-cmac */
+    for (j = 0; j < 2; j++)                                                                          /* one and two blocks */
+    {
+        (void)ntag21x_kdf_set_label(&handle, (uint8_t *)cmac_msg, (uint8_t)(j * 12));                /* label */
+        (void)ntag21x_kdf_derive_batch(&handle, uid, pwd, pack, 6);                                  /* batch */
+        for (i = 0; i < 6; i++)                                                                      /* compare */
+        {
+            a_ntag21x_kdf_derive(&handle, uid[i], one_pwd, one_pack);                                /* single */
+            if ((memcmp(pwd[i], one_pwd, 4) != 0) || (memcmp(pack[i], one_pack, 2) != 0))            /* check the result */
+            {
+                return 4;                                                                            /* return error */
+            }
+        }
+    }
+    
+    return 0;                                                                                        /* success return 0 */
+}
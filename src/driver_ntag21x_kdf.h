@@ -0,0 +1,239 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file      driver_ntag21x_kdf.h
+ * @brief     driver ntag21x kdf header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_NTAG21X_KDF_H
+#define DRIVER_NTAG21X_KDF_H
+
+#include "driver_ntag21x.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup ntag21x_kdf_driver ntag21x kdf driver function
+ * @brief    ntag21x kdf driver modules
+ * @ingroup  ntag21x_driver
+ * @{
+ */
+
+/**
+ * @brief ntag21x kdf aes backend definition
+ */
+#define NTAG21X_KDF_AES_BACKEND_PORTABLE        0        /**< byte oriented c, no table but the sbox */
+#define NTAG21X_KDF_AES_BACKEND_AESNI           1        /**< x86 aes-ni, four blocks in flight */
+
+/**
+ * @brief ntag21x kdf aes backend selection
+ * @note  override with -DNTAG21X_KDF_AES_BACKEND=NTAG21X_KDF_AES_BACKEND_xxx,
+ *        aes-ni is chosen when the compiler targets it, e.g. with -maes
+ */
+#ifndef NTAG21X_KDF_AES_BACKEND
+    #if defined(__AES__) && defined(__SSE2__)
+        #define NTAG21X_KDF_AES_BACKEND NTAG21X_KDF_AES_BACKEND_AESNI
+    #else
+        #define NTAG21X_KDF_AES_BACKEND NTAG21X_KDF_AES_BACKEND_PORTABLE
+    #endif
+#endif
+
+/**
+ * @brief ntag21x kdf max label length definition
+ */
+#define NTAG21X_KDF_MAX_LABEL_LEN        16        /**< keeps every message within two blocks */
+
+/**
+ * @brief ntag21x kdf algorithm enumeration definition
+ */
+typedef enum
+{
+    NTAG21X_KDF_ALGORITHM_AES_CMAC    = 0x00,        /**< AN10922 aes-128 diversification, cmac of 0x01 || uid || label padded to 32 bytes */
+    NTAG21X_KDF_ALGORITHM_HMAC_SHA256 = 0x01,        /**< hmac-sha256 of label || uid */
+} ntag21x_kdf_algorithm_t;
+
+/**
+ * @brief ntag21x kdf handle structure definition
+ */
+typedef struct ntag21x_kdf_handle_s
+{
+    uint8_t algorithm;                               /**< derivation algorithm */
+    uint8_t round_key[176];                          /**< aes-128 round keys */
+    uint8_t k1[16];                                  /**< cmac subkey 1 */
+    uint8_t k2[16];                                  /**< cmac subkey 2 */
+    uint32_t inner[8];                               /**< sha256 state after the inner key block */
+    uint32_t outer[8];                               /**< sha256 state after the outer key block */
+    uint8_t label[NTAG21X_KDF_MAX_LABEL_LEN];        /**< diversification label */
+    uint8_t label_len;                               /**< label length */
+    uint8_t inited;                                  /**< inited flag */
+} ntag21x_kdf_handle_t;
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup ntag21x_kdf_basic_driver ntag21x kdf basic driver function
+ * @brief    ntag21x kdf basic driver modules
+ * @ingroup  ntag21x_kdf_driver
+ * @{
+ */
+
+/**
+ * @brief     initialize the key derivation with a master key
+ * @param[in] *handle pointer to an ntag21x kdf handle structure
+ * @param[in] algorithm derivation algorithm
+ * @param[in] *key pointer to a master key buffer
+ * @param[in] key_len master key length
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 4 algorithm is invalid
+ *            - 5 key_len is invalid
+ * @note      aes-cmac needs a 16 bytes key, hmac-sha256 takes 1 to 255 bytes,
+ *            the round keys, subkeys and hmac pads are computed once here, the label is cleared
+ */
+uint8_t ntag21x_kdf_init(ntag21x_kdf_handle_t *handle, ntag21x_kdf_algorithm_t algorithm, uint8_t *key, uint8_t key_len);
+
+/**
+ * @brief     set the diversification label
+ * @param[in] *handle pointer to an ntag21x kdf handle structure
+ * @param[in] *label pointer to a label buffer
+ * @param[in] len label length
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 len is invalid
+ * @note      e.g. an application or site identifier, len 0 clears it
+ */
+uint8_t ntag21x_kdf_set_label(ntag21x_kdf_handle_t *handle, uint8_t *label, uint8_t len);
+
+/**
+ * @brief      derive the password and pack of one uid
+ * @param[in]  *handle pointer to an ntag21x kdf handle structure
+ * @param[in]  *uid pointer to a 7 bytes uid buffer
+ * @param[out] *pwd pointer to a 4 bytes password buffer
+ * @param[out] *pack pointer to a 2 bytes pack buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       pwd is bytes 0 - 3 and pack is bytes 4 - 5 of the mac
+ */
+uint8_t ntag21x_kdf_derive(ntag21x_kdf_handle_t *handle, uint8_t uid[7], uint8_t pwd[4], uint8_t pack[2]);
+
+/**
+ * @brief      derive the passwords and packs of a uid list
+ * @param[in]  *handle pointer to an ntag21x kdf handle structure
+ * @param[in]  **uid pointer to a 7 bytes uid list
+ * @param[out] **pwd pointer to a 4 bytes password list
+ * @param[out] **pack pointer to a 2 bytes pack list
+ * @param[in]  num list length
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       same result as ntag21x_kdf_derive for every uid, aes-cmac keeps four
+ *             blocks in flight so the aes-ni pipeline stays busy
+ */
+uint8_t ntag21x_kdf_derive_batch(ntag21x_kdf_handle_t *handle, uint8_t (*uid)[7], uint8_t (*pwd)[4],
+                                 uint8_t (*pack)[2], uint32_t num);
+
+/**
+ * @brief      derive_password_ctx adapter
+ * @param[in]  *user pointer to an ntag21x kdf handle structure
+ * @param[in]  *uid pointer to a 7 bytes uid buffer
+ * @param[out] *pwd pointer to a 4 bytes password buffer
+ * @param[out] *pack pointer to a 2 bytes pack buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 derive failed
+ * @note       link with DRIVER_NTAG21X_LINK_DERIVE_PASSWORD_CTX and DRIVER_NTAG21X_LINK_USER
+ *             when the user context is free for the kdf handle
+ */
+uint8_t ntag21x_kdf_derive_password(void *user, uint8_t uid[7], uint8_t pwd[4], uint8_t pack[2]);
+
+/**
+ * @brief     write the derived password and pack to the selected tag
+ * @param[in] *handle pointer to an ntag21x kdf handle structure
+ * @param[in] *ntag pointer to an ntag21x handle structure
+ * @param[in] *uid pointer to a 7 bytes uid buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      calls ntag21x_set_password and ntag21x_set_pack
+ */
+uint8_t ntag21x_kdf_write_password(ntag21x_kdf_handle_t *handle, ntag21x_handle_t *ntag, uint8_t uid[7]);
+
+/**
+ * @brief     authenticate the selected tag with the derived password
+ * @param[in] *handle pointer to an ntag21x kdf handle structure
+ * @param[in] *ntag pointer to an ntag21x handle structure
+ * @param[in] *uid pointer to a 7 bytes uid buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 authenticate failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 pack check failed
+ * @note      calls ntag21x_authenticate
+ */
+uint8_t ntag21x_kdf_authenticate(ntag21x_kdf_handle_t *handle, ntag21x_handle_t *ntag, uint8_t uid[7]);
+
+/**
+ * @brief  check the primitives against the published test vectors
+ * @return status code
+ *         - 0 success
+ *         - 1 aes failed
+ *         - 2 aes-cmac failed
+ *         - 3 hmac-sha256 failed
+ *         - 4 batch differs from the single derivation
+ *         - 5 AN10922 diversification failed
+ * @note   fips-197 c.1, rfc 4493 examples 1, 2 and 3, rfc 4231 test cases 1, 2 and 6,
+ *         AN10922 2.2.1 aes-128 example
+ */
+uint8_t ntag21x_kdf_self_test(void);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
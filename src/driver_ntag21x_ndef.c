@@ -0,0 +1,991 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file      driver_ntag21x_ndef.c
+ * @brief     driver ntag21x ndef source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_ntag21x_ndef.h"
+
+/**
+ * @brief ndef capability container definition
+ */
+#define NTAG21X_NDEF_CC_MAGIC               0xE1        /**< ndef magic number */
+#define NTAG21X_NDEF_CC_VERSION             0x10        /**< mapping version 1.x */
+#define NTAG21X_NDEF_CC_PAGE                0x03        /**< capability container page */
+
+/**
+ * @brief ndef uri identifier code table
+ * @note  the index is the code written in front of the uri
+ */
+static const char *const gsc_ntag21x_ndef_uri_prefix[] =
+{
+    "", "http://www.", "https://www.", "http://", "https://", "tel:", "mailto:",
+    "ftp://anonymous:anonymous@", "ftp://ftp.", "ftps://", "sftp://", "smb://", "nfs://",
+    "ftp://", "dav://", "news:", "telnet://", "imap:", "rtsp://", "urn:", "pop:", "sip:",
+    "sips:", "tftp:", "btspp://", "btl2cap://", "btgoep://", "tcpobex://", "irdaobex://",
+    "file://", "urn:epc:id:", "urn:epc:tag:", "urn:epc:pat:", "urn:epc:raw:", "urn:epc:",
+    "urn:nfc:",
+};
+
+/**
+ * @brief      ndef encoder start a record
+ * @param[in]  *encoder pointer to an encoder structure
+ * @param[in]  tnf type name format
+ * @param[in]  *type pointer to a type buffer
+ * @param[in]  type_len type length
+ * @param[in]  *id pointer to an id buffer
+ * @param[in]  id_len id length
+ * @param[in]  payload_len payload length
+ * @param[out] **payload pointer to a payload address buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 buffer is full
+ *             - 2 encoder is NULL
+ *             - 3 encoder is finished
+ * @note       header, type and id are written, the payload space is reserved for the caller
+ */
+static uint8_t a_ntag21x_ndef_encoder_record(ntag21x_ndef_encoder_t *encoder, ntag21x_ndef_tnf_t tnf,
+                                             uint8_t *type, uint8_t type_len, uint8_t *id, uint8_t id_len,
+                                             uint16_t payload_len, uint8_t **payload)
+{
+    uint8_t header;
+    uint8_t *p;
+    uint32_t size;
+    
+    if (encoder == NULL)                                         /* check encoder */
+    {
+        return 2;                                                /* return error */
+    }
+    if (encoder->finished != 0)                                  /* check the state */
+    {
+        return 3;                                                /* return error */
+    }
+    
+    header = (uint8_t)(tnf & 0x07);                              /* set the tnf */
+    if (encoder->records == 0)                                   /* first record */
+    {
+        header |= NTAG21X_NDEF_RECORD_FLAG_MB;                   /* message begin */
+    }
+    if (payload_len < 256)                                       /* short record */
+    {
+        header |= NTAG21X_NDEF_RECORD_FLAG_SR;                   /* one byte payload length */
+    }
+    if (id_len != 0)                                             /* id present */
+    {
+        header |= NTAG21X_NDEF_RECORD_FLAG_IL;                   /* id length present */
+    }
+    size = 2 + (((header & NTAG21X_NDEF_RECORD_FLAG_SR) != 0) ? 1 : 4) + ((id_len != 0) ? 1 : 0) +
+           (uint32_t)type_len + id_len + payload_len;            /* record size */
+    if ((uint32_t)encoder->len + size + 1 > encoder->cap)        /* record and terminator */
+    {
+        return 1;                                                /* return error */
+    }
+    
+    p = encoder->buf + encoder->len;                             /* record start */
+    encoder->last = encoder->len;                                /* save the header offset */
+    *p++ = header;                                               /* header */
+    *p++ = type_len;                                             /* type length */
+    if ((header & NTAG21X_NDEF_RECORD_FLAG_SR) != 0)             /* short record */
+    {
+        *p++ = (uint8_t)payload_len;                             /* one byte payload length */
+    }
+    else
+    {
+        *p++ = 0x00;                                             /* payload length byte 3 */
+        *p++ = 0x00;                                             /* payload length byte 2 */
+        *p++ = (uint8_t)(payload_len >> 8);                      /* payload length byte 1 */
+        *p++ = (uint8_t)(payload_len >> 0);                      /* payload length byte 0 */
+    }
+    if (id_len != 0)                                             /* id present */
+    {
+        *p++ = id_len;                                           /* id length */
+    }
+    if (type_len != 0)                                           /* type present */
+    {
+        memcpy(p, type, type_len);                               /* type */
+        p += type_len;                                           /* skip the type */
+    }
+    if (id_len != 0)                                             /* id present */
+    {
+        memcpy(p, id, id_len);                                   /* id */
+        p += id_len;                                             /* skip the id */
+    }
+    *payload = p;                                                /* payload space */
+    encoder->len = (uint16_t)(encoder->len + size);              /* update the length */
+    encoder->records++;                                          /* one more record */
+    
+    return 0;                                                    /* success return 0 */
+}
+
+/**
+ * @brief      ndef read and check the capability container
+ * @param[in]  *handle pointer to an ntag21x handle structure
+ * @param[out] *buf pointer to a buffer that receives the first 12 bytes of the data area
+ * @param[out] *parser pointer to a parser structure
+ * @param[out] *size pointer to a data area size buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ *             - 4 capability container is invalid
+ * @note       page 3 brings the capability container and pages 4 to 6, the parser is
+ *             initialized over buf and the data area size
+ */
+static uint8_t a_ntag21x_ndef_read_cc(ntag21x_handle_t *handle, uint8_t *buf, ntag21x_ndef_parser_t *parser, uint16_t *size)
+{
+    uint8_t res;
+    uint8_t data[16];
+    
+    res = ntag21x_read_four_pages(handle, NTAG21X_NDEF_CC_PAGE, data);                 /* capability container and 12 bytes */
+    if (res != 0)                                                                      /* check the result */
+    {
+        NTAG21X_PRINT(handle, "ntag21x_ndef: read failed.\n");                         /* read failed */
+        
+        return 1;                                                                      /* return error */
+    }
+    if ((data[0] != NTAG21X_NDEF_CC_MAGIC) || ((data[1] & 0xF0) != NTAG21X_NDEF_CC_VERSION) ||
+        (data[2] == 0) || ((data[3] & 0xF0) != 0x00))                                  /* check the capability container */
+    {
+        NTAG21X_PRINT(handle, "ntag21x_ndef: capability container is invalid.\n");     /* capability container is invalid */
+        
+        return 4;                                                                      /* return error */
+    }
+    *size = (uint16_t)(data[2] * 8);                                                   /* data area size */
+    (void)ntag21x_ndef_parser_init(parser, buf, *size);                                /* init the parser */
+    memcpy(buf, data + 4, 12);                                                         /* pages 4 to 6 */
+    
+    return 0;                                                                          /* success return 0 */
+}
+
+/**
+ * @brief     ndef parser init
+ * @param[in] *parser pointer to a parser structure
+ * @param[in] *buf pointer to a buffer that receives the data area from page 4
+ * @param[in] size data area size
+ * @return    status code
+ *            - 0 success
+ *            - 2 parser is NULL
+ * @note      the data area size is 8 times the size byte of the capability container
+ */
+uint8_t ntag21x_ndef_parser_init(ntag21x_ndef_parser_t *parser, uint8_t *buf, uint16_t size)
+{
+    if ((parser == NULL) || (buf == NULL))                 /* check parser */
+    {
+        return 2;                                          /* return error */
+    }
+    
+    parser->buf = buf;                                     /* set the buffer */
+    parser->size = size;                                   /* set the data area size */
+    parser->len = 0;                                       /* nothing yet */
+    parser->offset = 0;                                    /* first tlv */
+    parser->message = 0;                                   /* no message */
+    parser->message_len = 0;                               /* no message */
+    parser->record = 0;                                    /* no record */
+    parser->need = 1;                                      /* the first tag byte */
+    parser->state = NTAG21X_NDEF_PARSER_STATE_MORE;        /* need data */
+    
+    return 0;                                              /* success return 0 */
+}
+
+/**
+ * @brief     ndef parser init over a bare ndef message
+ * @param[in] *parser pointer to a parser structure
+ * @param[in] *buf pointer to a message buffer
+ * @param[in] len message length
+ * @return    status code
+ *            - 0 success
+ *            - 2 parser is NULL
+ * @note      used for the message returned by ntag21x_read_ndef
+ */
+uint8_t ntag21x_ndef_parser_init_message(ntag21x_ndef_parser_t *parser, uint8_t *buf, uint16_t len)
+{
+    if ((parser == NULL) || (buf == NULL))                    /* check parser */
+    {
+        return 2;                                             /* return error */
+    }
+    
+    parser->buf = buf;                                        /* set the buffer */
+    parser->size = len;                                       /* the message only */
+    parser->len = len;                                        /* all available */
+    parser->offset = len;                                     /* no tlv */
+    parser->message = 0;                                      /* message at the start */
+    parser->message_len = len;                                /* message length */
+    parser->record = 0;                                       /* first record */
+    parser->need = len;                                       /* nothing more */
+    parser->state = NTAG21X_NDEF_PARSER_STATE_MESSAGE;        /* message complete */
+    
+    return 0;                                                 /* success return 0 */
+}
+
+/**
+ * @brief      ndef parser feed more data
+ * @param[in]  *parser pointer to a parser structure
+ * @param[in]  len bytes now available in the buffer
+ * @param[out] *state pointer to a state buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 tlv is invalid
+ *             - 2 parser is NULL
+ *             - 3 len is invalid
+ * @note       len counts from the start of the buffer and never goes down, so the buffer can be
+ *             filled frame by frame while it is parsed, the first ndef message tlv is used
+ */
+uint8_t ntag21x_ndef_parser_feed(ntag21x_ndef_parser_t *parser, uint16_t len, ntag21x_ndef_parser_state_t *state)
+{
+    uint8_t tag;
+    uint8_t head;
+    uint32_t value_len;
+    
+    if (parser == NULL)                                                                                 /* check parser */
+    {
+        return 2;                                                                                       /* return error */
+    }
+    if (len < parser->len)                                                                              /* check the length */
+    {
+        return 3;                                                                                       /* return error */
+    }
+    
+    if ((parser->size != 0) && (len > parser->size))                                                    /* only the data area */
+    {
+        len = parser->size;                                                                             /* clamp to the data area */
+    }
+    parser->len = len;                                                                                  /* save the length */
+    while (parser->state == NTAG21X_NDEF_PARSER_STATE_MORE)                                             /* walk the tlvs */
+    {
+        if ((parser->size != 0) && (parser->offset >= parser->size))                                    /* end of the data area */
+        {
+            parser->state = NTAG21X_NDEF_PARSER_STATE_END;                                              /* no message */
+            
+            break;                                                                                      /* break */
+        }
+        if (parser->offset >= len)                                                                      /* wait for the tag byte */
+        {
+            parser->need = (uint16_t)(parser->offset + 1);                                              /* the tag byte */
+            break;                                                                                      /* break */
+        }
+        tag = parser->buf[parser->offset];                                                              /* get the tag */
+        if (tag == NTAG21X_NDEF_TLV_NULL)                                                               /* null tlv */
+        {
+            parser->offset++;                                                                           /* skip */
+            
+            continue;                                                                                   /* next tlv */
+        }
+        if (tag == NTAG21X_NDEF_TLV_TERMINATOR)                                                         /* terminator tlv */
+        {
+            parser->state = NTAG21X_NDEF_PARSER_STATE_END;                                              /* no message */
+            
+            break;                                                                                      /* break */
+        }
+        if ((uint32_t)parser->offset + 2 > len)                                                         /* wait for the length */
+        {
+            parser->need = (uint16_t)(parser->offset + 2);                                              /* tag and length */
+            break;                                                                                      /* break */
+        }
+        value_len = parser->buf[parser->offset + 1];                                                    /* one byte length */
+        head = 2;                                                                                       /* tag and length */
+        if (value_len == 0xFF)                                                                          /* three bytes length */
+        {
+            if ((uint32_t)parser->offset + 4 > len)                                                     /* wait for the length */
+            {
+                parser->need = (uint16_t)(parser->offset + 4);                                          /* tag and three bytes length */
+                break;                                                                                  /* break */
+            }
+            value_len = ((uint32_t)parser->buf[parser->offset + 2] << 8) |
+                        parser->buf[parser->offset + 3];                                                /* big endian length */
+            head = 4;                                                                                   /* tag and three bytes length */
+        }
+        if ((parser->size != 0) && ((uint32_t)parser->offset + head + value_len > parser->size))        /* check the data area */
+        {
+            return 1;                                                                                   /* return error */
+        }
+        if (tag == NTAG21X_NDEF_TLV_MESSAGE)                                                            /* ndef message */
+        {
+            if ((uint32_t)parser->offset + head + value_len > len)                                      /* wait for the whole message */
+            {
+                parser->need = (uint16_t)(parser->offset + head + value_len);                           /* the whole message */
+                break;                                                                                  /* break */
+            }
+            parser->message = (uint16_t)(parser->offset + head);                                        /* set the message */
+            parser->message_len = (uint16_t)value_len;                                                  /* set the message length */
+            parser->record = parser->message;                                                           /* first record */
+            parser->offset = (uint16_t)(parser->message + value_len);                                   /* next tlv */
+            parser->state = NTAG21X_NDEF_PARSER_STATE_MESSAGE;                                          /* message complete */
+            
+            break;                                                                                      /* break */
+        }
+        parser->offset = (uint16_t)(parser->offset + head + value_len);                                 /* skip the control tlv */
+    }
+    if (parser->state != NTAG21X_NDEF_PARSER_STATE_MORE)                                                /* nothing more needed */
+    {
+        parser->need = parser->len;                                                                     /* done */
+    }
+    if (state != NULL)                                                                                  /* check the state */
+    {
+        *state = (ntag21x_ndef_parser_state_t)parser->state;                                            /* set the state */
+    }
+    
+    return 0;                                                                                           /* success return 0 */
+}
+
+/**
+ * @brief      ndef parser get the next record
+ * @param[in]  *parser pointer to a parser structure
+ * @param[out] *record pointer to a record structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 no more records
+ *             - 2 parser is NULL
+ *             - 3 message is not complete
+ *             - 4 record is invalid
+ * @note       the spans point into the parser buffer, nothing is copied
+ */
+uint8_t ntag21x_ndef_parser_next_record(ntag21x_ndef_parser_t *parser, ntag21x_ndef_record_t *record)
+{
+    uint8_t header;
+    uint32_t pos;
+    uint32_t end;
+    
+    if ((parser == NULL) || (record == NULL))                                                      /* check parser */
+    {
+        return 2;                                                                                  /* return error */
+    }
+    if (parser->state != NTAG21X_NDEF_PARSER_STATE_MESSAGE)                                        /* check the message */
+    {
+        return 3;                                                                                  /* return error */
+    }
+    
+    pos = parser->record;                                                                          /* record start */
+    end = (uint32_t)parser->message + parser->message_len;                                         /* message end */
+    if (pos >= end)                                                                                /* check the end */
+    {
+        return 1;                                                                                  /* no more records */
+    }
+    if (pos + 3 > end)                                                                             /* header, type length and one payload length byte */
+    {
+        return 4;                                                                                  /* return error */
+    }
+    header = parser->buf[pos];                                                                     /* get the header */
+    record->flags = header & 0xF8;                                                                 /* set the flags */
+    record->tnf = (ntag21x_ndef_tnf_t)(header & 0x07);                                             /* set the tnf */
+    record->type_len = parser->buf[pos + 1];                                                       /* set the type length */
+    pos += 2;                                                                                      /* payload length */
+    if ((header & NTAG21X_NDEF_RECORD_FLAG_SR) != 0)                                               /* short record */
+    {
+        record->payload_len = parser->buf[pos];                                                    /* one byte length */
+        pos += 1;                                                                                  /* skip the length */
+    }
+    else
+    {
+        if (pos + 4 > end)                                                                         /* check the length */
+        {
+            return 4;                                                                              /* return error */
+        }
+        record->payload_len = ((uint32_t)parser->buf[pos] << 24) | ((uint32_t)parser->buf[pos + 1] << 16) |
+                              ((uint32_t)parser->buf[pos + 2] << 8) | parser->buf[pos + 3];        /* big endian length */
+        pos += 4;                                                                                  /* skip the length */
+    }
+    record->id_len = 0;                                                                            /* no id */
+    if ((header & NTAG21X_NDEF_RECORD_FLAG_IL) != 0)                                               /* id length present */
+    {
+        if (pos + 1 > end)                                                                         /* check the length */
+        {
+            return 4;                                                                              /* return error */
+        }
+        record->id_len = parser->buf[pos];                                                         /* set the id length */
+        pos += 1;                                                                                  /* skip the length */
+    }
+    if ((uint64_t)pos + record->type_len + record->id_len + record->payload_len > end)             /* check the spans */
+    {
+        return 4;                                                                                  /* return error */
+    }
+    record->type = parser->buf + pos;                                                              /* type span */
+    pos += record->type_len;                                                                       /* skip the type */
+    record->id = parser->buf + pos;                                                                /* id span */
+    pos += record->id_len;                                                                         /* skip the id */
+    record->payload = parser->buf + pos;                                                           /* payload span */
+    pos += record->payload_len;                                                                    /* skip the payload */
+    if ((header & NTAG21X_NDEF_RECORD_FLAG_ME) != 0)                                               /* last record */
+    {
+        pos = end;                                                                                 /* ignore the rest */
+    }
+    parser->record = (uint16_t)pos;                                                                /* next record */
+    
+    return 0;                                                                                      /* success return 0 */
+}
+
+/**
+ * @brief         ndef scan the tag
+ * @param[in]     *handle pointer to an ntag21x handle structure
+ * @param[out]    *buf pointer to a buffer that receives the data area
+ * @param[in]     cap buffer size
+ * @param[out]    *parser pointer to a parser structure
+ * @return        status code
+ *                - 0 success
+ *                - 1 read failed
+ *                - 2 handle is NULL
+ *                - 3 handle is not initialized
+ *                - 4 capability container is invalid
+ *                - 5 buf is invalid or cap is too small
+ *                - 6 tlv is invalid
+ * @note          12 <= cap, the data area is read frame by frame and parsed while it arrives,
+ *                reading stops as soon as the ndef message or the terminator tlv is complete,
+ *                the records are then taken with ntag21x_ndef_parser_next_record
+ */
+uint8_t ntag21x_ndef_scan(ntag21x_handle_t *handle, uint8_t *buf, uint16_t cap, ntag21x_ndef_parser_t *parser)
+{
+    uint8_t res;
+    uint8_t frame_len;
+    uint8_t chunk;
+    uint8_t pages;
+    uint16_t page;
+    uint16_t last_page;
+    uint16_t size;
+    uint16_t got;
+    uint16_t len;
+    ntag21x_ndef_parser_state_t state;
+    
+    if (handle == NULL)                                                                                        /* check handle */
+    {
+        return 2;                                                                                              /* return error */
+    }
+    if (handle->inited != 1)                                                                                   /* check handle initialization */
+    {
+        return 3;                                                                                              /* return error */
+    }
+    if ((buf == NULL) || (parser == NULL) || (cap < 12))                                                       /* check the buffer */
+    {
+        NTAG21X_PRINT(handle, "ntag21x_ndef: buf is invalid.\n");                                              /* buf is invalid */
+        
+        return 5;                                                                                              /* return error */
+    }
+    
+    res = a_ntag21x_ndef_read_cc(handle, buf, parser, &size);                                                  /* capability container and 12 bytes */
+    if (res != 0)                                                                                              /* check the result */
+    {
+        return res;                                                                                            /* return error */
+    }
+    got = 12;                                                                                                  /* bytes read */
+    if (ntag21x_ndef_parser_feed(parser, got, &state) != 0)                                                    /* parse the first bytes */
+    {
+        NTAG21X_PRINT(handle, "ntag21x_ndef: tlv is invalid.\n");                                              /* tlv is invalid */
+        
+        return 6;                                                                                              /* return error */
+    }
+    
+    (void)ntag21x_get_max_frame_length(handle, &frame_len);                                                    /* get the max frame length */
+    chunk = (uint8_t)((frame_len - 2) / 4);                                                                    /* pages per frame */
+    if (chunk > 15)                                                                                            /* fast read limit */
+    {
+        chunk = 15;                                                                                            /* 15 pages */
+    }
+    last_page = (uint16_t)(NTAG21X_NDEF_START_PAGE + (size + 3) / 4 - 1);                                      /* last page of the data area */
+    page = NTAG21X_NDEF_START_PAGE + 3;                                                                        /* next page */
+    while ((state == NTAG21X_NDEF_PARSER_STATE_MORE) && (page <= last_page))                                   /* until the message or the terminator */
+    {
+        pages = chunk;                                                                                         /* one frame */
+        if (page + pages - 1 > last_page)                                                                      /* check the data area */
+        {
+            pages = (uint8_t)(last_page - page + 1);                                                           /* pages left */
+        }
+        if (got + 4 * pages > cap)                                                                             /* check the buffer */
+        {
+            pages = (uint8_t)((cap - got) / 4);                                                                /* pages that fit */
+            if (pages == 0)                                                                                    /* buffer full */
+            {
+                NTAG21X_PRINT(handle, "ntag21x_ndef: cap is too small.\n");                                    /* cap is too small */
+                
+                return 5;                                                                                      /* return error */
+            }
+        }
+        len = (uint16_t)(cap - got);                                                                           /* space left */
+        res = ntag21x_dump_memory(handle, (uint8_t)page, (uint8_t)(page + pages - 1), buf + got, &len);        /* read one frame */
+        if (res != 0)                                                                                          /* check the result */
+        {
+            NTAG21X_PRINT(handle, "ntag21x_ndef: read failed.\n");                                             /* read failed */
+            
+            return 1;                                                                                          /* return error */
+        }
+        got = (uint16_t)(got + 4 * pages);                                                                     /* bytes read */
+        page = (uint16_t)(page + pages);                                                                       /* next page */
+        if (ntag21x_ndef_parser_feed(parser, got, &state) != 0)                                                /* parse the new bytes */
+        {
+            NTAG21X_PRINT(handle, "ntag21x_ndef: tlv is invalid.\n");                                          /* tlv is invalid */
+            
+            return 6;                                                                                          /* return error */
+        }
+    }
+    if (state == NTAG21X_NDEF_PARSER_STATE_MORE)                                                               /* data area ended inside a tlv */
+    {
+        NTAG21X_PRINT(handle, "ntag21x_ndef: tlv is invalid.\n");                                              /* tlv is invalid */
+        
+        return 6;                                                                                              /* return error */
+    }
+    
+    return 0;                                                                                                  /* success return 0 */
+}
+
+/**
+ * @brief         ndef read the message
+ * @param[in]     *handle pointer to an ntag21x handle structure
+ * @param[out]    *buf pointer to a buffer that receives the ndef message
+ * @param[in]     cap buffer size
+ * @param[out]    *len pointer to a message length buffer
+ * @return        status code
+ *                - 0 success
+ *                - 1 read failed
+ *                - 2 handle is NULL
+ *                - 3 handle is not initialized
+ *                - 4 capability container is invalid
+ *                - 5 buf is invalid or cap is too small
+ *                - 6 tlv is invalid
+ *                - 7 no ndef message
+ * @note          12 <= cap, the tlvs in front of the message are read into buf as well,
+ *                page 3 brings the capability container and the first 12 bytes, then only the
+ *                pages declared by the tlv lengths are fast read, so the cost follows the
+ *                message size and not the tag size, parse the result with
+ *                ntag21x_ndef_parser_init_message
+ */
+uint8_t ntag21x_read_ndef(ntag21x_handle_t *handle, uint8_t *buf, uint16_t cap, uint16_t *len)
+{
+    uint8_t res;
+    uint16_t size;
+    uint16_t got;
+    uint16_t page;
+    uint16_t last_page;
+    uint16_t space;
+    ntag21x_ndef_parser_t parser;
+    ntag21x_ndef_parser_state_t state;
+    
+    if (handle == NULL)                                                                                                  /* check handle */
+    {
+        return 2;                                                                                                        /* return error */
+    }
+    if (handle->inited != 1)                                                                                             /* check handle initialization */
+    {
+        return 3;                                                                                                        /* return error */
+    }
+    if ((buf == NULL) || (len == NULL) || (cap < 12))                                                                    /* check the buffer */
+    {
+        NTAG21X_PRINT(handle, "ntag21x_ndef: buf is invalid.\n");                                                        /* buf is invalid */
+        
+        return 5;                                                                                                        /* return error */
+    }
+    
+    res = a_ntag21x_ndef_read_cc(handle, buf, &parser, &size);                                                           /* capability container and 12 bytes */
+    if (res != 0)                                                                                                        /* check the result */
+    {
+        return res;                                                                                                      /* return error */
+    }
+    got = 12;                                                                                                            /* bytes read */
+    last_page = (uint16_t)(NTAG21X_NDEF_START_PAGE + (size + 3) / 4 - 1);                                                /* last page of the data area */
+    while (1)                                                                                                            /* read what the tlvs declare */
+    {
+        if (ntag21x_ndef_parser_feed(&parser, got, &state) != 0)                                                         /* parse */
+        {
+            NTAG21X_PRINT(handle, "ntag21x_ndef: tlv is invalid.\n");                                                    /* tlv is invalid */
+            
+            return 6;                                                                                                    /* return error */
+        }
+        if (state != NTAG21X_NDEF_PARSER_STATE_MORE)                                                                     /* message or terminator */
+        {
+            break;                                                                                                       /* break */
+        }
+        page = (uint16_t)(NTAG21X_NDEF_START_PAGE + got / 4);                                                            /* next page */
+        if (page > last_page)                                                                                            /* data area ended inside a tlv */
+        {
+            NTAG21X_PRINT(handle, "ntag21x_ndef: tlv is invalid.\n");                                                    /* tlv is invalid */
+            
+            return 6;                                                                                                    /* return error */
+        }
+        if ((uint32_t)(parser.need + 3) / 4 * 4 > cap)                                                                   /* check the buffer */
+        {
+            NTAG21X_PRINT(handle, "ntag21x_ndef: cap is too small.\n");                                                  /* cap is too small */
+            
+            return 5;                                                                                                    /* return error */
+        }
+        space = (uint16_t)(cap - got);                                                                                   /* space left */
+        res = ntag21x_dump_memory(handle, (uint8_t)page,
+                                  (uint8_t)(NTAG21X_NDEF_START_PAGE + (parser.need - 1) / 4), buf + got, &space);        /* read the declared pages */
+        if (res != 0)                                                                                                    /* check the result */
+        {
+            NTAG21X_PRINT(handle, "ntag21x_ndef: read failed.\n");                                                       /* read failed */
+            
+            return 1;                                                                                                    /* return error */
+        }
+        got = (uint16_t)((parser.need + 3) / 4 * 4);                                                                     /* whole pages read */
+    }
+    if (state != NTAG21X_NDEF_PARSER_STATE_MESSAGE)                                                                      /* terminator first */
+    {
+        NTAG21X_PRINT(handle, "ntag21x_ndef: no ndef message.\n");                                                       /* no ndef message */
+        
+        return 7;                                                                                                        /* return error */
+    }
+    memmove(buf, buf + parser.message, parser.message_len);                                                              /* message to the front */
+    *len = parser.message_len;                                                                                           /* set the length */
+    
+    return 0;                                                                                                            /* success return 0 */
+}
+
+/**
+ * @brief      ndef get the data area size
+ * @param[in]  container capability container
+ * @param[out] *size pointer to a size buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 container is invalid
+ * @note       the size of the image buffer that covers the whole data area
+ */
+uint8_t ntag21x_ndef_get_data_area_size(ntag21x_capability_container_t container, uint16_t *size)
+{
+    if (container == NTAG21X_CAPABILITY_CONTAINER_144_BYTE_NTAG213)             /* ntag213 */
+    {
+        *size = 144;                                                            /* 144 bytes */
+    }
+    else if (container == NTAG21X_CAPABILITY_CONTAINER_496_BYTE_NTAG215)        /* ntag215 */
+    {
+        *size = 496;                                                            /* 496 bytes */
+    }
+    else if (container == NTAG21X_CAPABILITY_CONTAINER_872_BYTE_NTAG216)        /* ntag216 */
+    {
+        *size = 872;                                                            /* 872 bytes */
+    }
+    else
+    {
+        return 1;                                                               /* return error */
+    }
+    
+    return 0;                                                                   /* success return 0 */
+}
+
+/**
+ * @brief     ndef encoder init
+ * @param[in] *encoder pointer to an encoder structure
+ * @param[in] *buf pointer to an image buffer
+ * @param[in] cap image buffer size
+ * @return    status code
+ *            - 0 success
+ *            - 1 cap is invalid
+ *            - 2 encoder is NULL
+ * @note      4 <= cap <= 0xFFFC and cap is a whole number of pages, records are built in place
+ *            right behind the tlv header, a three bytes tlv length is reserved when the message
+ *            may be over 254 bytes
+ */
+uint8_t ntag21x_ndef_encoder_init(ntag21x_ndef_encoder_t *encoder, uint8_t *buf, uint16_t cap)
+{
+    if ((encoder == NULL) || (buf == NULL))                     /* check encoder */
+    {
+        return 2;                                               /* return error */
+    }
+    if ((cap < 4) || (cap > 0xFFFC) || ((cap % 4) != 0))        /* check the cap */
+    {
+        return 1;                                               /* return error */
+    }
+    
+    encoder->buf = buf;                                         /* set the buffer */
+    encoder->cap = cap;                                         /* set the cap */
+    encoder->message = (cap - 3 > 254) ? 4 : 2;                 /* tlv header size */
+    encoder->len = encoder->message;                            /* records start here */
+    encoder->last = 0;                                          /* no record */
+    encoder->records = 0;                                       /* no record */
+    encoder->finished = 0;                                      /* not finished */
+    buf[0] = NTAG21X_NDEF_TLV_MESSAGE;                          /* ndef message tlv */
+    
+    return 0;                                                   /* success return 0 */
+}
+
+/**
+ * @brief     ndef encoder add a record
+ * @param[in] *encoder pointer to an encoder structure
+ * @param[in] tnf type name format
+ * @param[in] *type pointer to a type buffer
+ * @param[in] type_len type length
+ * @param[in] *id pointer to an id buffer
+ * @param[in] id_len id length
+ * @param[in] *payload pointer to a payload buffer
+ * @param[in] payload_len payload length
+ * @return    status code
+ *            - 0 success
+ *            - 1 buffer is full
+ *            - 2 encoder is NULL
+ *            - 3 encoder is finished
+ * @note      a short record is used when the payload is under 256 bytes, payload may be NULL
+ *            to reserve payload_len bytes that the caller fills later
+ */
+uint8_t ntag21x_ndef_encoder_add_record(ntag21x_ndef_encoder_t *encoder, ntag21x_ndef_tnf_t tnf,
+                                        uint8_t *type, uint8_t type_len, uint8_t *id, uint8_t id_len,
+                                        uint8_t *payload, uint16_t payload_len)
+{
+    uint8_t res;
+    uint8_t *p;
+    
+    res = a_ntag21x_ndef_encoder_record(encoder, tnf, type, type_len, id, id_len, payload_len, &p);        /* start the record */
+    if (res != 0)                                                                                          /* check the result */
+    {
+        return res;                                                                                        /* return error */
+    }
+    if ((payload != NULL) && (payload_len != 0))                                                           /* check the payload */
+    {
+        memcpy(p, payload, payload_len);                                                                   /* payload */
+    }
+    
+    return 0;                                                                                              /* success return 0 */
+}
+
+/**
+ * @brief     ndef encoder add a uri record
+ * @param[in] *encoder pointer to an encoder structure
+ * @param[in] *uri pointer to a uri string
+ * @return    status code
+ *            - 0 success
+ *            - 1 buffer is full
+ *            - 2 encoder is NULL
+ *            - 3 encoder is finished
+ * @note      the longest matching uri identifier code replaces the prefix
+ */
+uint8_t ntag21x_ndef_encoder_add_uri(ntag21x_ndef_encoder_t *encoder, char *uri)
+{
+    uint8_t res;
+    uint8_t i;
+    uint8_t code;
+    uint8_t *p;
+    size_t prefix_len;
+    size_t len;
+    size_t n;
+    
+    if (uri == NULL)                                                                                          /* check the uri */
+    {
+        return 2;                                                                                             /* return error */
+    }
+    
+    len = strlen(uri);                                                                                        /* uri length */
+    code = 0;                                                                                                 /* no abbreviation */
+    prefix_len = 0;                                                                                           /* no prefix */
+    for (i = 1; i < sizeof(gsc_ntag21x_ndef_uri_prefix) / sizeof(gsc_ntag21x_ndef_uri_prefix[0]); i++)        /* all codes */
+    {
+        n = strlen(gsc_ntag21x_ndef_uri_prefix[i]);                                                           /* prefix length */
+        if ((n > prefix_len) && (n <= len) && (strncmp(uri, gsc_ntag21x_ndef_uri_prefix[i], n) == 0))         /* longer match */
+        {
+            code = i;                                                                                         /* save the code */
+            prefix_len = n;                                                                                   /* save the length */
+        }
+    }
+    if (len - prefix_len + 1 > 0xFFFF)                                                                        /* check the length */
+    {
+        return 1;                                                                                             /* return error */
+    }
+    res = a_ntag21x_ndef_encoder_record(encoder, NTAG21X_NDEF_TNF_WELL_KNOWN, (uint8_t *)"U", 1, NULL, 0,
+                                        (uint16_t)(len - prefix_len + 1), &p);                                /* start the record */
+    if (res != 0)                                                                                             /* check the result */
+    {
+        return res;                                                                                           /* return error */
+    }
+    p[0] = code;                                                                                              /* identifier code */
+    memcpy(p + 1, uri + prefix_len, len - prefix_len);                                                        /* rest of the uri */
+    
+    return 0;                                                                                                 /* success return 0 */
+}
+
+/**
+ * @brief     ndef encoder add a text record
+ * @param[in] *encoder pointer to an encoder structure
+ * @param[in] *lang pointer to a language code string
+ * @param[in] *text pointer to an utf-8 text string
+ * @return    status code
+ *            - 0 success
+ *            - 1 buffer is full
+ *            - 2 encoder is NULL
+ *            - 3 encoder is finished
+ *            - 4 lang is invalid
+ * @note      1 <= strlen(lang) <= 63
+ */
+uint8_t ntag21x_ndef_encoder_add_text(ntag21x_ndef_encoder_t *encoder, char *lang, char *text)
+{
+    uint8_t res;
+    uint8_t *p;
+    size_t lang_len;
+    size_t text_len;
+    
+    if ((lang == NULL) || (text == NULL))                                                /* check the strings */
+    {
+        return 2;                                                                        /* return error */
+    }
+    lang_len = strlen(lang);                                                             /* language length */
+    if ((lang_len == 0) || (lang_len > 63))                                              /* check the language */
+    {
+        return 4;                                                                        /* return error */
+    }
+    
+    text_len = strlen(text);                                                             /* text length */
+    if (1 + lang_len + text_len > 0xFFFF)                                                /* check the length */
+    {
+        return 1;                                                                        /* return error */
+    }
+    res = a_ntag21x_ndef_encoder_record(encoder, NTAG21X_NDEF_TNF_WELL_KNOWN, (uint8_t *)"T", 1, NULL, 0,
+                                        (uint16_t)(1 + lang_len + text_len), &p);        /* start the record */
+    if (res != 0)                                                                        /* check the result */
+    {
+        return res;                                                                      /* return error */
+    }
+    p[0] = (uint8_t)lang_len;                                                            /* utf-8 and the language length */
+    memcpy(p + 1, lang, lang_len);                                                       /* language */
+    memcpy(p + 1 + lang_len, text, text_len);                                            /* text */
+    
+    return 0;                                                                            /* success return 0 */
+}
+
+/**
+ * @brief     ndef encoder add a mime record
+ * @param[in] *encoder pointer to an encoder structure
+ * @param[in] *mime pointer to a mime type string
+ * @param[in] *data pointer to a data buffer
+ * @param[in] len data length
+ * @return    status code
+ *            - 0 success
+ *            - 1 buffer is full
+ *            - 2 encoder is NULL
+ *            - 3 encoder is finished
+ *            - 4 mime is invalid
+ * @note      1 <= strlen(mime) <= 255
+ */
+uint8_t ntag21x_ndef_encoder_add_mime(ntag21x_ndef_encoder_t *encoder, char *mime, uint8_t *data, uint16_t len)
+{
+    size_t type_len;
+    
+    if (mime == NULL)                                                  /* check the mime */
+    {
+        return 2;                                                      /* return error */
+    }
+    type_len = strlen(mime);                                           /* type length */
+    if ((type_len == 0) || (type_len > 255))                           /* check the type */
+    {
+        return 4;                                                      /* return error */
+    }
+    
+    return ntag21x_ndef_encoder_add_record(encoder, NTAG21X_NDEF_TNF_MEDIA, (uint8_t *)mime, (uint8_t)type_len,
+                                           NULL, 0, data, len);        /* add the record */
+}
+
+/**
+ * @brief     ndef encoder add an external record
+ * @param[in] *encoder pointer to an encoder structure
+ * @param[in] *type pointer to a "domain:type" string
+ * @param[in] *data pointer to a data buffer
+ * @param[in] len data length
+ * @return    status code
+ *            - 0 success
+ *            - 1 buffer is full
+ *            - 2 encoder is NULL
+ *            - 3 encoder is finished
+ *            - 4 type is invalid
+ * @note      1 <= strlen(type) <= 255
+ */
+uint8_t ntag21x_ndef_encoder_add_external(ntag21x_ndef_encoder_t *encoder, char *type, uint8_t *data, uint16_t len)
+{
+    size_t type_len;
+    
+    if (type == NULL)                                                  /* check the type */
+    {
+        return 2;                                                      /* return error */
+    }
+    type_len = strlen(type);                                           /* type length */
+    if ((type_len == 0) || (type_len > 255))                           /* check the type */
+    {
+        return 4;                                                      /* return error */
+    }
+    
+    return ntag21x_ndef_encoder_add_record(encoder, NTAG21X_NDEF_TNF_EXTERNAL, (uint8_t *)type, (uint8_t)type_len,
+                                           NULL, 0, data, len);        /* add the record */
+}
+
+/**
+ * @brief      ndef encoder finish the image
+ * @param[in]  *encoder pointer to an encoder structure
+ * @param[out] *len pointer to an image length buffer
+ * @param[out] *pages pointer to a page number buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 buffer is full
+ *             - 2 encoder is NULL
+ *             - 3 encoder is finished
+ * @note       sets the message end flag, writes the tlv length and the terminator and pads
+ *             the image with zeros to a whole page, the image is then written from page 4
+ *             with ntag21x_write_image
+ */
+uint8_t ntag21x_ndef_encoder_finish(ntag21x_ndef_encoder_t *encoder, uint16_t *len, uint16_t *pages)
+{
+    uint16_t message_len;
+    
+    if ((encoder == NULL) || (len == NULL) || (pages == NULL))                /* check encoder */
+    {
+        return 2;                                                             /* return error */
+    }
+    if (encoder->finished != 0)                                               /* check the state */
+    {
+        return 3;                                                             /* return error */
+    }
+    if (encoder->len + 1 > encoder->cap)                                      /* terminator */
+    {
+        return 1;                                                             /* return error */
+    }
+    
+    if (encoder->records != 0)                                                /* check the records */
+    {
+        encoder->buf[encoder->last] |= NTAG21X_NDEF_RECORD_FLAG_ME;           /* message end */
+    }
+    message_len = (uint16_t)(encoder->len - encoder->message);                /* message length */
+    if ((encoder->message == 4) && (message_len < 0xFF))                      /* short enough for one byte */
+    {
+        memmove(encoder->buf + 2, encoder->buf + 4, message_len);             /* drop the reserved bytes */
+        encoder->message = 2;                                                 /* one byte length */
+        encoder->len = (uint16_t)(encoder->len - 2);                          /* update the length */
+    }
+    if (encoder->message == 4)                                                /* three bytes length */
+    {
+        encoder->buf[1] = 0xFF;                                               /* three bytes format */
+        encoder->buf[2] = (uint8_t)(message_len >> 8);                        /* length msb */
+        encoder->buf[3] = (uint8_t)(message_len >> 0);                        /* length lsb */
+    }
+    else
+    {
+        encoder->buf[1] = (uint8_t)message_len;                               /* one byte length */
+    }
+    encoder->buf[encoder->len++] = NTAG21X_NDEF_TLV_TERMINATOR;               /* terminator */
+    while ((encoder->len % 4) != 0)                                           /* pad to a whole page, the cap is page aligned */
+    {
+        encoder->buf[encoder->len++] = 0x00;                                  /* padding */
+    }
+    encoder->finished = 1;                                                    /* finished */
+    *len = encoder->len;                                                      /* image length */
+    *pages = (uint16_t)(encoder->len / 4);                                    /* page number */
+    
+    return 0;                                                                 /* success return 0 */
+}
@@ -0,0 +1,375 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file      driver_ntag21x_ndef.h
+ * @brief     driver ntag21x ndef header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_NTAG21X_NDEF_H
+#define DRIVER_NTAG21X_NDEF_H
+
+#include "driver_ntag21x.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup ntag21x_ndef_driver ntag21x ndef driver function
+ * @brief    ntag21x ndef driver modules
+ * @ingroup  ntag21x_driver
+ * @{
+ */
+
+/**
+ * @brief ntag21x ndef tlv definition
+ */
+#define NTAG21X_NDEF_TLV_NULL                  0x00        /**< null tlv */
+#define NTAG21X_NDEF_TLV_LOCK_CONTROL          0x01        /**< lock control tlv */
+#define NTAG21X_NDEF_TLV_MEMORY_CONTROL        0x02        /**< memory control tlv */
+#define NTAG21X_NDEF_TLV_MESSAGE               0x03        /**< ndef message tlv */
+#define NTAG21X_NDEF_TLV_PROPRIETARY           0xFD        /**< proprietary tlv */
+#define NTAG21X_NDEF_TLV_TERMINATOR            0xFE        /**< terminator tlv */
+
+/**
+ * @brief ntag21x ndef record header flag definition
+ */
+#define NTAG21X_NDEF_RECORD_FLAG_MB            0x80        /**< message begin */
+#define NTAG21X_NDEF_RECORD_FLAG_ME            0x40        /**< message end */
+#define NTAG21X_NDEF_RECORD_FLAG_CF            0x20        /**< chunk flag */
+#define NTAG21X_NDEF_RECORD_FLAG_SR            0x10        /**< short record */
+#define NTAG21X_NDEF_RECORD_FLAG_IL            0x08        /**< id length present */
+
+/**
+ * @brief ntag21x ndef data area start page definition
+ */
+#define NTAG21X_NDEF_START_PAGE                0x04        /**< first page of the data area */
+
+/**
+ * @brief ntag21x ndef tnf enumeration definition
+ */
+typedef enum
+{
+    NTAG21X_NDEF_TNF_EMPTY      = 0x00,        /**< empty */
+    NTAG21X_NDEF_TNF_WELL_KNOWN = 0x01,        /**< nfc forum well known type */
+    NTAG21X_NDEF_TNF_MEDIA      = 0x02,        /**< media type */
+    NTAG21X_NDEF_TNF_URI        = 0x03,        /**< absolute uri */
+    NTAG21X_NDEF_TNF_EXTERNAL   = 0x04,        /**< nfc forum external type */
+    NTAG21X_NDEF_TNF_UNKNOWN    = 0x05,        /**< unknown */
+    NTAG21X_NDEF_TNF_UNCHANGED  = 0x06,        /**< unchanged, middle and last chunks */
+} ntag21x_ndef_tnf_t;
+
+/**
+ * @brief ntag21x ndef parser state enumeration definition
+ */
+typedef enum
+{
+    NTAG21X_NDEF_PARSER_STATE_MORE    = 0x00,        /**< more data is needed */
+    NTAG21X_NDEF_PARSER_STATE_MESSAGE = 0x01,        /**< the ndef message is complete */
+    NTAG21X_NDEF_PARSER_STATE_END     = 0x02,        /**< terminator or end of the data area without a message */
+} ntag21x_ndef_parser_state_t;
+
+/**
+ * @brief ntag21x ndef parser structure definition
+ */
+typedef struct ntag21x_ndef_parser_s
+{
+    uint8_t *buf;                 /**< data area starting at page 4 */
+    uint16_t size;                /**< data area size */
+    uint16_t len;                 /**< bytes available in buf */
+    uint16_t offset;              /**< next tlv */
+    uint16_t message;             /**< ndef message offset */
+    uint16_t message_len;         /**< ndef message length */
+    uint16_t record;              /**< next record offset */
+    uint16_t need;                /**< bytes needed before the parser can go on */
+    uint8_t state;                /**< parser state */
+} ntag21x_ndef_parser_t;
+
+/**
+ * @brief ntag21x ndef record structure definition
+ */
+typedef struct ntag21x_ndef_record_s
+{
+    uint8_t flags;                /**< mb, me, cf, sr and il flags */
+    ntag21x_ndef_tnf_t tnf;       /**< type name format */
+    uint8_t *type;                /**< type span */
+    uint8_t type_len;             /**< type length */
+    uint8_t *id;                  /**< id span */
+    uint8_t id_len;               /**< id length */
+    uint8_t *payload;             /**< payload span */
+    uint32_t payload_len;         /**< payload length */
+} ntag21x_ndef_record_t;
+
+/**
+ * @brief ntag21x ndef encoder structure definition
+ */
+typedef struct ntag21x_ndef_encoder_s
+{
+    uint8_t *buf;                 /**< image buffer, written to page 4 */
+    uint16_t cap;                 /**< image buffer size */
+    uint16_t len;                 /**< image bytes written */
+    uint16_t message;             /**< ndef message offset */
+    uint16_t last;                /**< header offset of the last record */
+    uint16_t records;             /**< record number */
+    uint8_t finished;             /**< finished flag */
+} ntag21x_ndef_encoder_t;
+
+/**
+ * @brief     ndef parser init
+ * @param[in] *parser pointer to a parser structure
+ * @param[in] *buf pointer to a buffer that receives the data area from page 4
+ * @param[in] size data area size
+ * @return    status code
+ *            - 0 success
+ *            - 2 parser is NULL
+ * @note      the data area size is 8 times the size byte of the capability container
+ */
+uint8_t ntag21x_ndef_parser_init(ntag21x_ndef_parser_t *parser, uint8_t *buf, uint16_t size);
+
+/**
+ * @brief     ndef parser init over a bare ndef message
+ * @param[in] *parser pointer to a parser structure
+ * @param[in] *buf pointer to a message buffer
+ * @param[in] len message length
+ * @return    status code
+ *            - 0 success
+ *            - 2 parser is NULL
+ * @note      used for the message returned by ntag21x_read_ndef
+ */
+uint8_t ntag21x_ndef_parser_init_message(ntag21x_ndef_parser_t *parser, uint8_t *buf, uint16_t len);
+
+/**
+ * @brief      ndef parser feed more data
+ * @param[in]  *parser pointer to a parser structure
+ * @param[in]  len bytes now available in the buffer
+ * @param[out] *state pointer to a state buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 tlv is invalid
+ *             - 2 parser is NULL
+ *             - 3 len is invalid
+ * @note       len counts from the start of the buffer and never goes down, so the buffer can be
+ *             filled frame by frame while it is parsed, the first ndef message tlv is used,
+ *             while more data is needed parser->need holds the buffer length that lets it go on
+ */
+uint8_t ntag21x_ndef_parser_feed(ntag21x_ndef_parser_t *parser, uint16_t len, ntag21x_ndef_parser_state_t *state);
+
+/**
+ * @brief      ndef parser get the next record
+ * @param[in]  *parser pointer to a parser structure
+ * @param[out] *record pointer to a record structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 no more records
+ *             - 2 parser is NULL
+ *             - 3 message is not complete
+ *             - 4 record is invalid
+ * @note       the spans point into the parser buffer, nothing is copied
+ */
+uint8_t ntag21x_ndef_parser_next_record(ntag21x_ndef_parser_t *parser, ntag21x_ndef_record_t *record);
+
+/**
+ * @brief         ndef scan the tag
+ * @param[in]     *handle pointer to an ntag21x handle structure
+ * @param[out]    *buf pointer to a buffer that receives the data area
+ * @param[in]     cap buffer size
+ * @param[out]    *parser pointer to a parser structure
+ * @return        status code
+ *                - 0 success
+ *                - 1 read failed
+ *                - 2 handle is NULL
+ *                - 3 handle is not initialized
+ *                - 4 capability container is invalid
+ *                - 5 buf is invalid or cap is too small
+ *                - 6 tlv is invalid
+ * @note          12 <= cap, the data area is read frame by frame and parsed while it arrives,
+ *                reading stops as soon as the ndef message or the terminator tlv is complete,
+ *                the records are then taken with ntag21x_ndef_parser_next_record
+ */
+uint8_t ntag21x_ndef_scan(ntag21x_handle_t *handle, uint8_t *buf, uint16_t cap, ntag21x_ndef_parser_t *parser);
+
+/**
+ * @brief         ndef read the message
+ * @param[in]     *handle pointer to an ntag21x handle structure
+ * @param[out]    *buf pointer to a buffer that receives the ndef message
+ * @param[in]     cap buffer size
+ * @param[out]    *len pointer to a message length buffer
+ * @return        status code
+ *                - 0 success
+ *                - 1 read failed
+ *                - 2 handle is NULL
+ *                - 3 handle is not initialized
+ *                - 4 capability container is invalid
+ *                - 5 buf is invalid or cap is too small
+ *                - 6 tlv is invalid
+ *                - 7 no ndef message
+ * @note          12 <= cap, the tlvs in front of the message are read into buf as well,
+ *                page 3 brings the capability container and the first 12 bytes, then only the
+ *                pages declared by the tlv lengths are fast read, so the cost follows the
+ *                message size and not the tag size, parse the result with
+ *                ntag21x_ndef_parser_init_message
+ */
+uint8_t ntag21x_read_ndef(ntag21x_handle_t *handle, uint8_t *buf, uint16_t cap, uint16_t *len);
+
+/**
+ * @brief      ndef get the data area size
+ * @param[in]  container capability container
+ * @param[out] *size pointer to a size buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 container is invalid
+ * @note       the size of the image buffer that covers the whole data area
+ */
+uint8_t ntag21x_ndef_get_data_area_size(ntag21x_capability_container_t container, uint16_t *size);
+
+/**
+ * @brief     ndef encoder init
+ * @param[in] *encoder pointer to an encoder structure
+ * @param[in] *buf pointer to an image buffer
+ * @param[in] cap image buffer size
+ * @return    status code
+ *            - 0 success
+ *            - 1 cap is invalid
+ *            - 2 encoder is NULL
+ * @note      4 <= cap <= 0xFFFC and cap is a whole number of pages, records are built in place
+ *            right behind the tlv header, a three bytes tlv length is reserved when the message
+ *            may be over 254 bytes
+ */
+uint8_t ntag21x_ndef_encoder_init(ntag21x_ndef_encoder_t *encoder, uint8_t *buf, uint16_t cap);
+
+/**
+ * @brief     ndef encoder add a record
+ * @param[in] *encoder pointer to an encoder structure
+ * @param[in] tnf type name format
+ * @param[in] *type pointer to a type buffer
+ * @param[in] type_len type length
+ * @param[in] *id pointer to an id buffer
+ * @param[in] id_len id length
+ * @param[in] *payload pointer to a payload buffer
+ * @param[in] payload_len payload length
+ * @return    status code
+ *            - 0 success
+ *            - 1 buffer is full
+ *            - 2 encoder is NULL
+ *            - 3 encoder is finished
+ * @note      a short record is used when the payload is under 256 bytes, payload may be NULL
+ *            to reserve payload_len bytes that the caller fills later
+ */
+uint8_t ntag21x_ndef_encoder_add_record(ntag21x_ndef_encoder_t *encoder, ntag21x_ndef_tnf_t tnf,
+                                        uint8_t *type, uint8_t type_len, uint8_t *id, uint8_t id_len,
+                                        uint8_t *payload, uint16_t payload_len);
+
+/**
+ * @brief     ndef encoder add a uri record
+ * @param[in] *encoder pointer to an encoder structure
+ * @param[in] *uri pointer to a uri string
+ * @return    status code
+ *            - 0 success
+ *            - 1 buffer is full
+ *            - 2 encoder is NULL
+ *            - 3 encoder is finished
+ * @note      the longest matching uri identifier code replaces the prefix
+ */
+uint8_t ntag21x_ndef_encoder_add_uri(ntag21x_ndef_encoder_t *encoder, char *uri);
+
+/**
+ * @brief     ndef encoder add a text record
+ * @param[in] *encoder pointer to an encoder structure
+ * @param[in] *lang pointer to a language code string
+ * @param[in] *text pointer to an utf-8 text string
+ * @return    status code
+ *            - 0 success
+ *            - 1 buffer is full
+ *            - 2 encoder is NULL
+ *            - 3 encoder is finished
+ *            - 4 lang is invalid
+ * @note      1 <= strlen(lang) <= 63
+ */
+uint8_t ntag21x_ndef_encoder_add_text(ntag21x_ndef_encoder_t *encoder, char *lang, char *text);
+
+/**
+ * @brief     ndef encoder add a mime record
+ * @param[in] *encoder pointer to an encoder structure
+ * @param[in] *mime pointer to a mime type string
+ * @param[in] *data pointer to a data buffer
+ * @param[in] len data length
+ * @return    status code
+ *            - 0 success
+ *            - 1 buffer is full
+ *            - 2 encoder is NULL
+ *            - 3 encoder is finished
+ *            - 4 mime is invalid
+ * @note      1 <= strlen(mime) <= 255
+ */
+uint8_t ntag21x_ndef_encoder_add_mime(ntag21x_ndef_encoder_t *encoder, char *mime, uint8_t *data, uint16_t len);
+
+/**
+ * @brief     ndef encoder add an external record
+ * @param[in] *encoder pointer to an encoder structure
+ * @param[in] *type pointer to a "domain:type" string
+ * @param[in] *data pointer to a data buffer
+ * @param[in] len data length
+ * @return    status code
+ *            - 0 success
+ *            - 1 buffer is full
+ *            - 2 encoder is NULL
+ *            - 3 encoder is finished
+ *            - 4 type is invalid
+ * @note      1 <= strlen(type) <= 255
+ */
+uint8_t ntag21x_ndef_encoder_add_external(ntag21x_ndef_encoder_t *encoder, char *type, uint8_t *data, uint16_t len);
+
+/**
+ * @brief      ndef encoder finish the image
+ * @param[in]  *encoder pointer to an encoder structure
+ * @param[out] *len pointer to an image length buffer
+ * @param[out] *pages pointer to a page number buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 buffer is full
+ *             - 2 encoder is NULL
+ *             - 3 encoder is finished
+ * @note       sets the message end flag, writes the tlv length and the terminator and pads
+ *             the image with zeros to a whole page, the image is then written from page 4
+ *             with ntag21x_write_image
+ */
+uint8_t ntag21x_ndef_encoder_finish(ntag21x_ndef_encoder_t *encoder, uint16_t *len, uint16_t *pages);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,860 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file      driver_ntag21x_originality.c
+ * @brief     driver ntag21x originality source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_ntag21x_originality.h"
+
+/**
+ * @brief modulus structure definition
+ */
+typedef struct ntag21x_originality_modulus_s
+{
+    uint32_t m[4];                                                        /**< modulus, little endian words */
+    uint32_t m0inv;                                                       /**< -m^-1 mod 2^32 */
+    uint32_t rr[4];                                                       /**< 2^256 mod m */
+    uint32_t one[4];                                                      /**< 2^128 mod m, one in montgomery form */
+} ntag21x_originality_modulus_t;
+
+/**
+ * @brief jacobian point structure definition
+ */
+typedef struct ntag21x_originality_jacobian_s
+{
+    uint32_t x[4];                                                        /**< x = X / Z^2 */
+    uint32_t y[4];                                                        /**< y = Y / Z^3 */
+    uint32_t z[4];                                                        /**< 0 for the point at infinity */
+} ntag21x_originality_jacobian_t;
+
+/**
+ * @brief secp128r1 field prime
+ */
+static const ntag21x_originality_modulus_t gsc_ntag21x_originality_p =
+{
+    {0xFFFFFFFFU, 0xFFFFFFFFU, 0xFFFFFFFFU, 0xFFFFFFFDU},
+    0x00000001U,
+    {0x00000011U, 0x00000008U, 0x00000004U, 0x00000024U},
+    {0x00000001U, 0x00000000U, 0x00000000U, 0x00000002U},
+};
+
+/**
+ * @brief secp128r1 group order
+ */
+static const ntag21x_originality_modulus_t gsc_ntag21x_originality_n =
+{
+    {0x9038A115U, 0x75A30D1BU, 0x00000000U, 0xFFFFFFFEU},
+    0x26A959C3U,
+    {0xFADE9BEDU, 0x26BC6448U, 0xCDD81516U, 0x71875047U},
+    {0x6FC75EEBU, 0x8A5CF2E4U, 0xFFFFFFFFU, 0x00000001U},
+};
+
+/**
+ * @brief secp128r1 coefficient b in montgomery form
+ */
+static const uint32_t gsc_ntag21x_originality_b[4] = {0x62CB305AU, 0x9AEE68C3U, 0xE164E7C3U, 0xAE0BDA76U};
+
+/**
+ * @brief secp128r1 generator in montgomery form
+ */
+static const ntag21x_originality_point_t gsc_ntag21x_originality_g =
+{
+    {0x9CA343C9U, 0x7BBB7421U, 0xB7C989D2U, 0x4F667EE4U},
+    {0x47DEADD0U, 0xB4F899A6U, 0xFA657B89U, 0x5F1823DAU},
+};
+
+/**
+ * @brief nxp ntag21x originality public key
+ */
+static const uint8_t gsc_ntag21x_originality_nxp_key[NTAG21X_ORIGINALITY_PUBLIC_KEY_LEN] =
+{
+    0x04, 0x49, 0x4E, 0x1A, 0x38, 0x6D, 0x3D, 0x3C, 0xFE, 0x3D, 0xC1, 0x0E, 0x5D, 0xE6, 0x8A, 0x49,
+    0x9B, 0x1C, 0x20, 0x2D, 0xB5, 0xB1, 0x32, 0x39, 0x3E, 0x89, 0xED, 0x19, 0xFE, 0x5B, 0xE8, 0xBC,
+    0x61,
+};
+
+/**
+ * @brief     load a big endian number
+ * @param[in] *buf pointer to a buffer
+ * @param[in] len buffer length, 16 at most
+ * @param[in] *out pointer to a 4 words number buffer
+ * @note      none
+ */
+static void a_ntag21x_originality_load(const uint8_t *buf, uint8_t len, uint32_t out[4])
+{
+    uint8_t i;
+    
+    memset(out, 0, 16);                                                   /* clear */
+    for (i = 0; i < len; i++)                                             /* last byte is the lowest */
+    {
+        out[i / 4] |= (uint32_t)buf[len - 1 - i] << ((i % 4) * 8);        /* set the byte */
+    }
+}
+
+/**
+ * @brief     compare two numbers
+ * @param[in] *a pointer to a 4 words number buffer
+ * @param[in] *b pointer to a 4 words number buffer
+ * @return    -1 if a < b, 0 if a == b, 1 if a > b
+ * @note      none
+ */
+static int8_t a_ntag21x_originality_cmp(const uint32_t a[4], const uint32_t b[4])
+{
+    int8_t i;
+    
+    for (i = 3; i >= 0; i--)                      /* from the highest word */
+    {
+        if (a[i] != b[i])                         /* check the word */
+        {
+            return (a[i] > b[i]) ? 1 : -1;        /* return the order */
+        }
+    }
+    
+    return 0;                                     /* equal */
+}
+
+/**
+ * @brief     check a number is zero
+ * @param[in] *a pointer to a 4 words number buffer
+ * @return    1 if zero, 0 otherwise
+ * @note      none
+ */
+static uint8_t a_ntag21x_originality_is_zero(const uint32_t a[4])
+{
+    return (uint8_t)((a[0] | a[1] | a[2] | a[3]) == 0);
+}
+
+/**
+ * @brief      subtract without reduction
+ * @param[in]  *a pointer to a 4 words number buffer
+ * @param[in]  *b pointer to a 4 words number buffer
+ * @param[out] *out pointer to a 4 words number buffer
+ * @return     borrow
+ * @note       out may alias a or b
+ */
+static uint32_t a_ntag21x_originality_sub_raw(const uint32_t a[4], const uint32_t b[4], uint32_t out[4])
+{
+    uint8_t i;
+    uint64_t t;
+    uint32_t borrow;
+    
+    borrow = 0;                                       /* init 0 */
+    for (i = 0; i < 4; i++)                           /* one word each */
+    {
+        t = (uint64_t)a[i] - b[i] - borrow;           /* subtract */
+        out[i] = (uint32_t)t;                         /* set the word */
+        borrow = (uint32_t)((t >> 32) & 0x01);        /* get the borrow */
+    }
+    
+    return borrow;                                    /* return the borrow */
+}
+
+/**
+ * @brief      add modulo m
+ * @param[in]  *mod pointer to a modulus structure
+ * @param[in]  *a pointer to a 4 words number buffer
+ * @param[in]  *b pointer to a 4 words number buffer
+ * @param[out] *out pointer to a 4 words number buffer
+ * @note       a and b must be below m, out may alias a or b
+ */
+static void a_ntag21x_originality_add(const ntag21x_originality_modulus_t *mod, const uint32_t a[4],
+                                      const uint32_t b[4], uint32_t out[4])
+{
+    uint8_t i;
+    uint64_t t;
+    
+    t = 0;                                                                        /* init 0 */
+    for (i = 0; i < 4; i++)                                                       /* one word each */
+    {
+        t = (uint64_t)a[i] + b[i] + (t >> 32);                                    /* add */
+        out[i] = (uint32_t)t;                                                     /* set the word */
+    }
+    if (((t >> 32) != 0) || (a_ntag21x_originality_cmp(out, mod->m) >= 0))        /* reduce */
+    {
+        (void)a_ntag21x_originality_sub_raw(out, mod->m, out);                    /* out -= m */
+    }
+}
+
+/**
+ * @brief      subtract modulo m
+ * @param[in]  *mod pointer to a modulus structure
+ * @param[in]  *a pointer to a 4 words number buffer
+ * @param[in]  *b pointer to a 4 words number buffer
+ * @param[out] *out pointer to a 4 words number buffer
+ * @note       a and b must be below m, out may alias a or b
+ */
+static void a_ntag21x_originality_sub(const ntag21x_originality_modulus_t *mod, const uint32_t a[4],
+                                      const uint32_t b[4], uint32_t out[4])
+{
+    uint8_t i;
+    uint64_t t;
+    
+    if (a_ntag21x_originality_sub_raw(a, b, out) != 0)           /* borrow */
+    {
+        t = 0;                                                   /* init 0 */
+        for (i = 0; i < 4; i++)                                  /* out += m */
+        {
+            t = (uint64_t)out[i] + mod->m[i] + (t >> 32);        /* add */
+            out[i] = (uint32_t)t;                                /* set the word */
+        }
+    }
+}
+
+/**
+ * @brief      montgomery multiplication
+ * @param[in]  *mod pointer to a modulus structure
+ * @param[in]  *a pointer to a 4 words number buffer
+ * @param[in]  *b pointer to a 4 words number buffer
+ * @param[out] *out pointer to a 4 words number buffer
+ * @note       out = a * b / 2^128 mod m, a and b must be below m, out may alias a or b
+ */
+static void a_ntag21x_originality_mul(const ntag21x_originality_modulus_t *mod, const uint32_t a[4],
+                                      const uint32_t b[4], uint32_t out[4])
+{
+    uint8_t i;
+    uint8_t j;
+    uint32_t q;
+    uint32_t t[6];
+    uint64_t c;
+    
+    memset(t, 0, sizeof(t));                                               /* clear */
+    for (i = 0; i < 4; i++)                                                /* cios, one word of b each */
+    {
+        c = 0;                                                             /* init 0 */
+        for (j = 0; j < 4; j++)                                            /* t += a * b[i] */
+        {
+            c = (uint64_t)a[j] * b[i] + t[j] + (c >> 32);                  /* multiply and add */
+            t[j] = (uint32_t)c;                                            /* set the word */
+        }
+        c = (uint64_t)t[4] + (c >> 32);                                    /* carry */
+        t[4] = (uint32_t)c;                                                /* set the word */
+        t[5] = (uint32_t)(c >> 32);                                        /* set the word */
+        q = t[0] * mod->m0inv;                                             /* clears the lowest word */
+        c = (uint64_t)q * mod->m[0] + t[0];                                /* lowest word */
+        for (j = 1; j < 4; j++)                                            /* t = (t + q * m) / 2^32 */
+        {
+            c = (uint64_t)q * mod->m[j] + t[j] + (c >> 32);                /* multiply and add */
+            t[j - 1] = (uint32_t)c;                                        /* set the word */
+        }
+        c = (uint64_t)t[4] + (c >> 32);                                    /* carry */
+        t[3] = (uint32_t)c;                                                /* set the word */
+        t[4] = t[5] + (uint32_t)(c >> 32);                                 /* set the word */
+    }
+    if ((t[4] != 0) || (a_ntag21x_originality_cmp(t, mod->m) >= 0))        /* below 2m */
+    {
+        (void)a_ntag21x_originality_sub_raw(t, mod->m, t);                 /* t -= m */
+    }
+    memcpy(out, t, 16);                                                    /* copy */
+}
+
+/**
+ * @brief      montgomery inversion
+ * @param[in]  *mod pointer to a modulus structure
+ * @param[in]  *a pointer to a 4 words number buffer in montgomery form
+ * @param[out] *out pointer to a 4 words number buffer in montgomery form
+ * @note       fermat, a^(m - 2), m is prime and a must not be zero
+ */
+static void a_ntag21x_originality_inv(const ntag21x_originality_modulus_t *mod, const uint32_t a[4], uint32_t out[4])
+{
+    int16_t i;
+    uint32_t e[4];
+    uint32_t x[4];
+    
+    memcpy(e, mod->m, 16);                                  /* e = m */
+    e[0] -= 2;                                              /* e = m - 2, no borrow for odd m */
+    memcpy(x, mod->one, 16);                                /* x = 1 */
+    for (i = 127; i >= 0; i--)                              /* from the highest bit */
+    {
+        a_ntag21x_originality_mul(mod, x, x, x);            /* square */
+        if (((e[i / 32] >> (i % 32)) & 0x01) != 0)          /* bit set */
+        {
+            a_ntag21x_originality_mul(mod, x, a, x);        /* multiply */
+        }
+    }
+    memcpy(out, x, 16);                                     /* copy */
+}
+
+/**
+ * @brief         invert a list with one inversion
+ * @param[in]     *mod pointer to a modulus structure
+ * @param[in,out] **a pointer to a 4 words number list in montgomery form
+ * @param[in]     **prefix pointer to a 4 words scratch list
+ * @param[in]     num list length
+ * @note          montgomery's trick, 3 (num - 1) multiplications and one inversion,
+ *                no element may be zero
+ */
+static void a_ntag21x_originality_inv_batch(const ntag21x_originality_modulus_t *mod, uint32_t (*a)[4],
+                                            uint32_t (*prefix)[4], uint32_t num)
+{
+    uint32_t i;
+    uint32_t inv[4];
+    uint32_t t[4];
+    
+    memcpy(prefix[0], a[0], 16);                                               /* first product */
+    for (i = 1; i < num; i++)                                                  /* running products */
+    {
+        a_ntag21x_originality_mul(mod, prefix[i - 1], a[i], prefix[i]);        /* a[0] * ... * a[i] */
+    }
+    a_ntag21x_originality_inv(mod, prefix[num - 1], inv);                      /* the only inversion */
+    for (i = num - 1; i > 0; i--)                                              /* peel off one each */
+    {
+        a_ntag21x_originality_mul(mod, inv, prefix[i - 1], t);                 /* 1 / a[i] */
+        a_ntag21x_originality_mul(mod, inv, a[i], inv);                        /* 1 / (a[0] * ... * a[i - 1]) */
+        memcpy(a[i], t, 16);                                                   /* set the inverse */
+    }
+    memcpy(a[0], inv, 16);                                                     /* set the inverse */
+}
+
+/**
+ * @brief      double a point
+ * @param[in]  *in pointer to a jacobian point structure
+ * @param[out] *out pointer to a jacobian point structure
+ * @note       dbl-2001-b for a = -3, infinity stays infinity, out may alias in
+ */
+static void a_ntag21x_originality_double(const ntag21x_originality_jacobian_t *in, ntag21x_originality_jacobian_t *out)
+{
+    const ntag21x_originality_modulus_t *p = &gsc_ntag21x_originality_p;
+    uint32_t delta[4];
+    uint32_t gamma[4];
+    uint32_t beta[4];
+    uint32_t alpha[4];
+    uint32_t t[4];
+    uint32_t u[4];
+    
+    a_ntag21x_originality_mul(p, in->z, in->z, delta);        /* delta = Z^2 */
+    a_ntag21x_originality_mul(p, in->y, in->y, gamma);        /* gamma = Y^2 */
+    a_ntag21x_originality_mul(p, in->x, gamma, beta);         /* beta = X * gamma */
+    a_ntag21x_originality_sub(p, in->x, delta, t);            /* X - delta */
+    a_ntag21x_originality_add(p, in->x, delta, u);            /* X + delta */
+    a_ntag21x_originality_mul(p, t, u, alpha);                /* (X - delta) * (X + delta) */
+    a_ntag21x_originality_add(p, alpha, alpha, t);            /* 2 times */
+    a_ntag21x_originality_add(p, alpha, t, alpha);            /* alpha = 3 times */
+    a_ntag21x_originality_add(p, in->y, in->z, t);            /* Y + Z */
+    a_ntag21x_originality_mul(p, t, t, t);                    /* (Y + Z)^2 */
+    a_ntag21x_originality_sub(p, t, gamma, t);                /* - gamma */
+    a_ntag21x_originality_sub(p, t, delta, out->z);           /* Z3 = - delta */
+    a_ntag21x_originality_add(p, beta, beta, beta);           /* 2 beta */
+    a_ntag21x_originality_add(p, beta, beta, beta);           /* 4 beta */
+    a_ntag21x_originality_mul(p, alpha, alpha, t);            /* alpha^2 */
+    a_ntag21x_originality_sub(p, t, beta, t);                 /* - 4 beta */
+    a_ntag21x_originality_sub(p, t, beta, out->x);            /* X3 = - 8 beta */
+    a_ntag21x_originality_sub(p, beta, out->x, t);            /* 4 beta - X3 */
+    a_ntag21x_originality_mul(p, alpha, t, t);                /* alpha * (4 beta - X3) */
+    a_ntag21x_originality_mul(p, gamma, gamma, u);            /* gamma^2 */
+    a_ntag21x_originality_add(p, u, u, u);                    /* 2 gamma^2 */
+    a_ntag21x_originality_add(p, u, u, u);                    /* 4 gamma^2 */
+    a_ntag21x_originality_add(p, u, u, u);                    /* 8 gamma^2 */
+    a_ntag21x_originality_sub(p, t, u, out->y);               /* Y3 */
+}
+
+/**
+ * @brief      add an affine point to a jacobian point
+ * @param[in]  *a pointer to a jacobian point structure
+ * @param[in]  *b pointer to an affine point structure
+ * @param[out] *out pointer to a jacobian point structure
+ * @note       madd-2007-bl, falls back to doubling when a equals b, out may alias a
+ */
+static void a_ntag21x_originality_madd(const ntag21x_originality_jacobian_t *a, const ntag21x_originality_point_t *b,
+                                       ntag21x_originality_jacobian_t *out)
+{
+    const ntag21x_originality_modulus_t *p = &gsc_ntag21x_originality_p;
+    uint32_t z1z1[4];
+    uint32_t u2[4];
+    uint32_t s2[4];
+    uint32_t h[4];
+    uint32_t hh[4];
+    uint32_t i[4];
+    uint32_t j[4];
+    uint32_t r[4];
+    uint32_t v[4];
+    uint32_t t[4];
+    ntag21x_originality_jacobian_t d;
+    
+    if (a_ntag21x_originality_is_zero(a->z) != 0)                          /* a is infinity */
+    {
+        memcpy(out->x, b->x, 16);                                          /* x */
+        memcpy(out->y, b->y, 16);                                          /* y */
+        memcpy(out->z, gsc_ntag21x_originality_p.one, 16);                 /* z = 1 */
+        
+        return;                                                            /* b */
+    }
+    a_ntag21x_originality_mul(p, a->z, a->z, z1z1);                        /* Z1Z1 = Z1^2 */
+    a_ntag21x_originality_mul(p, b->x, z1z1, u2);                          /* U2 = X2 * Z1Z1 */
+    a_ntag21x_originality_mul(p, b->y, a->z, s2);                          /* Y2 * Z1 */
+    a_ntag21x_originality_mul(p, s2, z1z1, s2);                            /* S2 = Y2 * Z1 * Z1Z1 */
+    a_ntag21x_originality_sub(p, u2, a->x, h);                             /* H = U2 - X1 */
+    a_ntag21x_originality_sub(p, s2, a->y, r);                             /* S2 - Y1 */
+    if (a_ntag21x_originality_is_zero(h) != 0)                             /* same x */
+    {
+        if (a_ntag21x_originality_is_zero(r) != 0)                         /* same point */
+        {
+            memcpy(d.x, b->x, 16);                                         /* x */
+            memcpy(d.y, b->y, 16);                                         /* y */
+            memcpy(d.z, gsc_ntag21x_originality_p.one, 16);                /* z = 1 */
+            a_ntag21x_originality_double(&d, out);                         /* 2b */
+        }
+        else
+        {
+            memset(out, 0, sizeof(ntag21x_originality_jacobian_t));        /* a = -b, infinity */
+        }
+        
+        return;                                                            /* special case */
+    }
+    a_ntag21x_originality_add(p, r, r, r);                                 /* r = 2 (S2 - Y1) */
+    a_ntag21x_originality_mul(p, h, h, hh);                                /* HH = H^2 */
+    a_ntag21x_originality_add(p, hh, hh, i);                               /* 2 HH */
+    a_ntag21x_originality_add(p, i, i, i);                                 /* I = 4 HH */
+    a_ntag21x_originality_mul(p, h, i, j);                                 /* J = H * I */
+    a_ntag21x_originality_mul(p, a->x, i, v);                              /* V = X1 * I */
+    a_ntag21x_originality_add(p, a->z, h, t);                              /* Z1 + H */
+    a_ntag21x_originality_mul(p, t, t, t);                                 /* (Z1 + H)^2 */
+    a_ntag21x_originality_sub(p, t, z1z1, t);                              /* - Z1Z1 */
+    a_ntag21x_originality_sub(p, t, hh, d.z);                              /* Z3 = - HH */
+    a_ntag21x_originality_mul(p, a->y, j, s2);                             /* Y1 * J */
+    a_ntag21x_originality_add(p, s2, s2, s2);                              /* 2 Y1 J */
+    a_ntag21x_originality_mul(p, r, r, t);                                 /* r^2 */
+    a_ntag21x_originality_sub(p, t, j, t);                                 /* - J */
+    a_ntag21x_originality_sub(p, t, v, t);                                 /* - V */
+    a_ntag21x_originality_sub(p, t, v, d.x);                               /* X3 = - V */
+    a_ntag21x_originality_sub(p, v, d.x, t);                               /* V - X3 */
+    a_ntag21x_originality_mul(p, r, t, t);                                 /* r * (V - X3) */
+    a_ntag21x_originality_sub(p, t, s2, d.y);                              /* Y3 */
+    memcpy(out, &d, sizeof(ntag21x_originality_jacobian_t));               /* copy */
+}
+
+/**
+ * @brief      build the fixed base table of a point
+ * @param[in]  *base pointer to an affine point structure
+ * @param[out] **table pointer to a 32 x 15 point table
+ * @note       table[i][d - 1] = d * 16^i * base, one batched inversion per window
+ */
+static void a_ntag21x_originality_table(const ntag21x_originality_point_t *base, ntag21x_originality_point_t (*table)[15])
+{
+    uint8_t i;
+    uint8_t k;
+    uint8_t cnt;
+    uint32_t z[16][4];
+    uint32_t scratch[16][4];
+    uint32_t zi2[4];
+    ntag21x_originality_point_t b;
+    ntag21x_originality_point_t *pt;
+    ntag21x_originality_jacobian_t acc[16];
+    
+    memcpy(&b, base, sizeof(ntag21x_originality_point_t));                                      /* 16^0 * base */
+    for (i = 0; i < 32; i++)                                                                    /* one window each */
+    {
+        memset(&acc[0], 0, sizeof(ntag21x_originality_jacobian_t));                             /* infinity */
+        a_ntag21x_originality_madd(&acc[0], &b, &acc[0]);                                       /* 1 * b */
+        cnt = (uint8_t)((i == 31) ? 15 : 16);                                                   /* 16 * b is the next base */
+        for (k = 1; k < cnt; k++)                                                               /* 2 * b ... 16 * b */
+        {
+            a_ntag21x_originality_madd(&acc[k - 1], &b, &acc[k]);                               /* add b */
+        }
+        for (k = 0; k < cnt; k++)                                                               /* collect z */
+        {
+            memcpy(z[k], acc[k].z, 16);                                                         /* copy z */
+        }
+        a_ntag21x_originality_inv_batch(&gsc_ntag21x_originality_p, z, scratch, cnt);           /* 1 / z */
+        for (k = 0; k < cnt; k++)                                                               /* to affine */
+        {
+            pt = (k < 15) ? &table[i][k] : &b;                                                  /* table or next base */
+            a_ntag21x_originality_mul(&gsc_ntag21x_originality_p, z[k], z[k], zi2);             /* 1 / z^2 */
+            a_ntag21x_originality_mul(&gsc_ntag21x_originality_p, acc[k].x, zi2, pt->x);        /* x = X / z^2 */
+            a_ntag21x_originality_mul(&gsc_ntag21x_originality_p, zi2, z[k], zi2);              /* 1 / z^3 */
+            a_ntag21x_originality_mul(&gsc_ntag21x_originality_p, acc[k].y, zi2, pt->y);        /* y = Y / z^3 */
+        }
+    }
+}
+
+/**
+ * @brief     finish one verification
+ * @param[in] *handle pointer to an ntag21x originality handle structure
+ * @param[in] *uid pointer to a 7 bytes uid buffer
+ * @param[in] *r pointer to a 4 words r buffer
+ * @param[in] *w pointer to a 4 words 1 / s buffer in montgomery form
+ * @return    0 genuine, 1 invalid
+ * @note      R = u1 * G + u2 * Q costs 64 mixed additions and no doubling,
+ *            x(R) == r is checked as r * Z^2 == X so R needs no inversion
+ */
+static uint8_t a_ntag21x_originality_finish(ntag21x_originality_handle_t *handle, const uint8_t uid[7],
+                                            const uint32_t r[4], const uint32_t w[4])
+{
+    uint8_t i;
+    uint8_t d;
+    uint32_t e[4];
+    uint32_t u1[4];
+    uint32_t u2[4];
+    uint32_t t[4];
+    uint32_t zz[4];
+    ntag21x_originality_jacobian_t acc;
+    
+    a_ntag21x_originality_load(uid, 7, e);                                                            /* e = uid, below n */
+    a_ntag21x_originality_mul(&gsc_ntag21x_originality_n, e, w, u1);                                  /* u1 = e / s */
+    a_ntag21x_originality_mul(&gsc_ntag21x_originality_n, r, w, u2);                                  /* u2 = r / s */
+    memset(&acc, 0, sizeof(acc));                                                                     /* infinity */
+    for (i = 0; i < 32; i++)                                                                          /* one window each */
+    {
+        d = (uint8_t)((u1[i / 8] >> ((i % 8) * 4)) & 0x0F);                                           /* digit of u1 */
+        if (d != 0)                                                                                   /* skip zero */
+        {
+            a_ntag21x_originality_madd(&acc, &handle->g_table[i][d - 1], &acc);                       /* add d * 16^i * G */
+        }
+        d = (uint8_t)((u2[i / 8] >> ((i % 8) * 4)) & 0x0F);                                           /* digit of u2 */
+        if (d != 0)                                                                                   /* skip zero */
+        {
+            a_ntag21x_originality_madd(&acc, &handle->q_table[i][d - 1], &acc);                       /* add d * 16^i * Q */
+        }
+    }
+    if (a_ntag21x_originality_is_zero(acc.z) != 0)                                                    /* infinity */
+    {
+        return 1;                                                                                     /* invalid */
+    }
+    if (a_ntag21x_originality_cmp(r, gsc_ntag21x_originality_p.m) >= 0)                               /* x is below p */
+    {
+        return 1;                                                                                     /* invalid */
+    }
+    a_ntag21x_originality_mul(&gsc_ntag21x_originality_p, r, gsc_ntag21x_originality_p.rr, t);        /* r in montgomery form */
+    a_ntag21x_originality_mul(&gsc_ntag21x_originality_p, acc.z, acc.z, zz);                          /* Z^2 */
+    a_ntag21x_originality_mul(&gsc_ntag21x_originality_p, t, zz, t);                                  /* r * Z^2 */
+    
+    return (uint8_t)((a_ntag21x_originality_cmp(t, acc.x) == 0) ? 0 : 1);                             /* n > p, so x mod n is x */
+}
+
+/**
+ * @brief      parse a signature
+ * @param[in]  *signature pointer to a 32 bytes signature buffer
+ * @param[out] *r pointer to a 4 words r buffer
+ * @param[out] *s pointer to a 4 words s buffer in montgomery form
+ * @return     0 if r and s are in 1 ... n - 1, 1 otherwise
+ * @note       none
+ */
+static uint8_t a_ntag21x_originality_parse(const uint8_t signature[32], uint32_t r[4], uint32_t s[4])
+{
+    a_ntag21x_originality_load(signature, 16, r);                                                     /* r */
+    a_ntag21x_originality_load(signature + 16, 16, s);                                                /* s */
+    if ((a_ntag21x_originality_is_zero(r) != 0) || (a_ntag21x_originality_is_zero(s) != 0) ||
+        (a_ntag21x_originality_cmp(r, gsc_ntag21x_originality_n.m) >= 0) ||
+        (a_ntag21x_originality_cmp(s, gsc_ntag21x_originality_n.m) >= 0))                             /* check the range */
+    {
+        return 1;                                                                                     /* invalid */
+    }
+    a_ntag21x_originality_mul(&gsc_ntag21x_originality_n, s, gsc_ntag21x_originality_n.rr, s);        /* to montgomery form */
+    
+    return 0;                                                                                         /* valid range */
+}
+
+/**
+ * @brief     initialize the verifier with the nxp ntag21x public key
+ * @param[in] *handle pointer to an ntag21x originality handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ * @note      the public key is the one given for ntag21x in AN11350
+ */
+uint8_t ntag21x_originality_init(ntag21x_originality_handle_t *handle)
+{
+    return ntag21x_originality_init_key(handle, (uint8_t *)gsc_ntag21x_originality_nxp_key);        /* init with the nxp key */
+}
+
+/**
+ * @brief     initialize the verifier with a public key
+ * @param[in] *handle pointer to an ntag21x originality handle structure
+ * @param[in] *public_key pointer to an uncompressed secp128r1 public key buffer
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 4 public key is invalid
+ * @note      the public key is 0x04 || x || y, 33 bytes, and must be on the curve
+ */
+uint8_t ntag21x_originality_init_key(ntag21x_originality_handle_t *handle, uint8_t public_key[NTAG21X_ORIGINALITY_PUBLIC_KEY_LEN])
+{
+    const ntag21x_originality_modulus_t *p = &gsc_ntag21x_originality_p;
+    uint32_t lhs[4];
+    uint32_t rhs[4];
+    uint32_t t[4];
+    ntag21x_originality_point_t q;
+    
+    if ((handle == NULL) || (public_key == NULL))                                    /* check handle */
+    {
+        return 2;                                                                    /* return error */
+    }
+    
+    handle->inited = 0;                                                              /* not usable until the tables are built */
+    if (public_key[0] != 0x04)                                                       /* uncompressed only */
+    {
+        return 4;                                                                    /* return error */
+    }
+    a_ntag21x_originality_load(public_key + 1, 16, q.x);                             /* x */
+    a_ntag21x_originality_load(public_key + 17, 16, q.y);                            /* y */
+    if ((a_ntag21x_originality_cmp(q.x, p->m) >= 0) || 
+        (a_ntag21x_originality_cmp(q.y, p->m) >= 0))                                 /* check the range */
+    {
+        return 4;                                                                    /* return error */
+    }
+    a_ntag21x_originality_mul(p, q.x, p->rr, q.x);                                   /* x in montgomery form */
+    a_ntag21x_originality_mul(p, q.y, p->rr, q.y);                                   /* y in montgomery form */
+    a_ntag21x_originality_mul(p, q.y, q.y, lhs);                                     /* y^2 */
+    a_ntag21x_originality_mul(p, q.x, q.x, t);                                       /* x^2 */
+    a_ntag21x_originality_mul(p, t, q.x, rhs);                                       /* x^3 */
+    a_ntag21x_originality_add(p, q.x, q.x, t);                                       /* 2x */
+    a_ntag21x_originality_add(p, t, q.x, t);                                         /* 3x */
+    a_ntag21x_originality_sub(p, rhs, t, rhs);                                       /* x^3 - 3x */
+    a_ntag21x_originality_add(p, rhs, gsc_ntag21x_originality_b, rhs);               /* x^3 - 3x + b */
+    if (a_ntag21x_originality_cmp(lhs, rhs) != 0)                                    /* check the curve */
+    {
+        return 4;                                                                    /* return error */
+    }
+    
+    a_ntag21x_originality_table(&gsc_ntag21x_originality_g, handle->g_table);        /* generator table */
+    a_ntag21x_originality_table(&q, handle->q_table);                                /* public key table */
+    handle->inited = 1;                                                              /* flag inited */
+    
+    return 0;                                                                        /* success return 0 */
+}
+
+/**
+ * @brief     verify one originality signature
+ * @param[in] *handle pointer to an ntag21x originality handle structure
+ * @param[in] *uid pointer to a 7 bytes uid buffer
+ * @param[in] *signature pointer to a 32 bytes signature buffer
+ * @return    status code
+ *            - 0 genuine
+ *            - 1 signature is invalid
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      ecdsa over secp128r1 with the uid as the unhashed message,
+ *            the signature is r || s as returned by ntag21x_read_signature
+ */
+uint8_t ntag21x_originality_verify(ntag21x_originality_handle_t *handle, uint8_t uid[7], uint8_t signature[32])
+{
+    uint32_t r[4];
+    uint32_t s[4];
+    
+    if ((handle == NULL) || (uid == NULL) || (signature == NULL))        /* check handle */
+    {
+        return 2;                                                        /* return error */
+    }
+    if (handle->inited != 1)                                             /* check handle initialization */
+    {
+        return 3;                                                        /* return error */
+    }
+    
+    if (a_ntag21x_originality_parse(signature, r, s) != 0)               /* parse the signature */
+    {
+        return 1;                                                        /* invalid */
+    }
+    a_ntag21x_originality_inv(&gsc_ntag21x_originality_n, s, s);         /* w = 1 / s */
+    
+    return a_ntag21x_originality_finish(handle, uid, r, s);              /* check R */
+}
+
+/**
+ * @brief      verify a list of originality signatures
+ * @param[in]  *handle pointer to an ntag21x originality handle structure
+ * @param[in]  **uid pointer to a 7 bytes uid list
+ * @param[in]  **signature pointer to a 32 bytes signature list
+ * @param[out] *result pointer to a result list, 0 genuine and 1 invalid
+ * @param[in]  num list length
+ * @param[out] *valid pointer to a genuine number buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       every NTAG21X_ORIGINALITY_BATCH signatures share one modular inversion,
+ *             slices of one list may be verified by several threads with the same handle
+ */
+uint8_t ntag21x_originality_verify_batch(ntag21x_originality_handle_t *handle, uint8_t (*uid)[7], uint8_t (*signature)[32],
+                                         uint8_t *result, uint32_t num, uint32_t *valid)
+{
+    uint32_t i;
+    uint32_t k;
+    uint32_t cnt;
+    uint32_t r[NTAG21X_ORIGINALITY_BATCH][4];
+    uint32_t w[NTAG21X_ORIGINALITY_BATCH][4];
+    uint32_t scratch[NTAG21X_ORIGINALITY_BATCH][4];
+    uint32_t index[NTAG21X_ORIGINALITY_BATCH];
+    
+    if ((handle == NULL) || (valid == NULL) || 
+        (((uid == NULL) || (signature == NULL) || (result == NULL)) && (num != 0)))                    /* check handle */
+    {
+        return 2;                                                                                      /* return error */
+    }
+    if (handle->inited != 1)                                                                           /* check handle initialization */
+    {
+        return 3;                                                                                      /* return error */
+    }
+    
+    *valid = 0;                                                                                        /* init 0 */
+    for (i = 0; i < num; i += NTAG21X_ORIGINALITY_BATCH)                                               /* one batch each */
+    {
+        cnt = 0;                                                                                       /* init 0 */
+        for (k = i; (k < num) && (k < i + NTAG21X_ORIGINALITY_BATCH); k++)                             /* parse the batch */
+        {
+            result[k] = 1;                                                                             /* invalid until checked */
+            if (a_ntag21x_originality_parse(signature[k], r[cnt], w[cnt]) == 0)                        /* range is valid */
+            {
+                index[cnt] = k;                                                                        /* remember the entry */
+                cnt++;                                                                                 /* one more */
+            }
+        }
+        if (cnt == 0)                                                                                  /* nothing to check */
+        {
+            continue;                                                                                  /* next batch */
+        }
+        a_ntag21x_originality_inv_batch(&gsc_ntag21x_originality_n, w, scratch, cnt);                  /* w = 1 / s, one inversion */
+        for (k = 0; k < cnt; k++)                                                                      /* check every R */
+        {
+            result[index[k]] = a_ntag21x_originality_finish(handle, uid[index[k]], r[k], w[k]);        /* finish */
+            if (result[index[k]] == 0)                                                                 /* genuine */
+            {
+                (*valid)++;                                                                            /* one more */
+            }
+        }
+    }
+    
+    return 0;                                                                                          /* success return 0 */
+}
+
+/**
+ * @brief     read and verify the originality signature of the selected tag
+ * @param[in] *handle pointer to an ntag21x originality handle structure
+ * @param[in] *ntag pointer to an ntag21x handle structure
+ * @return    status code
+ *            - 0 genuine
+ *            - 1 read failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 signature is invalid
+ * @note      calls ntag21x_get_serial_number and ntag21x_read_signature
+ */
+uint8_t ntag21x_originality_check(ntag21x_originality_handle_t *handle, ntag21x_handle_t *ntag)
+{
+    uint8_t uid[7];
+    uint8_t signature[32];
+    
+    if ((handle == NULL) || (ntag == NULL))                                             /* check handle */
+    {
+        return 2;                                                                       /* return error */
+    }
+    if (handle->inited != 1)                                                            /* check handle initialization */
+    {
+        return 3;                                                                       /* return error */
+    }
+    
+    if (ntag21x_get_serial_number(ntag, uid) != 0)                                      /* get the uid */
+    {
+        NTAG21X_PRINT(ntag, "ntag21x_originality: get serial number failed.\n");        /* get serial number failed */
+        
+        return 1;                                                                       /* return error */
+    }
+    if (ntag21x_read_signature(ntag, signature) != 0)                                   /* read the signature */
+    {
+        NTAG21X_PRINT(ntag, "ntag21x_originality: read signature failed.\n");           /* read signature failed */
+        
+        return 1;                                                                       /* return error */
+    }
+    if (ntag21x_originality_verify(handle, uid, signature) != 0)                        /* verify */
+    {
+        return 4;                                                                       /* return error */
+    }
+    
+    return 0;                                                                           /* success return 0 */
+}
+
+/**
+ * @brief     check the verifier against a known signature
+ * @param[in] *handle pointer to an ntag21x originality handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 genuine signature rejected
+ *            - 2 handle is NULL
+ *            - 4 forged signature accepted
+ *            - 5 batch differs from the single verify
+ * @note      the handle is initialized with a test key, call ntag21x_originality_init afterwards
+ */
+uint8_t ntag21x_originality_self_test(ntag21x_originality_handle_t *handle)
+{
+    static const uint8_t key[NTAG21X_ORIGINALITY_PUBLIC_KEY_LEN] = {0x04, 0x68, 0xE7, 0xEB, 0x7F, 0x3D, 0x44, 0x1B, 0x23,
+                                                                    0xF5, 0x2B, 0xEB, 0x5F, 0x75, 0xB8, 0x8A, 0x55,
+                                                                    0x7E, 0xFA, 0x47, 0x45, 0x24, 0xED, 0x75, 0x29,
+                                                                    0x5F, 0xF7, 0x7F, 0x88, 0xDB, 0x8D, 0x0C, 0x6E};
+    static const uint8_t sig[32] = {0x27, 0xC1, 0x2F, 0x19, 0x1C, 0xC6, 0xB5, 0x0A, 0x83, 0x31, 0x41, 0x33, 0x12, 0x35, 0x3C, 0xC5,
+                                    0x75, 0xD4, 0x06, 0xF1, 0x05, 0x51, 0x19, 0x30, 0x69, 0xB3, 0xE0, 0x2F, 0xA1, 0x6F, 0x32, 0x26};
+    uint8_t i;
+    uint8_t uid[4][7];
+    uint8_t signature[4][32];
+    uint8_t result[4];
+    uint32_t valid;
+    
+    if (handle == NULL)                                                                       /* check handle */
+    {
+        return 2;                                                                             /* return error */
+    }
+    
+    if (ntag21x_originality_init_key(handle, (uint8_t *)key) != 0)                            /* test key */
+    {
+        return 1;                                                                             /* return error */
+    }
+    for (i = 0; i < 4; i++)                                                                   /* genuine, forged uid, forged s, zero r */
+    {
+        uid[i][0] = 0x04;                                                                     /* uid 04 01 02 03 04 05 06 */
+        uid[i][1] = 0x01;                                                                     /* set byte 1 */
+        uid[i][2] = 0x02;                                                                     /* set byte 2 */
+        uid[i][3] = 0x03;                                                                     /* set byte 3 */
+        uid[i][4] = 0x04;                                                                     /* set byte 4 */
+        uid[i][5] = 0x05;                                                                     /* set byte 5 */
+        uid[i][6] = 0x06;                                                                     /* set byte 6 */
+        memcpy(signature[i], sig, 32);                                                        /* signature */
+    }
+    uid[1][6] ^= 0x01;                                                                        /* another uid */
+    signature[2][31] ^= 0x01;                                                                 /* another s */
+    memset(signature[3], 0, 16);                                                              /* r = 0 */
+    if (ntag21x_originality_verify(handle, uid[0], signature[0]) != 0)                        /* genuine */
+    {
+        return 1;                                                                             /* return error */
+    }
+    for (i = 1; i < 4; i++)                                                                   /* forged */
+    {
+        if (ntag21x_originality_verify(handle, uid[i], signature[i]) == 0)                    /* must fail */
+        {
+            return 4;                                                                         /* return error */
+        }
+    }
+    (void)ntag21x_originality_verify_batch(handle, uid, signature, result, 4, &valid);        /* batch */
+    if ((valid != 1) || (result[0] != 0) || (result[1] != 1) || (result[2] != 1) || (result[3] != 1))
+    {
+        return 5;                                                                             /* return error */
+    }
+    
+    return 0;                                                                                 /* success return 0 */
+}
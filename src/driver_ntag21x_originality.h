@@ -0,0 +1,188 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file      driver_ntag21x_originality.h
+ * @brief     driver ntag21x originality header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_NTAG21X_ORIGINALITY_H
+#define DRIVER_NTAG21X_ORIGINALITY_H
+
+#include "driver_ntag21x.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup ntag21x_originality_driver ntag21x originality driver function
+ * @brief    ntag21x originality driver modules
+ * @ingroup  ntag21x_driver
+ * @{
+ */
+
+/**
+ * @brief ntag21x originality batch size definition
+ * @note  signatures sharing one modular inversion in ntag21x_originality_verify_batch
+ */
+#ifndef NTAG21X_ORIGINALITY_BATCH
+    #define NTAG21X_ORIGINALITY_BATCH 32
+#endif
+
+/**
+ * @brief ntag21x originality public key length definition
+ */
+#define NTAG21X_ORIGINALITY_PUBLIC_KEY_LEN        33        /**< 0x04 || x || y of secp128r1 */
+
+/**
+ * @brief ntag21x originality point structure definition
+ */
+typedef struct ntag21x_originality_point_s
+{
+    uint32_t x[4];        /**< affine x in montgomery form */
+    uint32_t y[4];        /**< affine y in montgomery form */
+} ntag21x_originality_point_t;
+
+/**
+ * @brief ntag21x originality handle structure definition
+ * @note  the tables hold d * 16^i * P for every 4 bits window i and digit d, about 30KB,
+ *        the handle is only read after the init so threads may share it
+ */
+typedef struct ntag21x_originality_handle_s
+{
+    ntag21x_originality_point_t g_table[32][15];        /**< fixed base table of the generator */
+    ntag21x_originality_point_t q_table[32][15];        /**< fixed base table of the public key */
+    uint8_t inited;                                     /**< inited flag */
+} ntag21x_originality_handle_t;
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup ntag21x_originality_basic_driver ntag21x originality basic driver function
+ * @brief    ntag21x originality basic driver modules
+ * @ingroup  ntag21x_originality_driver
+ * @{
+ */
+
+/**
+ * @brief     initialize the verifier with the nxp ntag21x public key
+ * @param[in] *handle pointer to an ntag21x originality handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ * @note      the public key is the one given for ntag21x in AN11350
+ */
+uint8_t ntag21x_originality_init(ntag21x_originality_handle_t *handle);
+
+/**
+ * @brief     initialize the verifier with a public key
+ * @param[in] *handle pointer to an ntag21x originality handle structure
+ * @param[in] *public_key pointer to an uncompressed secp128r1 public key buffer
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 4 public key is invalid
+ * @note      the public key is 0x04 || x || y, 33 bytes, and must be on the curve
+ */
+uint8_t ntag21x_originality_init_key(ntag21x_originality_handle_t *handle, uint8_t public_key[NTAG21X_ORIGINALITY_PUBLIC_KEY_LEN]);
+
+/**
+ * @brief     verify one originality signature
+ * @param[in] *handle pointer to an ntag21x originality handle structure
+ * @param[in] *uid pointer to a 7 bytes uid buffer
+ * @param[in] *signature pointer to a 32 bytes signature buffer
+ * @return    status code
+ *            - 0 genuine
+ *            - 1 signature is invalid
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      ecdsa over secp128r1 with the uid as the unhashed message,
+ *            the signature is r || s as returned by ntag21x_read_signature
+ */
+uint8_t ntag21x_originality_verify(ntag21x_originality_handle_t *handle, uint8_t uid[7], uint8_t signature[32]);
+
+/**
+ * @brief      verify a list of originality signatures
+ * @param[in]  *handle pointer to an ntag21x originality handle structure
+ * @param[in]  **uid pointer to a 7 bytes uid list
+ * @param[in]  **signature pointer to a 32 bytes signature list
+ * @param[out] *result pointer to a result list, 0 genuine and 1 invalid
+ * @param[in]  num list length
+ * @param[out] *valid pointer to a genuine number buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       every NTAG21X_ORIGINALITY_BATCH signatures share one modular inversion,
+ *             slices of one list may be verified by several threads with the same handle
+ */
+uint8_t ntag21x_originality_verify_batch(ntag21x_originality_handle_t *handle, uint8_t (*uid)[7], uint8_t (*signature)[32],
+                                         uint8_t *result, uint32_t num, uint32_t *valid);
+
+/**
+ * @brief     read and verify the originality signature of the selected tag
+ * @param[in] *handle pointer to an ntag21x originality handle structure
+ * @param[in] *ntag pointer to an ntag21x handle structure
+ * @return    status code
+ *            - 0 genuine
+ *            - 1 read failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 signature is invalid
+ * @note      calls ntag21x_get_serial_number and ntag21x_read_signature
+ */
+uint8_t ntag21x_originality_check(ntag21x_originality_handle_t *handle, ntag21x_handle_t *ntag);
+
+/**
+ * @brief     check the verifier against a known signature
+ * @param[in] *handle pointer to an ntag21x originality handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 genuine signature rejected
+ *            - 2 handle is NULL
+ *            - 4 forged signature accepted
+ *            - 5 batch differs from the single verify
+ * @note      the handle is initialized with a test key, call ntag21x_originality_init afterwards
+ */
+uint8_t ntag21x_originality_self_test(ntag21x_originality_handle_t *handle);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
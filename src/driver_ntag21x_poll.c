@@ -0,0 +1,648 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file      driver_ntag21x_poll.c
+ * @brief     driver ntag21x poll source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_ntag21x_poll.h"
+
+/**
+ * @brief poll profile table
+ * @note  the index is ntag21x_poll_profile_t
+ */
+static const ntag21x_poll_config_t gsc_ntag21x_poll_profile[] =
+{
+    {5, 5000, 10, 15, 20, 2},
+    {10, 3000, 20, 100, 25, 2},
+    {20, 2000, 100, 500, 50, 3},
+};
+
+/**
+ * @brief     get the current time
+ * @param[in] *handle pointer to an ntag21x poll handle structure
+ * @return    time in ms
+ * @note      none
+ */
+static uint32_t a_ntag21x_poll_now(ntag21x_poll_handle_t *handle)
+{
+    if (handle->timestamp_ms != NULL)         /* check the clock */
+    {
+        return handle->timestamp_ms();        /* wall clock */
+    }
+    
+    return handle->clock_ms;                  /* slept time */
+}
+
+/**
+ * @brief     sleep between probes
+ * @param[in] *handle pointer to an ntag21x poll handle structure
+ * @param[in] ms time
+ * @note      a reader interrupt ends the sleep early when wait_irq is linked
+ */
+static void a_ntag21x_poll_sleep(ntag21x_poll_handle_t *handle, uint32_t ms)
+{
+    uint32_t start;
+    
+    start = a_ntag21x_poll_now(handle);                                                  /* sleep start */
+    if (handle->wait_irq != NULL)                                                        /* interrupt driven */
+    {
+        if (handle->wait_irq(ms) == 0)                                                   /* woken by the reader */
+        {
+            handle->statistics.irq_wakeups++;                                            /* irq wakeup */
+        }
+    }
+    else
+    {
+        handle->delay_ms(ms);                                                            /* delay */
+    }
+    if (handle->timestamp_ms == NULL)                                                    /* no clock */
+    {
+        handle->clock_ms += ms;                                                          /* count the slept time */
+    }
+    handle->statistics.idle_ms += (uint32_t)(a_ntag21x_poll_now(handle) - start);        /* idle time */
+}
+
+/**
+ * @brief      probe and select a tag
+ * @param[in]  *handle pointer to an ntag21x poll handle structure
+ * @param[out] *type pointer to a capability container buffer
+ * @param[out] *id pointer to an 8 bytes id buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 no tag
+ * @note       none
+ */
+static uint8_t a_ntag21x_poll_probe(ntag21x_poll_handle_t *handle, ntag21x_capability_container_t *type, uint8_t id[8])
+{
+    uint8_t res;
+    uint32_t start;
+    ntag21x_type_t t;
+    
+    start = a_ntag21x_poll_now(handle);                                                    /* probe start */
+    handle->statistics.probes++;                                                           /* probe */
+    res = ntag21x_request(handle->ntag, &t);                                               /* request */
+    if (res == 0)
+    {
+        res = ntag21x_anticollision_cl1(handle->ntag, id);                                 /* anti collision cl1 */
+    }
+    if (res == 0)
+    {
+        res = ntag21x_select_cl1(handle->ntag, id);                                        /* select cl1 */
+    }
+    if (res == 0)
+    {
+        res = ntag21x_anticollision_cl2(handle->ntag, id + 4);                             /* anti collision cl2 */
+    }
+    if (res == 0)
+    {
+        res = ntag21x_select_cl2(handle->ntag, id + 4);                                    /* select cl2 */
+    }
+    if (res == 0)
+    {
+        res = ntag21x_get_capability_container(handle->ntag, type);                        /* get the capability container */
+    }
+    handle->statistics.active_ms += (uint32_t)(a_ntag21x_poll_now(handle) - start);        /* active time */
+    
+    return (res == 0) ? 0 : 1;                                                             /* return the result */
+}
+
+/**
+ * @brief      fill an event of the tracked tag
+ * @param[in]  *handle pointer to an ntag21x poll handle structure
+ * @param[in]  type event type
+ * @param[out] *event pointer to an event structure
+ * @note       none
+ */
+static void a_ntag21x_poll_event(ntag21x_poll_handle_t *handle, ntag21x_poll_event_type_t type, ntag21x_poll_event_t *event)
+{
+    event->type = type;                                      /* set the type */
+    event->container = handle->container;                    /* set the container */
+    memcpy(event->uid, handle->uid, 7);                      /* set the uid */
+    event->timestamp_ms = a_ntag21x_poll_now(handle);        /* set the time */
+}
+
+/**
+ * @brief     mark the tracked tag as gone
+ * @param[in] *handle pointer to an ntag21x poll handle structure
+ * @note      starts the fast window of the next search
+ */
+static void a_ntag21x_poll_departure(ntag21x_poll_handle_t *handle)
+{
+    handle->tracking = 0;                                     /* stop tracking */
+    handle->misses = 0;                                       /* reset the misses */
+    handle->departure_ms = a_ntag21x_poll_now(handle);        /* save the departure */
+    handle->departed = 1;                                     /* start the fast window */
+    handle->statistics.departures++;                          /* departure */
+}
+
+/**
+ * @brief     initialize the poll handle
+ * @param[in] *handle pointer to an ntag21x poll handle structure
+ * @param[in] *ntag pointer to an inited ntag21x handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 linked functions is NULL
+ * @note      the balanced profile is loaded
+ */
+uint8_t ntag21x_poll_init(ntag21x_poll_handle_t *handle, ntag21x_handle_t *ntag)
+{
+    if ((handle == NULL) || (ntag == NULL))                                          /* check handle */
+    {
+        return 2;                                                                    /* return error */
+    }
+    if (ntag->inited != 1)                                                           /* check ntag handle */
+    {
+        return 3;                                                                    /* return error */
+    }
+    if ((handle->delay_ms == NULL) && (handle->wait_irq == NULL))                    /* check delay_ms */
+    {
+        NTAG21X_PRINT(ntag, "ntag21x_poll: delay_ms is null.\n");                    /* delay_ms is null */
+        
+        return 3;                                                                    /* return error */
+    }
+    
+    handle->ntag = ntag;                                                             /* save the ntag handle */
+    handle->config = gsc_ntag21x_poll_profile[NTAG21X_POLL_PROFILE_BALANCED];        /* balanced profile */
+    memset(&handle->statistics, 0, sizeof(ntag21x_poll_statistics_t));               /* clear the statistics */
+    handle->clock_ms = 0;                                                            /* reset the clock */
+    handle->departed = 0;                                                            /* no departure */
+    handle->interval_ms = 0;                                                         /* start idle */
+    handle->inited = 1;                                                              /* flag inited */
+    
+    return 0;                                                                        /* success return 0 */
+}
+
+/**
+ * @brief     load a poll profile
+ * @param[in] *handle pointer to an ntag21x poll handle structure
+ * @param[in] profile poll profile
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 profile is invalid
+ * @note      none
+ */
+uint8_t ntag21x_poll_set_profile(ntag21x_poll_handle_t *handle, ntag21x_poll_profile_t profile)
+{
+    if (handle == NULL)                                                            /* check handle */
+    {
+        return 2;                                                                  /* return error */
+    }
+    if (handle->inited != 1)                                                       /* check handle initialization */
+    {
+        return 3;                                                                  /* return error */
+    }
+    if (profile > NTAG21X_POLL_PROFILE_LOW_POWER)                                  /* check the profile */
+    {
+        NTAG21X_PRINT(handle->ntag, "ntag21x_poll: profile is invalid.\n");        /* profile is invalid */
+        
+        return 4;                                                                  /* return error */
+    }
+    
+    handle->config = gsc_ntag21x_poll_profile[profile];                            /* load the profile */
+    handle->interval_ms = 0;                                                       /* restart the back off */
+    
+    return 0;                                                                      /* success return 0 */
+}
+
+/**
+ * @brief     set a custom poll config
+ * @param[in] *handle pointer to an ntag21x poll handle structure
+ * @param[in] *config pointer to a config structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 config is invalid
+ * @note      intervals must be at least 1 ms, fast_interval_ms <= idle_interval_ms <= max_interval_ms
+ *            and miss_limit must not be 0
+ */
+uint8_t ntag21x_poll_set_config(ntag21x_poll_handle_t *handle, ntag21x_poll_config_t *config)
+{
+    if ((handle == NULL) || (config == NULL))                                     /* check handle */
+    {
+        return 2;                                                                 /* return error */
+    }
+    if (handle->inited != 1)                                                      /* check handle initialization */
+    {
+        return 3;                                                                 /* return error */
+    }
+    if ((config->fast_interval_ms == 0) ||
+        (config->fast_interval_ms > config->idle_interval_ms) ||
+        (config->idle_interval_ms > config->max_interval_ms) ||
+        (config->miss_limit == 0))                                                /* check the config */
+    {
+        NTAG21X_PRINT(handle->ntag, "ntag21x_poll: config is invalid.\n");        /* config is invalid */
+        
+        return 4;                                                                 /* return error */
+    }
+    
+    handle->config = *config;                                                     /* save the config */
+    handle->interval_ms = 0;                                                      /* restart the back off */
+    
+    return 0;                                                                     /* success return 0 */
+}
+
+/**
+ * @brief      get the poll config
+ * @param[in]  *handle pointer to an ntag21x poll handle structure
+ * @param[out] *config pointer to a config structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t ntag21x_poll_get_config(ntag21x_poll_handle_t *handle, ntag21x_poll_config_t *config)
+{
+    if ((handle == NULL) || (config == NULL))        /* check handle */
+    {
+        return 2;                                    /* return error */
+    }
+    if (handle->inited != 1)                         /* check handle initialization */
+    {
+        return 3;                                    /* return error */
+    }
+    
+    *config = handle->config;                        /* get the config */
+    
+    return 0;                                        /* success return 0 */
+}
+
+/**
+ * @brief      search and select a tag
+ * @param[in]  *handle pointer to an ntag21x poll handle structure
+ * @param[out] *type pointer to a capability container buffer
+ * @param[out] *id pointer to an 8 bytes id buffer
+ * @param[in]  timeout_ms wall clock timeout or NTAG21X_POLL_WAIT_FOREVER
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 timeout
+ * @note       probes with the fast interval inside the window after a departure, then backs off
+ *             from idle_interval_ms to max_interval_ms, a reader interrupt ends the sleep early,
+ *             the latency is measured from the last missed probe to the detection
+ */
+uint8_t ntag21x_poll_search(ntag21x_poll_handle_t *handle, ntag21x_capability_container_t *type,
+                            uint8_t id[8], uint32_t timeout_ms)
+{
+    uint32_t start;
+    uint32_t miss;
+    uint32_t now;
+    uint32_t elapsed;
+    uint32_t interval;
+    uint32_t latency;
+    
+    if ((handle == NULL) || (type == NULL) || (id == NULL))                                                   /* check handle */
+    {
+        return 2;                                                                                             /* return error */
+    }
+    if (handle->inited != 1)                                                                                  /* check handle initialization */
+    {
+        return 3;                                                                                             /* return error */
+    }
+    
+    start = a_ntag21x_poll_now(handle);                                                                       /* search start */
+    miss = start;                                                                                             /* no missed probe yet */
+    while (1)
+    {
+        if (a_ntag21x_poll_probe(handle, type, id) == 0)                                                      /* probe */
+        {
+            latency = a_ntag21x_poll_now(handle) - miss;                                                      /* tap to detect latency */
+            if ((handle->statistics.detections == 0) || (latency < handle->statistics.latency_min_ms))        /* check min */
+            {
+                handle->statistics.latency_min_ms = latency;                                                  /* update min */
+            }
+            if (latency > handle->statistics.latency_max_ms)                                                  /* check max */
+            {
+                handle->statistics.latency_max_ms = latency;                                                  /* update max */
+            }
+            handle->statistics.latency_last_ms = latency;                                                     /* save last */
+            handle->statistics.latency_sum_ms += latency;                                                     /* update sum */
+            handle->statistics.detections++;                                                                  /* detection */
+            handle->interval_ms = 0;                                                                          /* restart the back off */
+            
+            return 0;                                                                                         /* success return 0 */
+        }
+        
+        now = a_ntag21x_poll_now(handle);                                                                     /* missed probe time */
+        miss = now;                                                                                           /* save the missed probe */
+        elapsed = now - start;                                                                                /* elapsed time */
+        if ((timeout_ms != NTAG21X_POLL_WAIT_FOREVER) && (elapsed >= timeout_ms))                             /* check the timeout */
+        {
+            handle->statistics.timeouts++;                                                                    /* timeout */
+            
+            return 4;                                                                                         /* return error */
+        }
+        if ((handle->departed != 0) &&
+            ((uint32_t)(now - handle->departure_ms) < handle->config.fast_window_ms))                         /* fast window */
+        {
+            interval = handle->config.fast_interval_ms;                                                       /* fast poll */
+        }
+        else
+        {
+            if (handle->interval_ms < handle->config.idle_interval_ms)                                        /* start backing off */
+            {
+                handle->interval_ms = handle->config.idle_interval_ms;                                        /* idle interval */
+            }
+            else
+            {
+                handle->interval_ms += (uint32_t)(((uint64_t)handle->interval_ms *
+                                       handle->config.backoff_percent) / 100);                                /* back off */
+                if (handle->interval_ms > handle->config.max_interval_ms)                                     /* check the limit */
+                {
+                    handle->interval_ms = handle->config.max_interval_ms;                                     /* max interval */
+                }
+            }
+            interval = handle->interval_ms;                                                                   /* idle poll */
+        }
+        if ((timeout_ms != NTAG21X_POLL_WAIT_FOREVER) && (interval > timeout_ms - elapsed))                   /* check the rest */
+        {
+            interval = timeout_ms - elapsed;                                                                  /* sleep up to the timeout */
+        }
+        a_ntag21x_poll_sleep(handle, interval);                                                               /* sleep */
+    }
+}
+
+/**
+ * @brief     wait until the selected tag leaves the field
+ * @param[in] *handle pointer to an ntag21x poll handle structure
+ * @param[in] timeout_ms wall clock timeout or NTAG21X_POLL_WAIT_FOREVER
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 timeout
+ * @note      halts the tag and probes it with wake up at the fast interval, after miss_limit
+ *            missed probes the tag is gone and the fast window of the next search starts
+ */
+uint8_t ntag21x_poll_wait_removed(ntag21x_poll_handle_t *handle, uint32_t timeout_ms)
+{
+    uint8_t misses;
+    uint32_t start;
+    uint32_t probe;
+    uint32_t elapsed;
+    uint32_t interval;
+    ntag21x_type_t t;
+    
+    if (handle == NULL)                                                                            /* check handle */
+    {
+        return 2;                                                                                  /* return error */
+    }
+    if (handle->inited != 1)                                                                       /* check handle initialization */
+    {
+        return 3;                                                                                  /* return error */
+    }
+    
+    misses = 0;                                                                                    /* no missed probe */
+    start = a_ntag21x_poll_now(handle);                                                            /* wait start */
+    (void)ntag21x_halt(handle->ntag);                                                              /* halt the selected tag */
+    while (1)
+    {
+        probe = a_ntag21x_poll_now(handle);                                                        /* probe start */
+        handle->statistics.probes++;                                                               /* probe */
+        if (ntag21x_wake_up(handle->ntag, &t) == 0)                                                /* still in the field */
+        {
+            misses = 0;                                                                            /* reset the misses */
+            (void)ntag21x_halt(handle->ntag);                                                      /* halt again */
+        }
+        else
+        {
+            misses++;                                                                              /* missed probe */
+        }
+        handle->statistics.active_ms += (uint32_t)(a_ntag21x_poll_now(handle) - probe);            /* active time */
+        if (misses >= handle->config.miss_limit)                                                   /* gone */
+        {
+            a_ntag21x_poll_departure(handle);                                                      /* departure */
+            
+            return 0;                                                                              /* success return 0 */
+        }
+        
+        elapsed = a_ntag21x_poll_now(handle) - start;                                              /* elapsed time */
+        if ((timeout_ms != NTAG21X_POLL_WAIT_FOREVER) && (elapsed >= timeout_ms))                  /* check the timeout */
+        {
+            handle->statistics.timeouts++;                                                         /* timeout */
+            
+            return 4;                                                                              /* return error */
+        }
+        interval = handle->config.fast_interval_ms;                                                /* fast poll */
+        if ((timeout_ms != NTAG21X_POLL_WAIT_FOREVER) && (interval > timeout_ms - elapsed))        /* check the rest */
+        {
+            interval = timeout_ms - elapsed;                                                       /* sleep up to the timeout */
+        }
+        a_ntag21x_poll_sleep(handle, interval);                                                    /* sleep */
+    }
+}
+
+/**
+ * @brief      track the tag in the field
+ * @param[in]  *handle pointer to an ntag21x poll handle structure
+ * @param[in]  timeout_ms search timeout or NTAG21X_POLL_WAIT_FOREVER while no tag is tracked
+ * @param[out] *event pointer to an event structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 timeout
+ * @note       without a tracked tag it searches and reports arrived, with a tracked tag it waits
+ *             fast_interval_ms and checks the presence with one read, a missed check selects
+ *             the known uid again without anti collision and after miss_limit misses the tag is
+ *             removed, the uid of every event is the uid of the tracked tag
+ */
+uint8_t ntag21x_poll_track(ntag21x_poll_handle_t *handle, uint32_t timeout_ms, ntag21x_poll_event_t *event)
+{
+    uint8_t res;
+    uint8_t id[8];
+    uint8_t uid[7];
+    uint32_t start;
+    
+    if ((handle == NULL) || (event == NULL))                                                    /* check handle */
+    {
+        return 2;                                                                               /* return error */
+    }
+    if (handle->inited != 1)                                                                    /* check handle initialization */
+    {
+        return 3;                                                                               /* return error */
+    }
+    
+    if (handle->tracking == 0)                                                                  /* no tracked tag */
+    {
+        if (handle->pending != 0)                                                               /* another tag is already selected */
+        {
+            handle->pending = 0;                                                                /* clear the pending flag */
+            if (ntag21x_get_capability_container(handle->ntag, &handle->container) == 0)        /* get the capability container */
+            {
+                memcpy(handle->uid, handle->pending_uid, 7);                                    /* track the pending tag */
+                handle->tracking = 1;                                                           /* start tracking */
+                handle->misses = 0;                                                             /* reset the misses */
+                handle->statistics.detections++;                                                /* detection */
+                a_ntag21x_poll_event(handle, NTAG21X_POLL_EVENT_ARRIVED, event);                /* arrived */
+                
+                return 0;                                                                       /* success return 0 */
+            }
+        }
+        res = ntag21x_poll_search(handle, &handle->container, id, timeout_ms);                  /* search */
+        if (res != 0)                                                                           /* check the result */
+        {
+            return res;                                                                         /* return error */
+        }
+        memcpy(handle->uid, id + 1, 3);                                                         /* uid0 - uid2 */
+        memcpy(handle->uid + 3, id + 4, 4);                                                     /* uid3 - uid6 */
+        handle->tracking = 1;                                                                   /* start tracking */
+        handle->misses = 0;                                                                     /* reset the misses */
+        a_ntag21x_poll_event(handle, NTAG21X_POLL_EVENT_ARRIVED, event);                        /* arrived */
+        
+        return 0;                                                                               /* success return 0 */
+    }
+    
+    a_ntag21x_poll_sleep(handle, handle->config.fast_interval_ms);                              /* wait */
+    start = a_ntag21x_poll_now(handle);                                                         /* check start */
+    handle->statistics.presence_checks++;                                                       /* presence check */
+    res = ntag21x_check_presence(handle->ntag, handle->uid);                                    /* one read */
+    if (res != 0)                                                                               /* missed */
+    {
+        memcpy(uid, handle->uid, 7);                                                            /* known uid */
+        if (ntag21x_reselect(handle->ntag, uid) == 0)                                           /* select again */
+        {
+            if (memcmp(uid, handle->uid, 7) == 0)                                               /* same tag */
+            {
+                handle->statistics.reselects++;                                                 /* reselect */
+                res = 0;                                                                        /* present */
+            }
+            else
+            {
+                memcpy(handle->pending_uid, uid, 7);                                            /* save the new tag */
+                handle->pending = 1;                                                            /* arrives with the next call */
+                res = 6;                                                                        /* another tag */
+            }
+        }
+    }
+    handle->statistics.active_ms += (uint32_t)(a_ntag21x_poll_now(handle) - start);             /* active time */
+    if (res == 0)                                                                               /* still in the field */
+    {
+        handle->misses = 0;                                                                     /* reset the misses */
+        a_ntag21x_poll_event(handle, NTAG21X_POLL_EVENT_PRESENT, event);                        /* present */
+    }
+    else if ((res == 6) || (++handle->misses >= handle->config.miss_limit))                     /* gone */
+    {
+        a_ntag21x_poll_event(handle, NTAG21X_POLL_EVENT_REMOVED, event);                        /* removed */
+        a_ntag21x_poll_departure(handle);                                                       /* departure */
+    }
+    else
+    {
+        a_ntag21x_poll_event(handle, NTAG21X_POLL_EVENT_NONE, event);                           /* not sure yet */
+    }
+    
+    return 0;                                                                                   /* success return 0 */
+}
+
+/**
+ * @brief     stop tracking the tag
+ * @param[in] *handle pointer to an ntag21x poll handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      the next track call searches again
+ */
+uint8_t ntag21x_poll_untrack(ntag21x_poll_handle_t *handle)
+{
+    if (handle == NULL)             /* check handle */
+    {
+        return 2;                   /* return error */
+    }
+    if (handle->inited != 1)        /* check handle initialization */
+    {
+        return 3;                   /* return error */
+    }
+    
+    handle->tracking = 0;           /* stop tracking */
+    handle->pending = 0;            /* drop the pending tag */
+    handle->misses = 0;             /* reset the misses */
+    
+    return 0;                       /* success return 0 */
+}
+
+/**
+ * @brief      get the poll statistics
+ * @param[in]  *handle pointer to an ntag21x poll handle structure
+ * @param[out] *statistics pointer to a statistics structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t ntag21x_poll_get_statistics(ntag21x_poll_handle_t *handle, ntag21x_poll_statistics_t *statistics)
+{
+    if ((handle == NULL) || (statistics == NULL))        /* check handle */
+    {
+        return 2;                                        /* return error */
+    }
+    if (handle->inited != 1)                             /* check handle initialization */
+    {
+        return 3;                                        /* return error */
+    }
+    
+    *statistics = handle->statistics;                    /* get the statistics */
+    
+    return 0;                                            /* success return 0 */
+}
+
+/**
+ * @brief     clear the poll statistics
+ * @param[in] *handle pointer to an ntag21x poll handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t ntag21x_poll_clear_statistics(ntag21x_poll_handle_t *handle)
+{
+    if (handle == NULL)                                                       /* check handle */
+    {
+        return 2;                                                             /* return error */
+    }
+    if (handle->inited != 1)                                                  /* check handle initialization */
+    {
+        return 3;                                                             /* return error */
+    }
+    
+    memset(&handle->statistics, 0, sizeof(ntag21x_poll_statistics_t));        /* clear the statistics */
+    
+    return 0;                                                                 /* success return 0 */
+}
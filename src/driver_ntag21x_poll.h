@@ -0,0 +1,344 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file      driver_ntag21x_poll.h
+ * @brief     driver ntag21x poll header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_NTAG21X_POLL_H
+#define DRIVER_NTAG21X_POLL_H
+
+#include "driver_ntag21x.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup ntag21x_poll_driver ntag21x poll driver function
+ * @brief    ntag21x poll driver modules
+ * @ingroup  ntag21x_driver
+ * @{
+ */
+
+/**
+ * @brief ntag21x poll timeout definition
+ */
+#define NTAG21X_POLL_WAIT_FOREVER        0xFFFFFFFFU        /**< never timeout */
+
+/**
+ * @brief ntag21x poll profile enumeration definition
+ */
+typedef enum
+{
+    NTAG21X_POLL_PROFILE_LOW_LATENCY = 0x00,        /**< 5 ms after a departure, idle back off up to 15 ms */
+    NTAG21X_POLL_PROFILE_BALANCED    = 0x01,        /**< 10 ms after a departure, idle back off up to 100 ms */
+    NTAG21X_POLL_PROFILE_LOW_POWER   = 0x02,        /**< 20 ms after a departure, idle back off up to 500 ms */
+} ntag21x_poll_profile_t;
+
+/**
+ * @brief ntag21x poll event enumeration definition
+ */
+typedef enum
+{
+    NTAG21X_POLL_EVENT_NONE    = 0x00,        /**< nothing changed, a presence check missed below the limit */
+    NTAG21X_POLL_EVENT_ARRIVED = 0x01,        /**< a tag was selected */
+    NTAG21X_POLL_EVENT_PRESENT = 0x02,        /**< the tracked tag is still in the field */
+    NTAG21X_POLL_EVENT_REMOVED = 0x03,        /**< the tracked tag left the field */
+} ntag21x_poll_event_type_t;
+
+/**
+ * @brief ntag21x poll event structure definition
+ */
+typedef struct ntag21x_poll_event_s
+{
+    ntag21x_poll_event_type_t type;               /**< event type */
+    ntag21x_capability_container_t container;     /**< capability container of the tag */
+    uint8_t uid[7];                               /**< uid of the tag */
+    uint32_t timestamp_ms;                        /**< event time */
+} ntag21x_poll_event_t;
+
+/**
+ * @brief ntag21x poll config structure definition
+ */
+typedef struct ntag21x_poll_config_s
+{
+    uint32_t fast_interval_ms;        /**< probe interval right after a departure */
+    uint32_t fast_window_ms;          /**< time the fast interval holds after a departure */
+    uint32_t idle_interval_ms;        /**< first idle probe interval */
+    uint32_t max_interval_ms;         /**< idle back off limit */
+    uint16_t backoff_percent;         /**< idle interval growth per missed probe */
+    uint8_t miss_limit;               /**< missed probes before a selected tag counts as gone */
+} ntag21x_poll_config_t;
+
+/**
+ * @brief ntag21x poll statistics structure definition
+ */
+typedef struct ntag21x_poll_statistics_s
+{
+    uint32_t probes;                /**< probes sent */
+    uint32_t detections;            /**< tags found by the search */
+    uint32_t departures;            /**< tags gone */
+    uint32_t timeouts;              /**< search and removal timeouts */
+    uint32_t irq_wakeups;           /**< sleeps ended early by the reader interrupt */
+    uint32_t latency_last_ms;       /**< last tap to detect latency */
+    uint32_t latency_min_ms;        /**< min tap to detect latency */
+    uint32_t latency_max_ms;        /**< max tap to detect latency */
+    uint64_t latency_sum_ms;        /**< sum of tap to detect latencies */
+    uint64_t active_ms;             /**< time spent in probes with the field on */
+    uint64_t idle_ms;               /**< time spent sleeping between probes */
+    uint32_t presence_checks;       /**< presence checks of the tracked tag */
+    uint32_t reselects;             /**< tracked tag selected again without anti collision */
+} ntag21x_poll_statistics_t;
+
+/**
+ * @brief ntag21x poll handle structure definition
+ */
+typedef struct ntag21x_poll_handle_s
+{
+    ntag21x_handle_t *ntag;                                /**< ntag21x handle */
+    uint32_t (*timestamp_ms)(void);                        /**< point to a timestamp_ms function address */
+    void (*delay_ms)(uint32_t ms);                         /**< point to a delay_ms function address */
+    uint8_t (*wait_irq)(uint32_t timeout_ms);              /**< point to a wait_irq function address */
+    ntag21x_poll_config_t config;                          /**< duty cycle config */
+    ntag21x_poll_statistics_t statistics;                  /**< statistics */
+    uint32_t clock_ms;                                     /**< slept time when no timestamp is linked */
+    uint32_t departure_ms;                                 /**< time of the last departure */
+    uint32_t interval_ms;                                  /**< current idle interval */
+    uint8_t departed;                                      /**< departure_ms is valid */
+    uint8_t tracking;                                      /**< a tag is tracked */
+    uint8_t pending;                                       /**< another tag was selected while tracking */
+    uint8_t misses;                                        /**< missed presence checks */
+    ntag21x_capability_container_t container;              /**< capability container of the tracked tag */
+    uint8_t uid[7];                                        /**< uid of the tracked tag */
+    uint8_t pending_uid[7];                                /**< uid of the pending tag */
+    uint8_t inited;                                        /**< inited flag */
+} ntag21x_poll_handle_t;
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup ntag21x_poll_link_driver ntag21x poll link driver function
+ * @brief    ntag21x poll link driver modules
+ * @ingroup  ntag21x_poll_driver
+ * @{
+ */
+
+/**
+ * @brief     initialize ntag21x_poll_handle_t structure
+ * @param[in] HANDLE pointer to an ntag21x poll handle structure
+ * @param[in] STRUCTURE ntag21x_poll_handle_t
+ * @note      none
+ */
+#define DRIVER_NTAG21X_POLL_LINK_INIT(HANDLE, STRUCTURE)            memset(HANDLE, 0, sizeof(STRUCTURE))
+
+/**
+ * @brief     link timestamp_ms function
+ * @param[in] HANDLE pointer to an ntag21x poll handle structure
+ * @param[in] FUC pointer to a timestamp_ms function address
+ * @note      optional monotonic wall clock, without it the slept time is used as the clock
+ */
+#define DRIVER_NTAG21X_POLL_LINK_TIMESTAMP_MS(HANDLE, FUC)          (HANDLE)->timestamp_ms = FUC
+
+/**
+ * @brief     link delay_ms function
+ * @param[in] HANDLE pointer to an ntag21x poll handle structure
+ * @param[in] FUC pointer to a delay_ms function address
+ * @note      none
+ */
+#define DRIVER_NTAG21X_POLL_LINK_DELAY_MS(HANDLE, FUC)              (HANDLE)->delay_ms = FUC
+
+/**
+ * @brief     link wait_irq function
+ * @param[in] HANDLE pointer to an ntag21x poll handle structure
+ * @param[in] FUC pointer to a wait_irq function address
+ * @note      optional, sleeps up to timeout_ms and returns 0 when the reader interrupt woke it
+ *            or 1 on timeout, it replaces delay_ms between probes
+ */
+#define DRIVER_NTAG21X_POLL_LINK_WAIT_IRQ(HANDLE, FUC)              (HANDLE)->wait_irq = FUC
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup ntag21x_poll_basic_driver ntag21x poll basic driver function
+ * @brief    ntag21x poll basic driver modules
+ * @ingroup  ntag21x_poll_driver
+ * @{
+ */
+
+/**
+ * @brief     initialize the poll handle
+ * @param[in] *handle pointer to an ntag21x poll handle structure
+ * @param[in] *ntag pointer to an inited ntag21x handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 linked functions is NULL
+ * @note      the balanced profile is loaded
+ */
+uint8_t ntag21x_poll_init(ntag21x_poll_handle_t *handle, ntag21x_handle_t *ntag);
+
+/**
+ * @brief     load a poll profile
+ * @param[in] *handle pointer to an ntag21x poll handle structure
+ * @param[in] profile poll profile
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 profile is invalid
+ * @note      none
+ */
+uint8_t ntag21x_poll_set_profile(ntag21x_poll_handle_t *handle, ntag21x_poll_profile_t profile);
+
+/**
+ * @brief     set a custom poll config
+ * @param[in] *handle pointer to an ntag21x poll handle structure
+ * @param[in] *config pointer to a config structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 config is invalid
+ * @note      intervals must be at least 1 ms, fast_interval_ms <= idle_interval_ms <= max_interval_ms
+ *            and miss_limit must not be 0
+ */
+uint8_t ntag21x_poll_set_config(ntag21x_poll_handle_t *handle, ntag21x_poll_config_t *config);
+
+/**
+ * @brief      get the poll config
+ * @param[in]  *handle pointer to an ntag21x poll handle structure
+ * @param[out] *config pointer to a config structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t ntag21x_poll_get_config(ntag21x_poll_handle_t *handle, ntag21x_poll_config_t *config);
+
+/**
+ * @brief      search and select a tag
+ * @param[in]  *handle pointer to an ntag21x poll handle structure
+ * @param[out] *type pointer to a capability container buffer
+ * @param[out] *id pointer to an 8 bytes id buffer
+ * @param[in]  timeout_ms wall clock timeout or NTAG21X_POLL_WAIT_FOREVER
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 timeout
+ * @note       probes with the fast interval inside the window after a departure, then backs off
+ *             from idle_interval_ms to max_interval_ms, a reader interrupt ends the sleep early,
+ *             the latency is measured from the last missed probe to the detection
+ */
+uint8_t ntag21x_poll_search(ntag21x_poll_handle_t *handle, ntag21x_capability_container_t *type,
+                            uint8_t id[8], uint32_t timeout_ms);
+
+/**
+ * @brief     wait until the selected tag leaves the field
+ * @param[in] *handle pointer to an ntag21x poll handle structure
+ * @param[in] timeout_ms wall clock timeout or NTAG21X_POLL_WAIT_FOREVER
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 timeout
+ * @note      halts the tag and probes it with wake up at the fast interval, after miss_limit
+ *            missed probes the tag is gone and the fast window of the next search starts
+ */
+uint8_t ntag21x_poll_wait_removed(ntag21x_poll_handle_t *handle, uint32_t timeout_ms);
+
+/**
+ * @brief      track the tag in the field
+ * @param[in]  *handle pointer to an ntag21x poll handle structure
+ * @param[in]  timeout_ms search timeout or NTAG21X_POLL_WAIT_FOREVER while no tag is tracked
+ * @param[out] *event pointer to an event structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 timeout
+ * @note       without a tracked tag it searches and reports arrived, with a tracked tag it waits
+ *             fast_interval_ms and checks the presence with one read, a missed check selects
+ *             the known uid again without anti collision and after miss_limit misses the tag is
+ *             removed, the uid of every event is the uid of the tracked tag
+ */
+uint8_t ntag21x_poll_track(ntag21x_poll_handle_t *handle, uint32_t timeout_ms, ntag21x_poll_event_t *event);
+
+/**
+ * @brief     stop tracking the tag
+ * @param[in] *handle pointer to an ntag21x poll handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      the next track call searches again
+ */
+uint8_t ntag21x_poll_untrack(ntag21x_poll_handle_t *handle);
+
+/**
+ * @brief      get the poll statistics
+ * @param[in]  *handle pointer to an ntag21x poll handle structure
+ * @param[out] *statistics pointer to a statistics structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t ntag21x_poll_get_statistics(ntag21x_poll_handle_t *handle, ntag21x_poll_statistics_t *statistics);
+
+/**
+ * @brief     clear the poll statistics
+ * @param[in] *handle pointer to an ntag21x poll handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t ntag21x_poll_clear_statistics(ntag21x_poll_handle_t *handle);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,751 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file      driver_ntag21x_trace.c
+ * @brief     driver ntag21x trace source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_ntag21x_trace.h"
+
+/**
+ * @brief     store a little endian 16 bits value
+ * @param[in] *p pointer to a buffer
+ * @param[in] v value
+ * @note      none
+ */
+static void a_ntag21x_trace_put_u16(uint8_t *p, uint16_t v)
+{
+    p[0] = (uint8_t)(v & 0xFF);                /* byte 0 */
+    p[1] = (uint8_t)((v >> 8) & 0xFF);         /* byte 1 */
+}
+
+/**
+ * @brief     store a little endian 32 bits value
+ * @param[in] *p pointer to a buffer
+ * @param[in] v value
+ * @note      none
+ */
+static void a_ntag21x_trace_put_u32(uint8_t *p, uint32_t v)
+{
+    p[0] = (uint8_t)(v & 0xFF);                 /* byte 0 */
+    p[1] = (uint8_t)((v >> 8) & 0xFF);          /* byte 1 */
+    p[2] = (uint8_t)((v >> 16) & 0xFF);         /* byte 2 */
+    p[3] = (uint8_t)((v >> 24) & 0xFF);         /* byte 3 */
+}
+
+/**
+ * @brief     load a little endian 16 bits value
+ * @param[in] *p pointer to a buffer
+ * @return    value
+ * @note      none
+ */
+static uint16_t a_ntag21x_trace_get_u16(const uint8_t *p)
+{
+    return (uint16_t)(p[0] | ((uint16_t)p[1] << 8));        /* little endian */
+}
+
+/**
+ * @brief     load a little endian 32 bits value
+ * @param[in] *p pointer to a buffer
+ * @return    value
+ * @note      none
+ */
+static uint32_t a_ntag21x_trace_get_u32(const uint8_t *p)
+{
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) |
+           ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);        /* little endian */
+}
+
+/**
+ * @brief      build the file header
+ * @param[out] *header pointer to a header buffer
+ * @note       none
+ */
+static void a_ntag21x_trace_header(uint8_t header[NTAG21X_TRACE_HEADER_LEN])
+{
+    memcpy(header, NTAG21X_TRACE_MAGIC, 4);                                           /* magic */
+    a_ntag21x_trace_put_u16(header + 4, NTAG21X_TRACE_VERSION);                       /* version */
+    a_ntag21x_trace_put_u16(header + 6, NTAG21X_TRACE_HEADER_LEN);                    /* header length */
+    a_ntag21x_trace_put_u16(header + 8, NTAG21X_TRACE_RECORD_HEADER_LEN);             /* record header length */
+    a_ntag21x_trace_put_u16(header + 10, 0);                                          /* reserved */
+    a_ntag21x_trace_put_u32(header + 12, 0);                                          /* reserved */
+}
+
+/**
+ * @brief     check the file header
+ * @param[in] *log pointer to a log buffer
+ * @param[in] len log length
+ * @return    1 if the header is valid, 0 otherwise
+ * @note      version 1 logs are accepted, their flags are zero
+ */
+static uint8_t a_ntag21x_trace_header_valid(const uint8_t *log, uint32_t len)
+{
+    if (len < NTAG21X_TRACE_HEADER_LEN)                                                           /* check the length */
+    {
+        return 0;                                                                                 /* too short */
+    }
+    if ((memcmp(log, NTAG21X_TRACE_MAGIC, 4) != 0) ||
+        (a_ntag21x_trace_get_u16(log + 4) == 0) || (a_ntag21x_trace_get_u16(log + 4) > NTAG21X_TRACE_VERSION) ||
+        (a_ntag21x_trace_get_u16(log + 6) != NTAG21X_TRACE_HEADER_LEN) ||
+        (a_ntag21x_trace_get_u16(log + 8) != NTAG21X_TRACE_RECORD_HEADER_LEN))                   /* check the header */
+    {
+        return 0;                                                                                 /* invalid */
+    }
+    
+    return 1;                                                                                     /* valid */
+}
+
+/**
+ * @brief     get the trace time
+ * @param[in] *handle pointer to an ntag21x trace handle structure
+ * @return    time in us
+ * @note      0 without a linked clock
+ */
+static uint32_t a_ntag21x_trace_now(ntag21x_trace_handle_t *handle)
+{
+    if (handle->timestamp_us == NULL)              /* check the clock */
+    {
+        return 0;                                  /* no clock */
+    }
+    
+    return handle->timestamp_us();                 /* get the time */
+}
+
+/**
+ * @brief         call the transceiver linked to the traced handle
+ * @param[in]     *ntag pointer to an ntag21x handle structure
+ * @param[in]     *in_buf pointer to an input buffer
+ * @param[in]     in_len input length
+ * @param[out]    *out_buf pointer to an output buffer
+ * @param[in,out] *out_len pointer to an output length buffer
+ * @return        contactless transceiver result
+ * @note          the context variant is used when it is linked
+ */
+static uint8_t a_ntag21x_trace_lower(ntag21x_handle_t *ntag, uint8_t *in_buf, uint8_t in_len,
+                                     uint8_t *out_buf, uint8_t *out_len)
+{
+    if (ntag->contactless_transceiver_ctx != NULL)                                                     /* context variant */
+    {
+        return ntag->contactless_transceiver_ctx(ntag->user, in_buf, in_len, out_buf, out_len);        /* transceiver */
+    }
+    if (ntag->contactless_transceiver == NULL)                                                         /* check the transceiver */
+    {
+        return 1;                                                                                      /* return error */
+    }
+    
+    return ntag->contactless_transceiver(in_buf, in_len, out_buf, out_len);                            /* transceiver */
+}
+
+/**
+ * @brief      call the bit oriented transceiver linked to the traced handle
+ * @param[in]  *ntag pointer to an ntag21x handle structure
+ * @param[in]  *in_buf pointer to an input buffer
+ * @param[in]  in_bits input length in bits
+ * @param[out] *out_buf pointer to an output buffer
+ * @param[out] *out_bits pointer to an output bits buffer
+ * @param[out] *collision pointer to a collision flag buffer
+ * @return     contactless transceiver result
+ * @note       the context variant is used when it is linked
+ */
+static uint8_t a_ntag21x_trace_lower_bits(ntag21x_handle_t *ntag, uint8_t *in_buf, uint8_t in_bits,
+                                          uint8_t *out_buf, uint8_t *out_bits, uint8_t *collision)
+{
+    if (ntag->contactless_transceiver_bits_ctx != NULL)                                                                  /* context variant */
+    {
+        return ntag->contactless_transceiver_bits_ctx(ntag->user, in_buf, in_bits, out_buf, out_bits, collision);        /* transceiver */
+    }
+    if (ntag->contactless_transceiver_bits == NULL)                                                                      /* check the transceiver */
+    {
+        return 1;                                                                                                        /* return error */
+    }
+    
+    return ntag->contactless_transceiver_bits(in_buf, in_bits, out_buf, out_bits, collision);                            /* transceiver */
+}
+
+/**
+ * @brief     get the byte length of a recorded field
+ * @param[in] flags record flags
+ * @param[in] len recorded length
+ * @return    length in bytes
+ * @note      bit oriented frames record bits
+ */
+static uint16_t a_ntag21x_trace_bytes(uint8_t flags, uint8_t len)
+{
+    if ((flags & NTAG21X_TRACE_FLAG_BITS) != 0)            /* bit oriented */
+    {
+        return (uint16_t)((len + 7) / 8);                  /* round up */
+    }
+    
+    return len;                                            /* bytes */
+}
+
+/**
+ * @brief     append one record to the sink
+ * @param[in] *handle pointer to an ntag21x trace handle structure
+ * @param[in] *in_buf pointer to the request
+ * @param[in] in_len request length
+ * @param[in] *out_buf pointer to the response
+ * @param[in] out_len response length
+ * @param[in] res transceiver result
+ * @param[in] out_cap response length expected by the driver
+ * @param[in] flags record flags
+ * @param[in] collision collision flag
+ * @param[in] start request time
+ * @param[in] stop response time
+ * @note      full or failing sinks count the record as dropped
+ */
+static void a_ntag21x_trace_append(ntag21x_trace_handle_t *handle, uint8_t *in_buf, uint8_t in_len,
+                                   uint8_t *out_buf, uint8_t out_len, uint8_t res, uint8_t out_cap,
+                                   uint8_t flags, uint8_t collision, uint32_t start, uint32_t stop)
+{
+    uint16_t in_bytes;
+    uint16_t out_bytes;
+    uint16_t len;
+    uint8_t *p;
+    
+    if ((handle->buf == NULL) && (handle->write == NULL))                                   /* not recording */
+    {
+        return;                                                                             /* return */
+    }
+    
+    in_bytes = a_ntag21x_trace_bytes(flags, in_len);                                        /* request bytes */
+    out_bytes = a_ntag21x_trace_bytes(flags, out_len);                                      /* response bytes */
+    len = (uint16_t)((NTAG21X_TRACE_RECORD_HEADER_LEN + in_bytes + out_bytes + 3) & ~3U);   /* padded record length */
+    if (handle->buf != NULL)                                                                /* ram sink */
+    {
+        if ((handle->size - handle->offset) < len)                                          /* check the free space */
+        {
+            handle->dropped++;                                                              /* buffer is full */
+            
+            return;                                                                         /* return */
+        }
+        p = handle->buf + handle->offset;                                                   /* append in place */
+    }
+    else
+    {
+        p = handle->record;                                                                 /* staging buffer */
+    }
+    a_ntag21x_trace_put_u16(p + 0, len);                                                    /* record length */
+    p[2] = in_len;                                                                          /* request length */
+    p[3] = out_len;                                                                         /* response length */
+    p[4] = res;                                                                             /* result */
+    p[5] = out_cap;                                                                         /* expected length */
+    p[6] = flags;                                                                           /* flags */
+    p[7] = collision;                                                                       /* collision */
+    a_ntag21x_trace_put_u32(p + 8, start);                                                  /* timestamp */
+    a_ntag21x_trace_put_u32(p + 12, stop - start);                                          /* duration */
+    memcpy(p + NTAG21X_TRACE_RECORD_HEADER_LEN, in_buf, in_bytes);                          /* request */
+    memcpy(p + NTAG21X_TRACE_RECORD_HEADER_LEN + in_bytes, out_buf, out_bytes);             /* response */
+    memset(p + NTAG21X_TRACE_RECORD_HEADER_LEN + in_bytes + out_bytes, 0,
+           len - (NTAG21X_TRACE_RECORD_HEADER_LEN + in_bytes + out_bytes));                 /* padding */
+    if (handle->write != NULL)                                                              /* write sink */
+    {
+        if (handle->write(p, len) != 0)                                                     /* write the record */
+        {
+            handle->dropped++;                                                              /* write failed */
+            
+            return;                                                                         /* return */
+        }
+    }
+    handle->offset += len;                                                                  /* append */
+    handle->records++;                                                                      /* one more record */
+}
+
+/**
+ * @brief     count a replayed request
+ * @param[in] *handle pointer to an ntag21x trace handle structure
+ * @param[in] same 1 if the request matches the log
+ * @note      none
+ */
+static void a_ntag21x_trace_replay_count(ntag21x_trace_handle_t *handle, uint8_t same)
+{
+    if ((same == 0) && (handle->mismatches++ == 0))        /* first mismatch */
+    {
+        handle->first_mismatch = handle->records;          /* save the index */
+    }
+    handle->records++;                                     /* one more record */
+}
+
+/**
+ * @brief         trace contactless transceiver
+ * @param[in]     *trace pointer to an ntag21x trace handle structure
+ * @param[in]     *in_buf pointer to an input buffer
+ * @param[in]     in_len input length
+ * @param[out]    *out_buf pointer to an output buffer
+ * @param[in,out] *out_len pointer to an output length buffer
+ * @return        status code of the linked transceiver
+ * @note          none
+ */
+static uint8_t a_ntag21x_trace_transceiver(void *trace, uint8_t *in_buf, uint8_t in_len,
+                                           uint8_t *out_buf, uint8_t *out_len)
+{
+    ntag21x_trace_handle_t *handle = (ntag21x_trace_handle_t *)trace;
+    uint8_t res;
+    uint8_t out_cap;
+    uint32_t start;
+    
+    out_cap = *out_len;                                                                    /* save the expected length */
+    start = a_ntag21x_trace_now(handle);                                                   /* start time */
+    res = a_ntag21x_trace_lower(handle->ntag, in_buf, in_len, out_buf, out_len);           /* transceiver */
+    a_ntag21x_trace_append(handle, in_buf, in_len, out_buf, (res == 0) ? (*out_len) : 0, 
+                           res, out_cap, 0, 0, start, a_ntag21x_trace_now(handle));        /* record the frame */
+    
+    return res;                                                                            /* return the result */
+}
+
+/**
+ * @brief         trace replay contactless transceiver
+ * @param[in]     *trace pointer to an ntag21x trace handle structure
+ * @param[in]     *in_buf pointer to an input buffer
+ * @param[in]     in_len input length
+ * @param[out]    *out_buf pointer to an output buffer
+ * @param[in,out] *out_len pointer to an output length buffer
+ * @return        status code
+ *                - 0 success
+ *                - 1 end of the log or the output buffer is too small
+ *                - others recorded transceiver failure
+ * @note          none
+ */
+static uint8_t a_ntag21x_trace_replay_transceiver(void *trace, uint8_t *in_buf, uint8_t in_len,
+                                                  uint8_t *out_buf, uint8_t *out_len)
+{
+    ntag21x_trace_handle_t *handle = (ntag21x_trace_handle_t *)trace;
+    ntag21x_trace_record_t record;
+    
+    if (ntag21x_trace_next(handle->log, handle->len, &handle->offset, &record) != 0)           /* next record */
+    {
+        return 1;                                                                              /* end of the log */
+    }
+    
+    a_ntag21x_trace_replay_count(handle, (uint8_t)((record.flags == 0) && (record.in_len == in_len) && 
+                                 (memcmp(record.in_buf, in_buf, in_len) == 0)));               /* check the request */
+    if ((record.flags & NTAG21X_TRACE_FLAG_BITS) != 0)                                         /* bit oriented record */
+    {
+        return 1;                                                                              /* return error */
+    }
+    if (record.result != 0)                                                                    /* recorded failure */
+    {
+        return record.result;                                                                  /* return the result */
+    }
+    if (record.out_len > (*out_len))                                                           /* check the buffer */
+    {
+        return 1;                                                                              /* return error */
+    }
+    memcpy(out_buf, record.out_buf, record.out_len);                                           /* copy the response */
+    *out_len = record.out_len;                                                                 /* set the length */
+    
+    return 0;                                                                                  /* success return 0 */
+}
+
+/**
+ * @brief      trace bit oriented contactless transceiver
+ * @param[in]  *trace pointer to an ntag21x trace handle structure
+ * @param[in]  *in_buf pointer to an input buffer
+ * @param[in]  in_bits input length in bits
+ * @param[out] *out_buf pointer to an output buffer
+ * @param[out] *out_bits pointer to an output bits buffer
+ * @param[out] *collision pointer to a collision flag buffer
+ * @return     status code of the linked transceiver
+ * @note       none
+ */
+static uint8_t a_ntag21x_trace_transceiver_bits(void *trace, uint8_t *in_buf, uint8_t in_bits,
+                                                uint8_t *out_buf, uint8_t *out_bits, uint8_t *collision)
+{
+    ntag21x_trace_handle_t *handle = (ntag21x_trace_handle_t *)trace;
+    uint8_t res;
+    uint32_t start;
+    
+    start = a_ntag21x_trace_now(handle);                                                                   /* start time */
+    res = a_ntag21x_trace_lower_bits(handle->ntag, in_buf, in_bits, out_buf, out_bits, collision);         /* transceiver */
+    a_ntag21x_trace_append(handle, in_buf, in_bits, out_buf, (res == 0) ? (*out_bits) : 0, res, 0,
+                           NTAG21X_TRACE_FLAG_BITS, (res == 0) ? (*collision) : 0,
+                           start, a_ntag21x_trace_now(handle));                                            /* record the frame */
+    
+    return res;                                                                                            /* return the result */
+}
+
+/**
+ * @brief      trace replay bit oriented contactless transceiver
+ * @param[in]  *trace pointer to an ntag21x trace handle structure
+ * @param[in]  *in_buf pointer to an input buffer
+ * @param[in]  in_bits input length in bits
+ * @param[out] *out_buf pointer to an output buffer
+ * @param[out] *out_bits pointer to an output bits buffer
+ * @param[out] *collision pointer to a collision flag buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 end of the log, the record is not bit oriented or the response is too long
+ *             - others recorded transceiver failure
+ * @note       a response longer than NTAG21X_TRACE_BITS_MAX_LEN counts as a mismatch
+ */
+static uint8_t a_ntag21x_trace_replay_transceiver_bits(void *trace, uint8_t *in_buf, uint8_t in_bits,
+                                                       uint8_t *out_buf, uint8_t *out_bits, uint8_t *collision)
+{
+    ntag21x_trace_handle_t *handle = (ntag21x_trace_handle_t *)trace;
+    ntag21x_trace_record_t record;
+    
+    if (ntag21x_trace_next(handle->log, handle->len, &handle->offset, &record) != 0)           /* next record */
+    {
+        return 1;                                                                              /* end of the log */
+    }
+    
+    a_ntag21x_trace_replay_count(handle, (uint8_t)((record.flags == NTAG21X_TRACE_FLAG_BITS) && 
+                                 (record.in_len == in_bits) &&
+                                 (record.out_len <= NTAG21X_TRACE_BITS_MAX_LEN) &&
+                                 (memcmp(record.in_buf, in_buf, (in_bits + 7) / 8) == 0)));     /* check the request */
+    if ((record.flags & NTAG21X_TRACE_FLAG_BITS) == 0)                                         /* byte oriented record */
+    {
+        return 1;                                                                              /* return error */
+    }
+    if (record.result != 0)                                                                    /* recorded failure */
+    {
+        return record.result;                                                                  /* return the result */
+    }
+    if (record.out_len > NTAG21X_TRACE_BITS_MAX_LEN)                                           /* check the response */
+    {
+        return 1;                                                                              /* return error */
+    }
+    memcpy(out_buf, record.out_buf, (record.out_len + 7) / 8);                                 /* copy the response */
+    *out_bits = record.out_len;                                                                /* set the bits */
+    *collision = record.collision;                                                             /* set the collision */
+    
+    return 0;                                                                                  /* success return 0 */
+}
+
+/**
+ * @brief     attach a trace handle to an ntag21x handle
+ * @param[in] *handle pointer to an ntag21x trace handle structure
+ * @param[in] *ntag pointer to an ntag21x handle structure
+ * @param[in] replay 1 to replay, 0 to record
+ * @return    status code
+ *            - 0 success
+ *            - 4 ntag is already traced
+ * @note      none
+ */
+static uint8_t a_ntag21x_trace_attach(ntag21x_trace_handle_t *handle, ntag21x_handle_t *ntag, uint8_t replay)
+{
+    if ((ntag->trace != NULL) && (ntag->trace != handle))                                  /* check the ntag handle */
+    {
+        return 4;                                                                          /* return error */
+    }
+    
+    handle->ntag = ntag;                                                                   /* save the ntag handle */
+    handle->replay = replay;                                                               /* set the mode */
+    handle->offset = 0;                                                                    /* nothing recorded */
+    handle->records = 0;                                                                   /* no records */
+    handle->dropped = 0;                                                                   /* nothing dropped */
+    handle->mismatches = 0;                                                                /* no mismatches */
+    handle->first_mismatch = 0;                                                            /* no mismatches */
+    handle->buf = NULL;                                                                    /* no ram sink */
+    handle->write = NULL;                                                                  /* no write sink */
+    ntag->trace = handle;                                                                  /* attach the trace */
+    ntag->trace_transceiver = (replay != 0) ? a_ntag21x_trace_replay_transceiver : 
+                                              a_ntag21x_trace_transceiver;                 /* set the transceiver */
+    ntag->trace_transceiver_bits = (replay != 0) ? a_ntag21x_trace_replay_transceiver_bits : 
+                                                   a_ntag21x_trace_transceiver_bits;       /* set the bit oriented transceiver */
+    handle->inited = 1;                                                                    /* flag inited */
+    
+    return 0;                                                                              /* success return 0 */
+}
+
+/**
+ * @brief     attach a recording trace to an ntag21x handle
+ * @param[in] *handle pointer to an ntag21x trace handle structure
+ * @param[in] *ntag pointer to a linked ntag21x handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 4 ntag is already traced
+ * @note      every frame of the linked transceiver, plain or context, passes the trace,
+ *            nothing is recorded until a buffer or a write function is set
+ */
+uint8_t ntag21x_trace_init(ntag21x_trace_handle_t *handle, ntag21x_handle_t *ntag)
+{
+    if ((handle == NULL) || (ntag == NULL))                 /* check handle */
+    {
+        return 2;                                           /* return error */
+    }
+    
+    return a_ntag21x_trace_attach(handle, ntag, 0);         /* attach to record */
+}
+
+/**
+ * @brief     detach the trace from its ntag21x handle
+ * @param[in] *handle pointer to an ntag21x trace handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      the ntag21x handle talks to its linked transceiver again
+ */
+uint8_t ntag21x_trace_deinit(ntag21x_trace_handle_t *handle)
+{
+    if (handle == NULL)                                /* check handle */
+    {
+        return 2;                                      /* return error */
+    }
+    if (handle->inited != 1)                           /* check handle initialization */
+    {
+        return 3;                                      /* return error */
+    }
+    
+    if (handle->ntag->trace == handle)                 /* still attached */
+    {
+        handle->ntag->trace = NULL;                    /* detach the trace */
+        handle->ntag->trace_transceiver = NULL;        /* linked transceiver */
+        handle->ntag->trace_transceiver_bits = NULL;   /* linked bit oriented transceiver */
+    }
+    handle->inited = 0;                                /* flag closed */
+    
+    return 0;                                          /* success return 0 */
+}
+
+/**
+ * @brief     trace record to a ram buffer
+ * @param[in] *handle pointer to an ntag21x trace handle structure
+ * @param[in] *buf pointer to a log buffer
+ * @param[in] len buffer length
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle or buf is NULL
+ *            - 3 handle is not initialized
+ *            - 4 len is too small
+ *            - 5 handle is replaying
+ * @note      the file header is written at once, records are appended until the buffer is full
+ */
+uint8_t ntag21x_trace_set_buffer(ntag21x_trace_handle_t *handle, uint8_t *buf, uint32_t len)
+{
+    if ((handle == NULL) || (buf == NULL))                 /* check handle */
+    {
+        return 2;                                          /* return error */
+    }
+    if (handle->inited != 1)                               /* check handle initialization */
+    {
+        return 3;                                          /* return error */
+    }
+    if (len < NTAG21X_TRACE_HEADER_LEN)                    /* check the length */
+    {
+        return 4;                                          /* return error */
+    }
+    if (handle->replay != 0)                               /* check the mode */
+    {
+        return 5;                                          /* return error */
+    }
+    
+    a_ntag21x_trace_header(buf);                           /* write the file header */
+    handle->write = NULL;                                  /* no write sink */
+    handle->buf = buf;                                     /* set the buffer */
+    handle->size = len;                                    /* set the size */
+    handle->offset = NTAG21X_TRACE_HEADER_LEN;             /* after the header */
+    handle->records = 0;                                   /* no records */
+    handle->dropped = 0;                                   /* nothing dropped */
+    
+    return 0;                                              /* success return 0 */
+}
+
+/**
+ * @brief     trace record through a write function
+ * @param[in] *handle pointer to an ntag21x trace handle structure
+ * @param[in] *write pointer to a write function address
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle or write is NULL
+ *            - 3 handle is not initialized
+ *            - 4 write header failed
+ *            - 5 handle is replaying
+ * @note      the write function gets the file header first and then one call per record,
+ *            it returns 0 on success
+ */
+uint8_t ntag21x_trace_set_write(ntag21x_trace_handle_t *handle, uint8_t (*write)(const uint8_t *buf, uint16_t len))
+{
+    uint8_t header[NTAG21X_TRACE_HEADER_LEN];
+    
+    if ((handle == NULL) || (write == NULL))                       /* check handle */
+    {
+        return 2;                                                  /* return error */
+    }
+    if (handle->inited != 1)                                       /* check handle initialization */
+    {
+        return 3;                                                  /* return error */
+    }
+    if (handle->replay != 0)                                       /* check the mode */
+    {
+        return 5;                                                  /* return error */
+    }
+    
+    handle->buf = NULL;                                            /* no ram sink */
+    handle->write = NULL;                                          /* stop recording */
+    a_ntag21x_trace_header(header);                                /* build the file header */
+    if (write(header, NTAG21X_TRACE_HEADER_LEN) != 0)              /* write the file header */
+    {
+        return 4;                                                  /* return error */
+    }
+    handle->write = write;                                         /* set the write function */
+    handle->offset = NTAG21X_TRACE_HEADER_LEN;                     /* after the header */
+    handle->records = 0;                                           /* no records */
+    handle->dropped = 0;                                           /* nothing dropped */
+    
+    return 0;                                                      /* success return 0 */
+}
+
+/**
+ * @brief      trace get the status
+ * @param[in]  *handle pointer to an ntag21x trace handle structure
+ * @param[out] *status pointer to a status structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle or status is NULL
+ *             - 3 handle is not initialized
+ * @note       mismatches are only counted while replaying, dropped records only while recording
+ */
+uint8_t ntag21x_trace_get_status(ntag21x_trace_handle_t *handle, ntag21x_trace_status_t *status)
+{
+    if ((handle == NULL) || (status == NULL))                  /* check handle */
+    {
+        return 2;                                              /* return error */
+    }
+    if (handle->inited != 1)                                   /* check handle initialization */
+    {
+        return 3;                                              /* return error */
+    }
+    
+    status->records = handle->records;                         /* set the records */
+    status->dropped = handle->dropped;                         /* set the dropped records */
+    status->mismatches = handle->mismatches;                   /* set the mismatches */
+    status->first_mismatch = handle->first_mismatch;           /* set the first mismatch */
+    status->length = handle->offset;                           /* set the length */
+    
+    return 0;                                                  /* success return 0 */
+}
+
+/**
+ * @brief      trace parse the next record of a log
+ * @param[in]  *log pointer to a log buffer
+ * @param[in]  len log length
+ * @param[in]  *offset pointer to an offset buffer, 0 starts at the first record
+ * @param[out] *record pointer to a record structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 end of the log
+ *             - 2 log, offset or record is NULL
+ *             - 4 file header is invalid
+ *             - 5 record is invalid
+ * @note       zero copy, the record points into the log
+ */
+uint8_t ntag21x_trace_next(const uint8_t *log, uint32_t len, uint32_t *offset, ntag21x_trace_record_t *record)
+{
+    const uint8_t *p;
+    uint16_t record_len;
+    uint16_t in_bytes;
+    uint16_t out_bytes;
+    
+    if ((log == NULL) || (offset == NULL) || (record == NULL))                                 /* check the buffers */
+    {
+        return 2;                                                                              /* return error */
+    }
+    if ((*offset) == 0)                                                                        /* first record */
+    {
+        if (a_ntag21x_trace_header_valid(log, len) == 0)                                       /* check the header */
+        {
+            return 4;                                                                          /* return error */
+        }
+        *offset = NTAG21X_TRACE_HEADER_LEN;                                                    /* skip the header */
+    }
+    if ((len < NTAG21X_TRACE_RECORD_HEADER_LEN) ||
+        ((*offset) > (len - NTAG21X_TRACE_RECORD_HEADER_LEN)))                                 /* check the end */
+    {
+        return 1;                                                                              /* end of the log */
+    }
+    
+    p = log + (*offset);                                                                       /* record */
+    record_len = a_ntag21x_trace_get_u16(p);                                                   /* record length */
+    in_bytes = a_ntag21x_trace_bytes(p[6], p[2]);                                              /* request bytes */
+    out_bytes = a_ntag21x_trace_bytes(p[6], p[3]);                                             /* response bytes */
+    if (((record_len & 3) != 0) || (record_len > (len - (*offset))) ||
+        (record_len < (NTAG21X_TRACE_RECORD_HEADER_LEN + in_bytes + out_bytes)))               /* check the record */
+    {
+        return 5;                                                                              /* return error */
+    }
+    record->in_len = p[2];                                                                     /* request length */
+    record->out_len = p[3];                                                                    /* response length */
+    record->result = p[4];                                                                     /* result */
+    record->out_cap = p[5];                                                                    /* expected length */
+    record->flags = p[6];                                                                      /* flags */
+    record->collision = p[7];                                                                  /* collision */
+    record->timestamp_us = a_ntag21x_trace_get_u32(p + 8);                                     /* timestamp */
+    record->duration_us = a_ntag21x_trace_get_u32(p + 12);                                     /* duration */
+    record->in_buf = p + NTAG21X_TRACE_RECORD_HEADER_LEN;                                      /* request */
+    record->out_buf = p + NTAG21X_TRACE_RECORD_HEADER_LEN + in_bytes;                          /* response */
+    *offset += record_len;                                                                     /* next record */
+    
+    return 0;                                                                                  /* success return 0 */
+}
+
+/**
+ * @brief     attach a replaying trace to an ntag21x handle
+ * @param[in] *handle pointer to an ntag21x trace handle structure
+ * @param[in] *ntag pointer to a linked ntag21x handle structure
+ * @param[in] *log pointer to a log buffer
+ * @param[in] len log length
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle or log is NULL
+ *            - 4 ntag is already traced
+ *            - 5 file header is invalid
+ * @note      the log must stay valid while replaying, the linked transceiver is not called,
+ *            the recorded response is returned even when the request differs and the
+ *            difference is counted as a mismatch, the end of the log fails every frame
+ */
+uint8_t ntag21x_trace_replay_init(ntag21x_trace_handle_t *handle, ntag21x_handle_t *ntag, const uint8_t *log, uint32_t len)
+{
+    uint8_t res;
+    
+    if ((handle == NULL) || (ntag == NULL) || (log == NULL))         /* check handle */
+    {
+        return 2;                                                    /* return error */
+    }
+    if (a_ntag21x_trace_header_valid(log, len) == 0)                 /* check the header */
+    {
+        return 5;                                                    /* return error */
+    }
+    
+    res = a_ntag21x_trace_attach(handle, ntag, 1);                   /* attach to replay */
+    if (res != 0)                                                    /* check the result */
+    {
+        return res;                                                  /* return error */
+    }
+    handle->log = log;                                               /* set the log */
+    handle->len = len;                                               /* set the length */
+    handle->offset = NTAG21X_TRACE_HEADER_LEN;                       /* first record */
+    
+    return 0;                                                        /* success return 0 */
+}
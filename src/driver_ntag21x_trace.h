@@ -0,0 +1,265 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file      driver_ntag21x_trace.h
+ * @brief     driver ntag21x trace header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_NTAG21X_TRACE_H
+#define DRIVER_NTAG21X_TRACE_H
+
+#include "driver_ntag21x.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup ntag21x_trace_driver ntag21x trace driver function
+ * @brief    ntag21x trace driver modules
+ * @ingroup  ntag21x_driver
+ * @{
+ */
+
+/**
+ * @brief ntag21x trace format definition
+ * @note  every field is little endian, the file header is followed by records padded to 4 bytes:
+ *        file header:   magic "N21T", u16 version, u16 header length, u16 record header length, u16 reserved, u32 reserved
+ *        record header: u16 record length, u8 in_len, u8 out_len, u8 result, u8 out_cap, u8 flags, u8 collision,
+ *                       u32 timestamp_us, u32 duration_us, then the request bytes and the response bytes,
+ *        flags bit 0 marks a bit oriented frame whose in_len and out_len count bits, version 1 logs have no flags
+ */
+#define NTAG21X_TRACE_MAGIC                    "N21T"        /**< file magic */
+#define NTAG21X_TRACE_VERSION                  2             /**< format version */
+#define NTAG21X_TRACE_FLAG_BITS                0x01          /**< bit oriented frame */
+#define NTAG21X_TRACE_HEADER_LEN               16            /**< file header length */
+#define NTAG21X_TRACE_RECORD_HEADER_LEN        16            /**< record header length */
+#define NTAG21X_TRACE_RECORD_MAX_LEN           528           /**< record header, 255 + 255 bytes and padding */
+#define NTAG21X_TRACE_BITS_MAX_LEN             40            /**< bit oriented response, uid and bcc */
+
+/**
+ * @brief ntag21x trace record structure definition
+ */
+typedef struct ntag21x_trace_record_s
+{
+    uint32_t timestamp_us;         /**< time the request was sent */
+    uint32_t duration_us;          /**< time spent in the transceiver */
+    uint8_t result;                /**< transceiver return code */
+    uint8_t in_len;                /**< request length, in bits for a bit oriented frame */
+    uint8_t out_len;               /**< response length, 0 when the transceiver failed */
+    uint8_t out_cap;               /**< response length expected by the driver, 0 for a bit oriented frame */
+    uint8_t flags;                 /**< NTAG21X_TRACE_FLAG_xxx */
+    uint8_t collision;             /**< collision flag of a bit oriented frame */
+    const uint8_t *in_buf;         /**< request bytes inside the log */
+    const uint8_t *out_buf;        /**< response bytes inside the log */
+} ntag21x_trace_record_t;
+
+/**
+ * @brief ntag21x trace status structure definition
+ */
+typedef struct ntag21x_trace_status_s
+{
+    uint32_t records;               /**< records written or replayed */
+    uint32_t dropped;               /**< records lost because the sink was full or failed */
+    uint32_t mismatches;            /**< replayed requests that differ from the log */
+    uint32_t first_mismatch;        /**< index of the first differing request */
+    uint32_t length;                /**< log length in bytes or replay position */
+} ntag21x_trace_status_t;
+
+/**
+ * @brief ntag21x trace handle structure definition
+ */
+typedef struct ntag21x_trace_handle_s
+{
+    ntag21x_handle_t *ntag;                                    /**< traced ntag21x handle */
+    uint32_t (*timestamp_us)(void);                            /**< point to a timestamp_us function address */
+    uint8_t (*write)(const uint8_t *buf, uint16_t len);        /**< write sink */
+    uint8_t *buf;                                              /**< ram sink */
+    uint32_t size;                                             /**< ram sink size */
+    const uint8_t *log;                                        /**< replayed log */
+    uint32_t len;                                              /**< replayed log length */
+    uint32_t offset;                                           /**< log length or next replayed record */
+    uint32_t records;                                          /**< written or replayed records */
+    uint32_t dropped;                                          /**< dropped records */
+    uint32_t mismatches;                                       /**< differing requests */
+    uint32_t first_mismatch;                                   /**< first differing request */
+    uint8_t replay;                                            /**< replay mode */
+    uint8_t inited;                                            /**< inited flag */
+    uint8_t record[NTAG21X_TRACE_RECORD_MAX_LEN];              /**< record staging buffer */
+} ntag21x_trace_handle_t;
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup ntag21x_trace_link_driver ntag21x trace link driver function
+ * @brief    ntag21x trace link driver modules
+ * @ingroup  ntag21x_trace_driver
+ * @{
+ */
+
+/**
+ * @brief     initialize ntag21x_trace_handle_t structure
+ * @param[in] HANDLE pointer to an ntag21x trace handle structure
+ * @param[in] STRUCTURE ntag21x_trace_handle_t
+ * @note      none
+ */
+#define DRIVER_NTAG21X_TRACE_LINK_INIT(HANDLE, STRUCTURE)           memset(HANDLE, 0, sizeof(STRUCTURE))
+
+/**
+ * @brief     link timestamp_us function
+ * @param[in] HANDLE pointer to an ntag21x trace handle structure
+ * @param[in] FUC pointer to a timestamp_us function address
+ * @note      optional, records carry zero times without it
+ */
+#define DRIVER_NTAG21X_TRACE_LINK_TIMESTAMP_US(HANDLE, FUC)         (HANDLE)->timestamp_us = FUC
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup ntag21x_trace_basic_driver ntag21x trace basic driver function
+ * @brief    ntag21x trace basic driver modules
+ * @ingroup  ntag21x_trace_driver
+ * @{
+ */
+
+/**
+ * @brief     attach a recording trace to an ntag21x handle
+ * @param[in] *handle pointer to an ntag21x trace handle structure
+ * @param[in] *ntag pointer to a linked ntag21x handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 4 ntag is already traced
+ * @note      every frame of the linked byte and bit oriented transceivers, plain or context,
+ *            passes the trace, nothing is recorded until a buffer or a write function is set
+ */
+uint8_t ntag21x_trace_init(ntag21x_trace_handle_t *handle, ntag21x_handle_t *ntag);
+
+/**
+ * @brief     detach the trace from its ntag21x handle
+ * @param[in] *handle pointer to an ntag21x trace handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      the ntag21x handle talks to its linked transceiver again
+ */
+uint8_t ntag21x_trace_deinit(ntag21x_trace_handle_t *handle);
+
+/**
+ * @brief     trace record to a ram buffer
+ * @param[in] *handle pointer to an ntag21x trace handle structure
+ * @param[in] *buf pointer to a log buffer
+ * @param[in] len buffer length
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle or buf is NULL
+ *            - 3 handle is not initialized
+ *            - 4 len is too small
+ *            - 5 handle is replaying
+ * @note      the file header is written at once, records are appended until the buffer is full
+ */
+uint8_t ntag21x_trace_set_buffer(ntag21x_trace_handle_t *handle, uint8_t *buf, uint32_t len);
+
+/**
+ * @brief     trace record through a write function
+ * @param[in] *handle pointer to an ntag21x trace handle structure
+ * @param[in] *write pointer to a write function address
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle or write is NULL
+ *            - 3 handle is not initialized
+ *            - 4 write header failed
+ *            - 5 handle is replaying
+ * @note      the write function gets the file header first and then one call per record,
+ *            it returns 0 on success
+ */
+uint8_t ntag21x_trace_set_write(ntag21x_trace_handle_t *handle, uint8_t (*write)(const uint8_t *buf, uint16_t len));
+
+/**
+ * @brief      trace get the status
+ * @param[in]  *handle pointer to an ntag21x trace handle structure
+ * @param[out] *status pointer to a status structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle or status is NULL
+ *             - 3 handle is not initialized
+ * @note       mismatches are only counted while replaying, dropped records only while recording
+ */
+uint8_t ntag21x_trace_get_status(ntag21x_trace_handle_t *handle, ntag21x_trace_status_t *status);
+
+/**
+ * @brief      trace parse the next record of a log
+ * @param[in]  *log pointer to a log buffer
+ * @param[in]  len log length
+ * @param[in]  *offset pointer to an offset buffer, 0 starts at the first record
+ * @param[out] *record pointer to a record structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 end of the log
+ *             - 2 log, offset or record is NULL
+ *             - 4 file header is invalid
+ *             - 5 record is invalid
+ * @note       zero copy, the record points into the log
+ */
+uint8_t ntag21x_trace_next(const uint8_t *log, uint32_t len, uint32_t *offset, ntag21x_trace_record_t *record);
+
+/**
+ * @brief     attach a replaying trace to an ntag21x handle
+ * @param[in] *handle pointer to an ntag21x trace handle structure
+ * @param[in] *ntag pointer to a linked ntag21x handle structure
+ * @param[in] *log pointer to a log buffer
+ * @param[in] len log length
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle or log is NULL
+ *            - 4 ntag is already traced
+ *            - 5 file header is invalid
+ * @note      the log must stay valid while replaying, the linked transceiver is not called,
+ *            the recorded response is returned even when the request differs and the
+ *            difference is counted as a mismatch, the end of the log fails every frame
+ */
+uint8_t ntag21x_trace_replay_init(ntag21x_trace_handle_t *handle, ntag21x_handle_t *ntag, const uint8_t *log, uint32_t len);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,1551 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file      driver_ntag21x_emulator.c
+ * @brief     driver ntag21x emulator source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_ntag21x_emulator.h"
+
+/**
+ * @brief emulator command definition
+ */
+#define EMULATOR_COMMAND_REQUEST               0x26        /**< request command */
+#define EMULATOR_COMMAND_WAKE_UP               0x52        /**< wake up command */
+#define EMULATOR_COMMAND_SEL_CL1               0x93        /**< select cascade level 1 */
+#define EMULATOR_COMMAND_SEL_CL2               0x95        /**< select cascade level 2 */
+#define EMULATOR_COMMAND_HALT                  0x50        /**< halt command */
+#define EMULATOR_COMMAND_GET_VERSION           0x60        /**< get version command */
+#define EMULATOR_COMMAND_READ                  0x30        /**< read command */
+#define EMULATOR_COMMAND_FAST_READ             0x3A        /**< fast read command */
+#define EMULATOR_COMMAND_WRITE                 0xA2        /**< write command */
+#define EMULATOR_COMMAND_COMP_WRITE            0xA0        /**< comp write command */
+#define EMULATOR_COMMAND_READ_CNT              0x39        /**< read cnt command */
+#define EMULATOR_COMMAND_PWD_AUTH              0x1B        /**< pwd auth command */
+#define EMULATOR_COMMAND_READ_SIG              0x3C        /**< read sig command */
+
+/**
+ * @brief emulator response definition
+ */
+#define EMULATOR_ACK                           0x0A        /**< ack */
+#define EMULATOR_NAK_INVALID_ARGUMENT          0x00        /**< nak, invalid argument or address */
+#define EMULATOR_NAK_CRC_ERROR                 0x01        /**< nak, parity or crc error */
+#define EMULATOR_NAK_AUTH_LIMIT                0x04        /**< nak, authentication counter overflow */
+#define EMULATOR_NO_RESPONSE                   0xFF        /**< the tag stays silent */
+
+/**
+ * @brief emulator memory definition
+ */
+#define EMULATOR_MAX_PAGES                     231         /**< ntag216 page count */
+#define EMULATOR_COMP_WRITE_NONE               0xFF        /**< no pending comp write */
+
+/**
+ * @brief emulator tag structure definition
+ */
+typedef struct emulator_tag_s
+{
+    uint8_t memory[EMULATOR_MAX_PAGES * 4];                 /**< eeprom */
+    uint8_t uid[7];                                         /**< uid */
+    uint8_t signature[32];                                  /**< originality signature */
+    uint32_t counter;                                       /**< nfc counter */
+    uint8_t end_page;                                       /**< last page */
+    uint8_t storage_size;                                   /**< get version storage size */
+    uint8_t present;                                        /**< tag in the field */
+    uint8_t state;                                          /**< iso14443-3 state */
+    uint8_t from_halt;                                      /**< woken up from halt */
+    uint8_t counter_incremented;                            /**< nfc counter incremented since power up */
+    uint8_t comp_write_page;                                /**< pending comp write page */
+    uint8_t auth_fail;                                      /**< negative password attempts */
+} emulator_tag_t;
+
+/**
+ * @brief emulator handle structure definition
+ */
+typedef struct emulator_handle_s
+{
+    emulator_tag_t tag[NTAG21X_EMULATOR_MAX_TAGS];          /**< tags */
+    uint8_t tags;                                           /**< number of tags */
+    uint32_t reader_latency_ns;                             /**< reader latency per frame */
+    uint32_t timeout_ns;                                    /**< reader timeout */
+    void (*delay_ns)(uint32_t ns);                          /**< real time delay function */
+    ntag21x_emulator_statistics_t statistics;               /**< statistics */
+    uint8_t async_pending;                                  /**< submitted frame not polled yet */
+    uint8_t async_res;                                      /**< submitted frame result */
+    uint8_t async_len;                                      /**< submitted frame response length */
+    uint8_t async_buf[256];                                 /**< submitted frame response */
+    uint32_t poll_count;                                    /**< busy polls before completion */
+    uint32_t polls;                                         /**< busy polls left */
+} emulator_handle_t;
+
+static emulator_handle_t gs_emulator;                    /**< emulator handle */
+static emulator_tag_t *gs_tag = &gs_emulator.tag[0];     /**< selected tag or the tag handling the frame */
+
+/**
+ * @brief     crc calculation
+ * @param[in] *p pointer to a data buffer
+ * @param[in] len data length
+ * @param[out] *output pointer to a crc buffer
+ * @note      independent bitwise crc_a so that the driver crc is checked against it
+ */
+static void a_emulator_crc(const uint8_t *p, uint16_t len, uint8_t output[2])
+{
+    uint16_t crc = 0x6363;
+    uint16_t i;
+    uint8_t j;
+
+    for (i = 0; i < len; i++)                                    /* all bytes */
+    {
+        crc ^= p[i];                                             /* xor the byte */
+        for (j = 0; j < 8; j++)                                  /* 8 bits */
+        {
+            if ((crc & 0x0001) != 0)                             /* check lsb */
+            {
+                crc = (uint16_t)((crc >> 1) ^ 0x8408);           /* reflected polynomial */
+            }
+            else
+            {
+                crc = (uint16_t)(crc >> 1);                      /* shift */
+            }
+        }
+    }
+    output[0] = (uint8_t)(crc & 0xFF);                           /* lsb */
+    output[1] = (uint8_t)((crc >> 8) & 0xFF);                    /* msb */
+}
+
+/**
+ * @brief     check the crc of a frame
+ * @param[in] *p pointer to a frame buffer
+ * @param[in] len frame length including the crc
+ * @return    1 if the crc is valid, 0 otherwise
+ * @note      none
+ */
+static uint8_t a_emulator_crc_valid(const uint8_t *p, uint8_t len)
+{
+    uint8_t crc[2];
+
+    if (len < 3)                                                 /* check the length */
+    {
+        return 0;                                                /* invalid */
+    }
+    a_emulator_crc(p, (uint16_t)(len - 2), crc);                 /* get the crc */
+
+    return (uint8_t)((crc[0] == p[len - 2]) && (crc[1] == p[len - 1]));
+}
+
+/**
+ * @brief     get the frame delay time after a pcd frame
+ * @param[in] last last transmitted byte or short frame
+ * @param[in] short_frame 1 for a 7 bits short frame
+ * @return    frame delay time in fc
+ * @note      n * 128 + 84 if the last bit is 1, n * 128 + 20 if it is 0, n = 9
+ */
+static uint32_t a_emulator_fdt(uint8_t last, uint8_t short_frame)
+{
+    uint8_t bit;
+
+    if (short_frame != 0)                                        /* short frame */
+    {
+        bit = (uint8_t)((last >> 6) & 0x01);                     /* last data bit */
+    }
+    else
+    {
+        bit = last;                                              /* odd parity bit */
+        bit ^= bit >> 4;
+        bit ^= bit >> 2;
+        bit ^= bit >> 1;
+        bit = (uint8_t)((bit & 0x01) ^ 0x01);
+    }
+
+    return (bit != 0) ? (9 * 128 + 84) : (9 * 128 + 20);
+}
+
+/**
+ * @brief     spend emulated time
+ * @param[in] cycles time in fc
+ * @param[in] extra_ns time in ns
+ * @note      none
+ */
+static void a_emulator_spend(uint64_t cycles, uint32_t extra_ns)
+{
+    uint64_t ns;
+
+    ns = cycles * 1000000000ULL / NTAG21X_EMULATOR_CARRIER_HZ + extra_ns;        /* convert to ns */
+    gs_emulator.statistics.cycles += cycles;                                     /* add the cycles */
+    gs_emulator.statistics.elapsed_ns += ns;                                     /* add the time */
+    if (gs_emulator.delay_ns != NULL)                                            /* real time mode */
+    {
+        while (ns > 0xFFFFFFFFULL)                                               /* split long delays */
+        {
+            gs_emulator.delay_ns(0xFFFFFFFFU);                                   /* delay */
+            ns -= 0xFFFFFFFFULL;                                                 /* next */
+        }
+        gs_emulator.delay_ns((uint32_t)ns);                                      /* delay */
+    }
+}
+
+/**
+ * @brief  get the first page of the access protected area
+ * @return auth0
+ * @note   none
+ */
+static uint8_t a_emulator_auth0(void)
+{
+    return gs_tag->memory[(gs_tag->end_page - 3) * 4 + 3];
+}
+
+/**
+ * @brief  get the access byte
+ * @return access byte
+ * @note   none
+ */
+static uint8_t a_emulator_access(void)
+{
+    return gs_tag->memory[(gs_tag->end_page - 2) * 4 + 0];
+}
+
+/**
+ * @brief  check the authentication state
+ * @return 1 if authenticated, 0 otherwise
+ * @note   none
+ */
+static uint8_t a_emulator_authenticated(void)
+{
+    return (uint8_t)(gs_tag->state == NTAG21X_EMULATOR_STATE_AUTHENTICATED);
+}
+
+/**
+ * @brief  get the end of the readable area
+ * @return first page that can not be read
+ * @note   pages from auth0 are hidden when read protection is enabled
+ */
+static uint16_t a_emulator_read_limit(void)
+{
+    uint8_t auth0;
+
+    auth0 = a_emulator_auth0();                                                  /* get auth0 */
+    if (((a_emulator_access() & (1 << 7)) != 0) &&
+        (a_emulator_authenticated() == 0) && (auth0 <= gs_tag->end_page))        /* read protected */
+    {
+        return auth0;                                                            /* limit at auth0 */
+    }
+
+    return (uint16_t)(gs_tag->end_page + 1);                                     /* whole memory */
+}
+
+/**
+ * @brief     check the lock bits of a page
+ * @param[in] page checked page
+ * @return    1 if locked, 0 otherwise
+ * @note      only user memory and the capability container are covered
+ */
+static uint8_t a_emulator_page_locked(uint8_t page)
+{
+    uint8_t *lock;
+    uint16_t bit;
+
+    if (page == 3)                                                               /* capability container */
+    {
+        return (uint8_t)((gs_tag->memory[2 * 4 + 2] >> 3) & 0x01);              /* l-cc */
+    }
+    if (page < 8)                                                                /* page 4 - 7 */
+    {
+        return (uint8_t)((gs_tag->memory[2 * 4 + 2] >> page) & 0x01);           /* l4 - l7 */
+    }
+    if (page < 16)                                                               /* page 8 - 15 */
+    {
+        return (uint8_t)((gs_tag->memory[2 * 4 + 3] >> (page - 8)) & 0x01);     /* l8 - l15 */
+    }
+    if (page >= gs_tag->end_page - 4)                                            /* not user memory */
+    {
+        return 0;                                                                /* not covered */
+    }
+    lock = &gs_tag->memory[(gs_tag->end_page - 4) * 4];                          /* dynamic lock bytes */
+    if (gs_tag->end_page == 0x2C)                                                /* ntag213 */
+    {
+        bit = (uint16_t)((page - 16) / 2);                                       /* 2 pages per bit */
+    }
+    else
+    {
+        bit = (uint16_t)((page - 16) / 16);                                      /* 16 pages per bit */
+    }
+
+    return (uint8_t)((lock[bit / 8] >> (bit % 8)) & 0x01);                       /* get the bit */
+}
+
+/**
+ * @brief      read one page as seen over the air
+ * @param[in]  page read page
+ * @param[out] *data pointer to a data buffer
+ * @note       password and pack are always read as zero
+ */
+static void a_emulator_read_page(uint8_t page, uint8_t data[4])
+{
+    if (page >= gs_tag->end_page - 1)                                            /* pwd and pack */
+    {
+        memset(data, 0, 4);                                                      /* read as 0 */
+    }
+    else
+    {
+        memcpy(data, &gs_tag->memory[page * 4], 4);                              /* copy the page */
+    }
+}
+
+/**
+ * @brief         overlay the uid and nfc counter ascii mirror
+ * @param[in]     page first page of the buffer
+ * @param[in,out] *buf pointer to a page data buffer
+ * @param[in]     len buffer length
+ * @note          none
+ */
+static void a_emulator_mirror(uint16_t page, uint8_t *buf, uint16_t len)
+{
+    const char hex[] = "0123456789ABCDEF";
+    uint8_t cfg;
+    uint8_t mirror_page;
+    uint8_t ascii[21];
+    uint8_t ascii_len;
+    uint8_t i;
+    uint16_t start;
+    uint16_t addr;
+
+    cfg = gs_tag->memory[(gs_tag->end_page - 3) * 4 + 0];                        /* get mirror byte */
+    mirror_page = gs_tag->memory[(gs_tag->end_page - 3) * 4 + 2];                /* get mirror page */
+    if ((((cfg >> 6) & 0x3) == 0) || (mirror_page < 4) ||
+        (mirror_page >= gs_tag->end_page - 4))                                   /* mirror disabled */
+    {
+        return;                                                                  /* nothing to do */
+    }
+
+    ascii_len = 0;                                                               /* init 0 */
+    if ((((cfg >> 6) & 0x3) & 0x1) != 0)                                         /* uid mirror */
+    {
+        for (i = 0; i < 7; i++)                                                  /* 7 bytes */
+        {
+            ascii[ascii_len++] = (uint8_t)hex[(gs_tag->uid[i] >> 4) & 0xF];      /* high nibble */
+            ascii[ascii_len++] = (uint8_t)hex[gs_tag->uid[i] & 0xF];             /* low nibble */
+        }
+    }
+    if ((((cfg >> 6) & 0x3) & 0x2) != 0)                                         /* nfc counter mirror */
+    {
+        if (ascii_len != 0)                                                      /* uid mirrored too */
+        {
+            ascii[ascii_len++] = 'x';                                            /* separator */
+        }
+        for (i = 0; i < 3; i++)                                                  /* 3 bytes, msb first */
+        {
+            uint8_t b = (uint8_t)((gs_tag->counter >> (16 - 8 * i)) & 0xFF);
+
+            ascii[ascii_len++] = (uint8_t)hex[(b >> 4) & 0xF];                   /* high nibble */
+            ascii[ascii_len++] = (uint8_t)hex[b & 0xF];                          /* low nibble */
+        }
+    }
+
+    start = (uint16_t)(mirror_page * 4 + ((cfg >> 4) & 0x3));                   /* mirror start byte */
+    for (i = 0; i < ascii_len; i++)                                              /* overlay */
+    {
+        addr = (uint16_t)(start + i);                                            /* byte address */
+        if ((addr >= page * 4) && (addr < page * 4 + len))                       /* inside the buffer */
+        {
+            buf[addr - page * 4] = ascii[i];                                     /* set the byte */
+        }
+    }
+}
+
+/**
+ * @brief  increase the nfc counter on the first read after power up
+ * @note   none
+ */
+static void a_emulator_count(void)
+{
+    if (((a_emulator_access() & (1 << 4)) != 0) &&
+        (gs_tag->counter_incremented == 0))                                      /* nfc counter enabled */
+    {
+        if (gs_tag->counter < 0xFFFFFF)                                          /* not saturated */
+        {
+            gs_tag->counter++;                                                   /* increase */
+        }
+        gs_tag->counter_incremented = 1;                                         /* once per power up */
+    }
+}
+
+/**
+ * @brief     write one page
+ * @param[in] page written page
+ * @param[in] *data pointer to a data buffer
+ * @return    ack or nak code
+ * @note      otp and lock bytes are or-ed, block bits freeze the lock bits
+ */
+static uint8_t a_emulator_write_page(uint8_t page, const uint8_t data[4])
+{
+    uint8_t *p;
+    uint8_t mask;
+    uint8_t i;
+
+    if ((page < 2) || (page > gs_tag->end_page))                                 /* check the page */
+    {
+        return EMULATOR_NAK_INVALID_ARGUMENT;                                    /* nak */
+    }
+    if ((page >= a_emulator_auth0()) && (a_emulator_authenticated() == 0))       /* write protected */
+    {
+        return EMULATOR_NAK_INVALID_ARGUMENT;                                    /* nak */
+    }
+
+    p = &gs_tag->memory[page * 4];                                               /* page address */
+    if (page == 2)                                                               /* static lock bytes */
+    {
+        mask = 0x07;                                                             /* block bits */
+        if ((p[2] & 0x01) == 0)                                                  /* bl-cc */
+        {
+            mask |= 0x08;                                                        /* l-cc */
+        }
+        if ((p[2] & 0x02) == 0)                                                  /* bl9-4 */
+        {
+            mask |= 0xF0;                                                        /* l4 - l7 */
+        }
+        p[2] |= data[2] & mask;                                                  /* or the lock bits */
+        mask = 0x00;                                                             /* init 0 */
+        if ((p[2] & 0x02) == 0)                                                  /* bl9-4 */
+        {
+            mask |= 0x03;                                                        /* l8 - l9 */
+        }
+        if ((p[2] & 0x04) == 0)                                                  /* bl15-10 */
+        {
+            mask |= 0xFC;                                                        /* l10 - l15 */
+        }
+        p[3] |= data[3] & mask;                                                  /* or the lock bits */
+    }
+    else if (page == 3)                                                          /* capability container */
+    {
+        if (a_emulator_page_locked(page) != 0)                                   /* locked */
+        {
+            return EMULATOR_NAK_INVALID_ARGUMENT;                                /* nak */
+        }
+        for (i = 0; i < 4; i++)                                                  /* otp */
+        {
+            p[i] |= data[i];                                                     /* or the bits */
+        }
+    }
+    else if (page < gs_tag->end_page - 4)                                        /* user memory */
+    {
+        if (a_emulator_page_locked(page) != 0)                                   /* locked */
+        {
+            return EMULATOR_NAK_INVALID_ARGUMENT;                                /* nak */
+        }
+        memcpy(p, data, 4);                                                      /* copy the page */
+    }
+    else if (page == gs_tag->end_page - 4)                                       /* dynamic lock bytes */
+    {
+        mask = p[2];                                                             /* block bits */
+        for (i = 0; i < 2; i++)                                                  /* lock bytes */
+        {
+            uint8_t allow = 0;
+            uint8_t j;
+
+            for (j = 0; j < 4; j++)                                              /* 4 block bits per byte */
+            {
+                if (((mask >> (i * 4 + j)) & 0x01) == 0)                         /* not blocked */
+                {
+                    allow |= (uint8_t)(0x03 << (j * 2));                         /* 2 lock bits */
+                }
+            }
+            p[i] |= data[i] & allow;                                             /* or the lock bits */
+        }
+        p[2] |= data[2];                                                         /* or the block bits */
+    }
+    else if (page < gs_tag->end_page - 1)                                        /* cfg0 and cfg1 */
+    {
+        if ((a_emulator_access() & (1 << 6)) != 0)                               /* cfglck */
+        {
+            return EMULATOR_NAK_INVALID_ARGUMENT;                                /* nak */
+        }
+        memcpy(p, data, 4);                                                      /* copy the page */
+    }
+    else                                                                         /* pwd and pack */
+    {
+        memcpy(p, data, 4);                                                      /* copy the page */
+    }
+    gs_emulator.statistics.eeprom_writes++;                                      /* programming cycle */
+
+    return EMULATOR_ACK;                                                         /* ack */
+}
+
+/**
+ * @brief      put a crc protected response
+ * @param[out] *resp pointer to a response buffer
+ * @param[in]  len data length
+ * @return     response length
+ * @note       none
+ */
+static uint8_t a_emulator_crc_response(uint8_t *resp, uint8_t len)
+{
+    a_emulator_crc(resp, len, resp + len);                                       /* append the crc */
+
+    return (uint8_t)(len + 2);                                                   /* data and crc */
+}
+
+/**
+ * @brief      handle a frame in the active state
+ * @param[in]  *in pointer to an input frame
+ * @param[in]  in_len input length
+ * @param[out] *resp pointer to a response buffer
+ * @param[out] *resp_len pointer to a response length buffer
+ * @param[out] *cycles pointer to a tag processing time buffer
+ * @return     0xFE for a normal frame, ack, nak code or EMULATOR_NO_RESPONSE
+ * @note       none
+ */
+static uint8_t a_emulator_active(uint8_t *in, uint8_t in_len, uint8_t *resp, uint8_t *resp_len, uint32_t *cycles)
+{
+    uint8_t res;
+    uint16_t limit;
+    uint16_t i;
+    uint8_t page;
+
+    if (gs_tag->comp_write_page != EMULATOR_COMP_WRITE_NONE)                     /* comp write data phase */
+    {
+        page = gs_tag->comp_write_page;                                          /* get the page */
+        gs_tag->comp_write_page = EMULATOR_COMP_WRITE_NONE;                      /* clear the phase */
+        if ((in_len != 18) || (a_emulator_crc_valid(in, in_len) == 0))           /* check the frame */
+        {
+            return EMULATOR_NAK_CRC_ERROR;                                       /* nak */
+        }
+        res = a_emulator_write_page(page, in);                                   /* write the first 4 bytes */
+        if (res == EMULATOR_ACK)                                                 /* check the result */
+        {
+            *cycles += NTAG21X_EMULATOR_EEPROM_WRITE_CYCLES;                     /* programming time */
+        }
+
+        return res;                                                              /* return the result */
+    }
+    if (in[0] == EMULATOR_COMMAND_HALT)                                          /* halt */
+    {
+        if ((in_len == 4) && (in[1] == 0x00) && (a_emulator_crc_valid(in, in_len) != 0))
+        {
+            gs_tag->state = NTAG21X_EMULATOR_STATE_HALT;                         /* halt */
+
+            return EMULATOR_NO_RESPONSE;                                         /* no response */
+        }
+
+        return EMULATOR_NAK_CRC_ERROR;                                           /* nak */
+    }
+    if (a_emulator_crc_valid(in, in_len) == 0)                                   /* check the crc */
+    {
+        return EMULATOR_NAK_CRC_ERROR;                                           /* nak */
+    }
+
+    switch (in[0])
+    {
+        case EMULATOR_COMMAND_GET_VERSION :
+        {
+            if (in_len != 3)                                                     /* check the length */
+            {
+                return EMULATOR_NAK_INVALID_ARGUMENT;                            /* nak */
+            }
+            resp[0] = 0x00;                                                      /* fixed header */
+            resp[1] = 0x04;                                                      /* nxp */
+            resp[2] = 0x04;                                                      /* ntag */
+            resp[3] = 0x02;                                                      /* 50 pF */
+            resp[4] = 0x01;                                                      /* major version */
+            resp[5] = 0x00;                                                      /* minor version */
+            resp[6] = gs_tag->storage_size;                                      /* storage size */
+            resp[7] = 0x03;                                                      /* iso14443-3 */
+            *resp_len = a_emulator_crc_response(resp, 8);                        /* append the crc */
+
+            return 0xFE;                                                         /* frame */
+        }
+        case EMULATOR_COMMAND_READ :
+        {
+            limit = a_emulator_read_limit();                                     /* readable area */
+            if ((in_len != 4) || (in[1] >= limit))                               /* check the address */
+            {
+                return EMULATOR_NAK_INVALID_ARGUMENT;                            /* nak */
+            }
+            a_emulator_count();                                                  /* nfc counter */
+            for (i = 0; i < 4; i++)                                              /* 4 pages */
+            {
+                page = (uint8_t)((in[1] + i) % limit);                           /* roll over */
+                a_emulator_read_page(page, resp + i * 4);                        /* read one page */
+                a_emulator_mirror(page, resp + i * 4, 4);                        /* mirror */
+            }
+            *resp_len = a_emulator_crc_response(resp, 16);                       /* append the crc */
+
+            return 0xFE;                                                         /* frame */
+        }
+        case EMULATOR_COMMAND_FAST_READ :
+        {
+            limit = a_emulator_read_limit();                                     /* readable area */
+            if ((in_len != 5) || (in[1] > in[2]) || (in[2] >= limit))            /* check the address */
+            {
+                return EMULATOR_NAK_INVALID_ARGUMENT;                            /* nak */
+            }
+            if ((in[2] - in[1] + 1) * 4 + 2 > 255)                               /* frame too long */
+            {
+                return EMULATOR_NAK_INVALID_ARGUMENT;                            /* nak */
+            }
+            a_emulator_count();                                                  /* nfc counter */
+            for (i = in[1]; i <= in[2]; i++)                                     /* all pages */
+            {
+                a_emulator_read_page((uint8_t)i, resp + (i - in[1]) * 4);        /* read one page */
+            }
+            a_emulator_mirror(in[1], resp, (uint16_t)((in[2] - in[1] + 1) * 4)); /* mirror */
+            *resp_len = a_emulator_crc_response(resp, (uint8_t)((in[2] - in[1] + 1) * 4));
+
+            return 0xFE;                                                         /* frame */
+        }
+        case EMULATOR_COMMAND_WRITE :
+        {
+            if (in_len != 8)                                                     /* check the length */
+            {
+                return EMULATOR_NAK_INVALID_ARGUMENT;                            /* nak */
+            }
+            res = a_emulator_write_page(in[1], in + 2);                          /* write the page */
+            if (res == EMULATOR_ACK)                                             /* check the result */
+            {
+                *cycles += NTAG21X_EMULATOR_EEPROM_WRITE_CYCLES;                 /* programming time */
+            }
+
+            return res;                                                          /* return the result */
+        }
+        case EMULATOR_COMMAND_COMP_WRITE :
+        {
+            if ((in_len != 4) || (in[1] < 2) || (in[1] > gs_tag->end_page))      /* check the address */
+            {
+                return EMULATOR_NAK_INVALID_ARGUMENT;                            /* nak */
+            }
+            gs_tag->comp_write_page = in[1];                                     /* wait for the data */
+
+            return EMULATOR_ACK;                                                 /* ack */
+        }
+        case EMULATOR_COMMAND_READ_CNT :
+        {
+            if ((in_len != 4) || (in[1] != 0x02) ||
+                ((a_emulator_access() & (1 << 4)) == 0))                         /* counter disabled */
+            {
+                return EMULATOR_NAK_INVALID_ARGUMENT;                            /* nak */
+            }
+            if (((a_emulator_access() & (1 << 3)) != 0) &&
+                (a_emulator_authenticated() == 0))                               /* password protected */
+            {
+                return EMULATOR_NAK_INVALID_ARGUMENT;                            /* nak */
+            }
+            resp[0] = (uint8_t)((gs_tag->counter >> 0) & 0xFF);                  /* lsb */
+            resp[1] = (uint8_t)((gs_tag->counter >> 8) & 0xFF);                  /* middle */
+            resp[2] = (uint8_t)((gs_tag->counter >> 16) & 0xFF);                 /* msb */
+            *resp_len = a_emulator_crc_response(resp, 3);                        /* append the crc */
+
+            return 0xFE;                                                         /* frame */
+        }
+        case EMULATOR_COMMAND_PWD_AUTH :
+        {
+            uint8_t authlim;
+
+            if (in_len != 7)                                                     /* check the length */
+            {
+                return EMULATOR_NAK_INVALID_ARGUMENT;                            /* nak */
+            }
+            authlim = a_emulator_access() & 0x07;                                /* get authlim */
+            if ((authlim != 0) && (gs_tag->auth_fail >= (1 << authlim)))         /* limit reached */
+            {
+                return EMULATOR_NAK_AUTH_LIMIT;                                  /* nak */
+            }
+            if (memcmp(in + 1, &gs_tag->memory[(gs_tag->end_page - 1) * 4], 4) != 0)
+            {
+                if (gs_tag->auth_fail < 0xFF)                                    /* not saturated */
+                {
+                    gs_tag->auth_fail++;                                         /* negative attempt */
+                }
+
+                return EMULATOR_NAK_INVALID_ARGUMENT;                            /* nak */
+            }
+            gs_tag->auth_fail = 0;                                               /* reset the counter */
+            gs_tag->state = NTAG21X_EMULATOR_STATE_AUTHENTICATED;                /* authenticated */
+            resp[0] = gs_tag->memory[gs_tag->end_page * 4 + 0];                  /* pack0 */
+            resp[1] = gs_tag->memory[gs_tag->end_page * 4 + 1];                  /* pack1 */
+            *resp_len = a_emulator_crc_response(resp, 2);                        /* append the crc */
+
+            return 0xFE;                                                         /* frame */
+        }
+        case EMULATOR_COMMAND_READ_SIG :
+        {
+            if ((in_len != 4) || (in[1] != 0x00))                                /* check the address */
+            {
+                return EMULATOR_NAK_INVALID_ARGUMENT;                            /* nak */
+            }
+            memcpy(resp, gs_tag->signature, 32);                                 /* copy the signature */
+            *resp_len = a_emulator_crc_response(resp, 32);                       /* append the crc */
+
+            return 0xFE;                                                         /* frame */
+        }
+        default :
+        {
+            return EMULATOR_NAK_INVALID_ARGUMENT;                                /* unknown command */
+        }
+    }
+}
+
+/**
+ * @brief      handle a frame
+ * @param[in]  *in pointer to an input frame
+ * @param[in]  in_len input length
+ * @param[out] *resp pointer to a response buffer
+ * @param[out] *resp_len pointer to a response length buffer
+ * @param[out] *cycles pointer to a tag processing time buffer
+ * @return     0xFE for a normal frame, ack, nak code or EMULATOR_NO_RESPONSE
+ * @note       none
+ */
+static uint8_t a_emulator_process(uint8_t *in, uint8_t in_len, uint8_t *resp, uint8_t *resp_len, uint32_t *cycles)
+{
+    uint8_t res;
+    uint8_t level;
+    uint8_t *uid;
+    uint8_t i;
+
+    if ((in_len == 1) && ((in[0] == EMULATOR_COMMAND_REQUEST) ||
+        (in[0] == EMULATOR_COMMAND_WAKE_UP)))                                    /* request or wake up */
+    {
+        if ((gs_tag->state == NTAG21X_EMULATOR_STATE_IDLE) ||
+            ((gs_tag->state == NTAG21X_EMULATOR_STATE_HALT) &&
+            (in[0] == EMULATOR_COMMAND_WAKE_UP)))                                /* check the state */
+        {
+            gs_tag->from_halt = (uint8_t)(gs_tag->state == NTAG21X_EMULATOR_STATE_HALT);
+            gs_tag->state = NTAG21X_EMULATOR_STATE_READY1;                       /* ready 1 */
+            gs_tag->comp_write_page = EMULATOR_COMP_WRITE_NONE;                  /* clear the phase */
+            resp[0] = 0x44;                                                      /* atqa */
+            resp[1] = 0x00;                                                      /* atqa */
+            *resp_len = 2;                                                       /* set the length */
+
+            return 0xFE;                                                         /* frame */
+        }
+        if (gs_tag->state != NTAG21X_EMULATOR_STATE_HALT)                        /* unexpected frame */
+        {
+            gs_tag->state = (gs_tag->from_halt != 0) ? NTAG21X_EMULATOR_STATE_HALT :
+                                                               NTAG21X_EMULATOR_STATE_IDLE;
+        }
+
+        return EMULATOR_NO_RESPONSE;                                             /* no response */
+    }
+
+    switch (gs_tag->state)
+    {
+        case NTAG21X_EMULATOR_STATE_READY1 :
+        case NTAG21X_EMULATOR_STATE_READY2 :
+        {
+            level = (gs_tag->state == NTAG21X_EMULATOR_STATE_READY1) ?
+                     EMULATOR_COMMAND_SEL_CL1 : EMULATOR_COMMAND_SEL_CL2;        /* cascade level */
+            if ((in_len < 2) || (in[0] != level))                                /* unexpected frame */
+            {
+                break;                                                           /* back to idle */
+            }
+            if (level == EMULATOR_COMMAND_SEL_CL1)                               /* cascade level 1 */
+            {
+                resp[0] = 0x88;                                                  /* cascade tag */
+                resp[1] = gs_tag->uid[0];                                        /* uid0 */
+                resp[2] = gs_tag->uid[1];                                        /* uid1 */
+                resp[3] = gs_tag->uid[2];                                        /* uid2 */
+            }
+            else
+            {
+                uid = &gs_tag->uid[3];                                           /* uid3 - uid6 */
+                memcpy(resp, uid, 4);                                            /* copy the uid */
+            }
+            resp[4] = (uint8_t)(resp[0] ^ resp[1] ^ resp[2] ^ resp[3]);          /* bcc */
+            if ((in_len == 2) && (in[1] == 0x20))                                /* anti collision */
+            {
+                *resp_len = 5;                                                   /* uid and bcc */
+
+                return 0xFE;                                                     /* frame */
+            }
+            if ((in_len == 9) && (in[1] == 0x70) &&
+                (a_emulator_crc_valid(in, in_len) != 0))                         /* select */
+            {
+                for (i = 0; i < 5; i++)                                          /* check the uid */
+                {
+                    if (in[2 + i] != resp[i])                                    /* not this tag */
+                    {
+                        return EMULATOR_NO_RESPONSE;                             /* no response */
+                    }
+                }
+                if (level == EMULATOR_COMMAND_SEL_CL1)                           /* cascade level 1 */
+                {
+                    gs_tag->state = NTAG21X_EMULATOR_STATE_READY2;               /* ready 2 */
+                    resp[0] = 0x04;                                              /* sak, uid not complete */
+                }
+                else
+                {
+                    gs_tag->state = NTAG21X_EMULATOR_STATE_ACTIVE;               /* active */
+                    resp[0] = 0x00;                                              /* sak, uid complete */
+                }
+                *resp_len = 1;                                                   /* crc is removed by the reader */
+
+                return 0xFE;                                                     /* frame */
+            }
+
+            return EMULATOR_NO_RESPONSE;                                         /* no response */
+        }
+        case NTAG21X_EMULATOR_STATE_ACTIVE :
+        case NTAG21X_EMULATOR_STATE_AUTHENTICATED :
+        {
+            res = a_emulator_active(in, in_len, resp, resp_len, cycles);         /* active commands */
+            if ((res != 0xFE) && (res != EMULATOR_ACK) &&
+                (res != EMULATOR_NO_RESPONSE))                                   /* nak */
+            {
+                gs_tag->comp_write_page = EMULATOR_COMP_WRITE_NONE;              /* clear the phase */
+                gs_tag->state = (gs_tag->from_halt != 0) ? NTAG21X_EMULATOR_STATE_HALT :
+                                                                   NTAG21X_EMULATOR_STATE_IDLE;
+            }
+
+            return res;                                                          /* return the result */
+        }
+        default :
+        {
+            return EMULATOR_NO_RESPONSE;                                         /* idle and halt stay silent */
+        }
+    }
+
+    gs_tag->state = (gs_tag->from_halt != 0) ? NTAG21X_EMULATOR_STATE_HALT :
+                                                       NTAG21X_EMULATOR_STATE_IDLE;        /* unexpected frame */
+
+    return EMULATOR_NO_RESPONSE;                                                 /* no response */
+}
+
+/**
+ * @brief     load a tag with its factory defaults
+ * @param[in] *tag pointer to a tag structure
+ * @param[in] type tag type
+ * @param[in] *uid pointer to a 7 bytes uid buffer
+ * @return    status code
+ *            - 0 success
+ *            - 2 type is invalid
+ * @note      none
+ */
+static uint8_t a_emulator_tag_init(emulator_tag_t *tag, ntag21x_emulator_type_t type, uint8_t uid[7])
+{
+    uint8_t *p;
+    uint8_t size;
+    emulator_tag_t *selected;
+
+    selected = gs_tag;                                                           /* save the selected tag */
+    gs_tag = tag;                                                                /* set the tag */
+    memset(gs_tag, 0, sizeof(emulator_tag_t));                                   /* clear the tag */
+    if (type == NTAG21X_EMULATOR_TYPE_NTAG213)                                   /* ntag213 */
+    {
+        gs_tag->end_page = 0x2C;                                                 /* 45 pages */
+        gs_tag->storage_size = 0x0F;                                             /* storage size */
+        size = 0x12;                                                             /* 144 bytes */
+    }
+    else if (type == NTAG21X_EMULATOR_TYPE_NTAG215)                              /* ntag215 */
+    {
+        gs_tag->end_page = 0x86;                                                 /* 135 pages */
+        gs_tag->storage_size = 0x11;                                             /* storage size */
+        size = 0x3E;                                                             /* 496 bytes */
+    }
+    else if (type == NTAG21X_EMULATOR_TYPE_NTAG216)                              /* ntag216 */
+    {
+        gs_tag->end_page = 0xE6;                                                 /* 231 pages */
+        gs_tag->storage_size = 0x13;                                             /* storage size */
+        size = 0x6D;                                                             /* 872 bytes */
+    }
+    else
+    {
+        return 2;                                                                /* return error */
+    }
+
+    memcpy(gs_tag->uid, uid, 7);                                                 /* copy the uid */
+    p = gs_tag->memory;                                                          /* memory */
+    p[0] = uid[0];                                                               /* uid0 */
+    p[1] = uid[1];                                                               /* uid1 */
+    p[2] = uid[2];                                                               /* uid2 */
+    p[3] = (uint8_t)(0x88 ^ uid[0] ^ uid[1] ^ uid[2]);                           /* bcc0 */
+    p[4] = uid[3];                                                               /* uid3 */
+    p[5] = uid[4];                                                               /* uid4 */
+    p[6] = uid[5];                                                               /* uid5 */
+    p[7] = uid[6];                                                               /* uid6 */
+    p[8] = (uint8_t)(uid[3] ^ uid[4] ^ uid[5] ^ uid[6]);                         /* bcc1 */
+    p[9] = 0x48;                                                                 /* internal */
+    p[12] = 0xE1;                                                                /* ndef magic number */
+    p[13] = 0x10;                                                                /* version 1.0 */
+    p[14] = size;                                                                /* data area size */
+    p[15] = 0x00;                                                                /* read and write access */
+    p[16] = 0x03;                                                                /* empty ndef message tlv */
+    p[17] = 0x00;                                                                /* length */
+    p[18] = 0xFE;                                                                /* terminator tlv */
+    p = &gs_tag->memory[(gs_tag->end_page - 4) * 4];                             /* dynamic lock */
+    p[3] = 0xBD;                                                                 /* rfui */
+    p += 4;                                                                      /* cfg0 */
+    p[0] = 0x04;                                                                 /* strong modulation */
+    p[3] = 0xFF;                                                                 /* auth0, protection disabled */
+    p += 4;                                                                      /* cfg1 */
+    p[1] = 0x05;                                                                 /* rfui */
+    p += 4;                                                                      /* pwd */
+    memset(p, 0xFF, 4);                                                          /* default password */
+
+    gs_tag->present = 1;                                                         /* in the field */
+    gs_tag->state = NTAG21X_EMULATOR_STATE_IDLE;                                 /* idle */
+    gs_tag->comp_write_page = EMULATOR_COMP_WRITE_NONE;                          /* no pending write */
+    gs_tag = selected;                                                           /* restore the selected tag */
+
+    return 0;                                                                    /* success return 0 */
+}
+
+/**
+ * @brief     emulator init
+ * @param[in] type tag type
+ * @param[in] *uid pointer to a 7 bytes uid buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ *            - 2 type is invalid
+ * @note      the memory is loaded with the factory defaults of the chosen type,
+ *            the field holds this one tag and it is selected
+ */
+uint8_t ntag21x_emulator_init(ntag21x_emulator_type_t type, uint8_t uid[7])
+{
+    if (uid == NULL)                                                             /* check the uid */
+    {
+        return 1;                                                                /* return error */
+    }
+    memset(&gs_emulator, 0, sizeof(emulator_handle_t));                          /* clear the handle */
+    gs_tag = &gs_emulator.tag[0];                                                /* select the first tag */
+    gs_emulator.timeout_ns = 5000000;                                            /* 5 ms */
+    if (a_emulator_tag_init(gs_tag, type, uid) != 0)                             /* load the tag */
+    {
+        return 2;                                                                /* return error */
+    }
+    gs_emulator.tags = 1;                                                        /* one tag */
+
+    return 0;                                                                    /* success return 0 */
+}
+
+/**
+ * @brief      emulator add another tag to the field
+ * @param[in]  type tag type
+ * @param[in]  *uid pointer to a 7 bytes uid buffer
+ * @param[out] *index pointer to a tag index buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 the field is full
+ *             - 2 type is invalid
+ * @note       call after ntag21x_emulator_init, the selected tag does not change
+ */
+uint8_t ntag21x_emulator_add_tag(ntag21x_emulator_type_t type, uint8_t uid[7], uint8_t *index)
+{
+    if ((uid == NULL) || (index == NULL) || (gs_emulator.tags >= NTAG21X_EMULATOR_MAX_TAGS))   /* check the field */
+    {
+        return 1;                                                                          /* return error */
+    }
+    if (a_emulator_tag_init(&gs_emulator.tag[gs_emulator.tags], type, uid) != 0)           /* load the tag */
+    {
+        return 2;                                                                          /* return error */
+    }
+    *index = gs_emulator.tags;                                                             /* set the index */
+    gs_emulator.tags++;                                                                    /* one more tag */
+
+    return 0;                                                                              /* success return 0 */
+}
+
+/**
+ * @brief     emulator select the tag of the memory, state and presence functions
+ * @param[in] index tag index
+ * @return    status code
+ *            - 0 success
+ *            - 1 index is invalid
+ * @note      none
+ */
+uint8_t ntag21x_emulator_select_tag(uint8_t index)
+{
+    if (index >= gs_emulator.tags)                       /* check the index */
+    {
+        return 1;                                        /* return error */
+    }
+    gs_tag = &gs_emulator.tag[index];                    /* select the tag */
+
+    return 0;                                            /* success return 0 */
+}
+
+/**
+ * @brief     emulator set the timing
+ * @param[in] reader_latency_ns reader overhead added to every frame
+ * @param[in] timeout_ns reader timeout spent when the tag does not answer
+ * @return    status code
+ *            - 0 success
+ * @note      none
+ */
+uint8_t ntag21x_emulator_set_timing(uint32_t reader_latency_ns, uint32_t timeout_ns)
+{
+    gs_emulator.reader_latency_ns = reader_latency_ns;        /* set the latency */
+    gs_emulator.timeout_ns = timeout_ns;                      /* set the timeout */
+
+    return 0;                                                 /* success return 0 */
+}
+
+/**
+ * @brief     emulator link a real time delay function
+ * @param[in] *delay_ns pointer to a delay_ns function address, NULL disables real time mode
+ * @return    status code
+ *            - 0 success
+ * @note      when linked, every frame really spends its emulated time
+ */
+uint8_t ntag21x_emulator_set_delay(void (*delay_ns)(uint32_t ns))
+{
+    gs_emulator.delay_ns = delay_ns;        /* set the delay */
+
+    return 0;                               /* success return 0 */
+}
+
+/**
+ * @brief     power down a tag
+ * @param[in] *tag pointer to a tag structure
+ * @note      none
+ */
+static void a_emulator_tag_reset(emulator_tag_t *tag)
+{
+    tag->state = NTAG21X_EMULATOR_STATE_IDLE;                          /* idle */
+    tag->from_halt = 0;                                                /* clear the flag */
+    tag->counter_incremented = 0;                                      /* count the next read */
+    tag->comp_write_page = EMULATOR_COMP_WRITE_NONE;                   /* no pending write */
+}
+
+/**
+ * @brief     emulator put the selected tag into or out of the field
+ * @param[in] enable bool value
+ * @return    status code
+ *            - 0 success
+ * @note      taking the tag out of the field powers it down
+ */
+uint8_t ntag21x_emulator_set_present(ntag21x_bool_t enable)
+{
+    if (enable == NTAG21X_BOOL_FALSE)                                  /* leave the field */
+    {
+        a_emulator_tag_reset(gs_tag);                                  /* power down */
+    }
+    gs_tag->present = (uint8_t)enable;                                 /* set the flag */
+
+    return 0;                                                          /* success return 0 */
+}
+
+/**
+ * @brief  emulator power cycle the tags
+ * @return status code
+ *         - 0 success
+ * @note   every tag in the field is reset
+ */
+uint8_t ntag21x_emulator_field_reset(void)
+{
+    uint8_t i;
+
+    for (i = 0; i < gs_emulator.tags; i++)                             /* all tags */
+    {
+        a_emulator_tag_reset(&gs_emulator.tag[i]);                     /* power down */
+    }
+
+    return 0;                                                          /* success return 0 */
+}
+
+/**
+ * @brief      emulator get the tag state
+ * @param[out] *state pointer to a state buffer
+ * @return     status code
+ *             - 0 success
+ * @note       none
+ */
+uint8_t ntag21x_emulator_get_state(ntag21x_emulator_state_t *state)
+{
+    *state = (ntag21x_emulator_state_t)gs_tag->state;            /* get the state */
+
+    return 0;                                                    /* success return 0 */
+}
+
+/**
+ * @brief      emulator read the memory without rf access
+ * @param[in]  page memory page
+ * @param[out] *data pointer to a data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 page is invalid
+ * @note       none
+ */
+uint8_t ntag21x_emulator_read_memory(uint8_t page, uint8_t data[4])
+{
+    if (page > gs_tag->end_page)                                 /* check the page */
+    {
+        return 1;                                                /* return error */
+    }
+    memcpy(data, &gs_tag->memory[page * 4], 4);                  /* copy the page */
+
+    return 0;                                                    /* success return 0 */
+}
+
+/**
+ * @brief     emulator write the memory without rf access
+ * @param[in] page memory page
+ * @param[in] *data pointer to a data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 page is invalid
+ * @note      lock bits and access conditions are not checked
+ */
+uint8_t ntag21x_emulator_write_memory(uint8_t page, uint8_t data[4])
+{
+    if (page > gs_tag->end_page)                                 /* check the page */
+    {
+        return 1;                                                /* return error */
+    }
+    memcpy(&gs_tag->memory[page * 4], data, 4);                  /* copy the page */
+
+    return 0;                                                    /* success return 0 */
+}
+
+/**
+ * @brief     emulator set the originality signature
+ * @param[in] *signature pointer to a signature buffer
+ * @return    status code
+ *            - 0 success
+ * @note      none
+ */
+uint8_t ntag21x_emulator_set_signature(uint8_t signature[32])
+{
+    memcpy(gs_tag->signature, signature, 32);                    /* copy the signature */
+
+    return 0;                                                    /* success return 0 */
+}
+
+/**
+ * @brief     emulator set the nfc counter
+ * @param[in] cnt counter value
+ * @return    status code
+ *            - 0 success
+ * @note      none
+ */
+uint8_t ntag21x_emulator_set_counter(uint32_t cnt)
+{
+    gs_tag->counter = cnt & 0xFFFFFF;                            /* 24 bits */
+
+    return 0;                                                    /* success return 0 */
+}
+
+/**
+ * @brief      emulator get the statistics
+ * @param[out] *statistics pointer to a statistics structure
+ * @return     status code
+ *             - 0 success
+ * @note       none
+ */
+uint8_t ntag21x_emulator_get_statistics(ntag21x_emulator_statistics_t *statistics)
+{
+    memcpy(statistics, &gs_emulator.statistics,
+           sizeof(ntag21x_emulator_statistics_t));                             /* copy the statistics */
+
+    return 0;                                                                  /* success return 0 */
+}
+
+/**
+ * @brief  emulator clear the statistics
+ * @return status code
+ *         - 0 success
+ * @note   none
+ */
+uint8_t ntag21x_emulator_clear_statistics(void)
+{
+    memset(&gs_emulator.statistics, 0, sizeof(ntag21x_emulator_statistics_t));        /* clear the statistics */
+
+    return 0;                                                                         /* success return 0 */
+}
+
+/**
+ * @brief  emulator contactless init
+ * @return status code
+ *         - 0 success
+ * @note   link with DRIVER_NTAG21X_LINK_CONTACTLESS_INIT
+ */
+uint8_t ntag21x_emulator_contactless_init(void)
+{
+    return ntag21x_emulator_field_reset();        /* field on */
+}
+
+/**
+ * @brief  emulator contactless deinit
+ * @return status code
+ *         - 0 success
+ * @note   link with DRIVER_NTAG21X_LINK_CONTACTLESS_DEINIT
+ */
+uint8_t ntag21x_emulator_contactless_deinit(void)
+{
+    return ntag21x_emulator_field_reset();        /* field off */
+}
+
+/**
+ * @brief         emulator contactless transceiver
+ * @param[in]     *in_buf pointer to a input buffer
+ * @param[in]     in_len input length
+ * @param[out]    *out_buf pointer to a output buffer
+ * @param[in,out] *out_len pointer to a output length buffer
+ * @return        status code
+ *                - 0 success
+ *                - 1 no response or the output buffer is too small
+ * @note          link with DRIVER_NTAG21X_LINK_CONTACTLESS_TRANSCEIVER
+ */
+uint8_t ntag21x_emulator_contactless_transceiver(uint8_t *in_buf, uint8_t in_len, uint8_t *out_buf, uint8_t *out_len)
+{
+    uint8_t res;
+    uint8_t resp[256];
+    uint8_t resp_len;
+    uint8_t other;
+    uint8_t other_buf[256];
+    uint8_t other_len;
+    uint8_t short_frame;
+    uint8_t answers;
+    uint8_t collision;
+    uint8_t i;
+    uint32_t tag_cycles;
+    uint32_t other_cycles;
+    uint64_t cycles;
+    emulator_tag_t *selected;
+
+    if ((in_buf == NULL) || (in_len == 0) || (out_buf == NULL) || (out_len == NULL))   /* check the buffers */
+    {
+        return 1;                                                                      /* return error */
+    }
+
+    gs_emulator.statistics.frames++;                                                   /* one more frame */
+    short_frame = (uint8_t)((in_len == 1) && ((in_buf[0] == EMULATOR_COMMAND_REQUEST) ||
+                            (in_buf[0] == EMULATOR_COMMAND_WAKE_UP)));                 /* 7 bits frame */
+    cycles = (short_frame != 0) ? (9 * NTAG21X_EMULATOR_BIT_CYCLES) :
+             ((2 + 9 * (uint64_t)in_len) * NTAG21X_EMULATOR_BIT_CYCLES);               /* pcd frame */
+    res = EMULATOR_NO_RESPONSE;                                                        /* init silent */
+    resp_len = 0;                                                                      /* init 0 */
+    tag_cycles = 0;                                                                    /* init 0 */
+    answers = 0;                                                                       /* no answer */
+    collision = 0;                                                                     /* no collision */
+    selected = gs_tag;                                                                 /* save the selected tag */
+    for (i = 0; i < gs_emulator.tags; i++)                                             /* every tag hears the frame */
+    {
+        if (gs_emulator.tag[i].present == 0)                                           /* not in the field */
+        {
+            continue;                                                                  /* next tag */
+        }
+        gs_tag = &gs_emulator.tag[i];                                                  /* set the tag */
+        other_len = 0;                                                                 /* init 0 */
+        other_cycles = 0;                                                              /* init 0 */
+        other = a_emulator_process(in_buf, in_len, other_buf, &other_len, &other_cycles);
+        if (other == EMULATOR_NO_RESPONSE)                                             /* tag is silent */
+        {
+            continue;                                                                  /* next tag */
+        }
+        if (answers == 0)                                                              /* first answer */
+        {
+            res = other;                                                               /* save the code */
+            resp_len = other_len;                                                      /* save the length */
+            memcpy(resp, other_buf, other_len);                                        /* save the response */
+            tag_cycles = other_cycles;                                                 /* save the time */
+        }
+        else if ((other != res) || (other_len != resp_len) ||
+                 (memcmp(other_buf, resp, resp_len) != 0))                             /* different answer */
+        {
+            collision = 1;                                                             /* collision */
+        }
+        answers++;                                                                     /* one more answer */
+    }
+    gs_tag = selected;                                                                 /* restore the selected tag */
+    if (answers == 0)                                                                  /* no tag answered */
+    {
+        a_emulator_spend(cycles, gs_emulator.reader_latency_ns + gs_emulator.timeout_ns);
+
+        return 1;                                                                      /* no response */
+    }
+
+    cycles += a_emulator_fdt(in_buf[in_len - 1], short_frame) + tag_cycles;            /* frame delay time */
+    if (res != 0xFE)                                                                   /* 4 bits ack or nak */
+    {
+        if (res != EMULATOR_ACK)                                                       /* nak */
+        {
+            gs_emulator.statistics.naks++;                                             /* one more nak */
+        }
+        resp[0] = res;                                                                 /* set the code */
+        resp_len = 1;                                                                  /* 1 byte */
+        cycles += (1 + 4) * NTAG21X_EMULATOR_BIT_CYCLES;                               /* picc frame */
+    }
+    else if ((resp_len == 1) && (in_len == 9))                                         /* sak with crc */
+    {
+        cycles += (2 + 9 * 3) * NTAG21X_EMULATOR_BIT_CYCLES;                           /* picc frame */
+    }
+    else
+    {
+        cycles += (2 + 9 * (uint64_t)resp_len) * NTAG21X_EMULATOR_BIT_CYCLES;          /* picc frame */
+    }
+    a_emulator_spend(cycles, gs_emulator.reader_latency_ns);                           /* spend the time */
+    if (collision != 0)                                                                /* the reader sees a collision */
+    {
+        gs_emulator.statistics.collisions++;                                           /* one more collision */
+
+        return 1;                                                                      /* return error */
+    }
+    gs_emulator.statistics.responses++;                                                /* one more response */
+
+    if (resp_len > *out_len)                                                           /* reader buffer overflow */
+    {
+        return 1;                                                                      /* return error */
+    }
+    memcpy(out_buf, resp, resp_len);                                                   /* copy the response */
+    *out_len = resp_len;                                                               /* set the length */
+
+    return 0;                                                                          /* success return 0 */
+}
+
+/**
+ * @brief      emulator contactless bit oriented transceiver
+ * @param[in]  *in_buf pointer to a input buffer
+ * @param[in]  in_bits input length in bits
+ * @param[out] *out_buf pointer to a 5 bytes output buffer
+ * @param[out] *out_bits pointer to a received bits buffer
+ * @param[out] *collision pointer to a collision flag buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 no response or the frame is invalid
+ * @note       link with DRIVER_NTAG21X_LINK_CONTACTLESS_TRANSCEIVER_BITS,
+ *             only anti collision frames with a partial uid are answered,
+ *             the first received bit is stored at bit in_bits % 8 of out_buf[0]
+ *             and the bits stop before the first collision
+ */
+uint8_t ntag21x_emulator_contactless_transceiver_bits(uint8_t *in_buf, uint8_t in_bits, uint8_t *out_buf,
+                                                      uint8_t *out_bits, uint8_t *collision)
+{
+    uint8_t known;
+    uint8_t level;
+    uint8_t agree;
+    uint8_t answers;
+    uint8_t cl[5];
+    uint8_t first[5];
+    uint8_t i;
+    uint8_t b;
+    uint8_t pos;
+    emulator_tag_t *tag;
+    uint64_t cycles;
+
+    if ((in_buf == NULL) || (out_buf == NULL) || (out_bits == NULL) || (collision == NULL))          /* check the buffers */
+    {
+        return 1;                                                                                    /* return error */
+    }
+    if ((in_bits < 16) || (in_bits > 16 + 39))                                                       /* check the length */
+    {
+        return 1;                                                                                    /* return error */
+    }
+    known = (uint8_t)(in_bits - 16);                                                                 /* known uid bits */
+    if ((in_buf[1] != (uint8_t)(((2 + known / 8) << 4) | (known % 8))) ||
+        ((in_buf[0] != EMULATOR_COMMAND_SEL_CL1) && (in_buf[0] != EMULATOR_COMMAND_SEL_CL2)))        /* check the frame */
+    {
+        return 1;                                                                                    /* return error */
+    }
+
+    gs_emulator.statistics.frames++;                                                                 /* one more frame */
+    cycles = (2 + (uint64_t)in_bits + in_bits / 8) * NTAG21X_EMULATOR_BIT_CYCLES;                    /* pcd frame */
+    agree = 40;                                                                                      /* all bits agree */
+    answers = 0;                                                                                     /* no answer */
+    for (i = 0; i < gs_emulator.tags; i++)                                                           /* every tag hears the frame */
+    {
+        tag = &gs_emulator.tag[i];                                                                   /* set the tag */
+        if ((tag->present == 0) || ((tag->state != NTAG21X_EMULATOR_STATE_READY1) &&
+            (tag->state != NTAG21X_EMULATOR_STATE_READY2)))                                          /* not in the anti collision loop */
+        {
+            continue;                                                                                /* next tag */
+        }
+        level = (tag->state == NTAG21X_EMULATOR_STATE_READY1) ?
+                 EMULATOR_COMMAND_SEL_CL1 : EMULATOR_COMMAND_SEL_CL2;                                /* cascade level */
+        if (in_buf[0] != level)                                                                      /* unexpected frame */
+        {
+            tag->state = (tag->from_halt != 0) ? NTAG21X_EMULATOR_STATE_HALT :
+                                                 NTAG21X_EMULATOR_STATE_IDLE;                        /* back to idle */
+            continue;                                                                                /* next tag */
+        }
+        if (level == EMULATOR_COMMAND_SEL_CL1)                                                       /* cascade level 1 */
+        {
+            cl[0] = 0x88;                                                                            /* cascade tag */
+            memcpy(&cl[1], tag->uid, 3);                                                             /* uid0 - uid2 */
+        }
+        else
+        {
+            memcpy(cl, &tag->uid[3], 4);                                                             /* uid3 - uid6 */
+        }
+        cl[4] = (uint8_t)(cl[0] ^ cl[1] ^ cl[2] ^ cl[3]);                                            /* bcc */
+        for (b = 0; b < known; b++)                                                                  /* check the known bits */
+        {
+            if (((in_buf[2 + b / 8] ^ cl[b / 8]) & (1 << (b % 8))) != 0)                             /* different bit */
+            {
+                break;                                                                               /* not this tag */
+            }
+        }
+        if (b != known)                                                                              /* not this tag */
+        {
+            continue;                                                                                /* stay silent */
+        }
+        if (answers == 0)                                                                            /* first answer */
+        {
+            memcpy(first, cl, 5);                                                                    /* save the uid */
+        }
+        else
+        {
+            for (b = known; b < agree; b++)                                                          /* find the first collision */
+            {
+                if (((first[b / 8] ^ cl[b / 8]) & (1 << (b % 8))) != 0)                              /* different bit */
+                {
+                    agree = b;                                                                       /* collision position */
+                    
+                    break;                                                                           /* break */
+                }
+            }
+        }
+        answers++;                                                                                   /* one more answer */
+    }
+    if (answers == 0)                                                                                /* no tag answered */
+    {
+        a_emulator_spend(cycles, gs_emulator.reader_latency_ns + gs_emulator.timeout_ns);
+
+        return 1;                                                                                    /* no response */
+    }
+
+    memset(out_buf, 0, 5);                                                                           /* clear the buffer */
+    for (b = known; b < agree; b++)                                                                  /* copy the agreeing bits */
+    {
+        if ((first[b / 8] & (1 << (b % 8))) != 0)                                                    /* bit is set */
+        {
+            pos = (uint8_t)(b - known + known % 8);                                                  /* rx aligned position */
+            out_buf[pos / 8] |= (uint8_t)(1 << (pos % 8));                                           /* set the bit */
+        }
+    }
+    *out_bits = (uint8_t)(agree - known);                                                            /* set the bits */
+    *collision = (uint8_t)(agree < 40);                                                              /* set the collision */
+    cycles += 9 * 128 + 84;                                                                          /* frame delay time */
+    cycles += (1 + 40 - (uint64_t)known + (40 - known) / 8) * NTAG21X_EMULATOR_BIT_CYCLES;           /* picc frame */
+    a_emulator_spend(cycles, gs_emulator.reader_latency_ns);                                         /* spend the time */
+    if (*collision != 0)                                                                             /* the reader sees a collision */
+    {
+        gs_emulator.statistics.collisions++;                                                         /* one more collision */
+    }
+    else
+    {
+        gs_emulator.statistics.responses++;                                                          /* one more response */
+    }
+
+    return 0;                                                                                        /* success return 0 */
+}
+
+/**
+ * @brief     emulator delay ms
+ * @param[in] ms time
+ * @note      only advances the emulated time unless a delay function is linked
+ */
+void ntag21x_emulator_delay_ms(uint32_t ms)
+{
+    uint32_t i;
+
+    for (i = 0; i < ms; i++)                     /* split into 1 ms */
+    {
+        a_emulator_spend(0, 1000000);            /* 1 ms */
+    }
+}
+
+/**
+ * @brief     emulator set the number of busy polls
+ * @param[in] count busy polls before a submitted frame completes
+ * @return    status code
+ *            - 0 success
+ * @note      none
+ */
+uint8_t ntag21x_emulator_set_poll_count(uint32_t count)
+{
+    gs_emulator.poll_count = count;        /* set the count */
+
+    return 0;                              /* success return 0 */
+}
+
+/**
+ * @brief     emulator submit a frame
+ * @param[in] *in_buf pointer to a input buffer
+ * @param[in] in_len input length
+ * @param[in] out_len expected output length
+ * @return    status code
+ *            - 0 success
+ *            - 1 a frame is pending
+ * @note      link with DRIVER_NTAG21X_ASYNC_LINK_SUBMIT, the response is held back for the busy polls
+ */
+uint8_t ntag21x_emulator_submit(uint8_t *in_buf, uint8_t in_len, uint8_t out_len)
+{
+    if (gs_emulator.async_pending != 0)                                                /* check the pending frame */
+    {
+        return 1;                                                                      /* return error */
+    }
+
+    gs_emulator.async_len = out_len;                                                   /* set the expected length */
+    gs_emulator.async_res = ntag21x_emulator_contactless_transceiver(in_buf, in_len,
+                                                                     gs_emulator.async_buf,
+                                                                     &gs_emulator.async_len);
+    gs_emulator.polls = gs_emulator.poll_count;                                        /* busy polls */
+    gs_emulator.async_pending = 1;                                                     /* pending */
+
+    return 0;                                                                          /* success return 0 */
+}
+
+/**
+ * @brief         emulator poll the submitted frame
+ * @param[out]    *out_buf pointer to a output buffer
+ * @param[in,out] *out_len pointer to a output length buffer
+ * @return        status code
+ *                - 0 response received
+ *                - 1 no response or nothing submitted
+ *                - 2 busy
+ * @note          link with DRIVER_NTAG21X_ASYNC_LINK_POLL
+ */
+uint8_t ntag21x_emulator_poll(uint8_t *out_buf, uint8_t *out_len)
+{
+    if (gs_emulator.async_pending == 0)                                 /* nothing submitted */
+    {
+        return 1;                                                       /* return error */
+    }
+    if (gs_emulator.polls != 0)                                         /* still busy */
+    {
+        gs_emulator.polls--;                                            /* one poll less */
+
+        return 2;                                                       /* busy */
+    }
+
+    gs_emulator.async_pending = 0;                                      /* done */
+    if (gs_emulator.async_res != 0)                                     /* check the result */
+    {
+        return 1;                                                       /* no response */
+    }
+    if (gs_emulator.async_len > *out_len)                               /* check the buffer */
+    {
+        return 1;                                                       /* return error */
+    }
+    memcpy(out_buf, gs_emulator.async_buf, gs_emulator.async_len);      /* copy the response */
+    *out_len = gs_emulator.async_len;                                   /* set the length */
+
+    return 0;                                                           /* success return 0 */
+}
@@ -0,0 +1,336 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file      driver_ntag21x_emulator.h
+ * @brief     driver ntag21x emulator header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_NTAG21X_EMULATOR_H
+#define DRIVER_NTAG21X_EMULATOR_H
+
+#include "driver_ntag21x.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup ntag21x_emulator_driver ntag21x emulator driver function
+ * @brief    ntag21x emulator driver modules
+ * @ingroup  ntag21x_driver
+ * @{
+ */
+
+/**
+ * @brief ntag21x emulator timing definition
+ */
+#define NTAG21X_EMULATOR_CARRIER_HZ              13560000U        /**< carrier frequency fc */
+#define NTAG21X_EMULATOR_BIT_CYCLES              128U             /**< one bit at 106 kbit/s in fc */
+#define NTAG21X_EMULATOR_EEPROM_WRITE_CYCLES     55596U           /**< 4.1 ms eeprom programming time in fc */
+
+/**
+ * @brief ntag21x emulator max tags definition
+ */
+#ifndef NTAG21X_EMULATOR_MAX_TAGS
+    #define NTAG21X_EMULATOR_MAX_TAGS 24
+#endif
+
+/**
+ * @brief ntag21x emulator type enumeration definition
+ */
+typedef enum
+{
+    NTAG21X_EMULATOR_TYPE_NTAG213 = 0x00,        /**< ntag213, 45 pages */
+    NTAG21X_EMULATOR_TYPE_NTAG215 = 0x01,        /**< ntag215, 135 pages */
+    NTAG21X_EMULATOR_TYPE_NTAG216 = 0x02,        /**< ntag216, 231 pages */
+} ntag21x_emulator_type_t;
+
+/**
+ * @brief ntag21x emulator state enumeration definition
+ */
+typedef enum
+{
+    NTAG21X_EMULATOR_STATE_IDLE          = 0x00,        /**< idle */
+    NTAG21X_EMULATOR_STATE_READY1        = 0x01,        /**< ready 1 */
+    NTAG21X_EMULATOR_STATE_READY2        = 0x02,        /**< ready 2 */
+    NTAG21X_EMULATOR_STATE_ACTIVE        = 0x03,        /**< active */
+    NTAG21X_EMULATOR_STATE_AUTHENTICATED = 0x04,        /**< authenticated */
+    NTAG21X_EMULATOR_STATE_HALT          = 0x05,        /**< halt */
+} ntag21x_emulator_state_t;
+
+/**
+ * @brief ntag21x emulator statistics structure definition
+ */
+typedef struct ntag21x_emulator_statistics_s
+{
+    uint32_t frames;               /**< frames received from the reader */
+    uint32_t responses;            /**< frames answered by the tag */
+    uint32_t naks;                 /**< nak responses */
+    uint32_t eeprom_writes;        /**< eeprom page programming cycles */
+    uint32_t collisions;           /**< frames answered differently by several tags */
+    uint64_t cycles;               /**< air time and tag processing time in fc */
+    uint64_t elapsed_ns;           /**< total emulated time including reader latency */
+} ntag21x_emulator_statistics_t;
+
+/**
+ * @brief     emulator init
+ * @param[in] type tag type
+ * @param[in] *uid pointer to a 7 bytes uid buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ *            - 2 type is invalid
+ * @note      the memory is loaded with the factory defaults of the chosen type
+ */
+uint8_t ntag21x_emulator_init(ntag21x_emulator_type_t type, uint8_t uid[7]);
+
+/**
+ * @brief      emulator add another tag to the field
+ * @param[in]  type tag type
+ * @param[in]  *uid pointer to a 7 bytes uid buffer
+ * @param[out] *index pointer to a tag index buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 the field is full
+ *             - 2 type is invalid
+ * @note       call after ntag21x_emulator_init, the selected tag does not change
+ */
+uint8_t ntag21x_emulator_add_tag(ntag21x_emulator_type_t type, uint8_t uid[7], uint8_t *index);
+
+/**
+ * @brief     emulator select the tag of the memory, state and presence functions
+ * @param[in] index tag index
+ * @return    status code
+ *            - 0 success
+ *            - 1 index is invalid
+ * @note      none
+ */
+uint8_t ntag21x_emulator_select_tag(uint8_t index);
+
+/**
+ * @brief     emulator set the timing
+ * @param[in] reader_latency_ns reader overhead added to every frame
+ * @param[in] timeout_ns reader timeout spent when the tag does not answer
+ * @return    status code
+ *            - 0 success
+ * @note      none
+ */
+uint8_t ntag21x_emulator_set_timing(uint32_t reader_latency_ns, uint32_t timeout_ns);
+
+/**
+ * @brief     emulator link a real time delay function
+ * @param[in] *delay_ns pointer to a delay_ns function address, NULL disables real time mode
+ * @return    status code
+ *            - 0 success
+ * @note      when linked, every frame really spends its emulated time
+ */
+uint8_t ntag21x_emulator_set_delay(void (*delay_ns)(uint32_t ns));
+
+/**
+ * @brief     emulator put the tag into or out of the field
+ * @param[in] enable bool value
+ * @return    status code
+ *            - 0 success
+ * @note      taking the tag out of the field powers it down
+ */
+uint8_t ntag21x_emulator_set_present(ntag21x_bool_t enable);
+
+/**
+ * @brief  emulator power cycle the tag
+ * @return status code
+ *         - 0 success
+ * @note   none
+ */
+uint8_t ntag21x_emulator_field_reset(void);
+
+/**
+ * @brief      emulator get the tag state
+ * @param[out] *state pointer to a state buffer
+ * @return     status code
+ *             - 0 success
+ * @note       none
+ */
+uint8_t ntag21x_emulator_get_state(ntag21x_emulator_state_t *state);
+
+/**
+ * @brief      emulator read the memory without rf access
+ * @param[in]  page memory page
+ * @param[out] *data pointer to a data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 page is invalid
+ * @note       none
+ */
+uint8_t ntag21x_emulator_read_memory(uint8_t page, uint8_t data[4]);
+
+/**
+ * @brief     emulator write the memory without rf access
+ * @param[in] page memory page
+ * @param[in] *data pointer to a data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 page is invalid
+ * @note      lock bits and access conditions are not checked
+ */
+uint8_t ntag21x_emulator_write_memory(uint8_t page, uint8_t data[4]);
+
+/**
+ * @brief     emulator set the originality signature
+ * @param[in] *signature pointer to a signature buffer
+ * @return    status code
+ *            - 0 success
+ * @note      none
+ */
+uint8_t ntag21x_emulator_set_signature(uint8_t signature[32]);
+
+/**
+ * @brief     emulator set the nfc counter
+ * @param[in] cnt counter value
+ * @return    status code
+ *            - 0 success
+ * @note      none
+ */
+uint8_t ntag21x_emulator_set_counter(uint32_t cnt);
+
+/**
+ * @brief      emulator get the statistics
+ * @param[out] *statistics pointer to a statistics structure
+ * @return     status code
+ *             - 0 success
+ * @note       none
+ */
+uint8_t ntag21x_emulator_get_statistics(ntag21x_emulator_statistics_t *statistics);
+
+/**
+ * @brief  emulator clear the statistics
+ * @return status code
+ *         - 0 success
+ * @note   none
+ */
+uint8_t ntag21x_emulator_clear_statistics(void);
+
+/**
+ * @brief  emulator contactless init
+ * @return status code
+ *         - 0 success
+ * @note   link with DRIVER_NTAG21X_LINK_CONTACTLESS_INIT
+ */
+uint8_t ntag21x_emulator_contactless_init(void);
+
+/**
+ * @brief  emulator contactless deinit
+ * @return status code
+ *         - 0 success
+ * @note   link with DRIVER_NTAG21X_LINK_CONTACTLESS_DEINIT
+ */
+uint8_t ntag21x_emulator_contactless_deinit(void);
+
+/**
+ * @brief         emulator contactless transceiver
+ * @param[in]     *in_buf pointer to a input buffer
+ * @param[in]     in_len input length
+ * @param[out]    *out_buf pointer to a output buffer
+ * @param[in,out] *out_len pointer to a output length buffer
+ * @return        status code
+ *                - 0 success
+ *                - 1 no response or the output buffer is too small
+ * @note          link with DRIVER_NTAG21X_LINK_CONTACTLESS_TRANSCEIVER
+ */
+uint8_t ntag21x_emulator_contactless_transceiver(uint8_t *in_buf, uint8_t in_len, uint8_t *out_buf, uint8_t *out_len);
+
+/**
+ * @brief      emulator contactless bit oriented transceiver
+ * @param[in]  *in_buf pointer to a input buffer
+ * @param[in]  in_bits input length in bits
+ * @param[out] *out_buf pointer to a 5 bytes output buffer
+ * @param[out] *out_bits pointer to a received bits buffer
+ * @param[out] *collision pointer to a collision flag buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 no response or the frame is invalid
+ * @note       link with DRIVER_NTAG21X_LINK_CONTACTLESS_TRANSCEIVER_BITS,
+ *             only anti collision frames with a partial uid are answered,
+ *             the first received bit is stored at bit in_bits % 8 of out_buf[0]
+ *             and the bits stop before the first collision
+ */
+uint8_t ntag21x_emulator_contactless_transceiver_bits(uint8_t *in_buf, uint8_t in_bits, uint8_t *out_buf,
+                                                      uint8_t *out_bits, uint8_t *collision);
+
+/**
+ * @brief     emulator delay ms
+ * @param[in] ms time
+ * @note      only advances the emulated time unless a delay function is linked
+ */
+void ntag21x_emulator_delay_ms(uint32_t ms);
+
+/**
+ * @brief     emulator set the number of busy polls
+ * @param[in] count busy polls before a submitted frame completes
+ * @return    status code
+ *            - 0 success
+ * @note      none
+ */
+uint8_t ntag21x_emulator_set_poll_count(uint32_t count);
+
+/**
+ * @brief     emulator submit a frame
+ * @param[in] *in_buf pointer to a input buffer
+ * @param[in] in_len input length
+ * @param[in] out_len expected output length
+ * @return    status code
+ *            - 0 success
+ *            - 1 a frame is pending
+ * @note      link with DRIVER_NTAG21X_ASYNC_LINK_SUBMIT
+ */
+uint8_t ntag21x_emulator_submit(uint8_t *in_buf, uint8_t in_len, uint8_t out_len);
+
+/**
+ * @brief         emulator poll the submitted frame
+ * @param[out]    *out_buf pointer to a output buffer
+ * @param[in,out] *out_len pointer to a output length buffer
+ * @return        status code
+ *                - 0 response received
+ *                - 1 no response or nothing submitted
+ *                - 2 busy
+ * @note          link with DRIVER_NTAG21X_ASYNC_LINK_POLL
+ */
+uint8_t ntag21x_emulator_poll(uint8_t *out_buf, uint8_t *out_len);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif